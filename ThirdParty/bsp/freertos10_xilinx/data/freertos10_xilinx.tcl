@@ -407,7 +407,12 @@ proc generate {os_handle} {
 	file copy -force [file join src Source list.c] ./src
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
-	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	set heap_implementation [common::get_property CONFIG.heap_implementation $os_handle]
+	if {$heap_implementation == 6} {
+		file copy -force [file join src Source portable MemMang heap_6.c] ./src
+	} else {
+		file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	}
         set stream_buffer_enabled [common::get_property CONFIG.stream_buffer $os_handle]
         set message_buffer_enabled [common::get_property CONFIG.message_buffer $os_handle]
         if {$stream_buffer_enabled == "true" || $message_buffer_enabled == "true"} {
@@ -746,6 +751,12 @@ proc generate {os_handle} {
 	set total_heap_size [common::get_property CONFIG.total_heap_size $os_handle]
 	xput_define $config_file "configTOTAL_HEAP_SIZE"  "( ( size_t ) ( $total_heap_size ) )"
 
+	set val [common::get_property CONFIG.heap_implementation $os_handle]
+	if {$val == 6} {
+		set heap_slab_page_size [common::get_property CONFIG.heap_slab_page_size $os_handle]
+		xput_define $config_file "configHEAP_SLAB_PAGE_SIZE"  "( ( size_t ) ( $heap_slab_page_size ) )"
+	}
+
 	set max_task_name_len [common::get_property CONFIG.max_task_name_len $os_handle]
 	xput_define $config_file "configMAX_TASK_NAME_LEN"  $max_task_name_len
 
@@ -0,0 +1,206 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (C) 2026 Xilinx, Inc. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * This example loads the FreeRTOS heap with a mix of packet buffer and queue
+ * sized allocations, freed in random order, and reports the pvPortMalloc()
+ * latency and the heap statistics after each round.  Build it once with
+ * heap_implementation set to heap_4 and once with heap_6 to compare them.
+ * With heap_6 the statistics of every size class are printed as well.
+ */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+/* Xilinx includes. */
+#include "xil_printf.h"
+#include "xparameters.h"
+#if !defined (__MICROBLAZE__)
+#include "xtime_l.h"
+#endif
+
+/* Allocations alive at the same time, at most */
+#define HEAP_TEST_SLOTS			96
+/* Allocate or free operations per round */
+#define HEAP_TEST_OPS_PER_ROUND	20000
+#define HEAP_TEST_ROUNDS		4
+/*-----------------------------------------------------------*/
+
+static void prvHeapTask( void *pvParameters );
+static size_t prvPickSize( void );
+static void prvPrintStats( UBaseType_t uxRound );
+/*-----------------------------------------------------------*/
+
+static void *pvSlots[ HEAP_TEST_SLOTS ];
+static uint32_t ulSeed = 1;
+static uint32_t ulFailures;
+#if !defined (__MICROBLAZE__)
+static uint64_t xSum;
+static XTime xWorst;
+static uint32_t ulCount;
+#endif
+
+int main( void )
+{
+	xil_printf( "\r\nHello from Freertos heap example main\r\n" );
+
+	xTaskCreate( prvHeapTask,
+				 ( const char * ) "Heap",
+				 configMINIMAL_STACK_SIZE * 2,
+				 NULL,
+				 tskIDLE_PRIORITY + 1,
+				 NULL );
+
+	/* Start the task running. */
+	vTaskStartScheduler();
+
+	/* If all is well, the scheduler will now be running, and the following line
+	will never be reached.  If the following line does execute, then there was
+	insufficient FreeRTOS heap memory available for the idle and/or timer tasks
+	to be created.  See the memory management section on the FreeRTOS web site
+	for more details. */
+	for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+	ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+	return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPickSize( void )
+{
+	uint32_t ulClass = prvRandom() % 100;
+
+	/* Mostly small control blocks, some pbuf sized and a few large ones. */
+	if( ulClass < 70 ) {
+		return 16 + ( prvRandom() % 180 );
+	} else if( ulClass < 95 ) {
+		return 200 + ( prvRandom() % 312 );
+	}
+
+	return 600 + ( prvRandom() % 1500 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapTask( void *pvParameters )
+{
+	UBaseType_t uxRound;
+	uint32_t ulOp;
+	uint32_t ulSlot;
+	size_t xSize;
+#if !defined (__MICROBLAZE__)
+	XTime xStart;
+	XTime xEnd;
+#endif
+
+	( void ) pvParameters;
+
+	for( uxRound = 0; uxRound < HEAP_TEST_ROUNDS; uxRound++ ) {
+		for( ulOp = 0; ulOp < HEAP_TEST_OPS_PER_ROUND; ulOp++ ) {
+			ulSlot = prvRandom() % HEAP_TEST_SLOTS;
+
+			if( pvSlots[ ulSlot ] != NULL ) {
+				vPortFree( pvSlots[ ulSlot ] );
+				pvSlots[ ulSlot ] = NULL;
+				continue;
+			}
+
+			xSize = prvPickSize();
+#if !defined (__MICROBLAZE__)
+			XTime_GetTime( &xStart );
+#endif
+			pvSlots[ ulSlot ] = pvPortMalloc( xSize );
+#if !defined (__MICROBLAZE__)
+			XTime_GetTime( &xEnd );
+			xSum += xEnd - xStart;
+			ulCount++;
+			if( ( xEnd - xStart ) > xWorst ) {
+				xWorst = xEnd - xStart;
+			}
+#endif
+			if( pvSlots[ ulSlot ] == NULL ) {
+				ulFailures++;
+			}
+		}
+
+		prvPrintStats( uxRound );
+	}
+
+	for( ulSlot = 0; ulSlot < HEAP_TEST_SLOTS; ulSlot++ ) {
+		vPortFree( pvSlots[ ulSlot ] );
+		pvSlots[ ulSlot ] = NULL;
+	}
+
+	if( ulFailures == 0 ) {
+		xil_printf( "FreeRTOS Heap Example PASSED\r\n" );
+	} else {
+		xil_printf( "FreeRTOS Heap Example FAILED, %d allocations failed\r\n",
+					ulFailures );
+	}
+
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintStats( UBaseType_t uxRound )
+{
+	HeapStats_t xStats;
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	HeapClassStats_t xClassStats;
+	UBaseType_t uxClass;
+#endif
+
+	vPortGetHeapStats( &xStats );
+
+	xil_printf( "\r\nRound %d\r\n", uxRound );
+#if !defined (__MICROBLAZE__)
+	xil_printf( "malloc latency avg %d worst %d ns\r\n",
+				( uint32_t ) ( ( xSum * 1000000000ULL ) / COUNTS_PER_SECOND / ulCount ),
+				( uint32_t ) ( ( xWorst * 1000000000ULL ) / COUNTS_PER_SECOND ) );
+#endif
+	xil_printf( "available %d largest free %d free blocks %d min ever %d\r\n",
+				xStats.xAvailableHeapSpaceInBytes,
+				xStats.xSizeOfLargestFreeBlockInBytes,
+				xStats.xNumberOfFreeBlocks,
+				xStats.xMinimumEverFreeBytesRemaining );
+
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	xil_printf( "class  objects  free  high water  failures\r\n" );
+	for( uxClass = 0; xPortGetHeapClassStats( uxClass, &xClassStats ) == pdPASS; uxClass++ ) {
+		xil_printf( "%5d  %7d  %4d  %10d  %8d\r\n",
+					xClassStats.xObjectSize,
+					xClassStats.xObjectsTotal,
+					xClassStats.xObjectsFree,
+					xClassStats.xHighWaterMark,
+					xClassStats.xAllocationFailures );
+	}
+#endif
+}
@@ -0,0 +1,269 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2026 Xilinx, Inc. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Host benchmark of the FreeRTOS heaps, with heap_4.c or heap_6.c compiled
+ * into this tool against the kernel headers of the BSP.  The scheduler
+ * suspension of the heaps is a no-op on the host.
+ *
+ * The heap is loaded as by examples/freertos_heap_stats.c: a mix of control
+ * block, packet buffer and large sized allocations, freed in random order.
+ * The pvPortMalloc() latency, the allocation failures and the heap
+ * statistics are printed after each round.  With heap_6 the statistics of
+ * every size class are printed as well.  At the end every block is freed,
+ * the allocations and frees must match, and with heap_6 every class object
+ * must be free again.
+ *
+ * Usage: heap_bench [-n <operations per round>] [-r <rounds>]
+ *	-n	Allocate or free operations per round, 400000 by default
+ *	-r	Rounds, 4 by default
+ *
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   kc   10/18/26 First release
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Allocations alive at the same time, at most */
+#define HEAP_BENCH_SLOTS		96
+/*-----------------------------------------------------------*/
+
+static void *pvSlots[ HEAP_BENCH_SLOTS ];
+static uint32_t ulSeed = 1;
+static unsigned long ulFailures;
+/*-----------------------------------------------------------*/
+
+/* The heaps suspend the scheduler around their lists, there is none here. */
+void vTaskSuspendAll( void )
+{
+}
+
+BaseType_t xTaskResumeAll( void )
+{
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNowNs( void )
+{
+	struct timespec xTs;
+
+	clock_gettime( CLOCK_MONOTONIC, &xTs );
+	return ( ( uint64_t ) xTs.tv_sec * 1000000000ULL ) + ( uint64_t ) xTs.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+	ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+	return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPickSize( void )
+{
+	uint32_t ulClass = prvRandom() % 100;
+
+	/* Mostly small control blocks, some pbuf sized and a few large ones. */
+	if( ulClass < 70 ) {
+		return 16 + ( prvRandom() % 180 );
+	} else if( ulClass < 95 ) {
+		return 200 + ( prvRandom() % 312 );
+	}
+
+	return 600 + ( prvRandom() % 1500 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRound( unsigned long ulOps, uint64_t *pxSum, uint64_t *pxWorst,
+					  unsigned long *pulCount )
+{
+	unsigned long ulOp;
+	uint32_t ulSlot;
+	size_t xSize;
+	uint64_t xStart;
+	uint64_t xNs;
+
+	for( ulOp = 0; ulOp < ulOps; ulOp++ ) {
+		ulSlot = prvRandom() % HEAP_BENCH_SLOTS;
+
+		if( pvSlots[ ulSlot ] != NULL ) {
+			vPortFree( pvSlots[ ulSlot ] );
+			pvSlots[ ulSlot ] = NULL;
+			continue;
+		}
+
+		xSize = prvPickSize();
+		xStart = prvNowNs();
+		pvSlots[ ulSlot ] = pvPortMalloc( xSize );
+		xNs = prvNowNs() - xStart;
+		*pxSum += xNs;
+		( *pulCount )++;
+		if( xNs > *pxWorst ) {
+			*pxWorst = xNs;
+		}
+
+		if( pvSlots[ ulSlot ] == NULL ) {
+			ulFailures++;
+		} else {
+			/* Touch the block as its user would */
+			memset( pvSlots[ ulSlot ], ( int ) ulSlot, xSize );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintStats( unsigned long ulRound, uint64_t xSum,
+						   uint64_t xWorst, unsigned long ulCount )
+{
+	HeapStats_t xStats;
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	HeapClassStats_t xClassStats;
+	UBaseType_t uxClass;
+#endif
+
+	vPortGetHeapStats( &xStats );
+
+	printf( "round %lu: malloc latency avg %.1f worst %llu ns, %lu failures\n",
+			ulRound, ( double ) xSum / ( double ) ulCount,
+			( unsigned long long ) xWorst, ulFailures );
+	printf( "available %zu largest free %zu free blocks %zu min ever %zu\n",
+			xStats.xAvailableHeapSpaceInBytes,
+			xStats.xSizeOfLargestFreeBlockInBytes,
+			xStats.xNumberOfFreeBlocks,
+			xStats.xMinimumEverFreeBytesRemaining );
+
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	printf( "class  objects  free  high water  failures\n" );
+	for( uxClass = 0; xPortGetHeapClassStats( uxClass, &xClassStats ) == pdPASS; uxClass++ ) {
+		printf( "%5zu  %7zu  %4zu  %10zu  %8zu\n",
+				xClassStats.xObjectSize,
+				xClassStats.xObjectsTotal,
+				xClassStats.xObjectsFree,
+				xClassStats.xHighWaterMark,
+				xClassStats.xAllocationFailures );
+	}
+#endif
+}
+/*-----------------------------------------------------------*/
+
+static int prvCheckFreed( void )
+{
+	HeapStats_t xStats;
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	HeapClassStats_t xClassStats;
+	UBaseType_t uxClass;
+#endif
+	uint32_t ulSlot;
+
+	for( ulSlot = 0; ulSlot < HEAP_BENCH_SLOTS; ulSlot++ ) {
+		vPortFree( pvSlots[ ulSlot ] );
+		pvSlots[ ulSlot ] = NULL;
+	}
+
+	vPortGetHeapStats( &xStats );
+	if( xStats.xNumberOfSuccessfulAllocations != xStats.xNumberOfSuccessfulFrees ) {
+		printf( "%zu allocations, %zu frees\n",
+				xStats.xNumberOfSuccessfulAllocations,
+				xStats.xNumberOfSuccessfulFrees );
+		return -1;
+	}
+
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	for( uxClass = 0; xPortGetHeapClassStats( uxClass, &xClassStats ) == pdPASS; uxClass++ ) {
+		if( xClassStats.xObjectsFree != xClassStats.xObjectsTotal ) {
+			printf( "class %zu: %zu of %zu objects free\n",
+					xClassStats.xObjectSize, xClassStats.xObjectsFree,
+					xClassStats.xObjectsTotal );
+			return -1;
+		}
+	}
+#endif
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char **argv )
+{
+	unsigned long ulOps = 400000;
+	unsigned long ulRounds = 4;
+	unsigned long ulRound;
+	unsigned long ulCount;
+	uint64_t xSum;
+	uint64_t xWorst;
+	int iOpt;
+
+	while( ( iOpt = getopt( argc, argv, "n:r:" ) ) != -1 ) {
+		switch( iOpt ) {
+		case 'n':
+			ulOps = strtoul( optarg, NULL, 0 );
+			break;
+		case 'r':
+			ulRounds = strtoul( optarg, NULL, 0 );
+			break;
+		default:
+			fprintf( stderr, "Usage: %s [-n <operations per round>] "
+					 "[-r <rounds>]\n", argv[ 0 ] );
+			return 1;
+		}
+	}
+
+#ifdef configHEAP_SLAB_PAGE_SIZE
+	printf( "heap_6, %d byte heap, %d byte class pages\n",
+			configTOTAL_HEAP_SIZE, configHEAP_SLAB_PAGE_SIZE );
+#else
+	printf( "heap_4, %d byte heap\n", configTOTAL_HEAP_SIZE );
+#endif
+
+	for( ulRound = 0; ulRound < ulRounds; ulRound++ ) {
+		xSum = 0;
+		xWorst = 0;
+		ulCount = 0;
+		prvRound( ulOps, &xSum, &xWorst, &ulCount );
+		prvPrintStats( ulRound, xSum, xWorst, ulCount );
+	}
+
+	if( ( ulFailures != 0 ) || ( prvCheckFreed() != 0 ) ) {
+		printf( "FAILED\n" );
+		return 1;
+	}
+	printf( "PASSED\n" );
+
+	return 0;
+}
@@ -0,0 +1,23 @@
+/* Host build, the heap settings of the BSP defaults */
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION			1
+#define configUSE_IDLE_HOOK			0
+#define configUSE_TICK_HOOK			0
+#define configTICK_RATE_HZ			100
+#define configMAX_PRIORITIES			8
+#define configMINIMAL_STACK_SIZE		200
+#define configMAX_TASK_NAME_LEN			10
+#define configUSE_16_BIT_TICKS			0
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#define configSUPPORT_STATIC_ALLOCATION		0
+#define configAPPLICATION_ALLOCATED_HEAP	0
+#define configUSE_MALLOC_FAILED_HOOK		0
+#define configTOTAL_HEAP_SIZE			65536
+
+#define configASSERT( x )			assert( x )
+
+#endif
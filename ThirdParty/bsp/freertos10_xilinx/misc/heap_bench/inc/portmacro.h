@@ -0,0 +1,37 @@
+/* Host build, the types of the 64 bit Cortex-A53 port */
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE		size_t
+#define portBASE_TYPE		long
+
+typedef portSTACK_TYPE StackType_t;
+typedef portBASE_TYPE BaseType_t;
+typedef uint64_t UBaseType_t;
+typedef uint64_t TickType_t;
+
+#define portMAX_DELAY		( ( TickType_t ) 0xffffffffffffffff )
+#define portTICK_TYPE_IS_ATOMIC	1
+#define portSTACK_GROWTH	( -1 )
+#define portBYTE_ALIGNMENT	16
+#define portPOINTER_SIZE_TYPE	uint64_t
+#define portNOP()
+
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portYIELD()
+#define portYIELD_WITHIN_API()
+
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) \
+	void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) \
+	void vFunction( void *pvParameters )
+
+#endif
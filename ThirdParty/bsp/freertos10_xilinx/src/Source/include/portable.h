@@ -150,6 +150,17 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Used to pass information about one size class of heap_6.c out of
+ * xPortGetHeapClassStats(). */
+typedef struct xHeapClassStats
+{
+    size_t xObjectSize;         /* The largest request, in bytes, served by the size class. */
+    size_t xObjectsTotal;       /* The number of objects the size class has taken from the heap. */
+    size_t xObjectsFree;        /* The number of objects of the size class that are currently free. */
+    size_t xHighWaterMark;      /* The maximum number of objects of the size class that have been allocated at the same time. */
+    size_t xAllocationFailures; /* The number of times the size class could not get more memory from the heap. */
+} HeapClassStats_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -169,6 +180,13 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/*
+ * Returns the statistics of size class uxClass of heap_6.c.  Size classes are
+ * numbered from 0, pdFAIL is returned past the last one.
+ */
+BaseType_t xPortGetHeapClassStats( UBaseType_t uxClass,
+                                   HeapClassStats_t * pxClassStats );
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -0,0 +1,739 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (C) 2026 Xilinx, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that serves small
+ * requests from segregated size classes and larger requests from a coalescing
+ * first fit allocator, as used by heap_4.c.
+ *
+ * Every size class keeps a list of free objects of one size, so allocating
+ * and freeing a small block is a list pop or push, whatever the age of the
+ * heap.  When a class runs out of objects it takes a page of
+ * configHEAP_SLAB_PAGE_SIZE bytes from the coalescing allocator and cuts it
+ * into objects.  Pages stay with their class, so the memory used by a class
+ * is its high water mark.  If no page can be taken the request is served by
+ * the coalescing allocator directly.
+ *
+ * Per class statistics are returned by xPortGetHeapClassStats().  The totals
+ * returned by vPortGetHeapStats() and xPortGetFreeHeapSize() include the free
+ * objects of all classes.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c and heap_4.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* Bytes taken from the coalescing allocator each time a size class runs out
+ * of objects. */
+#ifndef configHEAP_SLAB_PAGE_SIZE
+    #define configHEAP_SLAB_PAGE_SIZE    1024U
+#endif
+
+/* Block sizes must not get too small. */
+#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* Size classes are looked up in steps of heapCLASS_GRANULE bytes. */
+#define heapCLASS_GRANULE         ( ( size_t ) 16 )
+#define heapNUM_SIZE_CLASSES      ( ( UBaseType_t ) 10 )
+#define heapMAX_CLASS_SIZE        ( ( size_t ) 512 )
+
+/* A page holds at least this many objects, even for the largest class. */
+#define heapMIN_OBJECTS_PER_PAGE  ( ( size_t ) 4 )
+
+/* The low bits of the size member of a size class object hold its class. */
+#define heapCLASS_INDEX_MASK      ( ( size_t ) 0xFF )
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Define the linked list structure.  This is used to link free blocks in order
+ * of their memory address, and the free objects of a size class. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the list. */
+    size_t xBlockSize;                     /*<< The size of the free block. */
+} BlockLink_t;
+
+/* State of one size class. */
+typedef struct A_SIZE_CLASS
+{
+    BlockLink_t * pxFreeList;   /*<< Free objects of the class. */
+    size_t xObjectSize;         /*<< Object size, including the BlockLink_t. */
+    size_t xObjectsPerPage;     /*<< Objects cut from each page. */
+    HeapClassStats_t xStats;    /*<< Statistics returned to the application. */
+} SizeClass_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts a block of memory that is being freed into the correct position in
+ * the list of free memory blocks.  The block being freed will be merged with
+ * the block in front it and/or the block behind it if the memory blocks are
+ * adjacent to each other.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
+
+/*
+ * Allocates xWantedSize bytes from the coalescing allocator.  Must be called
+ * with the scheduler suspended.
+ */
+static void * prvLargeAlloc( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes a free object from a size class, adding a page to the class first if
+ * it is empty.  Must be called with the scheduler suspended.
+ */
+static void * prvClassAlloc( UBaseType_t uxClass ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+ * block must by correctly byte aligned. */
+static const size_t xHeapStructSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Bytes available to the application in each size class. */
+static const size_t xClassSizes[ heapNUM_SIZE_CLASSES ] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512 };
+
+/* Create a couple of list links to mark the start and end of the list. */
+PRIVILEGED_DATA static BlockLink_t xStart, * pxEnd = NULL;
+
+/* The size classes, and the class serving each heapCLASS_GRANULE step of
+ * requested size. */
+PRIVILEGED_DATA static SizeClass_t xClasses[ heapNUM_SIZE_CLASSES ];
+PRIVILEGED_DATA static uint8_t ucClassLookup[ ( heapMAX_CLASS_SIZE / heapCLASS_GRANULE ) + 1 ];
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation.
+ * xFreeBytesRemaining counts the coalescing allocator only, xClassFreeBytes the
+ * free objects of the size classes. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xClassFreeBytes = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+ * member of an BlockLink_t structure is set then the block belongs to the
+ * application.  When the bit is free the block is still part of the free heap
+ * space. */
+PRIVILEGED_DATA static size_t xBlockAllocatedBit = 0;
+
+/* Gets set to the bit below xBlockAllocatedBit.  When this bit is set the
+ * block is an object of a size class. */
+PRIVILEGED_DATA static size_t xBlockClassBit = 0;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    void * pvReturn = NULL;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the list of free blocks. */
+        if( pxEnd == NULL )
+        {
+            prvHeapInit();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= heapMAX_CLASS_SIZE ) )
+        {
+            pvReturn = prvClassAlloc( ( UBaseType_t ) ucClassLookup[ ( xWantedSize + ( heapCLASS_GRANULE - 1 ) ) / heapCLASS_GRANULE ] );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Large requests, and small requests whose class could not get a
+         * page, go to the coalescing allocator. */
+        if( pvReturn == NULL )
+        {
+            pvReturn = prvLargeAlloc( xWantedSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pvReturn != NULL )
+        {
+            xNumberOfSuccessfulAllocations++;
+
+            if( ( xFreeBytesRemaining + xClassFreeBytes ) < xMinimumEverFreeBytesRemaining )
+            {
+                xMinimumEverFreeBytesRemaining = xFreeBytesRemaining + xClassFreeBytes;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+        {
+            if( pvReturn == NULL )
+            {
+                extern void vApplicationMallocFailedHook( void );
+                vApplicationMallocFailedHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    SizeClass_t * pxClass;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have an BlockLink_t structure immediately
+         * before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        /* Check the block is actually allocated. */
+        configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+        if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+        {
+            if( pxLink->pxNextFreeBlock == NULL )
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated. */
+                pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+                vTaskSuspendAll();
+                {
+                    if( ( pxLink->xBlockSize & xBlockClassBit ) != 0 )
+                    {
+                        configASSERT( ( pxLink->xBlockSize & heapCLASS_INDEX_MASK ) < heapNUM_SIZE_CLASSES );
+
+                        /* Put the object back on the free list of its class. */
+                        pxClass = &xClasses[ pxLink->xBlockSize & heapCLASS_INDEX_MASK ];
+                        pxLink->pxNextFreeBlock = pxClass->pxFreeList;
+                        pxClass->pxFreeList = pxLink;
+                        pxClass->xStats.xObjectsFree++;
+                        xClassFreeBytes += pxClass->xObjectSize;
+                        traceFREE( pv, pxClass->xObjectSize );
+                    }
+                    else
+                    {
+                        /* Add this block to the list of free blocks. */
+                        xFreeBytesRemaining += pxLink->xBlockSize;
+                        traceFREE( pv, pxLink->xBlockSize );
+                        prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+                    }
+
+                    xNumberOfSuccessfulFrees++;
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining + xClassFreeBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void * prvClassAlloc( UBaseType_t uxClass ) /* PRIVILEGED_FUNCTION */
+{
+    SizeClass_t * pxClass = &xClasses[ uxClass ];
+    BlockLink_t * pxBlock;
+    uint8_t * pucPage;
+    size_t xObject;
+    size_t xInUse;
+
+    if( pxClass->pxFreeList == NULL )
+    {
+        /* Cut a new page into objects.  The page itself is an allocated
+         * block of the coalescing allocator and is never returned to it. */
+        pucPage = prvLargeAlloc( pxClass->xObjectSize * pxClass->xObjectsPerPage );
+
+        if( pucPage == NULL )
+        {
+            pxClass->xStats.xAllocationFailures++;
+            return NULL;
+        }
+
+        for( xObject = pxClass->xObjectsPerPage; xObject > 0; xObject-- )
+        {
+            pxBlock = ( void * ) ( pucPage + ( ( xObject - 1 ) * pxClass->xObjectSize ) );
+            pxBlock->xBlockSize = xBlockClassBit | ( size_t ) uxClass;
+            pxBlock->pxNextFreeBlock = pxClass->pxFreeList;
+            pxClass->pxFreeList = pxBlock;
+        }
+
+        pxClass->xStats.xObjectsTotal += pxClass->xObjectsPerPage;
+        pxClass->xStats.xObjectsFree += pxClass->xObjectsPerPage;
+        xClassFreeBytes += pxClass->xObjectSize * pxClass->xObjectsPerPage;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* The object is being returned - it is allocated and owned by the
+     * application and has no "next" block. */
+    pxBlock = pxClass->pxFreeList;
+    pxClass->pxFreeList = pxBlock->pxNextFreeBlock;
+    pxBlock->xBlockSize |= xBlockAllocatedBit;
+    pxBlock->pxNextFreeBlock = NULL;
+
+    pxClass->xStats.xObjectsFree--;
+    xClassFreeBytes -= pxClass->xObjectSize;
+
+    xInUse = pxClass->xStats.xObjectsTotal - pxClass->xStats.xObjectsFree;
+
+    if( xInUse > pxClass->xStats.xHighWaterMark )
+    {
+        pxClass->xStats.xHighWaterMark = xInUse;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+}
+/*-----------------------------------------------------------*/
+
+static void * prvLargeAlloc( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxBlock, * pxPreviousBlock, * pxNewBlockLink;
+    void * pvReturn = NULL;
+
+    /* Check the requested block size is not so large that the top two bits
+     * are set.  They are used to determine who owns the block - the
+     * application or the kernel - and whether it is a size class object, so
+     * they must be free. */
+    if( ( xWantedSize & ( xBlockAllocatedBit | xBlockClassBit ) ) == 0 )
+    {
+        /* The wanted size must be increased so it can contain a BlockLink_t
+         * structure in addition to the requested amount of bytes. */
+        if( ( xWantedSize > 0 ) &&
+            ( ( xWantedSize + xHeapStructSize ) >  xWantedSize ) ) /* Overflow check */
+        {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned. */
+            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+            {
+                /* Byte alignment required. Check for overflow. */
+                if( ( xWantedSize + ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) ) )
+                        > xWantedSize )
+                {
+                    xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+                    configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+                }
+                else
+                {
+                    xWantedSize = 0;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xWantedSize = 0;
+        }
+
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+        {
+            /* Traverse the list from the start (lowest address) block until
+             * one of adequate size is found. */
+            pxPreviousBlock = &xStart;
+            pxBlock = xStart.pxNextFreeBlock;
+
+            while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+            {
+                pxPreviousBlock = pxBlock;
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            /* If the end marker was reached then a block of adequate size
+             * was not found. */
+            if( pxBlock != pxEnd )
+            {
+                /* Return the memory space pointed to - jumping over the
+                 * BlockLink_t structure at its start. */
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + xHeapStructSize );
+
+                /* This block is being returned for use so must be taken out
+                 * of the list of free blocks. */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+                /* If the block is larger than required it can be split into
+                 * two. */
+                if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+                {
+                    /* This block is to be split into two.  Create a new
+                     * block following the number of bytes requested. The void
+                     * cast is used to prevent byte alignment warnings from the
+                     * compiler. */
+                    pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                    configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                    /* Calculate the sizes of two blocks split from the
+                     * single block. */
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    /* Insert the new block into the list of free blocks. */
+                    prvInsertBlockIntoFreeList( pxNewBlockLink );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                /* The block is being returned - it is allocated and owned
+                 * by the application and has no "next" block. */
+                pxBlock->xBlockSize |= xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxFirstFreeBlock;
+    uint8_t * pucAlignedHeap;
+    size_t uxAddress;
+    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+    size_t xSize;
+    UBaseType_t uxClass;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    uxAddress = ( size_t ) ucHeap;
+
+    if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+        xTotalHeapSize -= uxAddress - ( size_t ) ucHeap;
+    }
+
+    pucAlignedHeap = ( uint8_t * ) uxAddress;
+
+    /* xStart is used to hold a pointer to the first item in the list of free
+     * blocks.  The void cast is used to prevent compiler warnings. */
+    xStart.pxNextFreeBlock = ( void * ) pucAlignedHeap;
+    xStart.xBlockSize = ( size_t ) 0;
+
+    /* pxEnd is used to mark the end of the list of free blocks and is inserted
+     * at the end of the heap space. */
+    uxAddress = ( ( size_t ) pucAlignedHeap ) + xTotalHeapSize;
+    uxAddress -= xHeapStructSize;
+    uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+    pxEnd = ( void * ) uxAddress;
+    pxEnd->xBlockSize = 0;
+    pxEnd->pxNextFreeBlock = NULL;
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space, minus the space taken by pxEnd. */
+    pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+    pxFirstFreeBlock->xBlockSize = uxAddress - ( size_t ) pxFirstFreeBlock;
+    pxFirstFreeBlock->pxNextFreeBlock = pxEnd;
+
+    /* Only one block exists - and it covers the entire usable heap space. */
+    xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+    xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+
+    /* Work out the position of the top two bits in a size_t variable. */
+    xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+    xBlockClassBit = xBlockAllocatedBit >> 1;
+
+    /* Size the objects of each class, and map every heapCLASS_GRANULE step
+     * of requested size to the smallest class it fits in. */
+    xSize = 0;
+
+    for( uxClass = 0; uxClass < heapNUM_SIZE_CLASSES; uxClass++ )
+    {
+        xClasses[ uxClass ].xObjectSize = xClassSizes[ uxClass ] + xHeapStructSize;
+        xClasses[ uxClass ].xObjectsPerPage = configHEAP_SLAB_PAGE_SIZE / xClasses[ uxClass ].xObjectSize;
+
+        if( xClasses[ uxClass ].xObjectsPerPage < heapMIN_OBJECTS_PER_PAGE )
+        {
+            xClasses[ uxClass ].xObjectsPerPage = heapMIN_OBJECTS_PER_PAGE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xClasses[ uxClass ].xStats.xObjectSize = xClassSizes[ uxClass ];
+
+        while( ( xSize * heapCLASS_GRANULE ) <= xClassSizes[ uxClass ] )
+        {
+            ucClassLookup[ xSize ] = ( uint8_t ) uxClass;
+            xSize++;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxIterator;
+    uint8_t * puc;
+
+    /* Iterate through the list until a block is found that has a higher address
+     * than the block being inserted. */
+    for( pxIterator = &xStart; pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+    {
+        /* Nothing to do here, just iterate to the right position. */
+    }
+
+    /* Do the block being inserted, and the block it is being inserted after
+     * make a contiguous block of memory? */
+    puc = ( uint8_t * ) pxIterator;
+
+    if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
+    {
+        pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
+        pxBlockToInsert = pxIterator;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Do the block being inserted, and the block it is being inserted before
+     * make a contiguous block of memory? */
+    puc = ( uint8_t * ) pxBlockToInsert;
+
+    if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
+    {
+        if( pxIterator->pxNextFreeBlock != pxEnd )
+        {
+            /* Form one big block from the two blocks. */
+            pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
+            pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+        }
+        else
+        {
+            pxBlockToInsert->pxNextFreeBlock = pxEnd;
+        }
+    }
+    else
+    {
+        pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+    }
+
+    /* If the block being inserted plugged a gab, so was merged with the block
+     * before and the block after, then it's pxNextFreeBlock pointer will have
+     * already been set, and should not be set here as that would make it point
+     * to itself. */
+    if( pxIterator != pxBlockToInsert )
+    {
+        pxIterator->pxNextFreeBlock = pxBlockToInsert;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+    vTaskSuspendAll();
+    {
+        pxBlock = xStart.pxNextFreeBlock;
+
+        /* pxBlock will be NULL if the heap has not been initialised.  The heap
+         * is initialised automatically when the first allocation is made. */
+        if( pxBlock != NULL )
+        {
+            do
+            {
+                /* Increment the number of blocks and record the largest block seen
+                 * so far. */
+                xBlocks++;
+
+                if( pxBlock->xBlockSize > xMaxSize )
+                {
+                    xMaxSize = pxBlock->xBlockSize;
+                }
+
+                if( pxBlock->xBlockSize < xMinSize )
+                {
+                    xMinSize = pxBlock->xBlockSize;
+                }
+
+                /* Move to the next block in the chain until the last block is
+                 * reached. */
+                pxBlock = pxBlock->pxNextFreeBlock;
+            } while( pxBlock != pxEnd );
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    /* The block counts and sizes describe the coalescing allocator, the free
+     * objects of the size classes are not blocks of it. */
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining + xClassFreeBytes;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortGetHeapClassStats( UBaseType_t uxClass,
+                                   HeapClassStats_t * pxClassStats )
+{
+    if( uxClass >= heapNUM_SIZE_CLASSES )
+    {
+        return pdFAIL;
+    }
+
+    taskENTER_CRITICAL();
+    {
+        *pxClassStats = xClasses[ uxClass ].xStats;
+
+        /* Before the first allocation the sizes are not set up yet. */
+        pxClassStats->xObjectSize = xClassSizes[ uxClass ];
+    }
+    taskEXIT_CRITICAL();
+
+    return pdPASS;
+}
@@ -802,14 +802,29 @@ proc generate_lwip_opts {libhandle} {
 			puts $lwipopts_fd "\#define CHECKSUM_CHECK_UDP  1"
 			puts $lwipopts_fd "\#define CHECKSUM_CHECK_IP 	1"
 		} else {
-			puts $lwipopts_fd "\#define CHECKSUM_GEN_TCP 	0"
-			puts $lwipopts_fd "\#define CHECKSUM_GEN_UDP 	0"
-			puts $lwipopts_fd "\#define CHECKSUM_GEN_IP  	0"
-			puts $lwipopts_fd "\#define CHECKSUM_CHECK_TCP  0"
-			puts $lwipopts_fd "\#define CHECKSUM_CHECK_UDP  0"
-			puts $lwipopts_fd "\#define CHECKSUM_CHECK_IP 	0"
-			puts $lwipopts_fd "\#define LWIP_FULL_CSUM_OFFLOAD_RX  1"
-			puts $lwipopts_fd "\#define LWIP_FULL_CSUM_OFFLOAD_TX  1"
+			# Gem, the lwIP checksum options follow the offload settings
+			set tx_emac_csum [common::get_property CONFIG.emac_tx_checksum_offload $libhandle]
+			set rx_emac_csum [common::get_property CONFIG.emac_rx_checksum_offload $libhandle]
+			if {$tx_emac_csum == true} {
+				puts $lwipopts_fd "\#define CHECKSUM_GEN_TCP 	0"
+				puts $lwipopts_fd "\#define CHECKSUM_GEN_UDP 	0"
+				puts $lwipopts_fd "\#define CHECKSUM_GEN_IP  	0"
+				puts $lwipopts_fd "\#define LWIP_FULL_CSUM_OFFLOAD_TX  1"
+			} else {
+				puts $lwipopts_fd "\#define CHECKSUM_GEN_TCP 	1"
+				puts $lwipopts_fd "\#define CHECKSUM_GEN_UDP 	1"
+				puts $lwipopts_fd "\#define CHECKSUM_GEN_IP  	1"
+			}
+			if {$rx_emac_csum == true} {
+				puts $lwipopts_fd "\#define CHECKSUM_CHECK_TCP  0"
+				puts $lwipopts_fd "\#define CHECKSUM_CHECK_UDP  0"
+				puts $lwipopts_fd "\#define CHECKSUM_CHECK_IP 	0"
+				puts $lwipopts_fd "\#define LWIP_FULL_CSUM_OFFLOAD_RX  1"
+			} else {
+				puts $lwipopts_fd "\#define CHECKSUM_CHECK_TCP  1"
+				puts $lwipopts_fd "\#define CHECKSUM_CHECK_UDP  1"
+				puts $lwipopts_fd "\#define CHECKSUM_CHECK_IP 	1"
+			}
 		}
 	}
 
@@ -1522,6 +1537,17 @@ proc generate_adapterconfig_include {libhandle} {
 		puts $fd "\#define XLWIP_CONFIG_N_TX_DESC $ndesc"
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_DESC $ndesc"
+		set rxbudget [common::get_property CONFIG.emac_rx_poll_budget $libhandle]
+		if {$rxbudget > 0} {
+			puts $fd "\#define XLWIP_CONFIG_EMAC_RX_POLL_BUDGET $rxbudget"
+		}
+		set ndesc [common::get_property CONFIG.n_rx_q1_descriptors $libhandle]
+		if {$ndesc > 4096} {
+			error "ERROR: n_rx_q1_descriptors is $ndesc, the 64 KB BD space of rx queue 1 holds at most 4096 BDs" "" "MDT_ERROR"
+		}
+		if {$ndesc > 0} {
+			puts $fd "\#define XLWIP_CONFIG_N_RX_Q1_DESC $ndesc"
+		}
 		puts $fd ""
 	}
 
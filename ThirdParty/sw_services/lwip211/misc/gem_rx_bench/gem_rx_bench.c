@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+/*
+ * Host benchmark of the GEM receive path of the lwIP adapter, with
+ * xemacpsif_dma.c, xpqueue.c, the BD ring code of the emacps driver and the
+ * lwIP pbuf pools compiled into this tool.
+ *
+ * The GEM is modelled by a register array and a DMA that completes the
+ * RX BDs of the ring in order, as long as they were handed back with a new
+ * buffer; a frame finding no free BD is dropped. Bursts of frames are
+ * delivered, then the driver runs:
+ * - without XLWIP_CONFIG_EMAC_RX_POLL_BUDGET, emacps_recv_handler() reaps
+ *   and refills the whole ring, with interrupts disabled for its length.
+ * - with it, emacps_recv_handler() masks RX and emacps_rx_poll() is called
+ *   until it reaps less than the budget, as xemacif_input() does.
+ * The receive queue is then drained and its pbufs freed.
+ *
+ * The frames per second through the driver are printed, with the number,
+ * average and longest length of the interrupt disabled sections, which are
+ * the SYS_ARCH_PROTECT sections and the interrupt handler. The longest one
+ * includes the preemptions of the host. The cache
+ * invalidation is modelled as a loop over the cache lines of the range.
+ *
+ * Usage: gem_rx_bench [-n <frames>] [-b <burst>] [-l <frame length>] [-u]
+ *	-n	Frames to deliver, 2000000 by default
+ *	-b	Frames delivered between two runs of the driver, 32 by default
+ *	-l	Frame length in bytes, 64 by default
+ *	-u	Do not time the interrupt disabled sections, whose clock reads
+ *		are otherwise part of the frame rate
+ *
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   kc   10/18/26 First release
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include "lwip/mem.h"
+#include "lwip/memp.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "netif/xadapter.h"
+#include "netif/xemacpsif.h"
+
+#define BENCH_CACHE_LINE	64U
+#define BENCH_GEM_REGS		0x800U
+
+u32 BenchGemRegs[BENCH_GEM_REGS];
+static XEmacPs_Bd RxBdSpace[XLWIP_CONFIG_N_RX_DESC]
+	__attribute__ ((aligned (XEMACPS_DMABD_MINIMUM_ALIGNMENT)));
+static u32 RxHwIndex;
+static volatile u32 CacheLines;
+
+static u64 Sections;
+static u64 SectionNs;
+static u64 SectionMaxNs;
+static u64 SectionStart;
+static u32 SectionDepth;
+static u32 InStack;
+static u32 TimeSections = 1U;
+
+static u64 NowNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec;
+}
+
+/*
+ * Interrupt disabled sections of the driver, the memp pools nest in them.
+ * The pbuf frees of the stack are not counted.
+ */
+unsigned int BenchProtect(void)
+{
+	if ((SectionDepth == 0U) && (TimeSections != 0U)) {
+		SectionStart = NowNs();
+	}
+	SectionDepth++;
+	return 0;
+}
+
+void BenchUnprotect(unsigned int lev)
+{
+	u64 Ns;
+
+	(void)lev;
+	SectionDepth--;
+	if ((SectionDepth != 0U) || (InStack != 0U) || (TimeSections == 0U)) {
+		return;
+	}
+	Ns = NowNs() - SectionStart;
+	Sections++;
+	SectionNs += Ns;
+	if (Ns > SectionMaxNs) {
+		SectionMaxNs = Ns;
+	}
+}
+
+void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len)
+{
+	INTPTR end = adr + len;
+
+	for (adr &= ~(INTPTR)(BENCH_CACHE_LINE - 1U); adr < end;
+			adr += BENCH_CACHE_LINE) {
+		CacheLines++;
+	}
+}
+
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len)
+{
+	Xil_DCacheInvalidateRange(adr, len);
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	(void)ctrl1;
+}
+
+/*
+ * Completes 'count' frames of 'len' bytes on the RX ring. Returns the number
+ * of frames dropped for lack of a BD holding a new buffer.
+ */
+static u32 GemReceive(u32 count, u32 len)
+{
+	XEmacPs_Bd *bd;
+	u32 dropped = 0U;
+	u32 k;
+
+	for (k = 0U; k < count; k++) {
+		bd = &RxBdSpace[RxHwIndex];
+		if ((XEmacPs_BdRead(bd, XEMACPS_BD_ADDR_OFFSET) &
+				XEMACPS_RXBUF_NEW_MASK) != 0U) {
+			dropped++;
+			continue;
+		}
+		XEmacPs_BdWrite(bd, XEMACPS_BD_STAT_OFFSET, len |
+			XEMACPS_RXBUF_SOF_MASK | XEMACPS_RXBUF_EOF_MASK);
+		XEmacPs_BdWrite(bd, XEMACPS_BD_ADDR_OFFSET,
+			XEmacPs_BdRead(bd, XEMACPS_BD_ADDR_OFFSET) |
+			XEMACPS_RXBUF_NEW_MASK);
+		RxHwIndex = (RxHwIndex + 1U) % XLWIP_CONFIG_N_RX_DESC;
+	}
+
+	return dropped;
+}
+
+static u32 Drain(xemacpsif_s *xemacpsif)
+{
+	struct pbuf *p;
+	u32 n = 0U;
+
+	InStack = 1U;
+	while ((p = pq_spsc_dequeue(xemacpsif->recv_q)) != NULL) {
+		pbuf_free(p);
+		n++;
+	}
+	InStack = 0U;
+
+	return n;
+}
+
+int main(int argc, char **argv)
+{
+	static xemacpsif_s xemacpsif;
+	struct xemac_s xemac;
+	XEmacPs_BdRing *rxring;
+	XEmacPs_Bd bdtemplate;
+	u32 num = 2000000U;
+	u32 burst = 32U;
+	u32 len = 64U;
+	u32 sent = 0U;
+	u32 dropped = 0U;
+	u32 received = 0U;
+	u32 n;
+	u64 start;
+	u64 elapsed;
+	int opt;
+#ifndef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+	unsigned int lev;
+#endif
+
+	while ((opt = getopt(argc, argv, "n:b:l:u")) != -1) {
+		switch (opt) {
+		case 'n':
+			num = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			burst = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'l':
+			len = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'u':
+			TimeSections = 0U;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n <frames>] [-b <burst>] "
+				"[-l <frame length>] [-u]\n", argv[0]);
+			return 1;
+		}
+	}
+	if ((burst == 0U) || (len < 60U) || (len > XEMACPS_MAX_FRAME_SIZE)) {
+		fprintf(stderr, "invalid burst or frame length\n");
+		return 1;
+	}
+
+	mem_init();
+	memp_init();
+	/* A GEM version above 2, which needs no RX reset on overruns */
+	BenchGemRegs[0xFCU / 4U] = 7U << 16U;
+	xemacpsif.emacps.Config.BaseAddress = XPAR_XEMACPS_0_BASEADDR;
+	xemacpsif.emacps.Config.IsCacheCoherent = 0U;
+	xemacpsif.recv_q = pq_create_spsc();
+	xemac.state = &xemacpsif;
+	xemac.topology_index = 0;
+
+	rxring = &XEmacPs_GetRxRing(&xemacpsif.emacps);
+	XEmacPs_BdClear(&bdtemplate);
+	if ((xemacpsif.recv_q == NULL) ||
+		(XEmacPs_BdRingCreate(rxring, (UINTPTR)RxBdSpace,
+			(UINTPTR)RxBdSpace, XEMACPS_DMABD_MINIMUM_ALIGNMENT,
+			XLWIP_CONFIG_N_RX_DESC) != XST_SUCCESS) ||
+		(XEmacPs_BdRingClone(rxring, &bdtemplate, XEMACPS_RECV) !=
+			XST_SUCCESS)) {
+		printf("ring setup failed\n");
+		return 1;
+	}
+	setup_rx_bds(&xemacpsif, rxring);
+	Sections = 0U;
+	SectionNs = 0U;
+	SectionMaxNs = 0U;
+
+	start = NowNs();
+	while (sent < num) {
+		n = ((num - sent) < burst) ? (num - sent) : burst;
+		dropped += GemReceive(n, len);
+		sent += n;
+
+#ifdef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+		emacps_recv_handler(&xemac);
+		while (emacps_rx_poll(&xemacpsif,
+			XLWIP_CONFIG_EMAC_RX_POLL_BUDGET) ==
+			XLWIP_CONFIG_EMAC_RX_POLL_BUDGET) {
+			received += Drain(&xemacpsif);
+		}
+#else
+		/* The handler runs with interrupts disabled */
+		lev = BenchProtect();
+		emacps_recv_handler(&xemac);
+		BenchUnprotect(lev);
+#endif
+		received += Drain(&xemacpsif);
+	}
+	elapsed = NowNs() - start;
+
+#ifdef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+	printf("poll, budget %u: ", (u32)XLWIP_CONFIG_EMAC_RX_POLL_BUDGET);
+#else
+	printf("interrupt: ");
+#endif
+	printf("%u frames of %u bytes in bursts of %u, %u received, %u dropped\n",
+		sent, len, burst, received, dropped);
+	printf("%.2f Mpps, %.1f ns per frame\n",
+		(double)received * 1e3 / (double)elapsed,
+		(double)elapsed / (double)received);
+	if (TimeSections != 0U) {
+		printf("interrupts disabled: %llu sections, %.1f ns average, "
+			"%llu ns longest, %.1f%% of the time\n",
+			(unsigned long long)Sections,
+			(double)SectionNs / (double)Sections,
+			(unsigned long long)SectionMaxNs,
+			(double)SectionNs * 100.0 / (double)elapsed);
+	}
+
+	if ((received + dropped) != sent) {
+		printf("FAILED, frames lost\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
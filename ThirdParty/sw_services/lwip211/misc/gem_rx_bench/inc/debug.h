@@ -0,0 +1,2 @@
+/* Host build */
+#define LWIP_DEBUGF(debug, message)
@@ -0,0 +1,28 @@
+/* Host build of the GEM receive path, see ../gem_rx_bench.c */
+#ifndef LWIPOPTS_H
+#define LWIPOPTS_H
+
+#define NO_SYS				1
+#define LWIP_TCP			0
+#define LWIP_UDP			0
+#define LWIP_ICMP			0
+#define LWIP_IGMP			0
+#define LWIP_DHCP			0
+#define LWIP_NETCONN			0
+#define LWIP_SOCKET			0
+#define LWIP_STATS			0
+#define LINK_STATS			0
+#define MEM_ALIGNMENT			64
+#define MEM_SIZE			(256 * 1024)
+#define PBUF_POOL_SIZE			512
+#define PBUF_POOL_BUFSIZE		1700
+
+/* Critical sections are timed by the bench, as interrupt disabled time */
+#define SYS_LIGHTWEIGHT_PROT		1
+#define SYS_ARCH_DECL_PROTECT(lev)	unsigned int lev
+#define SYS_ARCH_PROTECT(lev)		lev = BenchProtect()
+#define SYS_ARCH_UNPROTECT(lev)		BenchUnprotect(lev)
+unsigned int BenchProtect(void);
+void BenchUnprotect(unsigned int lev);
+
+#endif
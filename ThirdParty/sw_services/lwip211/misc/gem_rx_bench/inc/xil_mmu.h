@@ -0,0 +1,10 @@
+/* Host build, the BD space is plain memory */
+#ifndef XIL_MMU_H
+#define XIL_MMU_H
+
+#define NORM_NONCACHE		0U
+#define INNER_SHAREABLE		0U
+#define DEVICE_MEMORY		0U
+#define Xil_SetTlbAttributes(Addr, Attr)	((void)(Addr), (void)(Attr))
+
+#endif
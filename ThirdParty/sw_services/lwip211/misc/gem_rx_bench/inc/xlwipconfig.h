@@ -0,0 +1,12 @@
+/* Host build of the GEM receive path, see ../gem_rx_bench.c */
+#ifndef XLWIPCONFIG_H
+#define XLWIPCONFIG_H
+
+#define XLWIP_CONFIG_INCLUDE_GEM	1
+#define XLWIP_CONFIG_N_TX_DESC		64
+#define XLWIP_CONFIG_N_RX_DESC		64
+#if defined(BENCH_RX_POLL_BUDGET) && (BENCH_RX_POLL_BUDGET > 0)
+#define XLWIP_CONFIG_EMAC_RX_POLL_BUDGET	BENCH_RX_POLL_BUDGET
+#endif
+
+#endif
@@ -0,0 +1,14 @@
+/* Host build of the GEM receive path, see ../gem_rx_bench.c */
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#include "xil_types.h"
+
+/* The GEM registers are an array of the bench */
+extern u32 BenchGemRegs[];
+#define XPAR_XEMACPS_NUM_INSTANCES	1U
+#define XPAR_XEMACPS_0_BASEADDR		((UINTPTR)BenchGemRegs)
+#define XPAR_SCUGIC_0_CPU_BASEADDR	0xF9001000U
+#define XPAR_SCUGIC_0_DIST_BASEADDR	0xF9000000U
+
+#endif
@@ -0,0 +1,9 @@
+/* Host build */
+#ifndef XPSEUDO_ASM_H
+#define XPSEUDO_ASM_H
+
+#define dsb()	__sync_synchronize()
+#define dmb()	__sync_synchronize()
+#define isb()	__sync_synchronize()
+
+#endif
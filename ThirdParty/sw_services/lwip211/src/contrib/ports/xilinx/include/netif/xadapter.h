@@ -75,6 +75,18 @@ struct netif *	xemac_add(struct netif *netif,
 	UINTPTR mac_baseaddr);
 #if defined (__arm__) || defined (__aarch64__)
 void xemacpsif_resetrx_on_no_rxdata(struct netif *netif);
+void xemacpsif_tx_batch_begin(struct netif *netif);
+void xemacpsif_tx_batch_end(struct netif *netif);
+
+/* flows that can be steered to the Gem receive priority queue 1 */
+#define XEMACPSIF_STEER_UDP_PORT	0	/* UDP destination port */
+#define XEMACPSIF_STEER_VLAN_PRIO	1	/* VLAN priority (PCP) */
+#define XEMACPSIF_STEER_ETHTYPE		2	/* EtherType */
+
+err_t xemacpsif_rx_steer(struct netif *netif, u8_t type, u16_t value);
+#if !NO_SYS
+void xemacpsif_input_q1_thread(struct netif *netif);
+#endif
 #endif
 
 /* global lwip debug variable used for debugging */
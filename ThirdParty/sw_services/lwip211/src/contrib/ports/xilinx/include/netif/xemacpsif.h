@@ -114,8 +114,8 @@ void 	xemacps_error_handler(XEmacPs * Temac);
 typedef struct {
 	XEmacPs emacps;
 
-	/* queue to store overflow packets */
-	pq_queue_t *recv_q;
+	/* received packets, filled by the RX handler or the RX poll */
+	pq_spsc_t *recv_q;
 	pq_queue_t *send_q;
 
 	/* pointers to memory holding buffer descriptors (used only with SDMA) */
@@ -124,6 +124,22 @@ typedef struct {
 
 	unsigned int last_rx_frms_cntr;
 
+	/* TX doorbell batching, see xemacpsif_tx_batch_begin() */
+	u32_t tx_batch_depth;
+	u32_t tx_held_bds;
+
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	/* priority queue 1, receives the frames steered by xemacpsif_rx_steer() */
+	pq_spsc_t *recv_q1;
+	XEmacPs_BdRing rxq1_ring;
+	void *rxq1_bdspace;
+	u8_t n_screen_t1;
+	u8_t n_screen_t2;
+#if !NO_SYS
+	sys_sem_t sem_rx_q1_data_available;
+#endif
+#endif
+
 } xemacpsif_s;
 
 extern xemacpsif_s xemacpsif;
@@ -142,7 +158,15 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 #else
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p);
 #endif
+void emacps_tx_kick(xemacpsif_s *xemacpsif);
 void emacps_recv_handler(void *arg);
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+void emacps_recv_q1_handler(void *arg);
+s32_t xemacpsif_input_q1(struct netif *netif);
+#endif
+#ifdef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+s32_t emacps_rx_poll(xemacpsif_s *xemacpsif, s32_t budget);
+#endif
 void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord);
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring);
 void HandleTxErrors(struct xemac_s *xemac);
@@ -44,11 +44,29 @@ typedef struct {
 	int head, tail, len;
 } pq_queue_t;
 
+/* Lock-free ring for one producer and one consumer (e.g. an ISR and a
+ * thread). head is only written by the producer and tail only by the
+ * consumer; both run freely and are masked with PQ_QUEUE_SIZE - 1.
+ */
+typedef struct {
+	void *data[PQ_QUEUE_SIZE];
+	volatile unsigned int head, tail;
+} pq_spsc_t;
+
+#if (PQ_QUEUE_SIZE & (PQ_QUEUE_SIZE - 1)) != 0
+#error "PQ_QUEUE_SIZE must be a power of 2"
+#endif
+
 pq_queue_t*	pq_create_queue();
 int 		pq_enqueue(pq_queue_t *q, void *p);
 void*		pq_dequeue(pq_queue_t *q);
 int		pq_qlength(pq_queue_t *q);
 
+pq_spsc_t*	pq_create_spsc(void);
+int		pq_spsc_enqueue(pq_spsc_t *q, void *p);
+void*		pq_spsc_dequeue(pq_spsc_t *q);
+int		pq_spsc_length(pq_spsc_t *q);
+
 #ifdef __cplusplus
 }
 #endif
@@ -176,6 +176,10 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 		err = _unbuffered_low_level_output(xemacpsif, p);
 #endif
 	} else {
+		/* do not leave held BDs behind the frame being dropped */
+		if (xemacpsif->tx_held_bds != 0) {
+			emacps_tx_kick(xemacpsif);
+		}
 #if LINK_STATS
 		lwip_stats.link.drop++;
 #endif
@@ -217,12 +221,8 @@ static struct pbuf * low_level_input(struct netif *netif)
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	struct pbuf *p;
 
-	/* see if there is data to process */
-	if (pq_qlength(xemacpsif->recv_q) == 0)
-		return NULL;
-
-	/* return one packet from receive q */
-	p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
+	/* return one packet from receive q, NULL if there is none */
+	p = (struct pbuf *)pq_spsc_dequeue(xemacpsif->recv_q);
 	return p;
 }
 
@@ -242,6 +242,49 @@ static err_t xemacpsif_output(struct netif *netif, struct pbuf *p,
 	return etharp_output(netif, p, ipaddr);
 }
 
+/*
+ * xemacpsif_deliver():
+ *
+ * Hands one received frame over to the TCP/IP stack.
+ *
+ */
+static void xemacpsif_deliver(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr;
+
+	/* points to packet payload, which starts with an Ethernet header */
+	ethhdr = p->payload;
+
+#if LINK_STATS
+	lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+	switch (htons(ethhdr->type)) {
+		/* IP or ARP packet? */
+		case ETHTYPE_IP:
+		case ETHTYPE_ARP:
+#if LWIP_IPV6
+		/*IPv6 Packet?*/
+		case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+			/* PPPoE packet? */
+		case ETHTYPE_PPPOEDISC:
+		case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+			/* full packet send to tcpip_thread to process */
+			if (netif->input(p, netif) != ERR_OK) {
+				LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
+				pbuf_free(p);
+			}
+			break;
+
+		default:
+			pbuf_free(p);
+			break;
+	}
+}
+
 /*
  * xemacpsif_input():
  *
@@ -253,65 +296,117 @@ static err_t xemacpsif_output(struct netif *netif, struct pbuf *p,
  * Returns the number of packets read (max 1 packet on success,
  * 0 if there are no packets)
  *
+ * With XLWIP_CONFIG_EMAC_RX_POLL_BUDGET, the RX interrupt only masks
+ * itself and frames are reaped here, up to the budget per poll. Returns
+ * the number of packets read in that case.
+ *
+ * With XLWIP_CONFIG_N_RX_Q1_DESC and NO_SYS, the frames of the priority
+ * queue 1 are passed to lwIP first and are counted as well.
+ *
  */
 
 s32_t xemacpsif_input(struct netif *netif)
 {
-	struct eth_hdr *ethhdr;
 	struct pbuf *p;
-	SYS_ARCH_DECL_PROTECT(lev);
+	s32_t n_q1 = 0;
+
+#if defined(XLWIP_CONFIG_N_RX_Q1_DESC) && NO_SYS
+	n_q1 = xemacpsif_input_q1(netif);
+#endif
+#ifdef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	s32_t n_packets = 0;
+	s32_t reaped;
+
+	do {
+		reaped = emacps_rx_poll(xemacpsif, XLWIP_CONFIG_EMAC_RX_POLL_BUDGET);
+		while ((p = low_level_input(netif)) != NULL) {
+			xemacpsif_deliver(netif, p);
+			n_packets++;
+		}
+#if NO_SYS
+		/* one budget per call keeps the main loop responsive */
+		break;
+#endif
+	} while (reaped == XLWIP_CONFIG_EMAC_RX_POLL_BUDGET);
+
+	return n_packets + n_q1;
+#else
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
 		/* move received packet into a new pbuf */
-		SYS_ARCH_PROTECT(lev);
 		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL) {
-			return 0;
+			return n_q1;
 		}
 
-		/* points to packet payload, which starts with an Ethernet header */
-		ethhdr = p->payload;
-
-	#if LINK_STATS
-		lwip_stats.link.recv++;
-	#endif /* LINK_STATS */
-
-		switch (htons(ethhdr->type)) {
-			/* IP or ARP packet? */
-			case ETHTYPE_IP:
-			case ETHTYPE_ARP:
-	#if LWIP_IPV6
-			/*IPv6 Packet?*/
-			case ETHTYPE_IPV6:
-	#endif
-	#if PPPOE_SUPPORT
-				/* PPPoE packet? */
-			case ETHTYPE_PPPOEDISC:
-			case ETHTYPE_PPPOE:
-	#endif /* PPPOE_SUPPORT */
-				/* full packet send to tcpip_thread to process */
-				if (netif->input(p, netif) != ERR_OK) {
-					LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
-					pbuf_free(p);
-					p = NULL;
-				}
-				break;
+		xemacpsif_deliver(netif, p);
+	}
 
-			default:
-				pbuf_free(p);
-				p = NULL;
-				break;
-		}
+	return 1 + n_q1;
+#endif
+}
+
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+/*
+ * xemacpsif_input_q1():
+ *
+ * Passes the frames received on the Gem priority queue 1 to lwIP.
+ * Returns the number of packets read.
+ *
+ */
+
+s32_t xemacpsif_input_q1(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	struct pbuf *p;
+	s32_t n_packets = 0;
+
+	while ((p = (struct pbuf *)pq_spsc_dequeue(xemacpsif->recv_q1)) != NULL) {
+		xemacpsif_deliver(netif, p);
+		n_packets++;
 	}
 
-	return 1;
+	return n_packets;
 }
+#endif
+
+#if !NO_SYS
+/*
+ * xemacpsif_input_q1_thread():
+ *
+ * Input thread of the Gem priority queue 1, to be created by the
+ * application next to xemacif_input_thread. It is the only consumer of the
+ * queue 1 frames, so it can run at a higher priority than the thread
+ * serving the bulk traffic. Deletes itself when the queue is not
+ * configured.
+ *
+ */
+
+void xemacpsif_input_q1_thread(struct netif *netif)
+{
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+
+	while (1) {
+		/* sleep until the queue 1 RX handler received packets */
+		sys_sem_wait(&xemacpsif->sem_rx_q1_data_available);
+		xemacpsif_input_q1(netif);
+	}
+#else
+	LWIP_UNUSED_ARG(netif);
+	vTaskDelete(NULL);
+#endif
+}
+#endif
 
 #if !NO_SYS
 #if defined(__arm__) && !defined(ARMR5)
@@ -358,7 +453,20 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_emacps;
 
 	xemacpsif->send_q = NULL;
-	xemacpsif->recv_q = pq_create_queue();
+	xemacpsif->tx_batch_depth = 0;
+	xemacpsif->tx_held_bds = 0;
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	xemacpsif->rxq1_bdspace = NULL;
+	xemacpsif->n_screen_t1 = 0;
+	xemacpsif->n_screen_t2 = 0;
+	xemacpsif->recv_q1 = pq_create_spsc();
+	if (!xemacpsif->recv_q1)
+		return ERR_MEM;
+#if !NO_SYS
+	sys_sem_new(&xemacpsif->sem_rx_q1_data_available, 0);
+#endif
+#endif
+	xemacpsif->recv_q = pq_create_spsc();
 	if (!xemacpsif->recv_q)
 		return ERR_MEM;
 
@@ -793,3 +901,125 @@ void xemacpsif_resetrx_on_no_rxdata(struct netif *netif)
 
 	resetrx_on_no_rxdata(xemacpsif);
 }
+
+/*
+ * xemacpsif_tx_batch_begin():
+ *
+ * Starts a batch of transmissions. Frames sent until the matching
+ * xemacpsif_tx_batch_end() are handed to the DMA as they are queued but the
+ * transmit doorbell is rung once for the batch. Batches may be nested.
+ *
+ */
+
+void xemacpsif_tx_batch_begin(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->tx_batch_depth++;
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * xemacpsif_tx_batch_end():
+ *
+ * Ends a batch of transmissions started with xemacpsif_tx_batch_begin() and
+ * starts the transmitter for the frames queued by the batch.
+ *
+ */
+
+void xemacpsif_tx_batch_end(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	if (xemacpsif->tx_batch_depth != 0) {
+		xemacpsif->tx_batch_depth--;
+	}
+	if ((xemacpsif->tx_batch_depth == 0) && (xemacpsif->tx_held_bds != 0)) {
+		emacps_tx_kick(xemacpsif);
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * xemacpsif_rx_steer():
+ *
+ * Steers the received frames of a flow to the Gem priority queue 1, using
+ * the type 1 screeners for UDP ports and the type 2 screeners for VLAN
+ * priorities and EtherTypes. Returns ERR_IF when the priority queue is not
+ * available and ERR_MEM when all screeners of the type are in use.
+ *
+ */
+
+err_t xemacpsif_rx_steer(struct netif *netif, u8_t type, u16_t value)
+{
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	LONG status = XST_SUCCESS;
+	err_t err = ERR_OK;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	/* only GEM versions with priority queues get the queue 1 ring */
+	if (xemacpsif->rxq1_bdspace == NULL) {
+		return ERR_IF;
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	switch (type) {
+		case XEMACPSIF_STEER_UDP_PORT:
+			if (xemacpsif->n_screen_t1 >= XEMACPS_MAX_SCREEN_T1) {
+				err = ERR_MEM;
+				break;
+			}
+			status = XEmacPs_SetScreenUdpPort(&xemacpsif->emacps,
+					xemacpsif->n_screen_t1, value, 1);
+			if (status == XST_SUCCESS) {
+				xemacpsif->n_screen_t1++;
+			}
+			break;
+
+		case XEMACPSIF_STEER_VLAN_PRIO:
+		case XEMACPSIF_STEER_ETHTYPE:
+			if ((type == XEMACPSIF_STEER_VLAN_PRIO) && (value > 7)) {
+				err = ERR_ARG;
+				break;
+			}
+			if (xemacpsif->n_screen_t2 >= XEMACPS_MAX_SCREEN_T2) {
+				err = ERR_MEM;
+				break;
+			}
+			if (type == XEMACPSIF_STEER_VLAN_PRIO) {
+				status = XEmacPs_SetScreenVlanPrio(&xemacpsif->emacps,
+						xemacpsif->n_screen_t2, (u8)value, 1);
+			} else {
+				status = XEmacPs_SetScreenEthType(&xemacpsif->emacps,
+						xemacpsif->n_screen_t2, value, 1);
+			}
+			if (status == XST_SUCCESS) {
+				xemacpsif->n_screen_t2++;
+			}
+			break;
+
+		default:
+			err = ERR_ARG;
+			break;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	if (status != XST_SUCCESS) {
+		err = ERR_IF;
+	}
+	return err;
+#else
+	LWIP_UNUSED_ARG(netif);
+	LWIP_UNUSED_ARG(type);
+	LWIP_UNUSED_ARG(value);
+	return ERR_IF;
+#endif
+}
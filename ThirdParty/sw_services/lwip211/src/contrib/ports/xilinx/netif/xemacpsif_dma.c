@@ -64,6 +64,13 @@
 /* A max of 4 different ethernet interfaces are supported */
 static UINTPTR tx_pbufs_storage[4*XLWIP_CONFIG_N_TX_DESC];
 static UINTPTR rx_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC];
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+/* The rx queue 1 ring takes the 64 KB chunk of the rx parking descriptor */
+#if (XLWIP_CONFIG_N_RX_Q1_DESC * XEMACPS_BD_NUM_WORDS * 4) > 0x10000
+#error "XLWIP_CONFIG_N_RX_Q1_DESC BDs do not fit in the 64 KB BD space of rx queue 1"
+#endif
+static UINTPTR rx_q1_pbufs_storage[4*XLWIP_CONFIG_N_RX_Q1_DESC];
+#endif
 
 static s32_t emac_intr_num;
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
@@ -223,6 +230,29 @@ u32_t get_base_index_rxpbufsstorage (xemacpsif_s *xemacpsif)
 	return index;
 }
 
+/*
+ * Returns the pbuf storage of the given RX ring and its number of BDs.
+ */
+static inline
+UINTPTR *get_rx_pbufs_storage(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring,
+		u32_t *n_desc)
+{
+	u32_t index;
+
+	index = get_base_index_rxpbufsstorage (xemacpsif);
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	if (rxring == &xemacpsif->rxq1_ring) {
+		*n_desc = XLWIP_CONFIG_N_RX_Q1_DESC;
+		return &rx_q1_pbufs_storage[(index / XLWIP_CONFIG_N_RX_DESC) *
+				XLWIP_CONFIG_N_RX_Q1_DESC];
+	}
+#else
+	(void)rxring;
+#endif
+	*n_desc = XLWIP_CONFIG_N_RX_DESC;
+	return &rx_pbufs_storage[index];
+}
+
 void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 {
 	XEmacPs_Bd *txbdset;
@@ -306,6 +336,29 @@ void emacps_send_handler(void *arg)
 	xInsideISR--;
 #endif
 }
+
+/*
+ * emacps_tx_kick():
+ *
+ * Rings the transmit doorbell for all BDs handed to the hardware since the
+ * last kick.
+ */
+void emacps_tx_kick(xemacpsif_s *xemacpsif)
+{
+	xemacpsif->tx_held_bds = 0;
+	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET,
+	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+}
+
+/*
+ * The frame is sent zero copy, one BD per pbuf of the chain. Only the head
+ * pbuf is referenced and it is remembered against the last BD of the frame,
+ * the reference keeps the whole chain alive until process_sent_bds frees it.
+ * Inside a xemacpsif_tx_batch_begin()/end() section the doorbell is only
+ * rung once half of the ring is held, otherwise when the section ends.
+ */
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 					u32_t block_till_tx_complete, u32_t *to_block_index)
@@ -316,7 +369,6 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	struct pbuf *q;
 	s32_t n_pbufs;
 	XEmacPs_Bd *txbdset, *txbd, *last_txbd = NULL;
-	XEmacPs_Bd *temp_txbd;
 	XStatus status;
 	XEmacPs_BdRing *txring;
 	u32_t bdindex = 0;
@@ -333,6 +385,12 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif);
 #endif
 
+#ifdef ZYNQMP_USE_JUMBO
+	max_fr_size = MAX_FRAME_SIZE_JUMBO - 18;
+#else
+	max_fr_size = XEMACPS_MAX_FRAME_SIZE - 18;
+#endif
+
 	/* first count the number of pbufs */
 	for (q = p, n_pbufs = 0; q != NULL; q = q->next)
 		n_pbufs++;
@@ -348,6 +406,7 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
 		if (tx_pbufs_storage[index + bdindex] != 0) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("PBUFS not available\r\n"));
+			XEmacPs_BdRingUnAlloc(txring, n_pbufs, txbdset);
 			return XST_FAILURE;
 		}
 
@@ -360,23 +419,23 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 
 		XEmacPs_BdSetAddressTx(txbd, (UINTPTR)q->payload);
 
-#ifdef ZYNQMP_USE_JUMBO
-		max_fr_size = MAX_FRAME_SIZE_JUMBO - 18;
-#else
-		max_fr_size = XEMACPS_MAX_FRAME_SIZE - 18;
-#endif
 		if (q->len > max_fr_size)
 			XEmacPs_BdSetLength(txbd, max_fr_size & 0x3FFF);
 		else
 			XEmacPs_BdSetLength(txbd, q->len & 0x3FFF);
 
-		tx_pbufs_storage[index + bdindex] = (UINTPTR)q;
-
-		pbuf_ref(q);
-		last_txbd = txbd;
 		XEmacPs_BdClearLast(txbd);
+		/* The used bit of the first BD is cleared last, once the
+		   whole frame is described */
+		if (txbd != txbdset) {
+			XEmacPs_BdClearTxUsed(txbd);
+		}
+		last_txbd = txbd;
 		txbd = XEmacPs_BdRingNext(txring, txbd);
 	}
+
+	tx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+	pbuf_ref(p);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
     if (block_till_tx_complete == 1) {
 		notifyinfo[tx_task_notifier_index + bdindex] = 1;
@@ -384,19 +443,8 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	}
 #endif
 	XEmacPs_BdSetLast(last_txbd);
-	/* For fragmented packets, remember the 1st BD allocated for the 1st
-	   packet fragment. The used bit for this BD should be cleared at the end
-	   after clearing out used bits for other fragments. For packets without
-	   just remember the allocated BD. */
-	temp_txbd = txbdset;
-	txbd = txbdset;
-	txbd = XEmacPs_BdRingNext(txring, txbd);
-	q = p->next;
-	for(; q != NULL; q = q->next) {
-		XEmacPs_BdClearTxUsed(txbd);
-		txbd = XEmacPs_BdRingNext(txring, txbd);
-	}
-	XEmacPs_BdClearTxUsed(temp_txbd);
+	dsb();
+	XEmacPs_BdClearTxUsed(txbdset);
 	dsb();
 
 	status = XEmacPs_BdRingToHw(txring, n_pbufs, txbdset);
@@ -404,29 +452,73 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
 		return XST_FAILURE;
 	}
+
 	/* Start transmit */
-	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
-	XEMACPS_NWCTRL_OFFSET,
-	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
-	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+	xemacpsif->tx_held_bds += n_pbufs;
+	if ((xemacpsif->tx_batch_depth == 0) ||
+		(xemacpsif->tx_held_bds >= (XLWIP_CONFIG_N_TX_DESC / 2))) {
+		emacps_tx_kick(xemacpsif);
+	}
 	return status;
 }
 
+/*
+ * Points an allocated RX BD to the payload of 'p' and records 'p' in the
+ * pbuf storage of the ring.
+ */
+static void setup_rx_bd(XEmacPs_BdRing *rxring, XEmacPs_Bd *rxbd,
+		struct pbuf *p, UINTPTR *storage, u32_t n_desc)
+{
+	u32_t bdindex;
+	u32 *temp;
+
+	bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
+	temp = (u32 *)rxbd;
+	temp++;
+	/* Status field should be cleared first to avoid drops */
+	*temp = 0;
+	dsb();
+
+	/* Set high address when required */
+#ifdef __aarch64__
+	XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_HI_OFFSET,
+		(((UINTPTR)p->payload) & ULONG64_HI_MASK) >> 32U);
+#endif
+	/* Set address field; add WRAP bit on last descriptor  */
+	if (bdindex == (n_desc - 1)) {
+		XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, ((UINTPTR)p->payload | XEMACPS_RXBUF_WRAP_MASK));
+	} else {
+		XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, (UINTPTR)p->payload);
+	}
+
+	storage[bdindex] = (UINTPTR)p;
+}
+
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 {
-	XEmacPs_Bd *rxbd;
+	XEmacPs_Bd *rxbdset, *rxbd;
 	XStatus status;
 	struct pbuf *p;
 	u32_t freebds;
-	u32_t bdindex;
-	u32 *temp;
-	u32_t index;
+	u32_t k;
+	UINTPTR *storage;
+	u32_t n_desc;
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
+	storage = get_rx_pbufs_storage(xemacpsif, rxring, &n_desc);
 
 	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
-	while (freebds > 0) {
-		freebds--;
+	if (freebds == 0) {
+		return;
+	}
+
+	/* Refill all free BDs as one set */
+	status = XEmacPs_BdRingAlloc(rxring, freebds, &rxbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
+		return;
+	}
+
+	for (k = 0, rxbd = rxbdset; k < freebds; k++) {
 #ifdef ZYNQMP_USE_JUMBO
 		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
 #else
@@ -438,27 +530,7 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 			lwip_stats.link.drop++;
 #endif
 			xil_printf("unable to alloc pbuf in recv_handler\r\n");
-			return;
-		}
-		status = XEmacPs_BdRingAlloc(rxring, 1, &rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
-			pbuf_free(p);
-			return;
-		}
-		status = XEmacPs_BdRingToHw(rxring, 1, rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware: "));
-			if (status == XST_DMA_SG_LIST_ERROR) {
-				LWIP_DEBUGF(NETIF_DEBUG, ("XST_DMA_SG_LIST_ERROR: this function was called out of sequence with XEmacPs_BdRingAlloc()\r\n"));
-			}
-			else {
-				LWIP_DEBUGF(NETIF_DEBUG, ("set of BDs was rejected because the first BD did not have its start-of-packet bit set, or the last BD did not have its end-of-packet bit set, or any one of the BD set has 0 as length value\r\n"));
-			}
-
-			pbuf_free(p);
-			XEmacPs_BdRingUnAlloc(rxring, 1, rxbd);
-			return;
+			break;
 		}
 #ifdef ZYNQMP_USE_JUMBO
 		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
@@ -469,53 +541,109 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
 		}
 #endif
-		bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
-		temp = (u32 *)rxbd;
-		temp++;
-		/* Status field should be cleared first to avoid drops */
-		*temp = 0;
-		dsb();
+		setup_rx_bd(rxring, rxbd, p, storage, n_desc);
+		rxbd = XEmacPs_BdRingNext(rxring, rxbd);
+	}
 
-		/* Set high address when required */
-#ifdef __aarch64__
-		XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_HI_OFFSET,
-			(((UINTPTR)p->payload) & ULONG64_HI_MASK) >> 32U);
+	/* Give back the BDs that could not get a pbuf */
+	if (k < freebds) {
+		XEmacPs_BdRingUnAlloc(rxring, freebds - k, rxbd);
+	}
+
+	status = XEmacPs_BdRingToHw(rxring, k, rxbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware: "));
+		if (status == XST_DMA_SG_LIST_ERROR) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("XST_DMA_SG_LIST_ERROR: this function was called out of sequence with XEmacPs_BdRingAlloc()\r\n"));
+		}
+		else {
+			LWIP_DEBUGF(NETIF_DEBUG, ("set of BDs was rejected because the first BD did not have its start-of-packet bit set, or the last BD did not have its end-of-packet bit set, or any one of the BD set has 0 as length value\r\n"));
+		}
+	}
+}
+
+#if !defined(XLWIP_CONFIG_EMAC_RX_POLL_BUDGET) || defined(XLWIP_CONFIG_N_RX_Q1_DESC)
+/*
+ * Moves up to 'budget' received frames from the RX BD ring to the receive
+ * queue 'recv_q' and frees their BDs. Returns the number of BDs processed.
+ */
+static s32_t emacps_rx_reap(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring,
+		pq_spsc_t *recv_q, s32_t budget)
+{
+	struct pbuf *p;
+	XEmacPs_Bd *rxbdset, *curbdptr;
+	s32_t bd_processed;
+	s32_t rx_bytes, k;
+	u32_t bdindex;
+	UINTPTR *storage;
+	u32_t n_desc;
+
+	storage = get_rx_pbufs_storage(xemacpsif, rxring, &n_desc);
+
+	bd_processed = XEmacPs_BdRingFromHwRx(rxring, budget, &rxbdset);
+	if (bd_processed <= 0) {
+		return 0;
+	}
+
+	for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
+
+		bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
+		p = (struct pbuf *)storage[bdindex];
+
+		/*
+		 * Adjust the buffer size to the actual number of bytes received.
+		 */
+#ifdef ZYNQMP_USE_JUMBO
+		rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
+#else
+		rx_bytes = XEmacPs_BdGetLength(curbdptr);
 #endif
-		/* Set address field; add WRAP bit on last descriptor  */
-		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
-			XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, ((UINTPTR)p->payload | XEMACPS_RXBUF_WRAP_MASK));
-		} else {
-			XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, (UINTPTR)p->payload);
+		pbuf_realloc(p, rx_bytes);
+
+		/* Invalidate RX frame before queuing to handle
+		 * L1 cache prefetch conditions on any architecture.
+		 */
+		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+			Xil_DCacheInvalidateRange((UINTPTR)p->payload, rx_bytes);
 		}
 
-		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+		/* store it in the receive queue,
+		 * where it'll be processed by a different handler
+		 */
+		if (pq_spsc_enqueue(recv_q, (void*)p) < 0) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+		}
+		curbdptr = XEmacPs_BdRingNext( rxring, curbdptr);
 	}
+	/* free up the BD's */
+	XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
+
+	return bd_processed;
 }
+#endif
 
 void emacps_recv_handler(void *arg)
 {
-	struct pbuf *p;
-	XEmacPs_Bd *rxbdset, *curbdptr;
 	struct xemac_s *xemac;
 	xemacpsif_s *xemacpsif;
-	XEmacPs_BdRing *rxring;
-	volatile s32_t bd_processed;
-	s32_t rx_bytes, k;
-	u32_t bdindex;
 	u32_t regval;
-	u32_t index;
 	u32_t gigeversion;
+#ifndef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+	XEmacPs_BdRing *rxring;
+#endif
 
 	xemac = (struct xemac_s *)(arg);
 	xemacpsif = (xemacpsif_s *)(xemac->state);
-	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
 
 #if !NO_SYS
 	xInsideISR++;
 #endif
 
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
-	index = get_base_index_rxpbufsstorage (xemacpsif);
 	/*
 	 * If Reception done interrupt is asserted, call RX call back function
 	 * to handle the processed BDs and then raise the according flag.
@@ -526,58 +654,242 @@ void emacps_recv_handler(void *arg)
 			resetrx_on_no_rxdata(xemacpsif);
 	}
 
-	while(1) {
+#ifdef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+	/* The frames are reaped by emacps_rx_poll(), which unmasks RX again
+	 * once the ring is drained.
+	 */
+	XEmacPs_IntDisable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+#else
+	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+	while (emacps_rx_reap(xemacpsif, rxring, xemacpsif->recv_q,
+				XLWIP_CONFIG_N_RX_DESC) > 0) {
+		setup_rx_bds(xemacpsif, rxring);
+	}
+#endif
+#if !NO_SYS
+	sys_sem_signal(&xemac->sem_rx_data_available);
+	xInsideISR--;
+#endif
+
+	return;
+}
+
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+/*
+ * RX handler of the priority queue 1. The queue carries the latency
+ * critical flows, so it is always drained from the interrupt, also with
+ * XLWIP_CONFIG_EMAC_RX_POLL_BUDGET.
+ */
+void emacps_recv_q1_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+	XEmacPs_BdRing *rxring;
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+	rxring = &xemacpsif->rxq1_ring;
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+
+	while (emacps_rx_reap(xemacpsif, rxring, xemacpsif->recv_q1,
+				XLWIP_CONFIG_N_RX_Q1_DESC) > 0) {
+		setup_rx_bds(xemacpsif, rxring);
+	}
+
+#if !NO_SYS
+	sys_sem_signal(&xemacpsif->sem_rx_q1_data_available);
+	xInsideISR--;
+#endif
+}
+#endif
 
-		bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
+#ifdef XLWIP_CONFIG_EMAC_RX_POLL_BUDGET
+/*
+ * Takes up to 'budget' received frames off the RX BD ring and frees their
+ * BDs. The pbufs are removed from the pbuf storage, so that a reset of the
+ * rings does not free them. Must be called with SYS_ARCH_PROTECT held.
+ *
+ * A full ring has its HW tail on its HW head, so XEmacPs_BdRingFromHwRx()
+ * returns one BD and is called again for the rest. The limit is kept to
+ * the BDs owned by the hardware, the freed BDs still carry their new bit.
+ */
+static s32_t emacps_rx_take(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring,
+		struct pbuf **frames, u32_t *lengths, s32_t budget)
+{
+	XEmacPs_Bd *rxbdset, *curbdptr;
+	s32_t bd_processed;
+	s32_t taken = 0;
+	s32_t k;
+	u32_t limit;
+	u32_t bdindex;
+	UINTPTR *storage;
+	u32_t n_desc;
+
+	storage = get_rx_pbufs_storage(xemacpsif, rxring, &n_desc);
+
+	while (taken < budget) {
+		limit = (u32_t)(budget - taken);
+		if (limit > rxring->HwCnt) {
+			limit = rxring->HwCnt;
+		}
+		bd_processed = XEmacPs_BdRingFromHwRx(rxring, limit, &rxbdset);
 		if (bd_processed <= 0) {
 			break;
 		}
 
-		for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
-
+		for (k = 0, curbdptr = rxbdset; k < bd_processed; k++) {
 			bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
-			p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
-
-			/*
-			 * Adjust the buffer size to the actual number of bytes received.
-			 */
+			frames[taken + k] = (struct pbuf *)storage[bdindex];
+			storage[bdindex] = 0;
 #ifdef ZYNQMP_USE_JUMBO
-			rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
+			lengths[taken + k] = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
 #else
-			rx_bytes = XEmacPs_BdGetLength(curbdptr);
+			lengths[taken + k] = XEmacPs_BdGetLength(curbdptr);
 #endif
-			pbuf_realloc(p, rx_bytes);
+			curbdptr = XEmacPs_BdRingNext(rxring, curbdptr);
+		}
+		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
+		taken += bd_processed;
+	}
 
-			/* Invalidate RX frame before queuing to handle
-			 * L1 cache prefetch conditions on any architecture.
-			 */
-			if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-				Xil_DCacheInvalidateRange((UINTPTR)p->payload, rx_bytes);
-			}
+	return taken;
+}
 
-			/* store it in the receive queue,
-			 * where it'll be processed by a different handler
-			 */
-			if (pq_enqueue(xemacpsif->recv_q, (void*)p) < 0) {
+/*
+ * Hands up to 'count' pbufs to the free BDs of the RX ring and commits them
+ * to the hardware. Returns the number of pbufs used. Must be called with
+ * SYS_ARCH_PROTECT held.
+ */
+static u32_t emacps_rx_give(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring,
+		struct pbuf **bufs, u32_t count)
+{
+	XEmacPs_Bd *rxbdset, *rxbd;
+	UINTPTR *storage;
+	u32_t n_desc;
+	u32_t k;
+
+	storage = get_rx_pbufs_storage(xemacpsif, rxring, &n_desc);
+
+	if (count > XEmacPs_BdRingGetFreeCnt(rxring)) {
+		count = XEmacPs_BdRingGetFreeCnt(rxring);
+	}
+	if ((count == 0) ||
+		(XEmacPs_BdRingAlloc(rxring, count, &rxbdset) != XST_SUCCESS)) {
+		return 0;
+	}
+
+	for (k = 0, rxbd = rxbdset; k < count; k++) {
+		setup_rx_bd(rxring, rxbd, bufs[k], storage, n_desc);
+		rxbd = XEmacPs_BdRingNext(rxring, rxbd);
+	}
+	if (XEmacPs_BdRingToHw(rxring, count, rxbdset) != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware\r\n"));
+	}
+
+	return count;
+}
+
+/*
+ * Reaps up to 'budget' received frames into the receive queue and refills
+ * the RX BD ring in batches. The RX interrupt is unmasked again when fewer
+ * than 'budget' frames were pending. Returns the number of frames reaped.
+ * Called from the context that runs xemacif_input().
+ *
+ * Only the BD ring accesses run with SYS_ARCH_PROTECT held, since the error
+ * handler resets the rings from interrupt context. The pbuf allocation, the
+ * cache maintenance and the queueing run with interrupts enabled.
+ */
+s32_t emacps_rx_poll(xemacpsif_s *xemacpsif, s32_t budget)
+{
+	struct pbuf *frames[XLWIP_CONFIG_EMAC_RX_POLL_BUDGET];
+	u32_t lengths[XLWIP_CONFIG_EMAC_RX_POLL_BUDGET];
+	XEmacPs_BdRing *rxring;
+	struct pbuf *p;
+	s32_t reaped;
+	u32_t n_alloc, n_given, k;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+	if (budget > XLWIP_CONFIG_EMAC_RX_POLL_BUDGET) {
+		budget = XLWIP_CONFIG_EMAC_RX_POLL_BUDGET;
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	reaped = emacps_rx_take(xemacpsif, rxring, frames, lengths, budget);
+	SYS_ARCH_UNPROTECT(lev);
+
+	for (k = 0; k < (u32_t)reaped; k++) {
+		p = frames[k];
+		pbuf_realloc(p, lengths[k]);
+		/* Invalidate RX frame before queuing to handle
+		 * L1 cache prefetch conditions on any architecture.
+		 */
+		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+			Xil_DCacheInvalidateRange((UINTPTR)p->payload, lengths[k]);
+		}
+		if (pq_spsc_enqueue(xemacpsif->recv_q, (void *)p) < 0) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+		}
+	}
+
+	/*
+	 * Refill in batches of up to 'budget' buffers. The free BD count read
+	 * without the lock is a hint, emacps_rx_give() checks it again.
+	 */
+	do {
+		n_alloc = XEmacPs_BdRingGetFreeCnt(rxring);
+		if (n_alloc > (u32_t)XLWIP_CONFIG_EMAC_RX_POLL_BUDGET) {
+			n_alloc = XLWIP_CONFIG_EMAC_RX_POLL_BUDGET;
+		}
+		for (k = 0; k < n_alloc; k++) {
+#ifdef ZYNQMP_USE_JUMBO
+			p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
+#else
+			p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
+#endif
+			if (p == NULL) {
 #if LINK_STATS
 				lwip_stats.link.memerr++;
 				lwip_stats.link.drop++;
 #endif
-				pbuf_free(p);
+				break;
 			}
-			curbdptr = XEmacPs_BdRingNext( rxring, curbdptr);
+			if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+#ifdef ZYNQMP_USE_JUMBO
+				Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
+#else
+				Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
+#endif
+			}
+			frames[k] = p;
 		}
-		/* free up the BD's */
-		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
-		setup_rx_bds(xemacpsif, rxring);
+		n_alloc = k;
+
+		SYS_ARCH_PROTECT(lev);
+		n_given = emacps_rx_give(xemacpsif, rxring, frames, n_alloc);
+		SYS_ARCH_UNPROTECT(lev);
+
+		/* The ring was refilled meanwhile, by a reset of the rings */
+		for (k = n_given; k < n_alloc; k++) {
+			pbuf_free(frames[k]);
+		}
+	} while ((n_alloc == (u32_t)XLWIP_CONFIG_EMAC_RX_POLL_BUDGET) &&
+			(n_given == n_alloc));
+
+	if (reaped < budget) {
+		XEmacPs_IntEnable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
 	}
-#if !NO_SYS
-	sys_sem_signal(&xemac->sem_rx_data_available);
-	xInsideISR--;
-#endif
 
-	return;
+	return reaped;
 }
+#endif
 
 void clean_dma_txdescs(struct xemac_s *xemac)
 {
@@ -785,12 +1097,36 @@ XStatus init_dma(struct xemac_s *xemac)
 		 * other queue pointers are parked to known state for avoiding
 		 * the controller to malfunction by fetching the descriptors
 		 * from these queues.
+		 * With XLWIP_CONFIG_N_RX_Q1_DESC, the rx priority queue 1 gets a
+		 * ring of its own in place of the parking descriptor.
 		 */
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+		xemacpsif->rxq1_bdspace = (void *)bdrxterminate;
+		XEmacPs_BdClear(&bdtemplate);
+		status = XEmacPs_BdRingCreate(&xemacpsif->rxq1_ring,
+				(UINTPTR) xemacpsif->rxq1_bdspace,
+				(UINTPTR) xemacpsif->rxq1_bdspace, BD_ALIGNMENT,
+				XLWIP_CONFIG_N_RX_Q1_DESC);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space of queue 1\r\n"));
+			return ERR_IF;
+		}
+		status = XEmacPs_BdRingClone(&xemacpsif->rxq1_ring, &bdtemplate,
+				XEMACPS_RECV);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error initializing RxBD space of queue 1\r\n"));
+			return ERR_IF;
+		}
+		setup_rx_bds(xemacpsif, &xemacpsif->rxq1_ring);
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps),
+				xemacpsif->rxq1_ring.BaseBdAddr, 1, XEMACPS_RECV);
+#else
 		XEmacPs_BdClear(bdrxterminate);
 		XEmacPs_BdSetAddressRx(bdrxterminate, (XEMACPS_RXBUF_NEW_MASK |
 						XEMACPS_RXBUF_WRAP_MASK));
 		XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_RXQ1BASE_OFFSET),
 				   (UINTPTR)bdrxterminate);
+#endif
 		XEmacPs_BdClear(bdtxterminate);
 		XEmacPs_BdSetStatus(bdtxterminate, (XEMACPS_TXBUF_USED_MASK |
 						XEMACPS_TXBUF_WRAP_MASK));
@@ -875,9 +1211,24 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 	index1 = get_base_index_rxpbufsstorage(xemacpsif);
 	for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_DESC); index++) {
 		p = (struct pbuf *)rx_pbufs_storage[index];
-		pbuf_free(p);
+		if (p != NULL) {
+			pbuf_free(p);
+			rx_pbufs_storage[index] = 0;
+		}
+	}
 
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	if (xemacpsif->rxq1_bdspace != NULL) {
+		index1 = (index1 / XLWIP_CONFIG_N_RX_DESC) * XLWIP_CONFIG_N_RX_Q1_DESC;
+		for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_Q1_DESC); index++) {
+			p = (struct pbuf *)rx_q1_pbufs_storage[index];
+			if (p != NULL) {
+				pbuf_free(p);
+				rx_q1_pbufs_storage[index] = 0;
+			}
+		}
 	}
+#endif
 }
 
 void free_onlytx_pbufs(xemacpsif_s *xemacpsif)
@@ -917,6 +1268,12 @@ void reset_dma(struct xemac_s *xemac)
 
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, txqueuenum, XEMACPS_SEND);
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	if (xemacpsif->rxq1_bdspace != NULL) {
+		XEmacPs_BdRingPtrReset(&xemacpsif->rxq1_ring, xemacpsif->rxq1_bdspace);
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->rxq1_ring.BaseBdAddr, 1, XEMACPS_RECV);
+	}
+#endif
 }
 
 void emac_disable_intr(void)
@@ -82,6 +82,18 @@ void init_emacps(xemacpsif_s *xemacps, struct netif *netif)
 	XEmacPs_SetOptions(xemacpsp, XEMACPS_MULTICAST_OPTION);
 #endif
 
+	/* The Gem computes/verifies the checksums that lwIP does not */
+#if LWIP_FULL_CSUM_OFFLOAD_TX
+	XEmacPs_SetOptions(xemacpsp, XEMACPS_TX_CHKSUM_ENABLE_OPTION);
+#else
+	XEmacPs_ClearOptions(xemacpsp, XEMACPS_TX_CHKSUM_ENABLE_OPTION);
+#endif
+#if LWIP_FULL_CSUM_OFFLOAD_RX
+	XEmacPs_SetOptions(xemacpsp, XEMACPS_RX_CHKSUM_ENABLE_OPTION);
+#else
+	XEmacPs_ClearOptions(xemacpsp, XEMACPS_RX_CHKSUM_ENABLE_OPTION);
+#endif
+
 	/* set mac address */
 	status = XEmacPs_SetMacAddress(xemacpsp, (void*)(netif->hwaddr), 1);
 	if (status != XST_SUCCESS) {
@@ -187,6 +199,12 @@ void setup_isr (struct xemac_s *xemac)
 				    (void *) emacps_recv_handler,
 				    (void *) xemac);
 
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+	XEmacPs_SetHandler(&xemacpsif->emacps, XEMACPS_HANDLER_DMARECVQ1,
+				    (void *) emacps_recv_q1_handler,
+				    (void *) xemac);
+#endif
+
 	XEmacPs_SetHandler(&xemacpsif->emacps, XEMACPS_HANDLER_ERROR,
 				    (void *) emacps_error_handler,
 				    (void *) xemac);
@@ -30,12 +30,24 @@
 
 #include <stdlib.h>
 
+#include "xlwipconfig.h"
 #include "netif/xpqueue.h"
 
 #define NUM_QUEUES	2
 
 pq_queue_t pq_queue[NUM_QUEUES];
 
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+/* one more receive queue per interface for the Gem priority queue 1 */
+#ifdef XLWIP_CONFIG_N_RX_Q1_DESC
+#define NUM_SPSC_QUEUES	(2 * NUM_QUEUES)
+#else
+#define NUM_SPSC_QUEUES	NUM_QUEUES
+#endif
+
+pq_spsc_t pq_spsc[NUM_SPSC_QUEUES];
+#endif
+
 pq_queue_t *
 pq_create_queue()
 {
@@ -90,3 +102,62 @@ pq_qlength(pq_queue_t *q)
 {
 	return q->len;
 }
+
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+pq_spsc_t *
+pq_create_spsc(void)
+{
+	static int i;
+	pq_spsc_t *q = NULL;
+
+	if (i >= NUM_SPSC_QUEUES) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("ERR: Max Queues allocated\n\r"));
+		return q;
+	}
+
+	q = &pq_spsc[i++];
+	q->head = q->tail = 0;
+
+	return q;
+}
+
+/* Producer side only */
+int
+pq_spsc_enqueue(pq_spsc_t *q, void *p)
+{
+	unsigned int head = q->head;
+
+	if (head - __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE) == PQ_QUEUE_SIZE)
+		return -1;
+
+	q->data[head & (PQ_QUEUE_SIZE - 1)] = p;
+	/* publish the entry before the new head */
+	__atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+/* Consumer side only */
+void*
+pq_spsc_dequeue(pq_spsc_t *q)
+{
+	unsigned int tail = q->tail;
+	void *p;
+
+	if (__atomic_load_n(&q->head, __ATOMIC_ACQUIRE) == tail)
+		return NULL;
+
+	p = q->data[tail & (PQ_QUEUE_SIZE - 1)];
+	/* release the slot only after it has been read */
+	__atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+
+	return p;
+}
+
+int
+pq_spsc_length(pq_spsc_t *q)
+{
+	return (int)(__atomic_load_n(&q->head, __ATOMIC_ACQUIRE) -
+		     __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE));
+}
+#endif
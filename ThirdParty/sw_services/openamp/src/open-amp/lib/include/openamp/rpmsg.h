@@ -87,6 +87,8 @@ struct rpmsg_endpoint {
  * @release_rx_buffer: release RPMsg RX buffer
  * @get_tx_payload_buffer: get RPMsg TX buffer
  * @send_offchannel_nocopy: send RPMsg data without copy
+ * @send_offchannel_nocopy_chain: send a chain of RPMsg buffers without copy
+ *                                and with a single notification
  */
 struct rpmsg_device_ops {
 	int (*send_offchannel_raw)(struct rpmsg_device *rdev,
@@ -99,6 +101,10 @@ struct rpmsg_device_ops {
 	int (*send_offchannel_nocopy)(struct rpmsg_device *rdev,
 				      uint32_t src, uint32_t dst,
 				       const void *data, int len);
+	int (*send_offchannel_nocopy_chain)(struct rpmsg_device *rdev,
+					    uint32_t src, uint32_t dst,
+					    void * const *data, const int *len,
+					    int count);
 };
 
 /**
@@ -436,6 +442,65 @@ static inline int rpmsg_send_nocopy(struct rpmsg_endpoint *ept,
 					    ept->dest_addr, data, len);
 }
 
+/**
+ * rpmsg_send_offchannel_nocopy_chain() - send a chain of messages in tx
+ * buffers reserved by rpmsg_get_tx_payload_buffer() across to the remote
+ * processor.
+ *
+ * This function sends count buffers, data[i] of length len[i], to the remote
+ * dst address, using src as the source address. All the buffers are placed on
+ * the transport in one go and the remote processor is notified only once,
+ * which makes it the preferred way to stream several messages.
+ * The application has the same responsibilities as for
+ * rpmsg_send_offchannel_nocopy() for every buffer of the chain.
+ *
+ * After the function returns successfully none of the tx buffers are owned by
+ * the sending task anymore. On error no buffer has been sent.
+ *
+ * @ept:   The rpmsg endpoint
+ * @src:   The rpmsg endpoint local address
+ * @dst:   The rpmsg endpoint remote address
+ * @data:  Array of TX buffers with messages filled
+ * @len:   Array of payload lengths
+ * @count: Number of buffers in the chain, at most RPMSG_TX_CHAIN_MAX for the
+ *         virtio transport
+ *
+ * @return total number of bytes sent or negative error value on failure.
+ *
+ * @see rpmsg_get_tx_payload_buffer
+ * @see rpmsg_send_offchannel_nocopy
+ * @see rpmsg_send_nocopy_chain
+ */
+int rpmsg_send_offchannel_nocopy_chain(struct rpmsg_endpoint *ept,
+				       uint32_t src, uint32_t dst,
+				       void * const *data, const int *len,
+				       int count);
+
+/**
+ * rpmsg_send_nocopy_chain() - send a chain of messages in tx buffers reserved
+ * by rpmsg_get_tx_payload_buffer() on the ept endpoint.
+ *
+ * Same as rpmsg_send_offchannel_nocopy_chain() using ept's source and
+ * destination addresses.
+ *
+ * @ept:   The rpmsg endpoint
+ * @data:  Array of TX buffers with messages filled
+ * @len:   Array of payload lengths
+ * @count: Number of buffers in the chain
+ *
+ * @return total number of bytes sent or negative error value on failure.
+ *
+ * @see rpmsg_send_offchannel_nocopy_chain
+ */
+static inline int rpmsg_send_nocopy_chain(struct rpmsg_endpoint *ept,
+					  void * const *data, const int *len,
+					  int count)
+{
+	return rpmsg_send_offchannel_nocopy_chain(ept, ept->addr,
+						  ept->dest_addr, data, len,
+						  count);
+}
+
 /**
  * rpmsg_init_ept - initialize rpmsg endpoint
  *
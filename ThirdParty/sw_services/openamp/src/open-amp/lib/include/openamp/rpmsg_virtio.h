@@ -26,6 +26,16 @@ extern "C" {
 #define RPMSG_BUFFER_SIZE	(512)
 #endif
 
+/* Number of received buffers dequeued per lock acquisition */
+#ifndef RPMSG_RX_BATCH_SIZE
+#define RPMSG_RX_BATCH_SIZE	(8)
+#endif
+
+/* Maximum number of TX buffers sent with one notification */
+#ifndef RPMSG_TX_CHAIN_MAX
+#define RPMSG_TX_CHAIN_MAX	(16)
+#endif
+
 /* The feature bitmap for virtio rpmsg */
 #define VIRTIO_RPMSG_F_NS	0 /* RP supports name service notifications */
 
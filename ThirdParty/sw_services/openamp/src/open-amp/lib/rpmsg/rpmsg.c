@@ -203,6 +203,32 @@ int rpmsg_send_offchannel_nocopy(struct rpmsg_endpoint *ept, uint32_t src,
 	return RPMSG_ERR_PARAM;
 }
 
+int rpmsg_send_offchannel_nocopy_chain(struct rpmsg_endpoint *ept,
+				       uint32_t src, uint32_t dst,
+				       void * const *data, const int *len,
+				       int count)
+{
+	struct rpmsg_device *rdev;
+	int i;
+
+	if (!ept || !ept->rdev || !data || !len || count <= 0 ||
+	    dst == RPMSG_ADDR_ANY)
+		return RPMSG_ERR_PARAM;
+
+	for (i = 0; i < count; i++) {
+		if (!data[i] || len[i] < 0)
+			return RPMSG_ERR_PARAM;
+	}
+
+	rdev = ept->rdev;
+
+	if (rdev->ops.send_offchannel_nocopy_chain)
+		return rdev->ops.send_offchannel_nocopy_chain(rdev, src, dst,
+							      data, len, count);
+
+	return RPMSG_ERR_PARAM;
+}
+
 struct rpmsg_endpoint *rpmsg_get_endpoint(struct rpmsg_device *rdev,
 					  const char *name, uint32_t addr,
 					  uint32_t dest_addr)
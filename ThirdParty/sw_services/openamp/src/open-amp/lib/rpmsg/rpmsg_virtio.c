@@ -348,21 +348,30 @@ static void *rpmsg_virtio_get_tx_payload_buffer(struct rpmsg_device *rdev,
 	return RPMSG_LOCATE_DATA(rp_hdr);
 }
 
-static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
-					       uint32_t src, uint32_t dst,
-					       const void *data, int len)
+/**
+ * rpmsg_virtio_fill_tx_hdr
+ *
+ * Fills the RPMsg header of a TX buffer reserved by
+ * rpmsg_virtio_get_tx_payload_buffer().
+ *
+ * @param rvdev - pointer to rpmsg virtio device
+ * @param src   - source address of channel
+ * @param dst   - destination address of channel
+ * @param data  - TX payload buffer
+ * @param len   - size of payload
+ *
+ * @return - index of the buffer in the send virtqueue
+ */
+static uint16_t rpmsg_virtio_fill_tx_hdr(struct rpmsg_virtio_device *rvdev,
+					 uint32_t src, uint32_t dst,
+					 const void *data, int len)
 {
-	struct rpmsg_virtio_device *rvdev;
 	struct metal_io_region *io;
 	struct rpmsg_hdr rp_hdr;
 	struct rpmsg_hdr *hdr;
-	uint32_t buff_len;
 	uint16_t idx;
 	int status;
 
-	/* Get the associated remote device for channel. */
-	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
-
 	hdr = RPMSG_LOCATE_HDR(data);
 	/* The reserved field contains buffer index */
 	idx = hdr->reserved;
@@ -380,7 +389,24 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 				      &rp_hdr, sizeof(rp_hdr));
 	RPMSG_ASSERT(status == sizeof(rp_hdr), "failed to write header\r\n");
 
-	metal_mutex_acquire(&rdev->lock);
+	return idx;
+}
+
+/**
+ * rpmsg_virtio_enqueue_tx_payload
+ *
+ * Places a TX buffer with its header filled on the send virtqueue.
+ * The caller must hold the rpmsg device lock and kick the virtqueue.
+ *
+ * @param rvdev - pointer to rpmsg virtio device
+ * @param data  - TX payload buffer
+ * @param idx   - index of the buffer in the send virtqueue
+ */
+static void rpmsg_virtio_enqueue_tx_payload(struct rpmsg_virtio_device *rvdev,
+					    const void *data, uint16_t idx)
+{
+	uint32_t buff_len;
+	int status;
 
 #ifndef VIRTIO_SLAVE_ONLY
 	if (rpmsg_virtio_get_role(rvdev) == RPMSG_MASTER)
@@ -390,8 +416,26 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 		buff_len = virtqueue_get_buffer_length(rvdev->svq, idx);
 
 	/* Enqueue buffer on virtqueue. */
-	status = rpmsg_virtio_enqueue_buffer(rvdev, hdr, buff_len, idx);
+	status = rpmsg_virtio_enqueue_buffer(rvdev, RPMSG_LOCATE_HDR(data),
+					     buff_len, idx);
 	RPMSG_ASSERT(status == VQUEUE_SUCCESS, "failed to enqueue buffer\r\n");
+}
+
+static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
+					       uint32_t src, uint32_t dst,
+					       const void *data, int len)
+{
+	struct rpmsg_virtio_device *rvdev;
+	uint16_t idx;
+
+	/* Get the associated remote device for channel. */
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	idx = rpmsg_virtio_fill_tx_hdr(rvdev, src, dst, data, len);
+
+	metal_mutex_acquire(&rdev->lock);
+
+	rpmsg_virtio_enqueue_tx_payload(rvdev, data, idx);
 	/* Let the other side know that there is a job to process. */
 	virtqueue_kick(rvdev->svq);
 
@@ -400,6 +444,58 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 	return len;
 }
 
+/**
+ * rpmsg_virtio_send_offchannel_nocopy_chain
+ *
+ * Sends a chain of TX buffers reserved by rpmsg_virtio_get_tx_payload_buffer()
+ * to the remote device. All the buffers are placed on the send virtqueue under
+ * a single lock acquisition and the other side is notified once.
+ *
+ * @param rdev  - pointer to rpmsg device
+ * @param src   - source address of channel
+ * @param dst   - destination address of channel
+ * @param data  - array of TX payload buffers
+ * @param len   - array of payload sizes
+ * @param count - number of buffers in the chain
+ *
+ * @return - total size of data sent or negative value for failure.
+ */
+static int
+rpmsg_virtio_send_offchannel_nocopy_chain(struct rpmsg_device *rdev,
+					  uint32_t src, uint32_t dst,
+					  void * const *data, const int *len,
+					  int count)
+{
+	struct rpmsg_virtio_device *rvdev;
+	uint16_t idx[RPMSG_TX_CHAIN_MAX];
+	int total = 0;
+	int i;
+
+	if (count > RPMSG_TX_CHAIN_MAX)
+		return RPMSG_ERR_PARAM;
+
+	/* Get the associated remote device for channel. */
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	/* Headers live in the shared buffers, no need to hold the lock */
+	for (i = 0; i < count; i++) {
+		idx[i] = rpmsg_virtio_fill_tx_hdr(rvdev, src, dst, data[i],
+						  len[i]);
+		total += len[i];
+	}
+
+	metal_mutex_acquire(&rdev->lock);
+
+	for (i = 0; i < count; i++)
+		rpmsg_virtio_enqueue_tx_payload(rvdev, data[i], idx[i]);
+	/* One notification for the whole chain. */
+	virtqueue_kick(rvdev->svq);
+
+	metal_mutex_release(&rdev->lock);
+
+	return total;
+}
+
 /**
  * This function sends rpmsg "message" to remote device.
  *
@@ -472,53 +568,87 @@ static void rpmsg_virtio_rx_callback(struct virtqueue *vq)
 	struct rpmsg_virtio_device *rvdev = vdev->priv;
 	struct rpmsg_device *rdev = &rvdev->rdev;
 	struct rpmsg_endpoint *ept;
-	struct rpmsg_hdr *rp_hdr;
-	uint32_t len;
-	uint16_t idx;
+	struct rpmsg_hdr *rp_hdr[RPMSG_RX_BATCH_SIZE];
+	uint32_t len[RPMSG_RX_BATCH_SIZE];
+	uint16_t idx[RPMSG_RX_BATCH_SIZE];
+	int returned = 0;
+	int count;
 	int status;
+	int i;
 
+	/* No need for the other side to notify us while we are draining */
 	metal_mutex_acquire(&rdev->lock);
-
-	/* Process the received data from remote node */
-	rp_hdr = rpmsg_virtio_get_rx_buffer(rvdev, &len, &idx);
-
+	virtqueue_disable_cb(rvdev->rvq);
 	metal_mutex_release(&rdev->lock);
 
-	while (rp_hdr) {
-		rp_hdr->reserved = idx;
-
-		/* Get the channel node from the remote device channels list. */
+	while (1) {
+		/* Dequeue a batch of received buffers from remote node */
 		metal_mutex_acquire(&rdev->lock);
-		ept = rpmsg_get_ept_from_addr(rdev, rp_hdr->dst);
+		for (count = 0; count < RPMSG_RX_BATCH_SIZE; count++) {
+			rp_hdr[count] = rpmsg_virtio_get_rx_buffer(rvdev,
+								   &len[count],
+								   &idx[count]);
+			if (!rp_hdr[count])
+				break;
+			rp_hdr[count]->reserved = idx[count];
+		}
+		if (!count) {
+			/*
+			 * Ring is empty, re-arm the notification. With
+			 * VIRTIO_RING_F_EVENT_IDX the event index is moved to
+			 * what has been consumed so far. Buffers which arrived
+			 * in between are drained without a new interrupt.
+			 */
+			if (!virtqueue_enable_cb(rvdev->rvq)) {
+				/* tell peer we return some rx buffer */
+				if (returned)
+					virtqueue_kick(rvdev->rvq);
+				metal_mutex_release(&rdev->lock);
+				break;
+			}
+			virtqueue_disable_cb(rvdev->rvq);
+			metal_mutex_release(&rdev->lock);
+			continue;
+		}
 		metal_mutex_release(&rdev->lock);
 
-		if (ept) {
+		for (i = 0; i < count; i++) {
+			/*
+			 * Get the channel node from the remote device channels
+			 * list. The lookup is done per message as a previous
+			 * callback may have destroyed the endpoint.
+			 */
+			metal_mutex_acquire(&rdev->lock);
+			ept = rpmsg_get_ept_from_addr(rdev, rp_hdr[i]->dst);
+			metal_mutex_release(&rdev->lock);
+
+			if (!ept)
+				continue;
+
 			if (ept->dest_addr == RPMSG_ADDR_ANY) {
 				/*
 				 * First message received from the remote side,
 				 * update channel destination address
 				 */
-				ept->dest_addr = rp_hdr->src;
+				ept->dest_addr = rp_hdr[i]->src;
 			}
-			status = ept->cb(ept, RPMSG_LOCATE_DATA(rp_hdr),
-					 rp_hdr->len, rp_hdr->src, ept->priv);
+			status = ept->cb(ept, RPMSG_LOCATE_DATA(rp_hdr[i]),
+					 rp_hdr[i]->len, rp_hdr[i]->src,
+					 ept->priv);
 
 			RPMSG_ASSERT(status >= 0,
 				     "unexpected callback status\r\n");
 		}
 
 		metal_mutex_acquire(&rdev->lock);
-
-		/* Check whether callback wants to hold buffer */
-		if (!(rp_hdr->reserved & RPMSG_BUF_HELD)) {
-			/* No, return used buffers. */
-			rpmsg_virtio_return_buffer(rvdev, rp_hdr, len, idx);
-		}
-
-		rp_hdr = rpmsg_virtio_get_rx_buffer(rvdev, &len, &idx);
-		if (!rp_hdr) {
-			/* tell peer we return some rx buffer */
-			virtqueue_kick(rvdev->rvq);
+		for (i = 0; i < count; i++) {
+			/* Check whether callback wants to hold buffer */
+			if (!(rp_hdr[i]->reserved & RPMSG_BUF_HELD)) {
+				/* No, return used buffers. */
+				rpmsg_virtio_return_buffer(rvdev, rp_hdr[i],
+							   len[i], idx[i]);
+				returned++;
+			}
 		}
 		metal_mutex_release(&rdev->lock);
 	}
@@ -628,6 +758,8 @@ int rpmsg_init_vdev(struct rpmsg_virtio_device *rvdev,
 	rdev->ops.release_rx_buffer = rpmsg_virtio_release_rx_buffer;
 	rdev->ops.get_tx_payload_buffer = rpmsg_virtio_get_tx_payload_buffer;
 	rdev->ops.send_offchannel_nocopy = rpmsg_virtio_send_offchannel_nocopy;
+	rdev->ops.send_offchannel_nocopy_chain =
+		rpmsg_virtio_send_offchannel_nocopy_chain;
 	role = rpmsg_virtio_get_role(rvdev);
 
 #ifndef VIRTIO_MASTER_ONLY
@@ -0,0 +1,37 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * CDO IO functions for the host tests built with __AIESIM_ESS__. The CDO
+ * mode is not used by the tests, the writes are dropped.
+ */
+#ifndef CDO_RTS_H
+#define CDO_RTS_H
+
+#include <stdint.h>
+
+static inline void cdo_Write32(uint64_t Addr, uint32_t Data)
+{
+	(void)Addr;
+	(void)Data;
+}
+
+static inline void cdo_MaskWrite32(uint64_t Addr, uint32_t Mask, uint32_t Data)
+{
+	(void)Addr;
+	(void)Mask;
+	(void)Data;
+}
+
+static inline void cdo_MaskPoll(uint64_t Addr, uint32_t Mask, uint32_t Value,
+		uint32_t TimeOutMs)
+{
+	(void)Addr;
+	(void)Mask;
+	(void)Value;
+	(void)TimeOutMs;
+}
+
+#endif /* CDO_RTS_H */
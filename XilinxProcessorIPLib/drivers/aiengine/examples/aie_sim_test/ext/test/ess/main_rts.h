@@ -0,0 +1,22 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ * ESS IO functions for the host tests built with __AIESIM_ESS__. The tests
+ * define them with a register model, in place of the ESS runtime.
+ */
+#ifndef MAIN_RTS_H
+#define MAIN_RTS_H
+
+#include <stdint.h>
+
+uint32_t ess_Read32(uint64_t Addr);
+void ess_Write32(uint64_t Addr, uint32_t Data);
+void ess_WriteCmd(uint8_t Command, uint8_t ColId, uint8_t RowId,
+		uint32_t CmdWd0, uint32_t CmdWd1, uint8_t *CmdStr);
+uint32_t ess_NpiRead32(uint64_t Addr);
+void ess_NpiWrite32(uint64_t Addr, uint32_t Data);
+
+#endif /* MAIN_RTS_H */
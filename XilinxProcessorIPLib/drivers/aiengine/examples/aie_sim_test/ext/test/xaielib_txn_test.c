@@ -0,0 +1,259 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_txn_test.c
+* @{
+*
+* This file contains a host test of the register write transactions of
+* xaielib_txn.c. The IO functions of the AIE library are replaced by stubs
+* accessing a sparse register model, which also counts the device accesses.
+*
+* The test checks the merging of contiguous writes, the dedup of redundant
+* writes and of mask writes, the export and replay of a transaction, the
+* rejection of a corrupted transaction and the flush of a full buffer. It
+* then writes the same register of every tile of a 50x8 array twice and
+* checks that the second pass is dropped, which needs the shadow table to
+* spread the tiles over its slots.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaielib_txn.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TEST_MEM_SIZE	(1U << 16U)	/**< Register model entries */
+#define XAIE_TEST_BUF_WORDS	4096U		/**< Command buffer words */
+#define XAIE_TEST_NUM_COLS	50U
+#define XAIE_TEST_NUM_ROWS	8U
+#define XAIE_TEST_COL_SHIFT	23U
+#define XAIE_TEST_ROW_SHIFT	18U
+#define XAIE_TEST_REGS		1U		/**< Registers per tile */
+#define XAIE_TEST_REG_OFF	0x32000U	/**< Core control register */
+
+#define XAIE_TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+			       __LINE__, #Cond);			\
+			return XAIELIB_FAILURE;				\
+		}							\
+	} while (0)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 Addr;
+	u32 Value;
+	u32 Used;
+} XAieTest_Reg;
+
+/************************** Variable Definitions *****************************/
+static XAieTest_Reg Regs[XAIE_TEST_MEM_SIZE];	/**< Register model */
+static u32 NumAccesses;				/**< Device accesses */
+static XAieLib_Txn Txn;
+static u32 TxnBuf[XAIE_TEST_BUF_WORDS];
+
+/************************** Function Definitions *****************************/
+static XAieTest_Reg *XAieTest_Find(u64 Addr)
+{
+	u32 Idx = (u32)(((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> 48U);
+
+	while ((Regs[Idx].Used != 0U) && (Regs[Idx].Addr != Addr)) {
+		Idx = (Idx + 1U) & (XAIE_TEST_MEM_SIZE - 1U);
+	}
+	Regs[Idx].Addr = Addr;
+	Regs[Idx].Used = 1U;
+
+	return &Regs[Idx];
+}
+
+static u32 XAieTest_Read(u64 Addr)
+{
+	return XAieTest_Find(Addr)->Value;
+}
+
+static void XAieTest_Reset(void)
+{
+	memset(Regs, 0, sizeof(Regs));
+	NumAccesses = 0U;
+}
+
+void XAieLib_IntPrint(const char *Format, ...)
+{
+	(void)Format;
+}
+
+void XAieLib_Write32(u64 Addr, u32 Data)
+{
+	if (XAieLib_TxnActive != NULL) {
+		XAieLib_TxnWrite32(XAieLib_TxnActive, Addr, Data);
+		return;
+	}
+	XAieTest_Find(Addr)->Value = Data;
+	NumAccesses++;
+}
+
+void XAieLib_BlockWrite32(u64 Addr, const u32 *Data, u32 Count)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Count; Idx++) {
+		XAieTest_Find(Addr + (Idx * 4U))->Value = Data[Idx];
+	}
+	NumAccesses++;
+}
+
+void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
+{
+	XAieTest_Reg *Reg;
+
+	if (XAieLib_TxnActive != NULL) {
+		XAieLib_TxnMaskWrite32(XAieLib_TxnActive, Addr, Mask, Data);
+		return;
+	}
+	Reg = XAieTest_Find(Addr);
+	Reg->Value = (Reg->Value & ~Mask) | (Data & Mask);
+	NumAccesses++;
+}
+
+u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
+{
+	(void)TimeOutUs;
+	NumAccesses++;
+	return ((XAieTest_Read(Addr) & Mask) == Value) ?
+		XAIELIB_SUCCESS : XAIELIB_FAILURE;
+}
+
+static u32 XAieTest_MergeDedup(void)
+{
+	u32 NumWords;
+	u32 Idx;
+
+	XAieTest_Reset();
+	XAIE_TEST_CHECK(XAieLib_TxnStart(&Txn, TxnBuf, 64U,
+		XAIELIB_TXN_OPT_DEDUP | XAIELIB_TXN_OPT_EXPORT) ==
+		XAIELIB_SUCCESS);
+	for (Idx = 0U; Idx < 8U; Idx++) {
+		XAieLib_Write32(0x100U + (Idx * 4U), Idx);
+	}
+	/* Redundant, then replaced */
+	XAieLib_Write32(0x100U, 0U);
+	XAieLib_Write32(0x200U, 5U);
+	XAieLib_Write32(0x200U, 6U);
+	/* Known register, unknown register */
+	XAieLib_MaskWrite32(0x100U, 0xF0U, 0x30U);
+	XAieLib_MaskWrite32(0x300U, 0xFU, 0x3U);
+	XAieLib_TxnMaskPoll(&Txn, 0x300U, 0xFU, 0x3U, 10U);
+	XAIE_TEST_CHECK(NumAccesses == 0U);
+	XAIE_TEST_CHECK(XAieLib_TxnStop(&Txn) == XAIELIB_SUCCESS);
+
+	XAIE_TEST_CHECK(XAieLib_TxnExport(&Txn, &NumWords) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(TxnBuf[0U] == XAIELIB_TXN_MAGIC);
+	XAIE_TEST_CHECK(TxnBuf[2U] == NumWords);
+	/* Block of 8, 0x200, 0x100 as plain write, mask write and poll */
+	XAIE_TEST_CHECK(TxnBuf[3U] == 5U);
+	XAIE_TEST_CHECK(Txn.NumDropped == 2U);
+	XAIE_TEST_CHECK(NumAccesses == 5U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x100U) == 0x30U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x11CU) == 7U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x200U) == 6U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x300U) == 3U);
+
+	/* Replay on a cleared model gives the same registers */
+	XAieTest_Reset();
+	XAIE_TEST_CHECK(XAieLib_TxnReplay(TxnBuf, NumWords) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(NumAccesses == 5U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x100U) == 0x30U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x11CU) == 7U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x200U) == 6U);
+	XAIE_TEST_CHECK(XAieTest_Read(0x300U) == 3U);
+
+	/* Corrupted and truncated transactions are rejected */
+	TxnBuf[0U] ^= 1U;
+	XAIE_TEST_CHECK(XAieLib_TxnReplay(TxnBuf, NumWords) == XAIELIB_FAILURE);
+	TxnBuf[0U] ^= 1U;
+	XAIE_TEST_CHECK(XAieLib_TxnReplay(TxnBuf, NumWords - 1U) ==
+		XAIELIB_FAILURE);
+
+	return XAIELIB_SUCCESS;
+}
+
+static u32 XAieTest_FullBuffer(void)
+{
+	u32 Idx;
+
+	/* Non contiguous writes overflow a small buffer, which is flushed */
+	XAieTest_Reset();
+	XAIE_TEST_CHECK(XAieLib_TxnStart(&Txn, TxnBuf, 12U, 0U) ==
+		XAIELIB_SUCCESS);
+	for (Idx = 0U; Idx < 40U; Idx++) {
+		XAieLib_Write32(0x1000U + (Idx * 8U), Idx + 1U);
+	}
+	XAIE_TEST_CHECK(XAieLib_TxnStop(&Txn) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(NumAccesses == 40U);
+	for (Idx = 0U; Idx < 40U; Idx++) {
+		XAIE_TEST_CHECK(XAieTest_Read(0x1000U + (Idx * 8U)) == Idx + 1U);
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+static u32 XAieTest_TileSpread(void)
+{
+	u32 Col, Row, Reg, Pass;
+	u32 NumTiles = XAIE_TEST_NUM_COLS * XAIE_TEST_NUM_ROWS;
+	u64 Addr;
+
+	/* Same register of every tile, second pass must be dropped */
+	XAieTest_Reset();
+	XAIE_TEST_CHECK(XAieLib_TxnStart(&Txn, TxnBuf, XAIE_TEST_BUF_WORDS,
+		XAIELIB_TXN_OPT_DEDUP) == XAIELIB_SUCCESS);
+	for (Pass = 0U; Pass < 2U; Pass++) {
+		for (Col = 0U; Col < XAIE_TEST_NUM_COLS; Col++) {
+			for (Row = 1U; Row <= XAIE_TEST_NUM_ROWS; Row++) {
+				for (Reg = 0U; Reg < XAIE_TEST_REGS; Reg++) {
+					Addr = ((u64)Col << XAIE_TEST_COL_SHIFT) |
+						((u64)Row << XAIE_TEST_ROW_SHIFT) |
+						(XAIE_TEST_REG_OFF + (Reg * 0x10U));
+					XAieLib_Write32(Addr, 1U);
+				}
+			}
+		}
+	}
+	XAIE_TEST_CHECK(XAieLib_TxnStop(&Txn) == XAIELIB_SUCCESS);
+	printf("tile spread: %u writes, %u dropped\n", Txn.NumWrites,
+	       Txn.NumDropped);
+	XAIE_TEST_CHECK(Txn.NumDropped == NumTiles * XAIE_TEST_REGS);
+	XAIE_TEST_CHECK(NumAccesses == NumTiles * XAIE_TEST_REGS);
+
+	return XAIELIB_SUCCESS;
+}
+
+int main(void)
+{
+	if ((XAieTest_MergeDedup() != XAIELIB_SUCCESS) ||
+	    (XAieTest_FullBuffer() != XAIELIB_SUCCESS) ||
+	    (XAieTest_TileSpread() != XAIELIB_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
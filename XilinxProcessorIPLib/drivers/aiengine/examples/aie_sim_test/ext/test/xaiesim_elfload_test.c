@@ -0,0 +1,281 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaiesim_elfload_test.c
+* @{
+*
+* This file contains a host test of the multi tile ELF loader of
+* xaiesim_elfload.c, built with the Linux IO so the columns are loaded by
+* worker threads. The IO functions of the AIE library are replaced by stubs
+* writing a sparse memory model.
+*
+* An ELF with a program section, a data section and a .bss section is built
+* and loaded into 32 tiles of 8 columns, once tile by tile with
+* XAieSim_LoadElf() and once with XAieSim_LoadElfMulti(). The two memory
+* images must be the same. This is done with the data sections crossing into
+* the east banks, so the columns share memory and are loaded one after the
+* other, and with the data sections in the banks of each tile, so the
+* columns are loaded in parallel.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "xaiegbl.h"
+#include "xaiesim.h"
+#include "xaiesim_elfload.h"
+#include "xaielib_txn.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TEST_MEM_SIZE	(1U << 18U)	/**< Memory model entries */
+#define XAIE_TEST_NUM_TILES	32U
+#define XAIE_TEST_NUM_ROWS	4U
+#define XAIE_TEST_COL_SHIFT	23U
+#define XAIE_TEST_ROW_SHIFT	18U
+#define XAIE_TEST_ELF_SIZE	0x4000U		/**< ELF buffer bytes */
+#define XAIE_TEST_TEXT_SIZE	0x1000U
+#define XAIE_TEST_DATA_SIZE	0x2000U
+#define XAIE_TEST_BSS_SIZE	0x400U
+
+#define XAIE_TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+			       __LINE__, #Cond);			\
+			return XAIESIM_FAILURE;				\
+		}							\
+	} while (0)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 Addr;
+	u32 Value;
+	u32 Used;
+} XAieTest_Mem;
+
+/************************** Variable Definitions *****************************/
+XAieGbl_Config XAieGbl_ConfigTable[1U] = {{0U, 0U, 9U, 50U}};
+XAieLib_Txn *XAieLib_TxnActive = NULL;
+
+static XAieTest_Mem Mem[XAIE_TEST_MEM_SIZE];	/**< Memory model */
+static XAieTest_Mem RefMem[XAIE_TEST_MEM_SIZE];	/**< Tile by tile image */
+static pthread_mutex_t MemLock = PTHREAD_MUTEX_INITIALIZER;
+static u32 ElfBuf[XAIE_TEST_ELF_SIZE / 4U];
+static XAieGbl_Tile Tiles[XAIE_TEST_NUM_TILES];
+static XAieGbl_Tile *TilePtrs[XAIE_TEST_NUM_TILES];
+
+/************************** Function Definitions *****************************/
+static XAieTest_Mem *XAieTest_Find(XAieTest_Mem *MemPtr, u64 Addr)
+{
+	u32 Idx = (u32)(((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> 46U);
+
+	while ((MemPtr[Idx].Used != 0U) && (MemPtr[Idx].Addr != Addr)) {
+		Idx = (Idx + 1U) & (XAIE_TEST_MEM_SIZE - 1U);
+	}
+
+	return &MemPtr[Idx];
+}
+
+static void XAieTest_Store(u64 Addr, u32 Data)
+{
+	XAieTest_Mem *Entry = XAieTest_Find(Mem, Addr);
+
+	Entry->Addr = Addr;
+	Entry->Value = Data;
+	Entry->Used = 1U;
+}
+
+void XAieLib_IntPrint(const char *Format, ...)
+{
+	(void)Format;
+}
+
+void XAieLib_Write32(u64 Addr, u32 Data)
+{
+	pthread_mutex_lock(&MemLock);
+	XAieTest_Store(Addr, Data);
+	pthread_mutex_unlock(&MemLock);
+}
+
+void XAieLib_BlockWrite32(u64 Addr, const u32 *Data, u32 Count)
+{
+	u32 Idx;
+
+	pthread_mutex_lock(&MemLock);
+	for (Idx = 0U; Idx < Count; Idx++) {
+		XAieTest_Store(Addr + (Idx * 4U), Data[Idx]);
+	}
+	pthread_mutex_unlock(&MemLock);
+}
+
+/*
+ * Builds an ELF with .text, .data and .bss sections, the data sections at
+ * DataAddr and BssAddr.
+ */
+static u32 XAieTest_BuildElf(u32 DataAddr, u32 BssAddr)
+{
+	static const char StrTab[] = "\0.text\0.data\0.bss\0.shstrtab";
+	u8 *ElfPtr = (u8 *)ElfBuf;
+	Elf32_Ehdr *ElfHdr = (Elf32_Ehdr *)ElfPtr;
+	Elf32_Shdr *SectHdr;
+	u32 TextOff = 0x100U;
+	u32 DataOff = TextOff + XAIE_TEST_TEXT_SIZE;
+	u32 StrOff = DataOff + XAIE_TEST_DATA_SIZE;
+	u32 ShOff = (StrOff + sizeof(StrTab) + 3U) & ~3U;
+	u32 Idx;
+
+	memset(ElfBuf, 0, sizeof(ElfBuf));
+	memcpy(ElfHdr->e_ident, ELFMAG, SELFMAG);
+	ElfHdr->e_ident[EI_CLASS] = ELFCLASS32;
+	ElfHdr->e_shoff = ShOff;
+	ElfHdr->e_shnum = 5U;
+	ElfHdr->e_shstrndx = 4U;
+
+	for (Idx = 0U; Idx < XAIE_TEST_TEXT_SIZE / 4U; Idx++) {
+		ElfBuf[(TextOff / 4U) + Idx] = 0x11000a0bU + (Idx * 3U);
+	}
+	for (Idx = 0U; Idx < XAIE_TEST_DATA_SIZE / 4U; Idx++) {
+		ElfBuf[(DataOff / 4U) + Idx] = 0x22000d07U + (Idx * 5U);
+	}
+	memcpy(ElfPtr + StrOff, StrTab, sizeof(StrTab));
+
+	SectHdr = (Elf32_Shdr *)(ElfPtr + ShOff);
+	SectHdr[1U].sh_name = 1U;
+	SectHdr[1U].sh_type = SHT_PROGBITS;
+	SectHdr[1U].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+	SectHdr[1U].sh_offset = TextOff;
+	SectHdr[1U].sh_size = XAIE_TEST_TEXT_SIZE;
+	SectHdr[2U].sh_name = 7U;
+	SectHdr[2U].sh_type = SHT_PROGBITS;
+	SectHdr[2U].sh_flags = SHF_ALLOC | SHF_WRITE;
+	SectHdr[2U].sh_addr = DataAddr;
+	SectHdr[2U].sh_offset = DataOff;
+	SectHdr[2U].sh_size = XAIE_TEST_DATA_SIZE;
+	SectHdr[3U].sh_name = 13U;
+	SectHdr[3U].sh_type = SHT_NOBITS;
+	SectHdr[3U].sh_flags = SHF_ALLOC | SHF_WRITE;
+	SectHdr[3U].sh_addr = BssAddr;
+	SectHdr[3U].sh_size = XAIE_TEST_BSS_SIZE;
+	SectHdr[4U].sh_name = 18U;
+	SectHdr[4U].sh_type = SHT_STRTAB;
+	SectHdr[4U].sh_offset = StrOff;
+	SectHdr[4U].sh_size = sizeof(StrTab);
+
+	return ShOff + (5U * sizeof(Elf32_Shdr));
+}
+
+static u32 XAieTest_Compare(void)
+{
+	XAieTest_Mem *Entry;
+	u32 NumRef = 0U;
+	u32 Num = 0U;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XAIE_TEST_MEM_SIZE; Idx++) {
+		Num += Mem[Idx].Used;
+		if (RefMem[Idx].Used == 0U) {
+			continue;
+		}
+		NumRef++;
+		Entry = XAieTest_Find(Mem, RefMem[Idx].Addr);
+		if ((Entry->Used == 0U) ||
+		    (Entry->Value != RefMem[Idx].Value)) {
+			printf("0x%llx: 0x%x, expected 0x%x\n",
+			       (unsigned long long)RefMem[Idx].Addr,
+			       Entry->Value, RefMem[Idx].Value);
+			return XAIESIM_FAILURE;
+		}
+	}
+	XAIE_TEST_CHECK(Num == NumRef);
+	printf("%u words match\n", Num);
+
+	return XAIESIM_SUCCESS;
+}
+
+static u32 XAieTest_LoadMulti(const char *Name, u32 DataAddr, u32 BssAddr)
+{
+	char Path[] = "/tmp/xaiesim_elfload_testXXXXXX";
+	XAieSim_ElfImage Img;
+	uint64_t TileUs[XAIE_TEST_NUM_TILES];
+	uint64_t TotalUs;
+	u32 ElfSize;
+	u32 Idx;
+	FILE *Fd;
+	int FdNum;
+
+	ElfSize = XAieTest_BuildElf(DataAddr, BssAddr);
+	FdNum = mkstemp(Path);
+	XAIE_TEST_CHECK(FdNum >= 0);
+	Fd = fdopen(FdNum, "wb");
+	XAIE_TEST_CHECK(Fd != NULL);
+	XAIE_TEST_CHECK(fwrite(ElfBuf, 1U, ElfSize, Fd) == ElfSize);
+	fclose(Fd);
+
+	/* Reference, tile by tile */
+	memset(Mem, 0, sizeof(Mem));
+	for (Idx = 0U; Idx < XAIE_TEST_NUM_TILES; Idx++) {
+		XAIE_TEST_CHECK(XAieSim_LoadElf(&Tiles[Idx], (uint8 *)Path,
+			0U) == XAIESIM_SUCCESS);
+	}
+	memcpy(RefMem, Mem, sizeof(Mem));
+
+	memset(Mem, 0, sizeof(Mem));
+	XAIE_TEST_CHECK(XAieSim_ElfParse(&Img, (uint8 *)Path) ==
+		XAIESIM_SUCCESS);
+	unlink(Path);
+	XAIE_TEST_CHECK(Img.NumSegs == 3U);
+	XAIE_TEST_CHECK(Img.NumBytes == XAIE_TEST_TEXT_SIZE +
+		XAIE_TEST_DATA_SIZE + XAIE_TEST_BSS_SIZE);
+	XAIE_TEST_CHECK(XAieSim_LoadElfMulti(TilePtrs, XAIE_TEST_NUM_TILES,
+		&Img, TileUs, &TotalUs) == XAIESIM_SUCCESS);
+	XAieSim_ElfFree(&Img);
+
+	printf("%s: %llu us for %u tiles, ", Name,
+	       (unsigned long long)TotalUs, XAIE_TEST_NUM_TILES);
+
+	return XAieTest_Compare();
+}
+
+int main(void)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XAIE_TEST_NUM_TILES; Idx++) {
+		Tiles[Idx].ColId = Idx / XAIE_TEST_NUM_ROWS;
+		Tiles[Idx].RowId = 1U + (Idx % XAIE_TEST_NUM_ROWS);
+		Tiles[Idx].TileAddr =
+			((u64)Tiles[Idx].ColId << XAIE_TEST_COL_SHIFT) |
+			((u64)Tiles[Idx].RowId << XAIE_TEST_ROW_SHIFT);
+		TilePtrs[Idx] = &Tiles[Idx];
+	}
+
+	/* Sections crossing into the east banks, then in the own banks */
+	if ((XAieTest_LoadMulti("shared banks", 0x3F000U, 0x47F00U) !=
+	     XAIESIM_SUCCESS) ||
+	    (XAieTest_LoadMulti("own banks", 0x21000U, 0x31000U) !=
+	     XAIESIM_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
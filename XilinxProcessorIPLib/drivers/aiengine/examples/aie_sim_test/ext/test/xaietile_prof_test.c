@@ -0,0 +1,361 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof_test.c
+* @{
+*
+* This file contains a host test of the profiling service of
+* xaietile_prof.c, run against the simulation IO in ESS mode. The ESS
+* functions are defined here with a sparse register model. The performance
+* counters advance by a fixed step on every read, and the event status
+* registers are write-1-to-clear.
+*
+* The test checks the counter control and group registers set for the
+* kernel metrics, the metrics between two samples, the capture and clear of
+* the sampled events, the dropped samples of a full ring, a consumer reading
+* the ring while the sampling thread fills it, the CSV and Chrome trace
+* export, and the generic counter setup.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "xaiegbl.h"
+#include "xaiegbl_params.h"
+#include "xaietile_event.h"
+#include "xaietile_perfcnt.h"
+#include "xaietile_prof.h"
+#include "main_rts.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TEST_MEM_SIZE	(1U << 16U)	/**< Register model entries */
+#define XAIE_TEST_REG_MASK	0x3FFFFU	/**< Register offset in tile */
+#define XAIE_TEST_NUM_TILES	8U		/**< Shim and core tiles */
+#define XAIE_TEST_RING_SIZE	64U
+#define XAIE_TEST_BUF_SIZE	4096U
+#define XAIE_TEST_COL_SHIFT	23U
+#define XAIE_TEST_ROW_SHIFT	18U
+
+#define XAIE_TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+			       __LINE__, #Cond);			\
+			return XAIELIB_FAILURE;				\
+		}							\
+	} while (0)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 Addr;
+	u32 Value;
+	u32 Used;
+} XAieTest_Reg;
+
+/************************** Variable Definitions *****************************/
+static XAieTest_Reg Regs[XAIE_TEST_MEM_SIZE];	/**< Register model */
+static pthread_mutex_t RegLock = PTHREAD_MUTEX_INITIALIZER;
+static XAieGbl_Tile Tiles[XAIE_TEST_NUM_TILES];
+static XAieGbl_Tile *TilePtrs[XAIE_TEST_NUM_TILES];
+static XAieTileProf_Record Ring[XAIE_TEST_RING_SIZE];
+static XAieTileProf_Record Buf[XAIE_TEST_BUF_SIZE];
+static XAieTileProf Prof;
+
+/************************** Function Definitions *****************************/
+static u32 *XAieTest_Find(u64 Addr)
+{
+	u32 Idx = (u32)(((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> 48U);
+
+	while ((Regs[Idx].Used != 0U) && (Regs[Idx].Addr != Addr)) {
+		Idx = (Idx + 1U) & (XAIE_TEST_MEM_SIZE - 1U);
+	}
+	Regs[Idx].Addr = Addr;
+	Regs[Idx].Used = 1U;
+
+	return &Regs[Idx].Value;
+}
+
+/* Step of a performance counter on each read, 0 for other registers */
+static u32 XAieTest_CounterStep(u64 Off)
+{
+	switch (Off) {
+	case XAIEGBL_CORE_PERCOU0:
+		return 1000U;
+	case XAIEGBL_CORE_PERCOU1:
+		return 600U;
+	case XAIEGBL_CORE_PERCOU2:
+		return 300U;
+	case XAIEGBL_CORE_PERCOU3:
+		return 100U;
+	case XAIEGBL_MEM_PERCOU0:
+		return 50U;
+	case XAIEGBL_MEM_PERCOU1:
+		return 250U;
+	default:
+		return 0U;
+	}
+}
+
+static u32 XAieTest_Peek(u64 Addr)
+{
+	u32 Value;
+
+	pthread_mutex_lock(&RegLock);
+	Value = *XAieTest_Find(Addr);
+	pthread_mutex_unlock(&RegLock);
+
+	return Value;
+}
+
+static void XAieTest_Poke(u64 Addr, u32 Value)
+{
+	pthread_mutex_lock(&RegLock);
+	*XAieTest_Find(Addr) = Value;
+	pthread_mutex_unlock(&RegLock);
+}
+
+uint32_t ess_Read32(uint64_t Addr)
+{
+	u32 *RegPtr;
+	u32 Value;
+
+	pthread_mutex_lock(&RegLock);
+	RegPtr = XAieTest_Find(Addr);
+	Value = *RegPtr;
+	*RegPtr += XAieTest_CounterStep(Addr & XAIE_TEST_REG_MASK);
+	pthread_mutex_unlock(&RegLock);
+
+	return Value;
+}
+
+void ess_Write32(uint64_t Addr, uint32_t Data)
+{
+	u64 Off = Addr & XAIE_TEST_REG_MASK;
+	u32 *RegPtr;
+
+	pthread_mutex_lock(&RegLock);
+	RegPtr = XAieTest_Find(Addr);
+	if ((Off >= XAIEGBL_CORE_EVTSTA0) &&
+	    (Off < XAIEGBL_CORE_EVTSTA0 + 0x10U)) {
+		*RegPtr &= ~Data;
+	} else {
+		*RegPtr = Data;
+	}
+	pthread_mutex_unlock(&RegLock);
+}
+
+void ess_WriteCmd(uint8_t Command, uint8_t ColId, uint8_t RowId,
+		uint32_t CmdWd0, uint32_t CmdWd1, uint8_t *CmdStr)
+{
+	(void)Command;
+	(void)ColId;
+	(void)RowId;
+	(void)CmdWd0;
+	(void)CmdWd1;
+	(void)CmdStr;
+}
+
+uint32_t ess_NpiRead32(uint64_t Addr)
+{
+	(void)Addr;
+	return 0U;
+}
+
+void ess_NpiWrite32(uint64_t Addr, uint32_t Data)
+{
+	(void)Addr;
+	(void)Data;
+}
+
+/* Counts the lines of an exported file and checks its first character */
+static u32 XAieTest_CheckFile(const char *File, char First, u32 *NumLines)
+{
+	FILE *Fd;
+	int Ch;
+	int Prev = '\n';
+
+	Fd = fopen(File, "r");
+	XAIE_TEST_CHECK(Fd != NULL);
+	XAIE_TEST_CHECK(fgetc(Fd) == First);
+	rewind(Fd);
+	*NumLines = 0U;
+	while ((Ch = fgetc(Fd)) != EOF) {
+		if (Ch == '\n') {
+			(*NumLines)++;
+		}
+		Prev = Ch;
+	}
+	fclose(Fd);
+	unlink(File);
+	XAIE_TEST_CHECK(Prev == '\n');
+
+	return XAIELIB_SUCCESS;
+}
+
+static u32 XAieTest_Kernel(void)
+{
+	XAieTileProf_KernelMetrics Metrics;
+	u8 Events[2U] = {XAIETILE_EVENT_CORE_INSTR_ERROR,
+		XAIETILE_EVENT_CORE_LOCK_STALL};
+	u64 EvtSta = Tiles[3U].TileAddr + XAIEGBL_CORE_EVTSTA0 +
+		((Events[0U] / 32U) * 4U);
+	char File[] = "/tmp/xaietile_prof_testXXXXXX";
+	u32 NumLines;
+	u32 Num;
+	u32 Idx;
+	int FdNum;
+
+	XAIE_TEST_CHECK(XAieTileProf_Initialize(&Prof, TilePtrs,
+		XAIE_TEST_NUM_TILES, Ring, 48U) == XAIELIB_FAILURE);
+	XAIE_TEST_CHECK(XAieTileProf_Initialize(&Prof, TilePtrs,
+		XAIE_TEST_NUM_TILES, Ring, XAIE_TEST_RING_SIZE) ==
+		XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(XAieTileProf_ConfigureKernel(&Prof) ==
+		XAIELIB_SUCCESS);
+	/* Stall group of the core: memory, stream, cascade and lock stalls */
+	XAIE_TEST_CHECK(XAieTest_Peek(Tiles[1U].TileAddr +
+		XAIEGBL_CORE_EVTGRP0ENA + 8U) == 0xFU);
+
+	XAIE_TEST_CHECK(XAieTileProf_SetEvents(&Prof, Events, 2U) ==
+		XAIELIB_SUCCESS);
+	XAieTest_Poke(EvtSta, 1U << (Events[0U] % 32U));
+	for (Idx = 0U; Idx < 3U; Idx++) {
+		XAIE_TEST_CHECK(XAieTileProf_Sample(&Prof, 1000U * Idx) ==
+			XAIELIB_SUCCESS);
+	}
+	Num = XAieTileProf_Read(&Prof, Buf, XAIE_TEST_BUF_SIZE);
+	XAIE_TEST_CHECK(Num == 3U * XAIE_TEST_NUM_TILES);
+	XAIE_TEST_CHECK(Buf[3U].Events == 1U);
+	XAIE_TEST_CHECK(Buf[XAIE_TEST_NUM_TILES + 3U].Events == 0U);
+	XAIE_TEST_CHECK(XAieTest_Peek(EvtSta) == 0U);
+
+	XAieTileProf_KernelMetricsGet(&Buf[1U], &Buf[XAIE_TEST_NUM_TILES + 1U],
+		&Metrics);
+	XAIE_TEST_CHECK((Metrics.Cycles == 1000U) && (Metrics.Active == 600U) &&
+		(Metrics.Stall == 300U) && (Metrics.LockWait == 100U) &&
+		(Metrics.S2mmIdle == 50U) && (Metrics.Mm2sIdle == 250U));
+	/* The shim tile has no core counters */
+	XAIE_TEST_CHECK(Buf[0U].Cnt[XAIETILEPROF_KERNEL_CYCLES] == 0U);
+
+	FdNum = mkstemp(File);
+	XAIE_TEST_CHECK(FdNum >= 0);
+	close(FdNum);
+	XAIE_TEST_CHECK(XAieTileProf_Export(&Prof, Buf, Num, File,
+		XAIETILEPROF_FORMAT_CSV) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(XAieTest_CheckFile(File, 's', &NumLines) ==
+		XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(NumLines == Num + 1U);
+	XAIE_TEST_CHECK(XAieTileProf_Export(&Prof, Buf, Num, File,
+		XAIETILEPROF_FORMAT_CHROME) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(XAieTest_CheckFile(File, '[', &NumLines) ==
+		XAIELIB_SUCCESS);
+
+	/* A full ring drops the new samples */
+	for (Idx = 0U; Idx < 10U; Idx++) {
+		(void)XAieTileProf_Sample(&Prof, Idx);
+	}
+	XAIE_TEST_CHECK(Prof.Dropped ==
+		(10U * XAIE_TEST_NUM_TILES) - XAIE_TEST_RING_SIZE);
+	XAIE_TEST_CHECK(XAieTileProf_Read(&Prof, Buf, XAIE_TEST_BUF_SIZE) ==
+		XAIE_TEST_RING_SIZE);
+
+	return XAIELIB_SUCCESS;
+}
+
+static u32 XAieTest_Thread(void)
+{
+	u32 Dropped = Prof.Dropped;
+	u32 LastSeq = 0U;
+	u32 Total = 0U;
+	u32 Num;
+	u32 Loop;
+	u32 Idx;
+
+	XAIE_TEST_CHECK(XAieTileProf_Start(&Prof, 500U) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(XAieTileProf_Start(&Prof, 500U) == XAIELIB_FAILURE);
+	for (Loop = 0U; Loop < 200U; Loop++) {
+		Num = XAieTileProf_Read(&Prof, Buf, XAIE_TEST_BUF_SIZE);
+		for (Idx = 0U; Idx < Num; Idx++) {
+			XAIE_TEST_CHECK(Buf[Idx].Seq >= LastSeq);
+			LastSeq = Buf[Idx].Seq;
+		}
+		Total += Num;
+		usleep(200U);
+	}
+	XAieTileProf_Stop(&Prof);
+	Total += XAieTileProf_Read(&Prof, Buf, XAIE_TEST_BUF_SIZE);
+
+	printf("thread: %u records, %u dropped\n", Total,
+	       Prof.Dropped - Dropped);
+	XAIE_TEST_CHECK((Total > 0U) && ((Total % XAIE_TEST_NUM_TILES) == 0U));
+
+	return XAIELIB_SUCCESS;
+}
+
+static u32 XAieTest_Generic(void)
+{
+	XAieTileProf_Counter Cnt = {XAIETILEPROF_MODULE_MEM, 1U,
+		XAIETILE_EVENT_MEM_TRUE, XAIETILE_EVENT_MEM_TRUE,
+		XAIETILE_PERFCNT_EVENT_INVALID};
+	XAieTileProf_Counter Bad = {XAIETILEPROF_MODULE_MEM, 2U, 1U, 1U, 0U};
+	u32 Num;
+
+	XAIE_TEST_CHECK(XAieTileProf_Configure(&Prof, &Cnt, 1U) ==
+		XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(XAieTileProf_Sample(&Prof, 1U) == XAIELIB_SUCCESS);
+	XAIE_TEST_CHECK(XAieTileProf_Sample(&Prof, 2U) == XAIELIB_SUCCESS);
+	Num = XAieTileProf_Read(&Prof, Buf, XAIE_TEST_BUF_SIZE);
+	XAIE_TEST_CHECK(Num == 2U * XAIE_TEST_NUM_TILES);
+	XAIE_TEST_CHECK(Buf[XAIE_TEST_NUM_TILES + 1U].Cnt[0U] -
+		Buf[1U].Cnt[0U] == 250U);
+	/* The memory module has 2 counters */
+	XAIE_TEST_CHECK(XAieTileProf_Configure(&Prof, &Bad, 1U) ==
+		XAIELIB_FAILURE);
+
+	return XAIELIB_SUCCESS;
+}
+
+int main(void)
+{
+	u32 Idx;
+
+	/* Shim and core tile in each column */
+	for (Idx = 0U; Idx < XAIE_TEST_NUM_TILES; Idx++) {
+		Tiles[Idx].ColId = Idx / 2U;
+		Tiles[Idx].RowId = Idx % 2U;
+		Tiles[Idx].TileType = (Tiles[Idx].RowId != 0U) ?
+			XAIEGBL_TILE_TYPE_AIETILE : XAIEGBL_TILE_TYPE_SHIMNOC;
+		Tiles[Idx].TileAddr =
+			((u64)Tiles[Idx].ColId << XAIE_TEST_COL_SHIFT) |
+			((u64)Tiles[Idx].RowId << XAIE_TEST_ROW_SHIFT);
+		TilePtrs[Idx] = &Tiles[Idx];
+	}
+
+	if ((XAieTest_Kernel() != XAIELIB_SUCCESS) ||
+	    (XAieTest_Thread() != XAIELIB_SUCCESS) ||
+	    (XAieTest_Generic() != XAIELIB_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
@@ -28,22 +28,52 @@
 * 1.8  Hyun    09/13/2019  Added XAieSim_LoadElfMem()
 * 1.9  Tejus   12/04/2019  Support for new .bss/.data section prefixes in elf
 * 2.0  Nishad  02/03/2020  Added support for non-standard ELF sections
+* 2.1  kc      10/18/2026  Added the parsed ELF image and the multi tile loader
 * </pre>
 *
 ******************************************************************************/
 
 /***************************** Include Files *********************************/
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "xaiesim.h"
 #include "xaiesim_elfload.h"
+#include "xaielib_txn.h"
+
+/*
+ * The columns are loaded in parallel only with the Linux IO, as the
+ * simulator IO is not thread safe.
+ */
+#if !defined(__AIESIM__) && defined(__linux__)
+#define XAIESIM_ELF_USE_THREADS
+#include <pthread.h>
+#endif
 
 /************************** Constant Definitions *****************************/
+#define XAIESIM_ELF_DMB_SIZE			0x8000U	/* 32 KB bank */
+#define XAIESIM_ELF_ZERO_WORDS			256U
+
+/**************************** Type Definitions *******************************/
+/**
+ * This typedef contains the work of one column of XAieSim_LoadElfMulti().
+ */
+typedef struct {
+	XAieSim_Tile **TilePtrs;		/**< All the target tiles */
+	uint32 NumTiles;			/**< Number of target tiles */
+	u16 ColId;				/**< Column of this worker */
+	const XAieSim_ElfImage *ImgPtr;		/**< Image to load */
+	uint64_t *TileUs;			/**< Per tile time, or NULL */
+	uint32 Status;				/**< Load status */
+} XAieSim_ElfWork;
 
 /************************** Variable Definitions *****************************/
 extern XAieGbl_Config XAieGbl_ConfigTable[];
 
+static const uint32 XAieSim_ElfZero[XAIESIM_ELF_ZERO_WORDS];
+
 /************************** Function Prototypes  *****************************/
 
 /************************** Function Definitions *****************************/
@@ -801,5 +831,519 @@ uint64_t XAieSim_GetTargetTileAddr(XAieSim_Tile *TileInstPtr, uint32 ShAddr)
 	return TgtTileAddr;
 }
 
-/** @} */
+/*****************************************************************************/
+/**
+*
+* This routine returns the monotonic time in micro seconds.
+*
+* @return	Time in micro seconds.
+*
+* @note		None.
+*
+*******************************************************************************/
+static uint64_t XAieSim_ElfTimeUs(void)
+{
+	struct timespec Ts;
 
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((uint64_t)Ts.tv_sec * 1000000U) + ((uint64_t)Ts.tv_nsec / 1000U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the API to parse an ELF in memory into a list of loadable sections.
+* The image can then be loaded into any number of tiles without parsing the
+* ELF again.
+*
+* @param	ImgPtr: Pointer to the image to fill.
+* @param	ElfPtr: Pointer to the ELF in memory. It must stay valid as long
+*		as the image is used.
+*
+* @return	XAIESIM_SUCCESS on success, else XAIESIM_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+uint32 XAieSim_ElfParseMem(XAieSim_ElfImage *ImgPtr, uint8 *ElfPtr)
+{
+	Elf32_Ehdr *ElfHdr = (Elf32_Ehdr *)ElfPtr;
+	Elf32_Shdr *SectHdr;
+	XAieSim_ElfSeg *SegPtr;
+	uint32 Count;
+
+	if(ImgPtr == XAIE_NULL || ElfPtr == XAIE_NULL) {
+		return XAIESIM_FAILURE;
+	}
+
+	memset(ImgPtr, 0, sizeof(*ImgPtr));
+	if(memcmp(ElfHdr->e_ident, ELFMAG, SELFMAG) != 0 ||
+			ElfHdr->e_ident[EI_CLASS] != ELFCLASS32) {
+		XAieSim_print("ERROR: Invalid ELF header\n");
+		return XAIESIM_FAILURE;
+	}
+
+	ImgPtr->ElfPtr = ElfPtr;
+	SectHdr = (Elf32_Shdr *)(ElfPtr + ElfHdr->e_shoff);
+
+	for(Count = 0U; Count < ElfHdr->e_shnum; Count++) {
+		if(ImgPtr->NumSegs == XAIESIM_ELF_SECTION_NUMMAX) {
+			XAieSim_print("ERROR: Too many ELF sections\n");
+			return XAIESIM_FAILURE;
+		}
+		SegPtr = &ImgPtr->Segs[ImgPtr->NumSegs];
+
+		if(SectHdr[Count].sh_type == SHT_PROGBITS &&
+				SectHdr[Count].sh_flags) {
+			if(SectHdr[Count].sh_flags == SHF_ALLOC ||
+					SectHdr[Count].sh_flags ==
+					(SHF_ALLOC | SHF_WRITE)) {
+				SegPtr->Type = XAIESIM_ELF_SEG_DATMEM;
+			} else if(SectHdr[Count].sh_flags ==
+					(SHF_ALLOC | SHF_EXECINSTR)) {
+				SegPtr->Type = XAIESIM_ELF_SEG_PRGMEM;
+			} else {
+				XAieSim_print("ERROR: Invalid section %d with flag value of 0x%x\n",
+						Count, SectHdr[Count].sh_flags);
+				continue;
+			}
+			SegPtr->Data = (const uint32 *)(ElfPtr +
+					SectHdr[Count].sh_offset);
+		} else if(SectHdr[Count].sh_type == SHT_NOBITS &&
+				SectHdr[Count].sh_addr > 0x1FFFFU) {
+			SegPtr->Type = XAIESIM_ELF_SEG_BSS;
+			SegPtr->Data = XAIE_NULL;
+		} else {
+			continue;
+		}
+
+		/* Use 32 bit loads to match sim output */
+		SegPtr->Addr = SectHdr[Count].sh_addr;
+		SegPtr->Size = (SectHdr[Count].sh_size + 3U) & ~3U;
+		ImgPtr->NumBytes += SegPtr->Size;
+		ImgPtr->NumSegs++;
+	}
+
+	XAieSim_print("Parsed ELF: %d sections, %d bytes per tile\n",
+			ImgPtr->NumSegs, ImgPtr->NumBytes);
+
+	return XAIESIM_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the API to read an ELF file and parse it with XAieSim_ElfParseMem().
+* On the simulator, the stack range is also read from the map file.
+*
+* @param	ImgPtr: Pointer to the image to fill.
+* @param	ElfPath: Path to the ELF file.
+*
+* @return	XAIESIM_SUCCESS on success, else XAIESIM_FAILURE.
+*
+* @note		The image must be released with XAieSim_ElfFree().
+*
+*******************************************************************************/
+uint32 XAieSim_ElfParse(XAieSim_ElfImage *ImgPtr, uint8 *ElfPath)
+{
+	FILE *Fd;
+	uint8 *ElfPtr;
+	long Size;
+	uint32 Status;
+#ifdef __AIESIM__
+	uint8 MapPath[256U];
+	XAieSim_StackSz StackSz;
+#endif
+
+	Fd = fopen((const char *)ElfPath, "rb");
+	if(Fd == NULL) {
+		XAieSim_print("ERROR: Invalid ELF file\n");
+		return XAIESIM_FAILURE;
+	}
+
+	fseek(Fd, 0L, SEEK_END);
+	Size = ftell(Fd);
+	fseek(Fd, 0L, SEEK_SET);
+	if(Size < (long)sizeof(Elf32_Ehdr)) {
+		fclose(Fd);
+		return XAIESIM_FAILURE;
+	}
+
+	/* Allocate as words, so the section data can be read as words */
+	ElfPtr = (uint8 *)malloc(((size_t)Size + 3U) & ~(size_t)3U);
+	if(ElfPtr == NULL || fread(ElfPtr, 1U, (size_t)Size, Fd) !=
+			(size_t)Size) {
+		XAieSim_print("ERROR: Failed to read the ELF file\n");
+		free(ElfPtr);
+		fclose(Fd);
+		return XAIESIM_FAILURE;
+	}
+	fclose(Fd);
+
+	Status = XAieSim_ElfParseMem(ImgPtr, ElfPtr);
+	if(Status != XAIESIM_SUCCESS) {
+		free(ElfPtr);
+		return Status;
+	}
+	ImgPtr->IsOwned = 1U;
+
+#ifdef __AIESIM__
+	if(strlen((const char *)ElfPath) + sizeof(".map") <=
+			sizeof(MapPath)) {
+		strcpy((char *)MapPath, (const char *)ElfPath);
+		strcat((char *)MapPath, ".map");
+		if(XAieSim_GetStackRange(MapPath, &StackSz) ==
+				XAIESIM_SUCCESS) {
+			ImgPtr->Stack = StackSz;
+			ImgPtr->HasStack = 1U;
+		}
+	}
+#endif
+
+	return XAIESIM_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the API to release an image parsed by XAieSim_ElfParse().
+*
+* @param	ImgPtr: Pointer to the image.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieSim_ElfFree(XAieSim_ElfImage *ImgPtr)
+{
+	if(ImgPtr != XAIE_NULL && ImgPtr->IsOwned) {
+		free(ImgPtr->ElfPtr);
+	}
+	if(ImgPtr != XAIE_NULL) {
+		memset(ImgPtr, 0, sizeof(*ImgPtr));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine writes a range of the data memory seen by a tile. The range is
+* split at the 32 KB bank boundaries, as each bank may belong to a
+* neighbouring tile.
+*
+* @param	TileInstPtr: Pointer to the Tile instance structure.
+* @param	Addr: Load address of the range.
+* @param	Data: Data of the range, NULL to zero it.
+* @param	Size: Size of the range in bytes, multiple of 4.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void XAieSim_ElfWriteDataMem(XAieSim_Tile *TileInstPtr, uint32 Addr,
+		const uint32 *Data, uint32 Size)
+{
+	uint32 DmbOff;
+	uint32 Chunk;
+	uint32 Words;
+	uint64_t TgtTileAddr;
+
+	while(Size > 0U) {
+		DmbOff = Addr & XAIESIM_ELF_TILEADDR_DMB_MASK;
+		Chunk = XAIESIM_ELF_DMB_SIZE - DmbOff;
+		if(Chunk > Size) {
+			Chunk = Size;
+		}
+
+		TgtTileAddr = XAieSim_GetTargetTileAddr(TileInstPtr, Addr) +
+			XAIESIM_ELF_TILECORE_DATMEM + DmbOff;
+		if(Data != XAIE_NULL) {
+			XAieLib_BlockWrite32(TgtTileAddr, Data, Chunk / 4U);
+			Data += Chunk / 4U;
+		} else {
+			for(Words = 0U; Words < Chunk / 4U;
+					Words += XAIESIM_ELF_ZERO_WORDS) {
+				XAieLib_BlockWrite32(TgtTileAddr + Words * 4U,
+					XAieSim_ElfZero,
+					(Chunk / 4U - Words) <
+					XAIESIM_ELF_ZERO_WORDS ?
+					(Chunk / 4U - Words) :
+					XAIESIM_ELF_ZERO_WORDS);
+			}
+		}
+
+		Addr += Chunk;
+		Size -= Chunk;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the API to load a parsed ELF image into a tile. It does the same as
+* XAieSim_LoadElfMem() without parsing the ELF.
+*
+* @param	TileInstPtr - Pointer to the Tile instance structure.
+* @param	ImgPtr: Pointer to the parsed image.
+*
+* @return	XAIESIM_SUCCESS on success, else XAIESIM_FAILURE.
+*
+* @note		Symbols are not loaded to the simulator.
+*
+*******************************************************************************/
+uint32 XAieSim_LoadElfImage(XAieSim_Tile *TileInstPtr,
+		const XAieSim_ElfImage *ImgPtr)
+{
+	const XAieSim_ElfSeg *SegPtr;
+	uint32 Idx;
+
+	if(TileInstPtr == XAIE_NULL || ImgPtr == XAIE_NULL ||
+			ImgPtr->ElfPtr == XAIE_NULL) {
+		return XAIESIM_FAILURE;
+	}
+
+#ifdef __AIESIM__
+	if(ImgPtr->HasStack) {
+		XAieSim_WriteCmd(XAIESIM_CMDIO_CMD_SETSTACK, TileInstPtr->ColId,
+			TileInstPtr->RowId, ImgPtr->Stack.start,
+			ImgPtr->Stack.end, XAIE_NULL);
+	}
+#endif
+
+	for(Idx = 0U; Idx < ImgPtr->NumSegs; Idx++) {
+		SegPtr = &ImgPtr->Segs[Idx];
+		if(SegPtr->Type == XAIESIM_ELF_SEG_PRGMEM) {
+			XAieLib_BlockWrite32(TileInstPtr->TileAddr +
+					XAIESIM_ELF_TILECORE_PRGMEM +
+					SegPtr->Addr, SegPtr->Data,
+					SegPtr->Size / 4U);
+		} else {
+			XAieSim_ElfWriteDataMem(TileInstPtr, SegPtr->Addr,
+					SegPtr->Data, SegPtr->Size);
+		}
+	}
+
+	return XAIESIM_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine loads the image into the tiles of one column.
+*
+* @param	Arg: Pointer to the XAieSim_ElfWork of the column.
+*
+* @return	NULL.
+*
+* @note		Runs in a worker thread with the Linux IO.
+*
+*******************************************************************************/
+static void *XAieSim_ElfLoadColumn(void *Arg)
+{
+	XAieSim_ElfWork *WorkPtr = (XAieSim_ElfWork *)Arg;
+	uint64_t Start;
+	uint32 Idx;
+
+	WorkPtr->Status = XAIESIM_SUCCESS;
+	for(Idx = 0U; Idx < WorkPtr->NumTiles; Idx++) {
+		if(WorkPtr->TilePtrs[Idx]->ColId != WorkPtr->ColId) {
+			continue;
+		}
+
+		Start = XAieSim_ElfTimeUs();
+		if(XAieSim_LoadElfImage(WorkPtr->TilePtrs[Idx],
+					WorkPtr->ImgPtr) != XAIESIM_SUCCESS) {
+			WorkPtr->Status = XAIESIM_FAILURE;
+		}
+		if(WorkPtr->TileUs != XAIE_NULL) {
+			WorkPtr->TileUs[Idx] = XAieSim_ElfTimeUs() - Start;
+		}
+	}
+
+	return NULL;
+}
+
+#ifdef XAIESIM_ELF_USE_THREADS
+/*****************************************************************************/
+/**
+*
+* This routine checks if a tile writes the data memory of a tile in another
+* of the columns to load. Loading such columns in parallel would change the
+* order of the writes to the shared memory banks.
+*
+* @param	WorkPtr: Array of the work items, one per column.
+* @param	NumWork: Number of work items.
+* @param	ImgPtr: Pointer to the parsed image.
+*
+* @return	1 if the columns share data memory banks, else 0.
+*
+* @note		None.
+*
+*******************************************************************************/
+static uint8 XAieSim_ElfColumnsShared(const XAieSim_ElfWork *WorkPtr,
+		uint32 NumWork, const XAieSim_ElfImage *ImgPtr)
+{
+	XAieSim_Tile *TilePtr;
+	const XAieSim_ElfSeg *SegPtr;
+	uint64_t TileCol;
+	uint64_t TgtCol;
+	uint32 Idx, SegIdx, WorkIdx;
+	uint32 Addr;
+
+	for(Idx = 0U; Idx < WorkPtr->NumTiles; Idx++) {
+		TilePtr = WorkPtr->TilePtrs[Idx];
+		TileCol = TilePtr->TileAddr >> XAIESIM_ELF_TILEADDR_COL_SHIFT;
+
+		for(SegIdx = 0U; SegIdx < ImgPtr->NumSegs; SegIdx++) {
+			SegPtr = &ImgPtr->Segs[SegIdx];
+			if(SegPtr->Type == XAIESIM_ELF_SEG_PRGMEM) {
+				continue;
+			}
+
+			/* Check each bank the section is in */
+			for(Addr = SegPtr->Addr &
+					~XAIESIM_ELF_TILEADDR_DMB_MASK;
+					Addr < SegPtr->Addr + SegPtr->Size;
+					Addr += XAIESIM_ELF_DMB_SIZE) {
+				TgtCol = XAieSim_GetTargetTileAddr(TilePtr,
+						Addr) >>
+					XAIESIM_ELF_TILEADDR_COL_SHIFT;
+				if(TgtCol == TileCol) {
+					continue;
+				}
+
+				/* East and west banks are in the next columns */
+				TgtCol = (TgtCol > TileCol) ?
+					(TilePtr->ColId + 1U) :
+					(TilePtr->ColId - 1U);
+				for(WorkIdx = 0U; WorkIdx < NumWork;
+						WorkIdx++) {
+					if(WorkPtr[WorkIdx].ColId == TgtCol) {
+						return 1U;
+					}
+				}
+			}
+		}
+	}
+
+	return 0U;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This is the API to load one parsed ELF image into many tiles. With the Linux
+* IO, each column is loaded by its own worker thread. The AIE array has no
+* broadcast for memory mapped writes, so every tile is written.
+*
+* The tiles of a column are loaded in the order of TilePtrs. When a tile
+* writes the data memory of a tile in another of the columns, through its
+* east or west bank, the columns are loaded one after the other, so the
+* result is the same as loading the tiles in order with
+* XAieSim_LoadElfImage().
+*
+* @param	TilePtrs: Array of pointers to the target tiles.
+* @param	NumTiles: Number of target tiles.
+* @param	ImgPtr: Pointer to the parsed image.
+* @param	TileUs: Array of NumTiles entries to return the load time of
+*		each tile in usec, or NULL.
+* @param	TotalUs: Pointer to return the total load time in usec, or
+*		NULL.
+*
+* @return	XAIESIM_SUCCESS on success, else XAIESIM_FAILURE.
+*
+* @note		When a transaction is active, the columns are loaded one after
+*		the other into the transaction.
+*
+*******************************************************************************/
+uint32 XAieSim_LoadElfMulti(XAieSim_Tile **TilePtrs, uint32 NumTiles,
+		const XAieSim_ElfImage *ImgPtr, uint64_t *TileUs,
+		uint64_t *TotalUs)
+{
+	XAieSim_ElfWork Work[XAIESIM_ELF_MAX_WORKERS];
+	uint32 NumWork = 0U;
+	uint32 Status = XAIESIM_SUCCESS;
+	uint32 Idx, WorkIdx;
+	uint64_t Start;
+#ifdef XAIESIM_ELF_USE_THREADS
+	pthread_t Thread[XAIESIM_ELF_MAX_WORKERS];
+	uint8 Started[XAIESIM_ELF_MAX_WORKERS];
+	uint8 Parallel;
+#endif
+
+	if(TilePtrs == XAIE_NULL || ImgPtr == XAIE_NULL) {
+		return XAIESIM_FAILURE;
+	}
+
+	Start = XAieSim_ElfTimeUs();
+
+	/* One work item per column */
+	for(Idx = 0U; Idx < NumTiles; Idx++) {
+		for(WorkIdx = 0U; WorkIdx < NumWork; WorkIdx++) {
+			if(Work[WorkIdx].ColId == TilePtrs[Idx]->ColId) {
+				break;
+			}
+		}
+		if(WorkIdx < NumWork) {
+			continue;
+		}
+		if(NumWork == XAIESIM_ELF_MAX_WORKERS) {
+			XAieSim_print("ERROR: Too many columns\n");
+			return XAIESIM_FAILURE;
+		}
+		Work[NumWork].TilePtrs = TilePtrs;
+		Work[NumWork].NumTiles = NumTiles;
+		Work[NumWork].ColId = TilePtrs[Idx]->ColId;
+		Work[NumWork].ImgPtr = ImgPtr;
+		Work[NumWork].TileUs = TileUs;
+		Work[NumWork].Status = XAIESIM_FAILURE;
+		NumWork++;
+	}
+
+#ifdef XAIESIM_ELF_USE_THREADS
+	/* Recording into a transaction is not thread safe */
+	Parallel = (NumWork > 1U && XAieLib_TxnActive == NULL &&
+			!XAieSim_ElfColumnsShared(Work, NumWork, ImgPtr));
+	for(WorkIdx = 0U; WorkIdx < NumWork; WorkIdx++) {
+		Started[WorkIdx] = 0U;
+		if(Parallel && pthread_create(&Thread[WorkIdx], NULL,
+					XAieSim_ElfLoadColumn,
+					&Work[WorkIdx]) == 0) {
+			Started[WorkIdx] = 1U;
+		} else {
+			(void)XAieSim_ElfLoadColumn(&Work[WorkIdx]);
+		}
+	}
+	for(WorkIdx = 0U; WorkIdx < NumWork; WorkIdx++) {
+		if(Started[WorkIdx]) {
+			pthread_join(Thread[WorkIdx], NULL);
+		}
+	}
+#else
+	for(WorkIdx = 0U; WorkIdx < NumWork; WorkIdx++) {
+		(void)XAieSim_ElfLoadColumn(&Work[WorkIdx]);
+	}
+#endif
+
+	for(WorkIdx = 0U; WorkIdx < NumWork; WorkIdx++) {
+		if(Work[WorkIdx].Status != XAIESIM_SUCCESS) {
+			Status = XAIESIM_FAILURE;
+		}
+	}
+
+	if(TotalUs != XAIE_NULL) {
+		*TotalUs = XAieSim_ElfTimeUs() - Start;
+	}
+
+	XAieSim_print("Loaded %d bytes into %d tiles of %d columns in %lu us\n",
+			ImgPtr->NumBytes, NumTiles, NumWork,
+			(unsigned long)(XAieSim_ElfTimeUs() - Start));
+
+	return Status;
+}
+
+/** @} */
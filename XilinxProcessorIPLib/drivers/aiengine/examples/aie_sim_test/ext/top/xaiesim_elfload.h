@@ -23,6 +23,7 @@
 * 1.3  Naresh  07/11/2018  Updated copyright info
 * 1.4  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.8  Hyun    09/13/2019  Added XAieSim_LoadElfMem()
+* 1.9  kc      10/18/2026  Added the parsed ELF image and the multi tile loader
 * </pre>
 *
 ******************************************************************************/
@@ -38,6 +39,13 @@
 #define XAIESIM_ELF_SECTION_NUMMAX		100
 #define XAIESIM_ELF_SECTION_NAMEMAXLEN		100
 
+#define XAIESIM_ELF_SEG_PRGMEM			0U	/**< Program memory */
+#define XAIESIM_ELF_SEG_DATMEM			1U	/**< Data memory */
+#define XAIESIM_ELF_SEG_BSS			2U	/**< Zeroed data memory */
+
+/* Maximum number of worker threads of XAieSim_LoadElfMulti() */
+#define XAIESIM_ELF_MAX_WORKERS			64U
+
 #define XAIESIM_ELF_TILEADDR_DMB_MASK            0x7FFFU	/* 32 KB */
 #define XAIESIM_ELF_TILEADDR_DMB_CARD_OFF        0x18000U
 #define XAIESIM_ELF_TILEADDR_DMB_CARD_SHIFT      15U
@@ -60,6 +68,30 @@ typedef struct {
 	uint32 end;	/**< Stack end address */
 } XAieSim_StackSz;
 
+/**
+ * This typedef contains a loadable section of a parsed ELF.
+ */
+typedef struct {
+	uint32 Type;		/**< XAIESIM_ELF_SEG_* */
+	uint32 Addr;		/**< Load address of the section */
+	uint32 Size;		/**< Size in bytes, rounded up to words */
+	const uint32 *Data;	/**< Section data, NULL for BSS */
+} XAieSim_ElfSeg;
+
+/**
+ * This typedef contains an ELF parsed once by XAieSim_ElfParse() or
+ * XAieSim_ElfParseMem(), to be loaded into any number of tiles.
+ */
+typedef struct {
+	uint8 *ElfPtr;		/**< ELF in memory */
+	uint8 IsOwned;		/**< ElfPtr was allocated by the parser */
+	uint8 HasStack;		/**< Stack is valid */
+	XAieSim_StackSz Stack;	/**< Stack range from the map file */
+	uint32 NumSegs;		/**< Number of loadable sections */
+	uint32 NumBytes;	/**< Bytes written per tile */
+	XAieSim_ElfSeg Segs[XAIESIM_ELF_SECTION_NUMMAX]; /**< Sections */
+} XAieSim_ElfImage;
+
 /***************************** Macro Definitions *****************************/
 
 /************************** Function Prototypes  *****************************/
@@ -69,6 +101,13 @@ uint32 XAieSim_GetStackRange(uint8 *MapPtr, XAieSim_StackSz *StackSzPtr);
 void XAieSim_LoadSymbols(XAieGbl_Tile *TileInstPtr, uint8 *ElfPtr);
 void XAieSim_WriteSection(XAieGbl_Tile *TileInstPtr, uint8 *SectName, Elf32_Shdr *SectPtr, FILE *Fd);
 uint64_t XAieSim_GetTargetTileAddr(XAieGbl_Tile *TileInstPtr, uint32 ShAddr);
+uint32 XAieSim_ElfParseMem(XAieSim_ElfImage *ImgPtr, uint8 *ElfPtr);
+uint32 XAieSim_ElfParse(XAieSim_ElfImage *ImgPtr, uint8 *ElfPath);
+void XAieSim_ElfFree(XAieSim_ElfImage *ImgPtr);
+uint32 XAieSim_LoadElfImage(XAieGbl_Tile *TileInstPtr, const XAieSim_ElfImage *ImgPtr);
+uint32 XAieSim_LoadElfMulti(XAieGbl_Tile **TilePtrs, uint32 NumTiles,
+		const XAieSim_ElfImage *ImgPtr, uint64_t *TileUs,
+		uint64_t *TotalUs);
 
 #endif		/* end of protection macro */
 /** @} */
@@ -0,0 +1,175 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie-prof.c
+* @{
+*
+* This file contains the test application for the AIE profiling service. The
+* kernel metrics of a block of core tiles are sampled every millisecond from
+* the sampling thread, printed, and written to prof.csv and prof.json.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stddef.h>
+#include <stdio.h>
+#include <xaiengine.h>
+#include <unistd.h>
+
+/************************** Constant Definitions *****************************/
+#define XAIE_NUM_ROWS		8
+#define XAIE_NUM_COLS		50
+#define XAIE_ADDR_ARRAY_OFF	0x800
+
+#define PROF_COL		6	/* First column of the profiled tiles */
+#define PROF_NUM_COLS		4
+#define PROF_NUM_ROWS		4	/* From row 1 */
+#define PROF_NUM_TILES		(PROF_NUM_COLS * PROF_NUM_ROWS)
+
+#define PROF_RING_SIZE		1024U
+#define PROF_INTERVAL_US	1000U
+#define PROF_NUM_SAMPLES	100U
+
+/************************** Variable Definitions *****************************/
+static XAieGbl_Config *AieConfigPtr;	/**< AIE configuration pointer */
+static XAieGbl AieInst;			/**< AIE global instance */
+static XAieGbl_HwCfg AieConfig;          /**< AIE HW configuration instance */
+
+static XAieGbl_Tile TileInst[XAIE_NUM_COLS][XAIE_NUM_ROWS+1];
+
+static XAieTileProf Prof;		/**< Profiling service */
+static XAieGbl_Tile *ProfTiles[PROF_NUM_TILES];
+static XAieTileProf_Record Ring[PROF_RING_SIZE];
+static XAieTileProf_Record Samples[PROF_NUM_SAMPLES * PROF_NUM_TILES];
+static XAieTileProf_Record *FirstSample[PROF_NUM_TILES];
+static XAieTileProf_Record *LastSample[PROF_NUM_TILES];
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is to profile the kernels of the tiles, with their stall, lock wait
+* and DMA idle cycles, and the instruction errors they report.
+*
+* @param	None.
+*
+* @return	0 for success, and negative value for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int test_prof_kernels(void)
+{
+	XAieTileProf_KernelMetrics Metrics;
+	u8 Events[] = {XAIETILE_EVENT_CORE_INSTR_ERROR};
+	u32 Num = 0;
+	u32 Idx;
+	int c, r;
+
+	for (c = 0; c < PROF_NUM_COLS; c++) {
+		for (r = 0; r < PROF_NUM_ROWS; r++) {
+			ProfTiles[c * PROF_NUM_ROWS + r] =
+				&TileInst[PROF_COL + c][r + 1];
+		}
+	}
+
+	if (XAieTileProf_Initialize(&Prof, ProfTiles, PROF_NUM_TILES, Ring,
+				PROF_RING_SIZE) != XAIELIB_SUCCESS ||
+			XAieTileProf_ConfigureKernel(&Prof) != XAIELIB_SUCCESS ||
+			XAieTileProf_SetEvents(&Prof, Events, 1) !=
+			XAIELIB_SUCCESS) {
+		printf("Failed to configure the profiling.\n");
+		return -1;
+	}
+
+	if (XAieTileProf_Start(&Prof, PROF_INTERVAL_US) != XAIELIB_SUCCESS) {
+		printf("Failed to start the sampling.\n");
+		return -1;
+	}
+	while (Num < PROF_NUM_SAMPLES * PROF_NUM_TILES) {
+		usleep(PROF_INTERVAL_US * 10);
+		Num += XAieTileProf_Read(&Prof, &Samples[Num],
+				PROF_NUM_SAMPLES * PROF_NUM_TILES - Num);
+	}
+	XAieTileProf_Stop(&Prof);
+	printf("%u samples, %u dropped\n", Num, Prof.Dropped);
+
+	/*
+	 * Metrics of the tiles over the whole run, between the first and the
+	 * last sample of each tile. Samples are dropped when the ring is full,
+	 * so the tile of a sample is known only from its TileIdx.
+	 */
+	for (Idx = 0; Idx < Num; Idx++) {
+		if (FirstSample[Samples[Idx].TileIdx] == NULL) {
+			FirstSample[Samples[Idx].TileIdx] = &Samples[Idx];
+		}
+		LastSample[Samples[Idx].TileIdx] = &Samples[Idx];
+	}
+	for (Idx = 0; Idx < PROF_NUM_TILES; Idx++) {
+		if (FirstSample[Idx] == LastSample[Idx]) {
+			printf("tile (%u,%u): not enough samples\n",
+			       ProfTiles[Idx]->ColId, ProfTiles[Idx]->RowId);
+			continue;
+		}
+		XAieTileProf_KernelMetricsGet(FirstSample[Idx],
+				LastSample[Idx], &Metrics);
+		printf("tile (%u,%u): %u cycles, active %u, stall %u, "
+		       "lock wait %u, S2MM idle %u, MM2S idle %u\n",
+		       ProfTiles[Idx]->ColId, ProfTiles[Idx]->RowId,
+		       Metrics.Cycles, Metrics.Active, Metrics.Stall,
+		       Metrics.LockWait, Metrics.S2mmIdle, Metrics.Mm2sIdle);
+	}
+
+	if (XAieTileProf_Export(&Prof, Samples, Num, "prof.csv",
+				XAIETILEPROF_FORMAT_CSV) != XAIELIB_SUCCESS ||
+			XAieTileProf_Export(&Prof, Samples, Num, "prof.json",
+				XAIETILEPROF_FORMAT_CHROME) !=
+			XAIELIB_SUCCESS) {
+		printf("Failed to export the samples.\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the AIE profiling test.
+*
+* @param	None.
+*
+* @return	0 for success, and negative value for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main(void)
+{
+	printf("*************************************\n"
+	       " XAIE Profiling Testing.\n"
+	       "*************************************\n");
+	/* Initialize AIE Instance */
+	XAIEGBL_HWCFG_SET_CONFIG((&AieConfig), XAIE_NUM_ROWS, XAIE_NUM_COLS, XAIE_ADDR_ARRAY_OFF);
+	XAieGbl_HwInit(&AieConfig);
+
+	AieConfigPtr = XAieGbl_LookupConfig(XPAR_AIE_DEVICE_ID);
+	(void)XAieGbl_CfgInitialize(&AieInst, &TileInst[0][0], AieConfigPtr);
+
+	return test_prof_kernels();
+}
+
+/** @} */
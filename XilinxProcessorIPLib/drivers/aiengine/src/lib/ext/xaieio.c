@@ -20,6 +20,7 @@
 * 1.0  Hyun    07/12/2018  Initial creation
 * 1.1  Hyun    10/11/2018  Initialize the IO device for mem instance
 * 1.2  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.3  kc      10/18/2026  Add XAieIO_BlockWrite32()
 * </pre>
 *
 ******************************************************************************/
@@ -382,6 +383,48 @@ void XAieIO_Write128(u64 Addr, u32 *Data)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write contiguous 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data words.
+* @param	Count: Number of words to write.
+*
+* @return	None.
+*
+* @note		When the io region is mapped, the words are stored directly
+*		with a single barrier at the end, instead of one barrier per
+*		word with metal_io_write32().
+*
+*******************************************************************************/
+void XAieIO_BlockWrite32(u64 Addr, const u32 *Data, u32 Count)
+{
+	unsigned long Offset = Addr - IOInst.io_base;
+	volatile u32 *Ptr = metal_io_virt(IOInst.io, Offset);
+	u32 Idx;
+
+	if (!Count) {
+		return;
+	}
+
+	if (!Ptr || IOInst.io->ops.write ||
+			!metal_io_virt(IOInst.io, Offset + (Count - 1U) * 4U)) {
+		for(Idx = 0U; Idx < Count; Idx++) {
+			metal_io_write32(IOInst.io, Offset + Idx * 4U,
+					 Data[Idx]);
+		}
+		return;
+	}
+
+	for(Idx = 0U; Idx < Count; Idx++) {
+		Ptr[Idx] = Data[Idx];
+	}
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
 /*****************************************************************************/
 /**
 *
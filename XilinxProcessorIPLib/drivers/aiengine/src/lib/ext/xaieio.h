@@ -19,6 +19,7 @@
 * ----- ------  -------- -----------------------------------------------------
 * 1.0  Hyun    07/12/2018  Initial creation
 * 1.1  Nishad  12/05/2018  Renamed ME attributes to AIE
+* 1.2  kc      10/18/2026  Add XAieIO_BlockWrite32()
 * </pre>
 *
 ******************************************************************************/
@@ -49,6 +50,7 @@ uint32 XAieIO_Read32(uint64_t Addr);
 void XAieIO_Read128(uint64_t Addr, uint32 *Data);
 void XAieIO_Write32(uint64_t Addr, uint32 Data);
 void XAieIO_Write128(uint64_t Addr, uint32 *Data);
+void XAieIO_BlockWrite32(uint64_t Addr, const uint32 *Data, uint32 Count);
 
 typedef struct XAieIO_Mem XAieIO_Mem;
 
@@ -38,12 +38,15 @@
 * 2.6  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 2.7  Wendy   02/25/2020  Add logging API
 * 2.8  Tejus   04/17/2020  Fix variable overflow issue.
+* 2.9  kc      10/18/2026  Record the IO in the active transaction and add
+*                          XAieLib_BlockWrite32()
 * </pre>
 *
 ******************************************************************************/
 #include "xaiegbl_defs.h"
 #include "xaielib.h"
 #include "xaielib_npi.h"
+#include "xaielib_txn.h"
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -172,6 +175,7 @@ void XAieLib_AssertVoid(u8 Cond, const char *func, const u32 line)
 *******************************************************************************/
 int XAieLib_usleep(u64 Usec)
 {
+	XAieLib_TxnSync();
 #ifdef __AIESIM__
 	return XAieSim_usleep(Usec);
 #else
@@ -201,6 +205,7 @@ int XAieLib_usleep(u64 Usec)
 *******************************************************************************/
 u32 XAieLib_LoadElf(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 {
+	XAieLib_TxnSync();
 #ifdef __AIESIM__
 	return XAieSim_LoadElf(TileInstPtr, ElfPtr, LoadSym);
 #elif defined __AIEBAREMTL__
@@ -226,6 +231,7 @@ u32 XAieLib_LoadElf(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 *******************************************************************************/
 u32 XAieLib_LoadElfMem(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 {
+	XAieLib_TxnSync();
 #ifdef __AIESIM__
 	return XAIELIB_FAILURE;
 #elif defined __AIEBAREMTL__
@@ -893,6 +899,7 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 *******************************************************************************/
 u32 XAieLib_Read32(u64 Addr)
 {
+	XAieLib_TxnSync();
 #ifdef __AIESIM__
 	return(XAieSim_Read32(Addr));
 #elif defined __AIEBAREMTL__
@@ -919,6 +926,7 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 {
 	u8 Idx;
 
+	XAieLib_TxnSync();
 	for(Idx = 0U; Idx < 4U; Idx++) {
 #ifdef __AIESIM__
 		Data[Idx] = XAieSim_Read32(Addr + Idx*4U);
@@ -945,6 +953,11 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 *******************************************************************************/
 void XAieLib_Write32(u64 Addr, u32 Data)
 {
+	if (XAieLib_TxnActive != NULL) {
+		XAieLib_TxnWrite32(XAieLib_TxnActive, Addr, Data);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write32(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -973,6 +986,11 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	if (XAieLib_TxnActive != NULL) {
+		XAieLib_TxnMaskWrite32(XAieLib_TxnActive, Addr, Mask, Data);
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_MaskWrite32(Addr, Mask, Data);
 #elif defined __AIEBAREMTL__
@@ -1003,11 +1021,19 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 *******************************************************************************/
 void XAieLib_Write128(u64 Addr, u32 *Data)
 {
+	u8 Idx;
+
+	if (XAieLib_TxnActive != NULL) {
+		for(Idx = 0U; Idx < 4U; Idx++) {
+			XAieLib_TxnWrite32(XAieLib_TxnActive, Addr + Idx * 4U,
+					   Data[Idx]);
+		}
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write128(Addr, Data);
 #elif defined __AIEBAREMTL__
-	u8 Idx;
-
 	for(Idx = 0U; Idx < 4U; Idx++) {
 		Xil_Out32((u32)Addr + Idx * 4U, Data[Idx]);
 	}
@@ -1016,6 +1042,47 @@ void XAieLib_Write128(u64 Addr, u32 *Data)
 #endif
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write contiguous 32bit words starting at
+* the specified address.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the data words.
+* @param	Count: Number of words to write.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_BlockWrite32(u64 Addr, const u32 *Data, u32 Count)
+{
+	u32 Idx;
+
+	if (XAieLib_TxnActive != NULL) {
+		for(Idx = 0U; Idx < Count; Idx++) {
+			XAieLib_TxnWrite32(XAieLib_TxnActive, Addr + Idx * 4U,
+					   Data[Idx]);
+		}
+		return;
+	}
+
+#ifdef __AIESIM__
+	for(Idx = 0U; Idx < Count; Idx++) {
+		XAieSim_Write32(Addr + Idx * 4U, Data[Idx]);
+	}
+#elif defined __AIEBAREMTL__
+	for(Idx = 0U; Idx < Count; Idx++) {
+		Xil_Out32(Addr + Idx * 4U, Data[Idx]);
+	}
+#else
+	(void)Idx;
+	XAieIO_BlockWrite32(Addr, Data, Count);
+#endif
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1058,6 +1125,13 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
 
+	/* The poll runs when the transaction is executed */
+	if (XAieLib_TxnActive != NULL) {
+		XAieLib_TxnMaskPoll(XAieLib_TxnActive, Addr, Mask, Value,
+				    TimeOutUs);
+		return XAIELIB_SUCCESS;
+	}
+
 #ifdef __AIESIM__
 	if (XAieSim_MaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
 		Ret = XAIELIB_SUCCESS;
@@ -1104,6 +1178,7 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 *******************************************************************************/
 u32 XAieLib_NPIRead32(u64 Addr)
 {
+	XAieLib_TxnSync();
 #ifdef __AIESIM__
 	return XAieSim_NPIRead32(Addr);
 #elif defined __AIEBAREMTL__
@@ -1128,6 +1203,7 @@ static void XAieLib_NPISetLock(u8 Lock)
 {
 	u32 RegAddr, RegVal;
 
+	XAieLib_TxnSync();
 	RegAddr = XAIE_NPI_PCSR_LOCK;
 	if (Lock == 0) {
 		RegVal = XAIE_NPI_PCSR_LOCK_STATE_UNLOCK_CODE <<
@@ -1226,6 +1302,8 @@ u32 XAieLib_NPIMaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
 
+	XAieLib_TxnSync();
+
 #ifdef __AIESIM__
 	if (XAieSim_NPIMaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
 		Ret = XAIELIB_SUCCESS;
@@ -26,6 +26,7 @@
 * 1.7  Hyun    01/08/2019  Add XAieLib_MaskPoll()
 * 1.8  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 1.9  Wendy   02/25/2020  Add Logging API
+* 2.0  kc      10/18/2026  Add XAieLib_BlockWrite32()
 * </pre>
 *
 ******************************************************************************/
@@ -67,6 +68,7 @@ void XAieLib_Read128(u64 Addr, u32 *Data);
 void XAieLib_Write32(u64 Addr, u32 Data);
 void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data);
 void XAieLib_Write128(u64 Addr, u32 *Data);
+void XAieLib_BlockWrite32(u64 Addr, const u32 *Data, u32 Count);
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0, u32 CmdWd1, u8 *CmdStr);
 u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
 
@@ -0,0 +1,592 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_txn.c
+* @{
+*
+* This file contains the register write transactions of the AIE driver. See
+* xaielib_txn.h for the description of the transactions and of the command
+* buffer format.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* 1.1  kc      10/18/2026  Hash the shadow table with the top bits of the
+*                          product, so tiles do not share a slot
+* </pre>
+*
+******************************************************************************/
+#include "xaielib.h"
+#include "xaielib_txn.h"
+#include <string.h>
+
+/***************************** Macro Definitions *****************************/
+#define XAIELIB_TXN_WRITE_WORDS		3U	/* Header and address */
+#define XAIELIB_TXN_MASKWRITE_WORDS	5U
+#define XAIELIB_TXN_MASKPOLL_WORDS	6U
+
+/* Slots probed for a register before giving up on tracking it */
+#define XAIELIB_TXN_SHADOW_PROBES	8U
+
+#define XAIELIB_TXN_CMD(Op, Cnt)	(((Op) << XAIELIB_TXN_OP_LSB) | (Cnt))
+#define XAIELIB_TXN_ADDR(Cmd)		((u64)(Cmd)[1] | ((u64)(Cmd)[2] << 32))
+
+/************************** Variable Definitions *****************************/
+XAieLib_Txn *XAieLib_TxnActive;	/**< Transaction recording the IO, or NULL */
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to look up the shadow entry of a register.
+*
+* @param	TxnPtr: Transaction instance.
+* @param	Addr: Address of the register.
+* @param	Add: 1 to allocate an entry if the register has none.
+*
+* @return	Pointer to the entry, or NULL if the register is not tracked.
+*
+* @note		When the table is getting full, it is cleared. This only loses
+*		the values known so far.
+*
+*******************************************************************************/
+static XAieLib_TxnShadow *XAieLib_TxnShadowFind(XAieLib_Txn *TxnPtr,
+		u64 Addr, u8 Add)
+{
+	XAieLib_TxnShadow *Entry;
+	u32 Idx, Probe;
+
+	/*
+	 * The same register of every tile differs in the column and row bits
+	 * only, so take the top bits of the product, which depend on all bits
+	 * of the word address.
+	 */
+	Idx = ((u32)(Addr >> 2U) ^ (u32)(Addr >> 34U)) * 2654435761U;
+	Idx >>= 32U - XAIELIB_TXN_SHADOW_BITS;
+	for(Probe = 0U; Probe < XAIELIB_TXN_SHADOW_PROBES; Probe++) {
+		Entry = &TxnPtr->Shadow[(Idx + Probe) &
+			(XAIELIB_TXN_SHADOW_SIZE - 1U)];
+		if (Entry->Valid == 0U) {
+			break;
+		}
+		if (Entry->Addr == Addr) {
+			return Entry;
+		}
+	}
+
+	if (Add == 0U) {
+		return NULL;
+	}
+
+	if ((Probe == XAIELIB_TXN_SHADOW_PROBES) ||
+			(TxnPtr->ShadowCnt >= (XAIELIB_TXN_SHADOW_SIZE / 4U) * 3U)) {
+		memset(TxnPtr->Shadow, 0, sizeof(TxnPtr->Shadow));
+		TxnPtr->ShadowCnt = 0U;
+		Entry = &TxnPtr->Shadow[Idx & (XAIELIB_TXN_SHADOW_SIZE - 1U)];
+	}
+
+	Entry->Addr = Addr;
+	Entry->Valid = 1U;
+	Entry->Known = 0U;
+	TxnPtr->ShadowCnt++;
+
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to run commands of the command buffer format.
+*
+* @param	Cmd: Pointer to the first command.
+* @param	NumWords: Number of words of the commands.
+* @param	NumCmds: Pointer to return the number of commands run.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a poll
+*		times out or a command is malformed.
+*
+* @note		The caller makes sure no transaction is active, so the commands
+*		access the device.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnExec(const u32 *Cmd, u32 NumWords, u32 *NumCmds)
+{
+	u32 Off = 0U;
+	u32 Op, Cnt, Words;
+
+	*NumCmds = 0U;
+	while (Off < NumWords) {
+		Op = Cmd[Off] >> XAIELIB_TXN_OP_LSB;
+		Cnt = Cmd[Off] & XAIELIB_TXN_CNT_MASK;
+
+		if (Op == XAIELIB_TXN_OP_WRITE) {
+			Words = XAIELIB_TXN_WRITE_WORDS + Cnt;
+		} else if (Op == XAIELIB_TXN_OP_MASKWRITE) {
+			Words = XAIELIB_TXN_MASKWRITE_WORDS;
+		} else if (Op == XAIELIB_TXN_OP_MASKPOLL) {
+			Words = XAIELIB_TXN_MASKPOLL_WORDS;
+		} else {
+			XAieLib_print("Invalid transaction command 0x%x\n",
+				      Cmd[Off]);
+			return XAIELIB_FAILURE;
+		}
+		if (Words > NumWords - Off) {
+			XAieLib_print("Truncated transaction command\n");
+			return XAIELIB_FAILURE;
+		}
+
+		if (Op == XAIELIB_TXN_OP_WRITE) {
+			XAieLib_BlockWrite32(XAIELIB_TXN_ADDR(&Cmd[Off]),
+					     &Cmd[Off + XAIELIB_TXN_WRITE_WORDS],
+					     Cnt);
+		} else if (Op == XAIELIB_TXN_OP_MASKWRITE) {
+			XAieLib_MaskWrite32(XAIELIB_TXN_ADDR(&Cmd[Off]),
+					    Cmd[Off + 3U], Cmd[Off + 4U]);
+		} else if (XAieLib_MaskPoll(XAIELIB_TXN_ADDR(&Cmd[Off]),
+				Cmd[Off + 3U], Cmd[Off + 4U], Cmd[Off + 5U]) !=
+				XAIELIB_SUCCESS) {
+			XAieLib_print("Transaction poll timed out\n");
+			return XAIELIB_FAILURE;
+		}
+
+		Off += Words;
+		(*NumCmds)++;
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to make room in the command buffer. When the
+* commands are not kept for export, the buffer is flushed if it is full.
+*
+* @param	TxnPtr: Transaction instance.
+* @param	Words: Number of words needed.
+*
+* @return	XAIELIB_SUCCESS if there is room, otherwise XAIELIB_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u32 XAieLib_TxnReserve(XAieLib_Txn *TxnPtr, u32 Words)
+{
+	if (Words <= TxnPtr->Size - TxnPtr->Len) {
+		return XAIELIB_SUCCESS;
+	}
+
+	(void)XAieLib_TxnFlush(TxnPtr);
+	if (Words <= TxnPtr->Size - TxnPtr->Len) {
+		return XAIELIB_SUCCESS;
+	}
+
+	/* The command runs outside of the buffer, so the export is lost */
+	TxnPtr->Partial = 1U;
+
+	return XAIELIB_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a transaction. From here to XAieLib_TxnStop(), the register
+* writes and polls of the driver are recorded into the command buffer.
+*
+* @param	TxnPtr: Transaction instance to initialize.
+* @param	Buf: Command buffer.
+* @param	Size: Size of the command buffer in words.
+* @param	Flags: XAIELIB_TXN_OPT_* options, or 0.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if the
+*		arguments are invalid or a transaction is already active.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnStart(XAieLib_Txn *TxnPtr, u32 *Buf, u32 Size, u32 Flags)
+{
+	if ((TxnPtr == NULL) || (Buf == NULL) ||
+			(Size < XAIELIB_TXN_HDR_WORDS +
+			 XAIELIB_TXN_MASKPOLL_WORDS)) {
+		XAieLib_print("Invalid transaction buffer\n");
+		return XAIELIB_FAILURE;
+	}
+
+	if (XAieLib_TxnActive != NULL) {
+		XAieLib_print("Transaction already active\n");
+		return XAIELIB_FAILURE;
+	}
+
+	memset(TxnPtr, 0, sizeof(*TxnPtr));
+	TxnPtr->Buf = Buf;
+	TxnPtr->Size = Size;
+	TxnPtr->Len = XAIELIB_TXN_HDR_WORDS;
+	TxnPtr->Done = XAIELIB_TXN_HDR_WORDS;
+	TxnPtr->Flags = Flags;
+	TxnPtr->Status = XAIELIB_SUCCESS;
+
+	XAieLib_TxnActive = TxnPtr;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes the commands recorded since the last flush.
+*
+* @param	TxnPtr: Transaction instance.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a poll
+*		of the transaction has timed out.
+*
+* @note		Once a poll has timed out, the commands recorded after it are
+*		dropped.
+*
+*******************************************************************************/
+u32 XAieLib_TxnFlush(XAieLib_Txn *TxnPtr)
+{
+	XAieLib_Txn *Active;
+	u32 NumCmds;
+
+	if ((TxnPtr == NULL) || (TxnPtr->Buf == NULL)) {
+		return XAIELIB_FAILURE;
+	}
+
+	if ((TxnPtr->Done < TxnPtr->Len) &&
+			(TxnPtr->Status == XAIELIB_SUCCESS)) {
+		Active = XAieLib_TxnActive;
+		XAieLib_TxnActive = NULL;
+		TxnPtr->Status = XAieLib_TxnExec(&TxnPtr->Buf[TxnPtr->Done],
+				TxnPtr->Len - TxnPtr->Done, &NumCmds);
+		XAieLib_TxnActive = Active;
+	}
+
+	TxnPtr->Done = TxnPtr->Len;
+	TxnPtr->Last = 0U;
+	if ((TxnPtr->Flags & XAIELIB_TXN_OPT_EXPORT) == 0U) {
+		TxnPtr->Len = XAIELIB_TXN_HDR_WORDS;
+		TxnPtr->Done = XAIELIB_TXN_HDR_WORDS;
+		TxnPtr->NumCmds = 0U;
+	}
+
+	return TxnPtr->Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API executes the pending commands and ends the transaction.
+*
+* @param	TxnPtr: Transaction instance.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a poll
+*		of the transaction has timed out.
+*
+* @note		With XAIELIB_TXN_OPT_EXPORT, the commands stay in the buffer
+*		and can still be exported.
+*
+*******************************************************************************/
+u32 XAieLib_TxnStop(XAieLib_Txn *TxnPtr)
+{
+	u32 Ret;
+
+	if (TxnPtr == NULL) {
+		return XAIELIB_FAILURE;
+	}
+
+	Ret = XAieLib_TxnFlush(TxnPtr);
+	if (XAieLib_TxnActive == TxnPtr) {
+		XAieLib_TxnActive = NULL;
+	}
+
+	XAieLib_print("Transaction: %u writes, %u dropped, %u commands\n",
+		      TxnPtr->NumWrites, TxnPtr->NumDropped, TxnPtr->NumCmds);
+
+	return Ret;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API fills the header of the command buffer so the transaction can be
+* saved and given to XAieLib_TxnReplay() later.
+*
+* @param	TxnPtr: Transaction instance, started with
+*		XAIELIB_TXN_OPT_EXPORT.
+* @param	NumWords: Pointer to return the size of the transaction in
+*		words. The transaction is the first NumWords words of the
+*		command buffer.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if the
+*		transaction was not started for export or did not fit in the
+*		command buffer.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnExport(XAieLib_Txn *TxnPtr, u32 *NumWords)
+{
+	if ((TxnPtr == NULL) || (TxnPtr->Buf == NULL) || (NumWords == NULL) ||
+			((TxnPtr->Flags & XAIELIB_TXN_OPT_EXPORT) == 0U)) {
+		return XAIELIB_FAILURE;
+	}
+
+	if (TxnPtr->Partial != 0U) {
+		XAieLib_print("Transaction did not fit in the buffer\n");
+		return XAIELIB_FAILURE;
+	}
+
+	TxnPtr->Buf[0U] = XAIELIB_TXN_MAGIC;
+	TxnPtr->Buf[1U] = XAIELIB_TXN_VERSION;
+	TxnPtr->Buf[2U] = TxnPtr->Len;
+	TxnPtr->Buf[3U] = TxnPtr->NumCmds;
+	*NumWords = TxnPtr->Len;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API runs a transaction exported by XAieLib_TxnExport().
+*
+* @param	Buf: Pointer to the exported transaction.
+* @param	NumWords: Size of the exported transaction in words.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if the
+*		transaction is invalid or one of its polls times out.
+*
+* @note		If a transaction is active, its pending commands are executed
+*		first and the replayed commands are not recorded.
+*
+*******************************************************************************/
+u32 XAieLib_TxnReplay(const u32 *Buf, u32 NumWords)
+{
+	XAieLib_Txn *Active;
+	u32 NumCmds, Ret;
+
+	if ((Buf == NULL) || (NumWords < XAIELIB_TXN_HDR_WORDS) ||
+			(Buf[0U] != XAIELIB_TXN_MAGIC) ||
+			(Buf[1U] != XAIELIB_TXN_VERSION) ||
+			(Buf[2U] != NumWords)) {
+		XAieLib_print("Invalid transaction\n");
+		return XAIELIB_FAILURE;
+	}
+
+	XAieLib_TxnSync();
+
+	Active = XAieLib_TxnActive;
+	XAieLib_TxnActive = NULL;
+	Ret = XAieLib_TxnExec(&Buf[XAIELIB_TXN_HDR_WORDS],
+			NumWords - XAIELIB_TXN_HDR_WORDS, &NumCmds);
+	XAieLib_TxnActive = Active;
+
+	if ((Ret == XAIELIB_SUCCESS) && (NumCmds != Buf[3U])) {
+		XAieLib_print("Transaction command count mismatch\n");
+		Ret = XAIELIB_FAILURE;
+	}
+
+	return Ret;
+}
+
+/*****************************************************************************/
+/**
+*
+* This records a 32bit register write into the transaction. The write is
+* merged into the previous command if that is a block write ending at Addr.
+*
+* @param	TxnPtr: Transaction instance.
+* @param	Addr: Address to write to.
+* @param	Data: 32-bit data to be written.
+*
+* @return	None.
+*
+* @note		Used by XAieLib_Write32() while the transaction is active.
+*
+*******************************************************************************/
+void XAieLib_TxnWrite32(XAieLib_Txn *TxnPtr, u64 Addr, u32 Data)
+{
+	XAieLib_TxnShadow *Entry = NULL;
+	XAieLib_Txn *Active;
+	u32 *Cmd;
+	u32 Cnt;
+	u64 NextAddr;
+
+	TxnPtr->NumWrites++;
+
+	if ((TxnPtr->Flags & XAIELIB_TXN_OPT_DEDUP) != 0U) {
+		Entry = XAieLib_TxnShadowFind(TxnPtr, Addr, 1U);
+		if ((Entry != NULL) && (Entry->Known != 0U) &&
+				(Entry->Value == Data)) {
+			TxnPtr->NumDropped++;
+			return;
+		}
+	}
+
+	if (TxnPtr->Last != 0U) {
+		Cmd = &TxnPtr->Buf[TxnPtr->Last];
+		Cnt = Cmd[0U] & XAIELIB_TXN_CNT_MASK;
+		NextAddr = XAIELIB_TXN_ADDR(Cmd) + (u64)Cnt * 4U;
+
+		if (((TxnPtr->Flags & XAIELIB_TXN_OPT_DEDUP) != 0U) &&
+				(Addr == NextAddr - 4U)) {
+			/* Overwrite the last word of the previous command */
+			TxnPtr->Buf[TxnPtr->Len - 1U] = Data;
+			TxnPtr->NumDropped++;
+			goto SHADOW;
+		}
+
+		if ((Addr == NextAddr) && (Cnt < XAIELIB_TXN_CNT_MASK) &&
+				(TxnPtr->Len < TxnPtr->Size)) {
+			TxnPtr->Buf[TxnPtr->Len++] = Data;
+			Cmd[0U]++;
+			goto SHADOW;
+		}
+	}
+
+	if (XAieLib_TxnReserve(TxnPtr, XAIELIB_TXN_WRITE_WORDS + 1U) !=
+			XAIELIB_SUCCESS) {
+		if (TxnPtr->Status == XAIELIB_SUCCESS) {
+			Active = XAieLib_TxnActive;
+			XAieLib_TxnActive = NULL;
+			XAieLib_Write32(Addr, Data);
+			XAieLib_TxnActive = Active;
+		}
+		goto SHADOW;
+	}
+
+	Cmd = &TxnPtr->Buf[TxnPtr->Len];
+	Cmd[0U] = XAIELIB_TXN_CMD(XAIELIB_TXN_OP_WRITE, 1U);
+	Cmd[1U] = (u32)Addr;
+	Cmd[2U] = (u32)(Addr >> 32U);
+	Cmd[3U] = Data;
+	TxnPtr->Last = TxnPtr->Len;
+	TxnPtr->Len += XAIELIB_TXN_WRITE_WORDS + 1U;
+	TxnPtr->NumCmds++;
+
+SHADOW:
+	if (Entry != NULL) {
+		Entry->Value = Data;
+		Entry->Known = 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This records a masked 32bit register write into the transaction.
+*
+* @param	TxnPtr: Transaction instance.
+* @param	Addr: Address to write to.
+* @param	Mask: Mask to be applied to Data.
+* @param	Data: 32-bit data to be written.
+*
+* @return	None.
+*
+* @note		Used by XAieLib_MaskWrite32() while the transaction is active.
+*		With XAIELIB_TXN_OPT_DEDUP, a mask write to a register whose
+*		value is known is recorded as a plain write.
+*
+*******************************************************************************/
+void XAieLib_TxnMaskWrite32(XAieLib_Txn *TxnPtr, u64 Addr, u32 Mask,
+		u32 Data)
+{
+	XAieLib_TxnShadow *Entry = NULL;
+	XAieLib_Txn *Active;
+	u32 *Cmd;
+
+	if ((TxnPtr->Flags & XAIELIB_TXN_OPT_DEDUP) != 0U) {
+		Entry = XAieLib_TxnShadowFind(TxnPtr, Addr, 0U);
+		if ((Entry != NULL) && (Entry->Known != 0U)) {
+			XAieLib_TxnWrite32(TxnPtr, Addr,
+					   (Entry->Value & ~Mask) | Data);
+			return;
+		}
+	}
+
+	TxnPtr->NumWrites++;
+	if (Entry != NULL) {
+		Entry->Known = 0U;
+	}
+
+	if (XAieLib_TxnReserve(TxnPtr, XAIELIB_TXN_MASKWRITE_WORDS) !=
+			XAIELIB_SUCCESS) {
+		if (TxnPtr->Status == XAIELIB_SUCCESS) {
+			Active = XAieLib_TxnActive;
+			XAieLib_TxnActive = NULL;
+			XAieLib_MaskWrite32(Addr, Mask, Data);
+			XAieLib_TxnActive = Active;
+		}
+		return;
+	}
+
+	Cmd = &TxnPtr->Buf[TxnPtr->Len];
+	Cmd[0U] = XAIELIB_TXN_CMD(XAIELIB_TXN_OP_MASKWRITE, 0U);
+	Cmd[1U] = (u32)Addr;
+	Cmd[2U] = (u32)(Addr >> 32U);
+	Cmd[3U] = Mask;
+	Cmd[4U] = Data;
+	TxnPtr->Last = 0U;
+	TxnPtr->Len += XAIELIB_TXN_MASKWRITE_WORDS;
+	TxnPtr->NumCmds++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This records a register poll into the transaction.
+*
+* @param	TxnPtr: Transaction instance.
+* @param	Addr: Address to poll.
+* @param	Mask: Mask to be applied to read data.
+* @param	Value: The expected value
+* @param	TimeOutUs: Minimum timeout in usec.
+*
+* @return	None.
+*
+* @note		Used by XAieLib_MaskPoll() while the transaction is active.
+*
+*******************************************************************************/
+void XAieLib_TxnMaskPoll(XAieLib_Txn *TxnPtr, u64 Addr, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	XAieLib_Txn *Active;
+	u32 *Cmd;
+
+	if (XAieLib_TxnReserve(TxnPtr, XAIELIB_TXN_MASKPOLL_WORDS) !=
+			XAIELIB_SUCCESS) {
+		Active = XAieLib_TxnActive;
+		XAieLib_TxnActive = NULL;
+		if ((TxnPtr->Status == XAIELIB_SUCCESS) &&
+				(XAieLib_MaskPoll(Addr, Mask, Value,
+					TimeOutUs) != XAIELIB_SUCCESS)) {
+			TxnPtr->Status = XAIELIB_FAILURE;
+		}
+		XAieLib_TxnActive = Active;
+		return;
+	}
+
+	Cmd = &TxnPtr->Buf[TxnPtr->Len];
+	Cmd[0U] = XAIELIB_TXN_CMD(XAIELIB_TXN_OP_MASKPOLL, 0U);
+	Cmd[1U] = (u32)Addr;
+	Cmd[2U] = (u32)(Addr >> 32U);
+	Cmd[3U] = Mask;
+	Cmd[4U] = Value;
+	Cmd[5U] = TimeOutUs;
+	TxnPtr->Last = 0U;
+	TxnPtr->Len += XAIELIB_TXN_MASKPOLL_WORDS;
+	TxnPtr->NumCmds++;
+}
+
+/** @} */
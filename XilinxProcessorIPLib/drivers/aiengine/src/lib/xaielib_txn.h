@@ -0,0 +1,148 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_txn.h
+* @{
+*
+* Header file for the register write transactions of the AIE driver.
+*
+* Once a transaction is started with XAieLib_TxnStart(), XAieLib_Write32(),
+* XAieLib_MaskWrite32(), XAieLib_Write128() and XAieLib_MaskPoll() record
+* commands into the command buffer of the transaction instead of accessing
+* the device. Writes to contiguous addresses are merged into one block write
+* command. The buffer is executed by XAieLib_TxnFlush() and
+* XAieLib_TxnStop(), and whenever it is full. A register read, an NPI access,
+* a sleep or an ELF load executes the pending commands first, so the device
+* is always seen in program order.
+*
+* Recorded polls return XAIELIB_SUCCESS to the caller. A poll that times out
+* at execution stops the execution and makes the flush return
+* XAIELIB_FAILURE.
+*
+* With XAIELIB_TXN_OPT_DEDUP, the transaction keeps the last value written to
+* each register and drops writes that do not change it, replaces a write to
+* the register written by the previous command, and turns mask writes to known
+* registers into plain writes. This must not be used when the transaction
+* writes registers with side effects on write, such as the event generate or
+* DMA start queue registers, more than once with the same value.
+*
+* With XAIELIB_TXN_OPT_EXPORT, executed commands are kept in the buffer and
+* XAieLib_TxnExport() returns the whole transaction in a format that
+* XAieLib_TxnReplay() can run later, in this or another process. The buffer
+* starts with a header of XAIELIB_TXN_HDR_WORDS words:
+*	word 0: XAIELIB_TXN_MAGIC
+*	word 1: XAIELIB_TXN_VERSION
+*	word 2: size of the transaction in words, header included
+*	word 3: number of commands
+* followed by the commands. The first word of a command holds the opcode in
+* bits 31:24 and the number of data words of a block write in bits 23:0, the
+* next two the low and high words of the address:
+*	XAIELIB_TXN_OP_WRITE:		data words
+*	XAIELIB_TXN_OP_MASKWRITE:	mask, data
+*	XAIELIB_TXN_OP_MASKPOLL:	mask, value, timeout in usec
+*
+* Transactions are not thread safe. Only one transaction is active at a time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* 1.1  kc      10/18/2026  Size the shadow table with XAIELIB_TXN_SHADOW_BITS
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIELIB_TXN_H
+#define XAIELIB_TXN_H
+
+/***************************** Include Files *********************************/
+#include "xaielib.h"
+#include <stddef.h>
+
+/************************** Constant Definitions *****************************/
+#define XAIELIB_TXN_OPT_DEDUP		0x1U	/* Drop redundant writes */
+#define XAIELIB_TXN_OPT_EXPORT		0x2U	/* Keep commands for export */
+
+#define XAIELIB_TXN_MAGIC		0x54454941U	/* "AIET" */
+#define XAIELIB_TXN_VERSION		1U
+#define XAIELIB_TXN_HDR_WORDS		4U
+
+#define XAIELIB_TXN_OP_WRITE		0x1U
+#define XAIELIB_TXN_OP_MASKWRITE	0x2U
+#define XAIELIB_TXN_OP_MASKPOLL		0x3U
+
+#define XAIELIB_TXN_OP_LSB		24U
+#define XAIELIB_TXN_CNT_MASK		0x00FFFFFFU
+
+/* Registers whose value is tracked for XAIELIB_TXN_OPT_DEDUP, as a power of 2 */
+#ifndef XAIELIB_TXN_SHADOW_BITS
+#define XAIELIB_TXN_SHADOW_BITS		10U
+#endif
+#define XAIELIB_TXN_SHADOW_SIZE		(1U << XAIELIB_TXN_SHADOW_BITS)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 Addr;		/**< Register address */
+	u32 Value;		/**< Last value written */
+	u16 Valid;		/**< Entry is in use */
+	u16 Known;		/**< Value is the register value */
+} XAieLib_TxnShadow;
+
+typedef struct {
+	u32 *Buf;		/**< Command buffer */
+	u32 Size;		/**< Size of the buffer in words */
+	u32 Len;		/**< Words used, header included */
+	u32 Done;		/**< Words executed */
+	u32 Last;		/**< Offset of the last block write or 0 */
+	u32 NumCmds;		/**< Commands in the buffer */
+	u32 Flags;		/**< XAIELIB_TXN_OPT_* */
+	u32 Status;		/**< XAIELIB_FAILURE once a poll failed */
+	u32 Partial;		/**< Commands were executed without being kept */
+	u32 NumWrites;		/**< Writes recorded */
+	u32 NumDropped;		/**< Writes dropped as redundant */
+	u32 ShadowCnt;		/**< Shadow entries in use */
+	XAieLib_TxnShadow Shadow[XAIELIB_TXN_SHADOW_SIZE]; /**< Last values */
+} XAieLib_Txn;
+
+/************************** Variable Definitions *****************************/
+extern XAieLib_Txn *XAieLib_TxnActive;
+
+/************************** Function Prototypes  *****************************/
+u32 XAieLib_TxnStart(XAieLib_Txn *TxnPtr, u32 *Buf, u32 Size, u32 Flags);
+u32 XAieLib_TxnFlush(XAieLib_Txn *TxnPtr);
+u32 XAieLib_TxnStop(XAieLib_Txn *TxnPtr);
+u32 XAieLib_TxnExport(XAieLib_Txn *TxnPtr, u32 *NumWords);
+u32 XAieLib_TxnReplay(const u32 *Buf, u32 NumWords);
+
+void XAieLib_TxnWrite32(XAieLib_Txn *TxnPtr, u64 Addr, u32 Data);
+void XAieLib_TxnMaskWrite32(XAieLib_Txn *TxnPtr, u64 Addr, u32 Mask,
+		u32 Data);
+void XAieLib_TxnMaskPoll(XAieLib_Txn *TxnPtr, u64 Addr, u32 Mask, u32 Value,
+		u32 TimeOutUs);
+
+/*****************************************************************************/
+/**
+*
+* This executes the pending commands of the active transaction, if any, before
+* an access that is not recorded.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+#define XAieLib_TxnSync()						\
+	do {								\
+		if (XAieLib_TxnActive != NULL) {			\
+			(void)XAieLib_TxnFlush(XAieLib_TxnActive);	\
+		}							\
+	} while (0)
+
+#endif		/* end of protection macro */
+/** @} */
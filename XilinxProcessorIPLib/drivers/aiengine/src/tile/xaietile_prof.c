@@ -0,0 +1,824 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.c
+* @{
+*
+* This file contains routines for the profiling service of the AIE tiles.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0   kc      10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaietile_event.h"
+#include "xaietile_perfcnt.h"
+#include "xaietile_prof.h"
+#include <string.h>
+
+#ifdef __linux__
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#endif
+
+/***************************** Macro Definitions *****************************/
+#define XAIETILEPROF_EVTSTA_WID			32U
+
+/* Group enables of the memory, stream, cascade and lock stalls */
+#define XAIETILEPROF_CORE_STALL_MASK					\
+	((1U << (XAIETILE_EVENT_CORE_LOCK_STALL -			\
+		 XAIETILE_EVENT_CORE_GROUP_CORE_STALL)) - 1U)
+
+/************************** Variable Definitions *****************************/
+static const XAieTileProf_Counter XAieTileProf_KernelCnt[] = {
+	{XAIETILEPROF_MODULE_CORE, 0U, XAIETILE_EVENT_CORE_TRUE,
+		XAIETILE_EVENT_CORE_TRUE, XAIETILE_PERFCNT_EVENT_INVALID},
+	{XAIETILEPROF_MODULE_CORE, 1U, XAIETILE_EVENT_CORE_ACTIVE,
+		XAIETILE_EVENT_CORE_ACTIVE, XAIETILE_PERFCNT_EVENT_INVALID},
+	{XAIETILEPROF_MODULE_CORE, 2U, XAIETILE_EVENT_CORE_GROUP_CORE_STALL,
+		XAIETILE_EVENT_CORE_GROUP_CORE_STALL,
+		XAIETILE_PERFCNT_EVENT_INVALID},
+	{XAIETILEPROF_MODULE_CORE, 3U, XAIETILE_EVENT_CORE_LOCK_STALL,
+		XAIETILE_EVENT_CORE_LOCK_STALL, XAIETILE_PERFCNT_EVENT_INVALID},
+	{XAIETILEPROF_MODULE_MEM, 0U, XAIETILE_EVENT_MEM_DMA_S2MM_0_GO_TO_IDLE,
+		XAIETILE_EVENT_MEM_DMA_S2MM_0_START_BD,
+		XAIETILE_PERFCNT_EVENT_INVALID},
+	{XAIETILEPROF_MODULE_MEM, 1U, XAIETILE_EVENT_MEM_DMA_MM2S_0_GO_TO_IDLE,
+		XAIETILE_EVENT_MEM_DMA_MM2S_0_START_BD,
+		XAIETILE_PERFCNT_EVENT_INVALID},
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is an internal API to check if a module exists in a tile.
+*
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	Module - XAIETILEPROF_MODULE_*.
+*
+* @return	1 if the module exists in the tile, else 0.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static u8 _XAieTileProf_HasModule(XAieGbl_Tile *TileInstPtr, u8 Module)
+{
+	if (Module == XAIETILEPROF_MODULE_PL) {
+		return (TileInstPtr->TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
+			TileInstPtr->TileType == XAIEGBL_TILE_TYPE_SHIMPL);
+	}
+
+	return (TileInstPtr->TileType == XAIEGBL_TILE_TYPE_AIETILE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes the profiling service.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	TilePtrs - Array of pointers to the tiles to profile. It must
+*		stay valid as long as the service is used.
+* @param	NumTiles - Number of tiles.
+* @param	Ring - Array of RingSize entries for the samples.
+* @param	RingSize - Number of entries in Ring. Must be a power of 2.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE.
+*
+* @note		No counter is configured.
+*
+*******************************************************************************/
+u32 XAieTileProf_Initialize(XAieTileProf *ProfPtr, XAieGbl_Tile **TilePtrs,
+		u32 NumTiles, XAieTileProf_Record *Ring, u32 RingSize)
+{
+	u32 Idx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TilePtrs != XAIE_NULL);
+	XAie_AssertNonvoid(Ring != XAIE_NULL);
+
+	if (RingSize == 0U || (RingSize & (RingSize - 1U)) != 0U ||
+			NumTiles == 0U || NumTiles > 0xFFFFU) {
+		return XAIELIB_FAILURE;
+	}
+	for (Idx = 0U; Idx < NumTiles; Idx++) {
+		if (TilePtrs[Idx] == XAIE_NULL) {
+			return XAIELIB_FAILURE;
+		}
+	}
+
+	memset(ProfPtr, 0, sizeof(*ProfPtr));
+	ProfPtr->TilePtrs = TilePtrs;
+	ProfPtr->NumTiles = NumTiles;
+	ProfPtr->Ring = Ring;
+	ProfPtr->RingSize = RingSize;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API programs the same performance counters on all the tiles of the
+* service and clears them. A counter is only programmed on the tiles which
+* have its module, and samples as 0 on the others.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	Cnt - Array of counter setups. The value of the i-th counter is
+*		in Cnt[i] of the samples.
+* @param	NumCnt - Number of counters, up to XAIETILEPROF_MAX_COUNTERS.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE.
+*
+* @note		Must not be called while the sampling thread runs.
+*
+*******************************************************************************/
+u32 XAieTileProf_Configure(XAieTileProf *ProfPtr,
+		const XAieTileProf_Counter *Cnt, u32 NumCnt)
+{
+	XAieGbl_Tile *TilePtr;
+	const XAieTileProf_Counter *CntPtr;
+	u32 Idx, TileIdx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Cnt != XAIE_NULL || NumCnt == 0U);
+
+	if (ProfPtr->Running || NumCnt > XAIETILEPROF_MAX_COUNTERS) {
+		return XAIELIB_FAILURE;
+	}
+	for (Idx = 0U; Idx < NumCnt; Idx++) {
+		if (Cnt[Idx].Module > XAIETILEPROF_MODULE_PL ||
+				Cnt[Idx].Counter >=
+				((Cnt[Idx].Module == XAIETILEPROF_MODULE_CORE) ?
+				 4U : 2U)) {
+			return XAIELIB_FAILURE;
+		}
+	}
+
+	for (TileIdx = 0U; TileIdx < ProfPtr->NumTiles; TileIdx++) {
+		TilePtr = ProfPtr->TilePtrs[TileIdx];
+		for (Idx = 0U; Idx < NumCnt; Idx++) {
+			CntPtr = &Cnt[Idx];
+			if (!_XAieTileProf_HasModule(TilePtr, CntPtr->Module)) {
+				continue;
+			}
+
+			if (CntPtr->Module == XAIETILEPROF_MODULE_CORE) {
+				XAieTileCore_PerfCounterControl(TilePtr,
+					CntPtr->Counter, CntPtr->StartEvent,
+					CntPtr->StopEvent, CntPtr->ResetEvent);
+				XAieTileCore_PerfCounterSet(TilePtr,
+					CntPtr->Counter, 0U);
+			} else if (CntPtr->Module == XAIETILEPROF_MODULE_MEM) {
+				XAieTileMem_PerfCounterControl(TilePtr,
+					CntPtr->Counter, CntPtr->StartEvent,
+					CntPtr->StopEvent, CntPtr->ResetEvent);
+				XAieTileMem_PerfCounterSet(TilePtr,
+					CntPtr->Counter, 0U);
+			} else {
+				XAieTilePl_PerfCounterControl(TilePtr,
+					CntPtr->Counter, CntPtr->StartEvent,
+					CntPtr->StopEvent, CntPtr->ResetEvent);
+				XAieTilePl_PerfCounterSet(TilePtr,
+					CntPtr->Counter, 0U);
+			}
+		}
+	}
+
+	for (Idx = 0U; Idx < NumCnt; Idx++) {
+		ProfPtr->Cnt[Idx] = Cnt[Idx];
+	}
+	ProfPtr->NumCnt = NumCnt;
+	ProfPtr->IsKernel = 0U;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API programs the counters of the kernel metrics on all the tiles of
+* the service, as listed in xaietile_prof.h.
+*
+* @param	ProfPtr - Pointer to the service instance.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE.
+*
+* @note		The core stall group event of the tiles is set to the memory,
+*		stream, cascade and lock stalls. Must not be called while the
+*		sampling thread runs.
+*
+*******************************************************************************/
+u32 XAieTileProf_ConfigureKernel(XAieTileProf *ProfPtr)
+{
+	XAieGbl_Tile *TilePtr;
+	u32 TileIdx;
+	u32 Status;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	if (ProfPtr->Running) {
+		return XAIELIB_FAILURE;
+	}
+
+	for (TileIdx = 0U; TileIdx < ProfPtr->NumTiles; TileIdx++) {
+		TilePtr = ProfPtr->TilePtrs[TileIdx];
+		if (_XAieTileProf_HasModule(TilePtr, XAIETILEPROF_MODULE_CORE)) {
+			XAieTile_CoreGroupEventSet(TilePtr,
+					XAIETILE_GROUP_EVENT_CORE_CORE_STALL,
+					XAIETILEPROF_CORE_STALL_MASK);
+		}
+	}
+
+	Status = XAieTileProf_Configure(ProfPtr, XAieTileProf_KernelCnt,
+			sizeof(XAieTileProf_KernelCnt) /
+			sizeof(XAieTileProf_KernelCnt[0]));
+	if (Status == XAIELIB_SUCCESS) {
+		ProfPtr->IsKernel = 1U;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the core events whose occurrence is sampled. The status of
+* the events is cleared on the core tiles of the service.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	Events - Array of core event IDs. Event i is bit i of
+*		XAieTileProf_Record.Events.
+* @param	NumEvents - Number of events, up to XAIETILEPROF_MAX_EVENTS.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE.
+*
+* @note		Must not be called while the sampling thread runs.
+*
+*******************************************************************************/
+u32 XAieTileProf_SetEvents(XAieTileProf *ProfPtr, const u8 *Events,
+		u32 NumEvents)
+{
+	XAieGbl_Tile *TilePtr;
+	u32 Idx, TileIdx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Events != XAIE_NULL || NumEvents == 0U);
+
+	if (ProfPtr->Running || NumEvents > XAIETILEPROF_MAX_EVENTS) {
+		return XAIELIB_FAILURE;
+	}
+
+	for (Idx = 0U; Idx < NumEvents; Idx++) {
+		ProfPtr->Event[Idx] = Events[Idx];
+		for (TileIdx = 0U; TileIdx < ProfPtr->NumTiles; TileIdx++) {
+			TilePtr = ProfPtr->TilePtrs[TileIdx];
+			if (_XAieTileProf_HasModule(TilePtr,
+						XAIETILEPROF_MODULE_CORE)) {
+				XAieTile_CoreEventStatusClear(TilePtr,
+					Events[Idx], 1U << (Events[Idx] %
+						XAIETILEPROF_EVTSTA_WID));
+			}
+		}
+	}
+	ProfPtr->NumEvents = NumEvents;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to read the sampled events of a core tile and clear
+* them.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	TilePtr - Pointer to the Tile instance.
+*
+* @return	Bit i set if event i occurred.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static u16 _XAieTileProf_EventsGet(XAieTileProf *ProfPtr,
+		XAieGbl_Tile *TilePtr)
+{
+	u32 Status[128U / XAIETILEPROF_EVTSTA_WID];
+	u32 Clear[128U / XAIETILEPROF_EVTSTA_WID] = {0U};
+	u8 Read = 0U;
+	u32 Word, Bit;
+	u16 Events = 0U;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < ProfPtr->NumEvents; Idx++) {
+		Word = ProfPtr->Event[Idx] / XAIETILEPROF_EVTSTA_WID;
+		Bit = 1U << (ProfPtr->Event[Idx] % XAIETILEPROF_EVTSTA_WID);
+		if (!(Read & (1U << Word))) {
+			Status[Word] = XAieTile_CoreEventStatusGet(TilePtr,
+					ProfPtr->Event[Idx]);
+			Read |= 1U << Word;
+		}
+		if (Status[Word] & Bit) {
+			Events |= 1U << Idx;
+			Clear[Word] |= Bit;
+		}
+	}
+
+	for (Word = 0U; Word < 128U / XAIETILEPROF_EVTSTA_WID; Word++) {
+		if (Clear[Word] != 0U) {
+			XAieTile_CoreEventStatusClear(TilePtr,
+					Word * XAIETILEPROF_EVTSTA_WID,
+					Clear[Word]);
+		}
+	}
+
+	return Events;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API samples the counters and the events of all the tiles of the
+* service. One record per tile is added to the ring.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	TimeUs - Time of the sample in usec, stored in the records.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE if a record
+*		was dropped because the ring is full.
+*
+* @note		Only one context may call this at a time, and not while the
+*		sampling thread runs.
+*
+*******************************************************************************/
+u32 XAieTileProf_Sample(XAieTileProf *ProfPtr, u64 TimeUs)
+{
+	XAieGbl_Tile *TilePtr;
+	XAieTileProf_Record *SmplPtr;
+	const XAieTileProf_Counter *CntPtr;
+	u32 Status = XAIELIB_SUCCESS;
+	u32 Head, Idx, TileIdx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	Head = ProfPtr->Head;
+	for (TileIdx = 0U; TileIdx < ProfPtr->NumTiles; TileIdx++) {
+		if (Head - __atomic_load_n(&ProfPtr->Tail, __ATOMIC_ACQUIRE) ==
+				ProfPtr->RingSize) {
+			ProfPtr->Dropped++;
+			Status = XAIELIB_FAILURE;
+			continue;
+		}
+
+		TilePtr = ProfPtr->TilePtrs[TileIdx];
+		SmplPtr = &ProfPtr->Ring[Head & (ProfPtr->RingSize - 1U)];
+		SmplPtr->TimeUs = TimeUs;
+		SmplPtr->Seq = ProfPtr->Seq;
+		SmplPtr->TileIdx = (u16)TileIdx;
+		SmplPtr->Events = 0U;
+
+		for (Idx = 0U; Idx < XAIETILEPROF_MAX_COUNTERS; Idx++) {
+			SmplPtr->Cnt[Idx] = 0U;
+			if (Idx >= ProfPtr->NumCnt) {
+				continue;
+			}
+			CntPtr = &ProfPtr->Cnt[Idx];
+			if (!_XAieTileProf_HasModule(TilePtr, CntPtr->Module)) {
+				continue;
+			}
+
+			if (CntPtr->Module == XAIETILEPROF_MODULE_CORE) {
+				SmplPtr->Cnt[Idx] = XAieTileCore_PerfCounterGet(
+						TilePtr, CntPtr->Counter);
+			} else if (CntPtr->Module == XAIETILEPROF_MODULE_MEM) {
+				SmplPtr->Cnt[Idx] = XAieTileMem_PerfCounterGet(
+						TilePtr, CntPtr->Counter);
+			} else {
+				SmplPtr->Cnt[Idx] = XAieTilePl_PerfCounterGet(
+						TilePtr, CntPtr->Counter);
+			}
+		}
+
+		if (ProfPtr->NumEvents != 0U &&
+				_XAieTileProf_HasModule(TilePtr,
+					XAIETILEPROF_MODULE_CORE)) {
+			SmplPtr->Events = _XAieTileProf_EventsGet(ProfPtr,
+					TilePtr);
+		}
+
+		/* Publish the record to the consumer */
+		Head++;
+		__atomic_store_n(&ProfPtr->Head, Head, __ATOMIC_RELEASE);
+	}
+	ProfPtr->Seq++;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API takes the oldest records from the ring.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	Buf - Array to return the records.
+* @param	Num - Number of entries in Buf.
+*
+* @return	Number of records returned.
+*
+* @note		May be called while the sampling thread runs, from one
+*		context at a time.
+*
+*******************************************************************************/
+u32 XAieTileProf_Read(XAieTileProf *ProfPtr, XAieTileProf_Record *Buf,
+		u32 Num)
+{
+	u32 Head, Tail;
+	u32 Count = 0U;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Buf != XAIE_NULL || Num == 0U);
+
+	Head = __atomic_load_n(&ProfPtr->Head, __ATOMIC_ACQUIRE);
+	Tail = ProfPtr->Tail;
+	while (Tail != Head && Count < Num) {
+		Buf[Count] = ProfPtr->Ring[Tail & (ProfPtr->RingSize - 1U)];
+		Tail++;
+		Count++;
+	}
+
+	/* Give the entries back to the producer */
+	__atomic_store_n(&ProfPtr->Tail, Tail, __ATOMIC_RELEASE);
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the kernel metrics of a tile between two of its samples,
+* taken with the counters of XAieTileProf_ConfigureKernel().
+*
+* @param	Prev - Previous sample of the tile, or NULL for the first
+*		sample after the counters are configured.
+* @param	Curr - Current sample of the tile.
+* @param	MetricsPtr - Pointer to return the metrics.
+*
+* @return	None.
+*
+* @note		The counters are 32 bit. The samples must be less than 2^32
+*		cycles apart.
+*
+*******************************************************************************/
+void XAieTileProf_KernelMetricsGet(const XAieTileProf_Record *Prev,
+		const XAieTileProf_Record *Curr,
+		XAieTileProf_KernelMetrics *MetricsPtr)
+{
+	u32 Delta[XAIETILEPROF_MAX_COUNTERS];
+	u32 Idx;
+
+	XAie_AssertVoid(Curr != XAIE_NULL);
+	XAie_AssertVoid(MetricsPtr != XAIE_NULL);
+
+	for (Idx = 0U; Idx < XAIETILEPROF_MAX_COUNTERS; Idx++) {
+		Delta[Idx] = Curr->Cnt[Idx] -
+			((Prev != XAIE_NULL) ? Prev->Cnt[Idx] : 0U);
+	}
+
+	MetricsPtr->Cycles = Delta[XAIETILEPROF_KERNEL_CYCLES];
+	MetricsPtr->Active = Delta[XAIETILEPROF_KERNEL_ACTIVE];
+	MetricsPtr->Stall = Delta[XAIETILEPROF_KERNEL_STALL];
+	MetricsPtr->LockWait = Delta[XAIETILEPROF_KERNEL_LOCK];
+	MetricsPtr->S2mmIdle = Delta[XAIETILEPROF_KERNEL_S2MM_IDLE];
+	MetricsPtr->Mm2sIdle = Delta[XAIETILEPROF_KERNEL_MM2S_IDLE];
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+*
+* This is an internal API to return the monotonic time in usec.
+*
+* @return	Time in usec.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static u64 _XAieTileProf_TimeUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000U) + ((u64)Ts.tv_nsec / 1000U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the sampling thread. It samples at each period until the service is
+* stopped. A period is skipped if a sample takes longer.
+*
+* @param	Arg - Pointer to the service instance.
+*
+* @return	NULL.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void *_XAieTileProf_Thread(void *Arg)
+{
+	XAieTileProf *ProfPtr = (XAieTileProf *)Arg;
+	struct timespec Next;
+	u64 NowUs;
+
+	clock_gettime(CLOCK_MONOTONIC, &Next);
+	while (__atomic_load_n(&ProfPtr->Running, __ATOMIC_ACQUIRE)) {
+		NowUs = _XAieTileProf_TimeUs();
+		(void)XAieTileProf_Sample(ProfPtr, NowUs);
+
+		do {
+			Next.tv_nsec += (long)ProfPtr->IntervalUs * 1000L;
+			while (Next.tv_nsec >= 1000000000L) {
+				Next.tv_nsec -= 1000000000L;
+				Next.tv_sec++;
+			}
+		} while ((u64)Next.tv_sec * 1000000U +
+				(u64)Next.tv_nsec / 1000U <=
+				_XAieTileProf_TimeUs());
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &Next, NULL);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a thread which samples all the tiles of the service
+* periodically.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	IntervalUs - Sampling period in usec.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE.
+*
+* @note		The records are read with XAieTileProf_Read().
+*
+*******************************************************************************/
+u32 XAieTileProf_Start(XAieTileProf *ProfPtr, u32 IntervalUs)
+{
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	if (ProfPtr->Running || IntervalUs == 0U) {
+		return XAIELIB_FAILURE;
+	}
+
+	ProfPtr->IntervalUs = IntervalUs;
+	ProfPtr->Running = 1U;
+	if (pthread_create(&ProfPtr->Thread, NULL, _XAieTileProf_Thread,
+				ProfPtr) != 0) {
+		ProfPtr->Running = 0U;
+		XAieLib_print("Failed to create the sampling thread\n");
+		return XAIELIB_FAILURE;
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the sampling thread and waits for it to end.
+*
+* @param	ProfPtr - Pointer to the service instance.
+*
+* @return	None.
+*
+* @note		The records in the ring are kept.
+*
+*******************************************************************************/
+void XAieTileProf_Stop(XAieTileProf *ProfPtr)
+{
+	XAie_AssertVoid(ProfPtr != XAIE_NULL);
+
+	if (!ProfPtr->Running) {
+		return;
+	}
+
+	__atomic_store_n(&ProfPtr->Running, 0U, __ATOMIC_RELEASE);
+	pthread_join(ProfPtr->Thread, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to return a cycle count as a percentage.
+*
+* @param	Val - Cycle count.
+* @param	Cycles - Total cycles.
+*
+* @return	Percentage.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static double _XAieTileProf_Pct(u32 Val, u32 Cycles)
+{
+	return (Cycles != 0U) ? (100.0 * Val / Cycles) : 0.0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes samples to a file, as CSV or as a Chrome trace which can be
+* opened in chrome://tracing or Perfetto.
+*
+* The CSV file has one line per sample with the counter values and the
+* sampled events. With the kernel counters, it also has the kernel metrics
+* since the previous sample of the tile, in percent of the cycles.
+*
+* In the Chrome trace, each tile is a thread, named by its column and row,
+* of the process of its column. The counter increments since the previous
+* sample of the tile, or the kernel metrics, are counter events, and the
+* sampled events are instant events.
+*
+* @param	ProfPtr - Pointer to the service instance.
+* @param	Samples - Array of samples from XAieTileProf_Read(), in the order
+*		they were read.
+* @param	Num - Number of samples.
+* @param	File - Path of the file to write.
+* @param	Format - XAIETILEPROF_FORMAT_CSV or XAIETILEPROF_FORMAT_CHROME.
+*
+* @return	XAIELIB_SUCCESS on success, else XAIELIB_FAILURE.
+*
+* @note		The first sample of a tile in Samples is compared to zero
+*		counters, as after XAieTileProf_Configure().
+*
+*******************************************************************************/
+u32 XAieTileProf_Export(const XAieTileProf *ProfPtr,
+		const XAieTileProf_Record *Samples, u32 Num, const char *File,
+		u32 Format)
+{
+	const XAieTileProf_Record **Last;
+	const XAieTileProf_Record *SmplPtr;
+	const XAieTileProf_Record *PrevPtr;
+	XAieTileProf_KernelMetrics Metrics;
+	XAieGbl_Tile *TilePtr;
+	FILE *Fd;
+	u32 Idx, CntIdx;
+	u8 First = 1U;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Samples != XAIE_NULL || Num == 0U);
+
+	if (File == XAIE_NULL || Format > XAIETILEPROF_FORMAT_CHROME) {
+		return XAIELIB_FAILURE;
+	}
+
+	Last = calloc(ProfPtr->NumTiles, sizeof(*Last));
+	if (Last == XAIE_NULL) {
+		return XAIELIB_FAILURE;
+	}
+	Fd = fopen(File, "w");
+	if (Fd == XAIE_NULL) {
+		free(Last);
+		return XAIELIB_FAILURE;
+	}
+
+	if (Format == XAIETILEPROF_FORMAT_CSV) {
+		fprintf(Fd, "seq,time_us,col,row");
+		for (CntIdx = 0U; CntIdx < ProfPtr->NumCnt; CntIdx++) {
+			fprintf(Fd, ",cnt%u", CntIdx);
+		}
+		fprintf(Fd, ",events");
+		if (ProfPtr->IsKernel) {
+			fprintf(Fd, ",cycles,active_pct,stall_pct,"
+					"lock_wait_pct,s2mm_idle_pct,"
+					"mm2s_idle_pct");
+		}
+		fprintf(Fd, "\n");
+	} else {
+		fprintf(Fd, "[");
+		for (Idx = 0U; Idx < ProfPtr->NumTiles; Idx++) {
+			TilePtr = ProfPtr->TilePtrs[Idx];
+			fprintf(Fd, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\","
+					"\"pid\":%u,\"tid\":%u,\"args\":"
+					"{\"name\":\"tile_%u_%u\"}}",
+					First ? "" : ",", TilePtr->ColId,
+					TilePtr->RowId, TilePtr->ColId,
+					TilePtr->RowId);
+			First = 0U;
+		}
+	}
+
+	for (Idx = 0U; Idx < Num; Idx++) {
+		SmplPtr = &Samples[Idx];
+		if (SmplPtr->TileIdx >= ProfPtr->NumTiles) {
+			continue;
+		}
+		TilePtr = ProfPtr->TilePtrs[SmplPtr->TileIdx];
+		PrevPtr = Last[SmplPtr->TileIdx];
+		Last[SmplPtr->TileIdx] = SmplPtr;
+		XAieTileProf_KernelMetricsGet(PrevPtr, SmplPtr, &Metrics);
+
+		if (Format == XAIETILEPROF_FORMAT_CSV) {
+			fprintf(Fd, "%u,%llu,%u,%u", SmplPtr->Seq,
+					(unsigned long long)SmplPtr->TimeUs,
+					TilePtr->ColId, TilePtr->RowId);
+			for (CntIdx = 0U; CntIdx < ProfPtr->NumCnt; CntIdx++) {
+				fprintf(Fd, ",%u", SmplPtr->Cnt[CntIdx]);
+			}
+			fprintf(Fd, ",0x%x", SmplPtr->Events);
+			if (ProfPtr->IsKernel) {
+				fprintf(Fd, ",%u,%.1f,%.1f,%.1f,%.1f,%.1f",
+					Metrics.Cycles,
+					_XAieTileProf_Pct(Metrics.Active,
+						Metrics.Cycles),
+					_XAieTileProf_Pct(Metrics.Stall,
+						Metrics.Cycles),
+					_XAieTileProf_Pct(Metrics.LockWait,
+						Metrics.Cycles),
+					_XAieTileProf_Pct(Metrics.S2mmIdle,
+						Metrics.Cycles),
+					_XAieTileProf_Pct(Metrics.Mm2sIdle,
+						Metrics.Cycles));
+			}
+			fprintf(Fd, "\n");
+			continue;
+		}
+
+		fprintf(Fd, "%s\n{\"name\":\"tile_%u_%u\",\"ph\":\"C\","
+				"\"ts\":%llu,\"pid\":%u,\"tid\":%u,\"args\":{",
+				First ? "" : ",", TilePtr->ColId,
+				TilePtr->RowId,
+				(unsigned long long)SmplPtr->TimeUs,
+				TilePtr->ColId, TilePtr->RowId);
+		First = 0U;
+		if (ProfPtr->IsKernel) {
+			fprintf(Fd, "\"active_pct\":%.1f,\"stall_pct\":%.1f,"
+				"\"lock_wait_pct\":%.1f,"
+				"\"s2mm_idle_pct\":%.1f,"
+				"\"mm2s_idle_pct\":%.1f",
+				_XAieTileProf_Pct(Metrics.Active,
+					Metrics.Cycles),
+				_XAieTileProf_Pct(Metrics.Stall,
+					Metrics.Cycles),
+				_XAieTileProf_Pct(Metrics.LockWait,
+					Metrics.Cycles),
+				_XAieTileProf_Pct(Metrics.S2mmIdle,
+					Metrics.Cycles),
+				_XAieTileProf_Pct(Metrics.Mm2sIdle,
+					Metrics.Cycles));
+		} else {
+			for (CntIdx = 0U; CntIdx < ProfPtr->NumCnt; CntIdx++) {
+				fprintf(Fd, "%s\"cnt%u\":%u",
+					CntIdx ? "," : "", CntIdx,
+					SmplPtr->Cnt[CntIdx] -
+					((PrevPtr != XAIE_NULL) ?
+					 PrevPtr->Cnt[CntIdx] : 0U));
+			}
+		}
+		fprintf(Fd, "}}");
+
+		for (CntIdx = 0U; CntIdx < ProfPtr->NumEvents; CntIdx++) {
+			if (!(SmplPtr->Events & (1U << CntIdx))) {
+				continue;
+			}
+			fprintf(Fd, ",\n{\"name\":\"event_%u\",\"ph\":\"i\","
+					"\"s\":\"t\",\"ts\":%llu,\"pid\":%u,"
+					"\"tid\":%u}", ProfPtr->Event[CntIdx],
+					(unsigned long long)SmplPtr->TimeUs,
+					TilePtr->ColId, TilePtr->RowId);
+		}
+	}
+
+	if (Format == XAIETILEPROF_FORMAT_CHROME) {
+		fprintf(Fd, "\n]\n");
+	}
+
+	free(Last);
+	if (fclose(Fd) != 0) {
+		return XAIELIB_FAILURE;
+	}
+
+	return XAIELIB_SUCCESS;
+}
+#endif
+
+/** @} */
@@ -0,0 +1,164 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.h
+* @{
+*
+* Header file for the profiling service of the AIE tiles.
+*
+* The service programs the same set of performance counters on a set of
+* tiles with one call, XAieTileProf_Configure(), and samples them with
+* XAieTileProf_Sample(). Each sample of a tile is one XAieTileProf_Record in
+* a ring owned by the application. The ring has one producer, the
+* sampling, and one consumer, XAieTileProf_Read(), and needs no lock between
+* them.
+*
+* A sample also holds which of up to XAIETILEPROF_MAX_EVENTS core events
+* occurred since the previous sample of the tile. The events are taken from
+* the sticky event status registers, which are cleared at each sample.
+*
+* XAieTileProf_ConfigureKernel() programs the counters of the core tiles to
+* measure the kernels:
+*	core counter 0: cycles
+*	core counter 1: cycles the core is active
+*	core counter 2: cycles the core is stalled, for any reason
+*	core counter 3: cycles the core waits for a lock
+*	memory counter 0: cycles the S2MM 0 DMA channel is idle
+*	memory counter 1: cycles the MM2S 0 DMA channel is idle
+* An idle DMA channel is counted from the end of its last buffer descriptor
+* to the start of the next one.
+*
+* On Linux, XAieTileProf_Start() samples periodically from a thread, and
+* XAieTileProf_Export() writes samples to a CSV or a Chrome trace file. With
+* the simulator IO, which is not thread safe, the application must not access
+* the array while the thread runs, or call XAieTileProf_Sample() itself.
+* Register write transactions must not be active while the thread runs.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  kc      10/18/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIETILE_PROF_H
+#define XAIETILE_PROF_H
+
+/***************************** Include Files *********************************/
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+/***************************** Constant Definitions **************************/
+#define XAIETILEPROF_MODULE_CORE		0U
+#define XAIETILEPROF_MODULE_MEM			1U
+#define XAIETILEPROF_MODULE_PL			2U
+
+#define XAIETILEPROF_MAX_COUNTERS		6U	/* Core 4 + memory 2 */
+#define XAIETILEPROF_MAX_EVENTS			8U
+
+#define XAIETILEPROF_FORMAT_CSV			0U
+#define XAIETILEPROF_FORMAT_CHROME		1U
+
+/* Counter index of the kernel metrics in XAieTileProf_Record.Cnt */
+#define XAIETILEPROF_KERNEL_CYCLES		0U
+#define XAIETILEPROF_KERNEL_ACTIVE		1U
+#define XAIETILEPROF_KERNEL_STALL		2U
+#define XAIETILEPROF_KERNEL_LOCK		3U
+#define XAIETILEPROF_KERNEL_S2MM_IDLE		4U
+#define XAIETILEPROF_KERNEL_MM2S_IDLE		5U
+
+/***************************** Type Definitions ******************************/
+/**
+ * This typedef contains the setup of one performance counter.
+ */
+typedef struct {
+	u8 Module;		/**< XAIETILEPROF_MODULE_* */
+	u8 Counter;		/**< Counter in the module */
+	u16 StartEvent;		/**< Event to start counting */
+	u16 StopEvent;		/**< Event to stop counting */
+	u16 ResetEvent;		/**< Event to reset, or
+				  *  XAIETILE_PERFCNT_EVENT_INVALID */
+} XAieTileProf_Counter;
+
+/**
+ * This typedef contains one sample of a tile.
+ */
+typedef struct {
+	u64 TimeUs;		/**< Time of the sample in usec */
+	u32 Seq;		/**< Sample number */
+	u16 TileIdx;		/**< Index of the tile in the service */
+	u16 Events;		/**< Bit i set if event i occurred */
+	u32 Cnt[XAIETILEPROF_MAX_COUNTERS];	/**< Counter values */
+} XAieTileProf_Record;
+
+/**
+ * This typedef contains the kernel metrics between two samples of a tile.
+ */
+typedef struct {
+	u32 Cycles;		/**< Cycles between the samples */
+	u32 Active;		/**< Cycles the core is active */
+	u32 Stall;		/**< Cycles the core is stalled */
+	u32 LockWait;		/**< Cycles the core waits for a lock */
+	u32 S2mmIdle;		/**< Cycles the S2MM 0 channel is idle */
+	u32 Mm2sIdle;		/**< Cycles the MM2S 0 channel is idle */
+} XAieTileProf_KernelMetrics;
+
+/**
+ * The profiling service instance.
+ */
+typedef struct {
+	XAieGbl_Tile **TilePtrs;	/**< Profiled tiles */
+	u32 NumTiles;			/**< Number of profiled tiles */
+	XAieTileProf_Counter Cnt[XAIETILEPROF_MAX_COUNTERS]; /**< Counters */
+	u32 NumCnt;			/**< Number of counters */
+	u8 IsKernel;			/**< Counters are the kernel metrics */
+	u8 Event[XAIETILEPROF_MAX_EVENTS];	/**< Sampled core events */
+	u32 NumEvents;			/**< Number of sampled events */
+	XAieTileProf_Record *Ring;	/**< Sample ring */
+	u32 RingSize;			/**< Entries in the ring, power of 2 */
+	volatile u32 Head;		/**< Entries written, by the producer */
+	volatile u32 Tail;		/**< Entries read, by the consumer */
+	u32 Dropped;			/**< Samples dropped on a full ring */
+	u32 Seq;			/**< Number of the next sample */
+	u32 IntervalUs;			/**< Period of the sampling thread */
+	volatile u32 Running;		/**< Sampling thread runs */
+#ifdef __linux__
+	pthread_t Thread;		/**< Sampling thread */
+#endif
+} XAieTileProf;
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Function Prototypes  *****************************/
+u32 XAieTileProf_Initialize(XAieTileProf *ProfPtr, XAieGbl_Tile **TilePtrs,
+		u32 NumTiles, XAieTileProf_Record *Ring, u32 RingSize);
+u32 XAieTileProf_Configure(XAieTileProf *ProfPtr,
+		const XAieTileProf_Counter *Cnt, u32 NumCnt);
+u32 XAieTileProf_ConfigureKernel(XAieTileProf *ProfPtr);
+u32 XAieTileProf_SetEvents(XAieTileProf *ProfPtr, const u8 *Events,
+		u32 NumEvents);
+u32 XAieTileProf_Sample(XAieTileProf *ProfPtr, u64 TimeUs);
+u32 XAieTileProf_Read(XAieTileProf *ProfPtr, XAieTileProf_Record *Buf,
+		u32 Num);
+void XAieTileProf_KernelMetricsGet(const XAieTileProf_Record *Prev,
+		const XAieTileProf_Record *Curr,
+		XAieTileProf_KernelMetrics *MetricsPtr);
+#ifdef __linux__
+u32 XAieTileProf_Start(XAieTileProf *ProfPtr, u32 IntervalUs);
+void XAieTileProf_Stop(XAieTileProf *ProfPtr);
+u32 XAieTileProf_Export(const XAieTileProf *ProfPtr,
+		const XAieTileProf_Record *Samples, u32 Num, const char *File,
+		u32 Format);
+#endif
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -16,6 +16,7 @@ extern "C" {
 #include <xaiengine/xaiegbl_reginit.h>
 #include <xaiengine/xaielib.h>
 #include <xaiengine/xaielib_npi.h>
+#include <xaiengine/xaielib_txn.h>
 #include <xaiengine/xaiepm_clock.h>
 #include <xaiengine/xaietile_core.h>
 #include <xaiengine/xaietile_error.h>
@@ -25,6 +26,7 @@ extern "C" {
 #include <xaiengine/xaietile_noc.h>
 #include <xaiengine/xaietile_perfcnt.h>
 #include <xaiengine/xaietile_pl.h>
+#include <xaiengine/xaietile_prof.h>
 #include <xaiengine/xaietile_plif.h>
 #include <xaiengine/xaietile_shim.h>
 #include <xaiengine/xaietile_strm.h>
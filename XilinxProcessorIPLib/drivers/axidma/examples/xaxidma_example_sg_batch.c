@@ -0,0 +1,430 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xaxidma_example_sg_batch.c
+ *
+ * This file demonstrates how to use the batched BD API of the xaxidma driver
+ * on the Xilinx AXI DMA core (AXIDMA) configured in Scatter Gather Mode.
+ * Receive buffers and transmit packets are queued with
+ * XAxiDma_BdRingSubmit(), completions are collected with
+ * XAxiDma_BdRingReap(), and the receive ring runs with adaptive interrupt
+ * coalescing so the packet threshold follows the completion rate.
+ *
+ * Each transmit packet is made of two buffers, a header and a payload, to
+ * show chained BDs. The example polls for completion.
+ *
+ * This code assumes a loopback hardware widget is connected to the AXI DMA
+ * core for data packet loopback.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 9.16  kc   10/18/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+/***************************** Include Files *********************************/
+#include "xaxidma.h"
+#include "xparameters.h"
+#include "xdebug.h"
+
+#ifdef __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#if (!defined(DEBUG))
+extern void xil_printf(const char *format, ...);
+#endif
+
+/******************** Constant Definitions **********************************/
+
+/*
+ * Device hardware build related constants.
+ */
+
+#define DMA_DEV_ID		XPAR_AXIDMA_0_DEVICE_ID
+
+#ifdef XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif defined (XPAR_MIG7SERIES_0_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_MIG7SERIES_0_BASEADDR
+#elif defined (XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR
+#elif defined (XPAR_PSU_DDR_0_S_AXI_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#endif
+
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR		0x01000000
+#else
+#define MEM_BASE_ADDR		(DDR_BASE_ADDR + 0x1000000)
+#endif
+
+#define TX_BD_SPACE_BASE	(MEM_BASE_ADDR)
+#define TX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x00000FFF)
+#define RX_BD_SPACE_BASE	(MEM_BASE_ADDR + 0x00001000)
+#define RX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x00001FFF)
+#define TX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00100000)
+#define RX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00300000)
+
+#define MARK_UNCACHEABLE        0x701
+
+#define HDR_LEN			0x10	/* First buffer of a packet */
+#define PAYLOAD_LEN		0x70	/* Second buffer of a packet */
+#define MAX_PKT_LEN		(HDR_LEN + PAYLOAD_LEN)
+
+#define NUMBER_OF_PKTS		32	/* Packets per burst */
+#define NUMBER_OF_BURSTS	8
+
+/* Adaptive coalescing range and delay timer of the RX ring */
+#define COALESCE_MIN		1
+#define COALESCE_MAX		16
+#define COALESCE_TIMER		100
+
+#define TEST_START_VALUE	0xC
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static int RingSetup(XAxiDma_BdRing *RingPtr, UINTPTR BdSpace, u32 Size);
+static int RxFill(XAxiDma_BdRing *RxRingPtr, u32 Burst);
+static int SendBurst(XAxiDma_BdRing *TxRingPtr, u32 Burst);
+static int ReapBurst(XAxiDma_BdRing *TxRingPtr, XAxiDma_BdRing *RxRingPtr,
+			u32 Burst);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XAxiDma AxiDma;
+
+static XAxiDma_IoVec IoVec[2 * NUMBER_OF_PKTS];
+static XAxiDma_Completion Done[2 * NUMBER_OF_PKTS];
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* Sets up both rings, then loops NUMBER_OF_BURSTS bursts of NUMBER_OF_PKTS
+* packets through the loopback widget and checks the received data.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if test passes
+*		- XST_FAILURE if test fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	XAxiDma_Config *Config;
+	XAxiDma_BdRing *TxRingPtr;
+	XAxiDma_BdRing *RxRingPtr;
+	u32 Burst;
+	u32 Counter;
+	u32 Timer;
+	int Status;
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+
+#ifdef __aarch64__
+	Xil_SetTlbAttributes(TX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+	Xil_SetTlbAttributes(RX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+#endif
+
+	Config = XAxiDma_LookupConfig(DMA_DEV_ID);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", DMA_DEV_ID);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_CfgInitialize(&AxiDma, Config);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	if(!XAxiDma_HasSg(&AxiDma)) {
+		xil_printf("Device configured as Simple mode \r\n");
+
+		return XST_FAILURE;
+	}
+
+	TxRingPtr = XAxiDma_GetTxRing(&AxiDma);
+	RxRingPtr = XAxiDma_GetRxRing(&AxiDma);
+
+	Status = RingSetup(TxRingPtr, TX_BD_SPACE_BASE,
+			TX_BD_SPACE_HIGH - TX_BD_SPACE_BASE + 1);
+	if (Status != XST_SUCCESS) {
+		goto ERR;
+	}
+
+	Status = RingSetup(RxRingPtr, RX_BD_SPACE_BASE,
+			RX_BD_SPACE_HIGH - RX_BD_SPACE_BASE + 1);
+	if (Status != XST_SUCCESS) {
+		goto ERR;
+	}
+
+	Status = XAxiDma_BdRingSetAdaptiveCoalesce(RxRingPtr, COALESCE_MIN,
+			COALESCE_MAX, COALESCE_TIMER);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX adaptive coalesce failed %d\r\n", Status);
+		goto ERR;
+	}
+
+	for (Burst = 0; Burst < NUMBER_OF_BURSTS; Burst++) {
+		Status = RxFill(RxRingPtr, Burst);
+		if (Status != XST_SUCCESS) {
+			goto ERR;
+		}
+
+		Status = SendBurst(TxRingPtr, Burst);
+		if (Status != XST_SUCCESS) {
+			goto ERR;
+		}
+
+		Status = ReapBurst(TxRingPtr, RxRingPtr, Burst);
+		if (Status != XST_SUCCESS) {
+			goto ERR;
+		}
+
+		XAxiDma_BdRingGetCoalesce(RxRingPtr, &Counter, &Timer);
+		xil_printf("Burst %d: RX coalesce counter %d timer %d\r\n",
+			Burst, Counter, Timer);
+	}
+
+	xil_printf("Successfully ran AXI DMA SG Batch Example\r\n");
+	xil_printf("--- Exiting main() --- \r\n");
+
+	return XST_SUCCESS;
+
+ERR:
+	xil_printf("AXI DMA SG Batch Example Failed\r\n");
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates a BD ring in the given space, clones an all-zero
+* template into it and starts the channel.
+*
+* @param	RingPtr is the ring to set up.
+* @param	BdSpace is the address of the BD space.
+* @param	Size is the size of the BD space in bytes.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RingSetup(XAxiDma_BdRing *RingPtr, UINTPTR BdSpace, u32 Size)
+{
+	XAxiDma_Bd BdTemplate;
+	u32 BdCount;
+	int Status;
+
+	XAxiDma_BdRingIntDisable(RingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT, Size);
+
+	Status = XAxiDma_BdRingCreate(RingPtr, BdSpace, BdSpace,
+				XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Create BD ring failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+
+	Status = XAxiDma_BdRingClone(RingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Clone BD failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingStart(RingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Start BD ring failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues one receive buffer per packet of the burst.
+*
+* @param	RxRingPtr is the RX ring.
+* @param	Burst is the burst number, used as part of the BD Id.
+*
+* @return	XST_SUCCESS if the buffers are queued, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RxFill(XAxiDma_BdRing *RxRingPtr, u32 Burst)
+{
+	UINTPTR RxBufferPtr = RX_BUFFER_BASE;
+	int Index;
+	int Status;
+
+	for (Index = 0; Index < NUMBER_OF_PKTS; Index++) {
+		memset((void *)RxBufferPtr, 0, MAX_PKT_LEN);
+
+		IoVec[Index].BufAddr = RxBufferPtr;
+		IoVec[Index].Len = MAX_PKT_LEN;
+		IoVec[Index].Id = (Burst << 16) | Index;
+
+		RxBufferPtr += MAX_PKT_LEN;
+	}
+
+	Status = XAxiDma_BdRingSubmit(RxRingPtr, IoVec, NUMBER_OF_PKTS, 0);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX submit failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds NUMBER_OF_PKTS packets of a header and a payload
+* buffer and queues them with one XAxiDma_BdRingSubmit() call per packet.
+*
+* @param	TxRingPtr is the TX ring.
+* @param	Burst is the burst number, mixed into the data pattern.
+*
+* @return	XST_SUCCESS if the packets are queued, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SendBurst(XAxiDma_BdRing *TxRingPtr, u32 Burst)
+{
+	u8 *TxPacket = (u8 *)TX_BUFFER_BASE;
+	u8 Value;
+	int Index;
+	int Pkt;
+	int Status;
+
+	for (Pkt = 0; Pkt < NUMBER_OF_PKTS; Pkt++) {
+		Value = (TEST_START_VALUE + Burst + Pkt) & 0xFF;
+		for (Index = 0; Index < MAX_PKT_LEN; Index++) {
+			TxPacket[Index] = Value;
+			Value = (Value + 1) & 0xFF;
+		}
+
+		IoVec[0].BufAddr = (UINTPTR)TxPacket;
+		IoVec[0].Len = HDR_LEN;
+		IoVec[0].Id = (Burst << 16) | Pkt;
+		IoVec[1].BufAddr = (UINTPTR)TxPacket + HDR_LEN;
+		IoVec[1].Len = PAYLOAD_LEN;
+		IoVec[1].Id = (Burst << 16) | Pkt;
+
+		Status = XAxiDma_BdRingSubmit(TxRingPtr, IoVec, 2,
+				XAXIDMA_SUBMIT_PACKET);
+		if (Status != XST_SUCCESS) {
+			xil_printf("TX submit failed %d\r\n", Status);
+			return XST_FAILURE;
+		}
+
+		TxPacket += MAX_PKT_LEN;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reaps the TX and RX completions of a burst and checks the
+* received data.
+*
+* @param	TxRingPtr is the TX ring.
+* @param	RxRingPtr is the RX ring.
+* @param	Burst is the burst number.
+*
+* @return	- XST_SUCCESS if the data is correct,
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int ReapBurst(XAxiDma_BdRing *TxRingPtr, XAxiDma_BdRing *RxRingPtr,
+			u32 Burst)
+{
+	int TxDone = 0;
+	int RxDone = 0;
+	int Cnt;
+	int Index;
+	u32 Pkt;
+	u32 Offset;
+	u8 *RxPacket;
+	u8 Value;
+
+	while ((TxDone < (2 * NUMBER_OF_PKTS)) || (RxDone < NUMBER_OF_PKTS)) {
+		Cnt = XAxiDma_BdRingReap(TxRingPtr, Done, 2 * NUMBER_OF_PKTS, 0);
+		for (Index = 0; Index < Cnt; Index++) {
+			if (Done[Index].Status & XAXIDMA_BD_STS_ALL_ERR_MASK) {
+				xil_printf("TX error status %x\r\n",
+					Done[Index].Status);
+				return XST_FAILURE;
+			}
+		}
+		TxDone += Cnt;
+
+		Cnt = XAxiDma_BdRingReap(RxRingPtr, Done, NUMBER_OF_PKTS, 0);
+		for (Index = 0; Index < Cnt; Index++) {
+			if ((Done[Index].Status & XAXIDMA_BD_STS_ALL_ERR_MASK) ||
+			    (Done[Index].Len != MAX_PKT_LEN) ||
+			    ((Done[Index].Id >> 16) != Burst)) {
+				xil_printf("RX bad completion %x len %d id %x\r\n",
+					Done[Index].Status, Done[Index].Len,
+					Done[Index].Id);
+				return XST_FAILURE;
+			}
+
+			/* XAxiDma_BdRingReap() invalidated the buffer */
+			Pkt = Done[Index].Id & 0xFFFF;
+			RxPacket = (u8 *)Done[Index].BufAddr;
+			Value = (TEST_START_VALUE + Burst + Pkt) & 0xFF;
+			for (Offset = 0; Offset < MAX_PKT_LEN; Offset++) {
+				if (RxPacket[Offset] != Value) {
+					xil_printf("Data error pkt %d %d: "
+						"%x/%x\r\n", Pkt, Offset,
+						(unsigned int)RxPacket[Offset],
+						(unsigned int)Value);
+					return XST_FAILURE;
+				}
+				Value = (Value + 1) & 0xFF;
+			}
+		}
+		RxDone += Cnt;
+	}
+
+	return XST_SUCCESS;
+}
@@ -0,0 +1,260 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file bdring_test.c
+ *
+ * Host test of the batched BD ring API of the AXI DMA driver, with
+ * xaxidma_bdring.c compiled into this tool. The channel registers are an
+ * array and the hardware is modelled by marking the BDs given to it as
+ * completed, with the length they were submitted with.
+ *
+ * The test checks that XAxiDma_BdRingSubmit() builds a single Tx packet from
+ * an IoVec, moves the tail pointer once to its last BD and does the cache
+ * maintenance of every buffer, and that it gives back the BDs of a rejected
+ * request. XAxiDma_BdRingReap() must not return a partly completed packet
+ * and must report the address, length and Id of each buffer. The packet
+ * threshold of adaptive coalescing must climb to its maximum while every
+ * interrupt finds a full threshold of packets, and fall back to 1 with the
+ * delay timer disabled when the packets come one at a time.
+ *
+ * Usage: bdring_test
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   kc   10/18/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "xaxidma_bdring.h"
+
+#define TEST_NUM_BDS		16
+#define TEST_MAX_COALESCE	16U
+#define TEST_TIMER		10U
+#define TEST_BUF_BASE		0x100000U
+#define TEST_BUF_END		0x200000U
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+				__LINE__, #Cond);			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+static u32 Regs[XAXIDMA_RX_OFFSET / 4U];
+static u32 BdSpace[TEST_NUM_BDS * XAXIDMA_BD_MINIMUM_ALIGNMENT / 4U]
+	__attribute__ ((aligned (XAXIDMA_BD_MINIMUM_ALIGNMENT)));
+static XAxiDma_BdRing Ring;
+static XAxiDma_IoVec IoVec[TEST_NUM_BDS + 1];
+static XAxiDma_Completion Done[TEST_NUM_BDS];
+static u32 Flushes;
+static u32 Invalidates;
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	(void)vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+/* Only the cache maintenance of the buffers is counted, not of the BDs */
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len)
+{
+	(void)len;
+	if ((adr >= TEST_BUF_BASE) && (adr < TEST_BUF_END)) {
+		Flushes++;
+	}
+}
+
+void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len)
+{
+	(void)len;
+	if ((adr >= TEST_BUF_BASE) && (adr < TEST_BUF_END)) {
+		Invalidates++;
+	}
+}
+
+/*
+ * Completes the next Count BDs given to the hardware, setting the Rx end of
+ * frame on each one for an Rx channel.
+ */
+static void HwComplete(int Count)
+{
+	XAxiDma_Bd *BdPtr = Ring.HwHead;
+	u32 Sts;
+	int i;
+
+	for (i = 0; i < Count; i++) {
+		Sts = XAXIDMA_BD_STS_COMPLETE_MASK |
+			XAxiDma_BdGetLength(BdPtr, Ring.MaxTransferLen);
+		if (Ring.IsRxChannel) {
+			Sts |= XAXIDMA_BD_STS_RXEOF_MASK;
+		}
+		XAxiDma_BdWrite(BdPtr, XAXIDMA_BD_STS_OFFSET, Sts);
+		BdPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(&Ring, BdPtr);
+	}
+}
+
+static u32 CoalesceCount(void)
+{
+	return (Regs[XAXIDMA_CR_OFFSET / 4U] & XAXIDMA_COALESCE_MASK) >>
+		XAXIDMA_COALESCE_SHIFT;
+}
+
+static u32 CoalesceTimer(void)
+{
+	return (Regs[XAXIDMA_CR_OFFSET / 4U] & XAXIDMA_DELAY_MASK) >>
+		XAXIDMA_DELAY_SHIFT;
+}
+
+static int SetupRing(void)
+{
+	XAxiDma_Bd Template;
+	int i;
+
+	memset(&Ring, 0, sizeof(Ring));
+	memset(Template, 0, sizeof(Template));
+	Ring.ChanBase = (UINTPTR)Regs;
+	Ring.MaxTransferLen = 0x3FFFFFFU;
+	Ring.DataWidth = 4;
+	TEST_CHECK(XAxiDma_BdRingCreate(&Ring, (UINTPTR)BdSpace,
+		(UINTPTR)BdSpace, XAXIDMA_BD_MINIMUM_ALIGNMENT,
+		TEST_NUM_BDS) == XST_SUCCESS);
+	TEST_CHECK(XAxiDma_BdRingClone(&Ring, &Template) == XST_SUCCESS);
+	Ring.RunState = AXIDMA_CHANNEL_NOT_HALTED;
+
+	for (i = 0; i <= TEST_NUM_BDS; i++) {
+		IoVec[i].BufAddr = TEST_BUF_BASE + ((UINTPTR)i * 0x1000U);
+		IoVec[i].Len = 64U + (u32)i;
+		IoVec[i].Id = 100U + (u32)i;
+	}
+
+	return XST_SUCCESS;
+}
+
+static int TxPacket(void)
+{
+	XAxiDma_Bd *BdPtr;
+
+	Flushes = 0U;
+	TEST_CHECK(XAxiDma_BdRingSubmit(&Ring, IoVec, 3,
+		XAXIDMA_SUBMIT_PACKET) == XST_SUCCESS);
+	TEST_CHECK((Ring.HwCnt == 3) && (Ring.FreeCnt == (TEST_NUM_BDS - 3)));
+	TEST_CHECK(Flushes == 3U);
+
+	BdPtr = Ring.HwHead;
+	TEST_CHECK(XAxiDma_BdGetCtrl(BdPtr) == XAXIDMA_BD_CTRL_TXSOF_MASK);
+	BdPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(&Ring, BdPtr);
+	TEST_CHECK(XAxiDma_BdGetCtrl(BdPtr) == 0U);
+	BdPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(&Ring, BdPtr);
+	TEST_CHECK(XAxiDma_BdGetCtrl(BdPtr) == XAXIDMA_BD_CTRL_TXEOF_MASK);
+	TEST_CHECK(Regs[XAXIDMA_TDESC_OFFSET / 4U] == (u32)(UINTPTR)BdPtr);
+
+	/* Nothing completed, then a partly completed packet */
+	TEST_CHECK(XAxiDma_BdRingReap(&Ring, Done, TEST_NUM_BDS, 0U) == 0);
+	HwComplete(2);
+	TEST_CHECK(XAxiDma_BdRingReap(&Ring, Done, TEST_NUM_BDS, 0U) == 0);
+	HwComplete(3);
+	TEST_CHECK(XAxiDma_BdRingReap(&Ring, Done, TEST_NUM_BDS, 0U) == 3);
+	TEST_CHECK((Done[0].Id == IoVec[0].Id) && (Done[2].Id == IoVec[2].Id));
+	TEST_CHECK(Done[1].Len == IoVec[1].Len);
+	TEST_CHECK(Done[2].BufAddr == IoVec[2].BufAddr);
+	TEST_CHECK((Ring.FreeCnt == TEST_NUM_BDS) && (Ring.HwCnt == 0) &&
+		(Ring.PostCnt == 0));
+
+	return XST_SUCCESS;
+}
+
+static int Rejected(void)
+{
+	XAxiDma_IoVec Bad[2] = {
+		{0x1000U, 16U, 1U},
+		{0x2000U, 0U, 2U},
+	};
+
+	/* A zero length buffer and more buffers than BDs */
+	TEST_CHECK(XAxiDma_BdRingSubmit(&Ring, Bad, 2, 0U) ==
+		XST_INVALID_PARAM);
+	TEST_CHECK((Ring.FreeCnt == TEST_NUM_BDS) && (Ring.PreCnt == 0));
+	TEST_CHECK(XAxiDma_BdRingSubmit(&Ring, IoVec, TEST_NUM_BDS + 1, 0U) ==
+		XST_FAILURE);
+	TEST_CHECK(Ring.FreeCnt == TEST_NUM_BDS);
+	TEST_CHECK(XAxiDma_BdRingSetAdaptiveCoalesce(&Ring, 1U,
+		TEST_MAX_COALESCE, 0U) == XST_INVALID_PARAM);
+
+	return XST_SUCCESS;
+}
+
+static int RxAdaptive(void)
+{
+	int Count;
+	int i;
+
+	Ring.IsRxChannel = 1;
+	TEST_CHECK(XAxiDma_BdRingSetAdaptiveCoalesce(&Ring, 1U,
+		TEST_MAX_COALESCE, TEST_TIMER) == XST_SUCCESS);
+	TEST_CHECK((CoalesceCount() == 1U) && (CoalesceTimer() == 0U));
+
+	/* Busy channel, every interrupt finds one packet more than needed */
+	printf("high load thresholds:");
+	for (i = 0; i < 6; i++) {
+		Count = (int)Ring.CoalesceCnt + 1;
+		if (Count > TEST_NUM_BDS) {
+			Count = TEST_NUM_BDS;
+		}
+		Invalidates = 0U;
+		TEST_CHECK(XAxiDma_BdRingSubmit(&Ring, IoVec, Count, 0U) ==
+			XST_SUCCESS);
+		HwComplete(Count);
+		TEST_CHECK(XAxiDma_BdRingReap(&Ring, Done, TEST_NUM_BDS, 0U) ==
+			Count);
+		TEST_CHECK(Invalidates == (u32)(2 * Count));
+		printf(" %u", CoalesceCount());
+	}
+	printf("\n");
+	TEST_CHECK((CoalesceCount() == TEST_MAX_COALESCE) &&
+		(CoalesceTimer() == TEST_TIMER));
+
+	/* Quiet channel, the delay timer raises each interrupt */
+	printf("low load thresholds:");
+	for (i = 0; i < 12; i++) {
+		TEST_CHECK(XAxiDma_BdRingSubmit(&Ring, IoVec, 1, 0U) ==
+			XST_SUCCESS);
+		HwComplete(1);
+		TEST_CHECK(XAxiDma_BdRingReap(&Ring, Done, TEST_NUM_BDS, 0U) ==
+			1);
+		printf(" %u", CoalesceCount());
+	}
+	printf("\n");
+	TEST_CHECK((CoalesceCount() == 1U) && (CoalesceTimer() == 0U));
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	if ((SetupRing() != XST_SUCCESS) || (TxPacket() != XST_SUCCESS) ||
+		(Rejected() != XST_SUCCESS) || (RxAdaptive() != XST_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
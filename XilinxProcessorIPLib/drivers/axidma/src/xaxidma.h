@@ -455,6 +455,8 @@
 * 9.15  sa   08/12/22 Updated the examples to use latest MIG cannoical define
 * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
 *      adk   08/16/22 Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.16  kc   10/18/26 Added batched BD submit/reap API and adaptive interrupt
+*		       coalescing, see XAxiDma_BdRingSubmit().
 * </pre>
 *
 ******************************************************************************/
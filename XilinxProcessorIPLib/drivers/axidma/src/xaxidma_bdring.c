@@ -44,6 +44,8 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.16  kc   10/18/26  Added XAxiDma_BdRingSubmit(), XAxiDma_BdRingReap() and
+*		       XAxiDma_BdRingSetAdaptiveCoalesce().
 *
 * </pre>
 ******************************************************************************/
@@ -59,6 +61,9 @@
  */
 #define XAXIDMA_STOP_TIMEOUT	500000   /* about 100 milliseconds on 100MHz */
 
+/* Largest packet threshold supported by the coalescing counter */
+#define XAXIDMA_COALESCE_MAX	0xFFU
+
 /**************************** Type Definitions *******************************/
 
 
@@ -143,6 +148,8 @@
 
 /************************** Function Prototypes ******************************/
 
+static void XAxiDma_BdRingAdaptCoalesce(XAxiDma_BdRing * RingPtr, u32 Pkts);
+
 /************************** Variable Definitions *****************************/
 
 
@@ -1379,6 +1386,332 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 
 	return XST_SUCCESS;
 }
+/*****************************************************************************/
+/**
+ * Submit a list of buffers to hardware in one call. One BD is allocated per
+ * IoVec entry, filled in and the whole set is committed with a single tail
+ * pointer update.
+ *
+ * For a Tx channel each buffer is sent as its own packet, unless
+ * XAXIDMA_SUBMIT_PACKET is given in which case the buffers form one packet.
+ * Tx buffers are flushed from the data cache and Rx buffers are invalidated
+ * before the BDs are committed, unless XAXIDMA_SUBMIT_NO_CACHE is given.
+ *
+ * <pre>
+ *        XAxiDma_IoVec Iov[2] = {
+ *                {(UINTPTR)Hdr, HDR_LEN, 0},
+ *                {(UINTPTR)Payload, PAYLOAD_LEN, 1},
+ *        };
+ *
+ *        Status = XAxiDma_BdRingSubmit(TxRingPtr, Iov, 2,
+ *                                      XAXIDMA_SUBMIT_PACKET);
+ * </pre>
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	IoVec is the list of buffers to submit.
+ * @param	IoCnt is the number of entries in IoVec.
+ * @param	Flags is a combination of XAXIDMA_SUBMIT_* flags.
+ *
+ * @return
+ *		- XST_SUCCESS if all the buffers were given to hardware
+ *		- XST_INVALID_PARAM if IoVec is NULL, IoCnt is not positive or
+ *		a buffer address or length cannot be programmed in a BD
+ *		- XST_FAILURE if there are not enough free BDs
+ *		- XST_DMA_SG_LIST_ERROR if the ring is out of sync with
+ *		XAxiDma_BdRingAlloc()
+ *		On failure none of the buffers is given to hardware.
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSubmit(XAxiDma_BdRing * RingPtr,
+			const XAxiDma_IoVec *IoVec, int IoCnt, u32 Flags)
+{
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *BdPtr;
+	u32 Ctrl;
+	int Status;
+	int i;
+
+	if ((IoVec == NULL) || (IoCnt <= 0)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSubmit: invalid IoVec "
+			"count %d\r\n", IoCnt);
+
+		return XST_INVALID_PARAM;
+	}
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, IoCnt, &BdSetPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	BdPtr = BdSetPtr;
+	for (i = 0; i < IoCnt; i++) {
+		Status = (int)XAxiDma_BdSetBufAddr(BdPtr, IoVec[i].BufAddr);
+		if (Status != XST_SUCCESS) {
+			Status = XST_INVALID_PARAM;
+			goto ERR;
+		}
+
+		Status = XAxiDma_BdSetLength(BdPtr, IoVec[i].Len,
+				RingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			Status = XST_INVALID_PARAM;
+			goto ERR;
+		}
+
+		Ctrl = 0;
+		if (!(RingPtr->IsRxChannel)) {
+			if (!(Flags & XAXIDMA_SUBMIT_PACKET)) {
+				Ctrl = XAXIDMA_BD_CTRL_TXSOF_MASK |
+					XAXIDMA_BD_CTRL_TXEOF_MASK;
+			}
+			else {
+				if (i == 0) {
+					Ctrl |= XAXIDMA_BD_CTRL_TXSOF_MASK;
+				}
+				if (i == (IoCnt - 1)) {
+					Ctrl |= XAXIDMA_BD_CTRL_TXEOF_MASK;
+				}
+			}
+		}
+		XAxiDma_BdSetCtrl(BdPtr, Ctrl);
+		XAxiDma_BdWrite(BdPtr, XAXIDMA_BD_STS_OFFSET, 0);
+		XAxiDma_BdSetId(BdPtr, IoVec[i].Id);
+
+		if (!(Flags & XAXIDMA_SUBMIT_NO_CACHE)) {
+			if (RingPtr->IsRxChannel) {
+				Xil_DCacheInvalidateRange(IoVec[i].BufAddr,
+						IoVec[i].Len);
+			}
+			else {
+				Xil_DCacheFlushRange(IoVec[i].BufAddr,
+						IoVec[i].Len);
+			}
+		}
+
+		BdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, BdPtr));
+	}
+
+	Status = XAxiDma_BdRingToHw(RingPtr, IoCnt, BdSetPtr);
+	if (Status == XST_SUCCESS) {
+		return XST_SUCCESS;
+	}
+
+ERR:
+	(void)XAxiDma_BdRingUnAlloc(RingPtr, IoCnt, BdSetPtr);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Reap the BDs completed by hardware in bulk. Up to MaxCnt completed BDs are
+ * reported in Done and returned to the free group, so the caller does not
+ * handle BDs at all. Rx buffers are invalidated from the data cache for the
+ * number of bytes received, unless XAXIDMA_SUBMIT_NO_CACHE is given.
+ *
+ * When adaptive coalescing is enabled on the ring, the number of packets
+ * reaped is fed to it. In that mode call this function once per interrupt,
+ * from the interrupt handler or the deferred work it schedules.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	Done is an array of at least MaxCnt entries to be filled.
+ * @param	MaxCnt is the maximum number of BDs to reap.
+ * @param	Flags is a combination of XAXIDMA_SUBMIT_* flags.
+ *
+ * @return	The number of entries filled in Done, 0 if hardware has
+ *		nothing completed.
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingReap(XAxiDma_BdRing * RingPtr,
+			XAxiDma_Completion *Done, int MaxCnt, u32 Flags)
+{
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *BdPtr;
+	u32 Pkts = 0;
+	u32 Ctrl;
+	int NumBd;
+	int i;
+
+	if ((Done == NULL) || (MaxCnt <= 0)) {
+		return 0;
+	}
+
+	NumBd = XAxiDma_BdRingFromHw(RingPtr, MaxCnt, &BdSetPtr);
+
+	BdPtr = BdSetPtr;
+	for (i = 0; i < NumBd; i++) {
+		Done[i].BufAddr = (UINTPTR)XAxiDma_BdGetBufAddr(BdPtr);
+#if defined(__aarch64__) || defined(__arch64__)
+		Done[i].BufAddr |= ((UINTPTR)XAxiDma_BdRead(BdPtr,
+				XAXIDMA_BD_BUFA_MSB_OFFSET) << 32U);
+#endif
+		Done[i].Status = XAxiDma_BdGetSts(BdPtr);
+		Done[i].Len = XAxiDma_BdGetActualLength(BdPtr,
+				RingPtr->MaxTransferLen);
+		Done[i].Id = XAxiDma_BdGetId(BdPtr);
+
+		if (RingPtr->IsRxChannel) {
+			if (Done[i].Status & XAXIDMA_BD_STS_RXEOF_MASK) {
+				Pkts++;
+			}
+			if (!(Flags & XAXIDMA_SUBMIT_NO_CACHE)) {
+				Xil_DCacheInvalidateRange(Done[i].BufAddr,
+						Done[i].Len);
+			}
+		}
+		else {
+			Ctrl = XAxiDma_BdGetCtrl(BdPtr);
+			if (Ctrl & XAXIDMA_BD_CTRL_TXEOF_MASK) {
+				Pkts++;
+			}
+		}
+
+		BdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, BdPtr));
+	}
+
+	if (NumBd > 0) {
+		(void)XAxiDma_BdRingFree(RingPtr, NumBd, BdSetPtr);
+	}
+
+	XAxiDma_BdRingAdaptCoalesce(RingPtr, Pkts);
+
+	return NumBd;
+}
+
+/*****************************************************************************/
+/**
+ * Enable adaptive interrupt coalescing on the ring. The packet threshold
+ * starts at MinCount and is retuned by XAxiDma_BdRingReap() from the number
+ * of packets completed per interrupt:
+ *	- an interrupt that found at least the threshold of packets means the
+ *	  channel is busy, the threshold is doubled up to MaxCount. With a
+ *	  threshold of 1 more than one packet has to be pending.
+ *	- an interrupt raised by the delay timer with fewer packets moves the
+ *	  threshold down to the running average, not below MinCount
+ * This gives an interrupt per packet at low load and few interrupts at high
+ * load. The delay timer bounds the latency of the last packets of a burst;
+ * it is disabled while the threshold is 1.
+ *
+ * Pass MinCount and MaxCount equal to go back to a static setting.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	MinCount is the lowest packet threshold, from 1 to 255.
+ * @param	MaxCount is the highest packet threshold, from MinCount to
+ *		255.
+ * @param	Timer is the waitbound timer used whenever the threshold is
+ *		above 1, from 1 to 255. See XAxiDma_BdRingSetCoalesce().
+ *
+ * @return
+ *		- XST_SUCCESS if adaptive coalescing is set up
+ *		- XST_INVALID_PARAM if a parameter is out of range
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSetAdaptiveCoalesce(XAxiDma_BdRing * RingPtr,
+			u32 MinCount, u32 MaxCount, u32 Timer)
+{
+	int Status;
+
+	if ((MinCount == 0U) || (MinCount > MaxCount) ||
+		(MaxCount > XAXIDMA_COALESCE_MAX) ||
+		(Timer > XAXIDMA_COALESCE_MAX) ||
+		((MaxCount > 1U) && (Timer == 0U))) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSetAdaptiveCoalesce: "
+			"invalid range %d-%d timer %d\r\n", (int)MinCount,
+			(int)MaxCount, (int)Timer);
+
+		return XST_INVALID_PARAM;
+	}
+
+	Status = XAxiDma_BdRingSetCoalesce(RingPtr, MinCount,
+			(MinCount > 1U) ? Timer : 0U);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	RingPtr->CoalesceMin = MinCount;
+	RingPtr->CoalesceMax = MaxCount;
+	RingPtr->CoalesceTimer = Timer;
+	RingPtr->CoalesceCnt = MinCount;
+	RingPtr->CoalesceAvg = MinCount << 4U;
+	RingPtr->AdaptCoalesce = (MinCount != MaxCount) ? 1 : 0;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Retune the packet threshold of a ring in adaptive coalescing mode from the
+ * number of packets completed since the previous call. See
+ * XAxiDma_BdRingSetAdaptiveCoalesce().
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	Pkts is the number of packets reaped.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingAdaptCoalesce(XAxiDma_BdRing * RingPtr, u32 Pkts)
+{
+	u32 Target;
+
+	if (!(RingPtr->AdaptCoalesce) || (Pkts == 0U)) {
+		return;
+	}
+
+	/* Running average with a weight of 1/4 for the new sample */
+	RingPtr->CoalesceAvg = ((RingPtr->CoalesceAvg * 3U) +
+			(Pkts << 4U)) >> 2U;
+
+	/*
+	 * With a threshold of 1 every packet interrupts, only a backlog
+	 * tells a busy channel from a quiet one.
+	 */
+	if ((Pkts > RingPtr->CoalesceCnt) ||
+	    ((Pkts == RingPtr->CoalesceCnt) && (RingPtr->CoalesceCnt > 1U))) {
+		/* Threshold reached, the channel keeps up with more */
+		Target = RingPtr->CoalesceCnt << 1U;
+		if (Target > RingPtr->CoalesceMax) {
+			Target = RingPtr->CoalesceMax;
+		}
+	}
+	else {
+		/* Delay timer expired first, follow the completion rate */
+		Target = (RingPtr->CoalesceAvg + 8U) >> 4U;
+		if (Target < RingPtr->CoalesceMin) {
+			Target = RingPtr->CoalesceMin;
+		}
+		if (Target > RingPtr->CoalesceCnt) {
+			Target = RingPtr->CoalesceCnt;
+		}
+	}
+
+	if (Target != RingPtr->CoalesceCnt) {
+		(void)XAxiDma_BdRingSetCoalesce(RingPtr, Target,
+				(Target > 1U) ? RingPtr->CoalesceTimer : 0U);
+		RingPtr->CoalesceCnt = Target;
+	}
+}
+
 /*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
@@ -44,6 +44,8 @@
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
 * 9.15  adk  08/16/22  Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.16  kc   10/18/26  Added XAxiDma_BdRingSubmit(), XAxiDma_BdRingReap() and
+*		       adaptive interrupt coalescing.
 *
 * </pre>
 *
@@ -73,6 +75,13 @@ extern "C" {
 #define XAXIDMA_NO_CHANGE		0xFFFFFFFF
 #define XAXIDMA_ALL_BDS			0x0FFFFFFF /* 268 Million */
 
+/* Flags for XAxiDma_BdRingSubmit() and XAxiDma_BdRingReap()
+ */
+#define XAXIDMA_SUBMIT_PACKET		0x00000001 /**< Tx: the whole IoVec is
+						     *  one packet */
+#define XAXIDMA_SUBMIT_NO_CACHE		0x00000002 /**< Skip data cache
+						     *  maintenance */
+
 /**************************** Type Definitions *******************************/
 
 /** Container structure for descriptor storage control. If address translation
@@ -110,8 +119,32 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+	int AdaptCoalesce;	/**< Adaptive interrupt coalescing enabled */
+	u32 CoalesceMin;	/**< Lowest packet threshold in adaptive mode */
+	u32 CoalesceMax;	/**< Highest packet threshold in adaptive mode */
+	u32 CoalesceTimer;	/**< Delay timer used in adaptive mode */
+	u32 CoalesceCnt;	/**< Packet threshold currently programmed */
+	u32 CoalesceAvg;	/**< Average packets per reap, 1/16 units */
 } XAxiDma_BdRing;
 
+/** One buffer of a XAxiDma_BdRingSubmit() request
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Buffer length in bytes */
+	u32 Id;			/**< Application cookie, stored in the BD */
+} XAxiDma_IoVec;
+
+/** One completed BD returned by XAxiDma_BdRingReap()
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Number of bytes transferred */
+	u32 Id;			/**< Cookie given with XAxiDma_IoVec */
+	u32 Status;		/**< BD status word, check
+				     XAXIDMA_BD_STS_ALL_ERR_MASK */
+} XAxiDma_Completion;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -543,6 +576,12 @@ int XAxiDma_BdRingStart(XAxiDma_BdRing * RingPtr);
 int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing * RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing * RingPtr,
 		u32 *CounterPtr, u32 *TimerPtr);
+int XAxiDma_BdRingSubmit(XAxiDma_BdRing * RingPtr,
+			const XAxiDma_IoVec *IoVec, int IoCnt, u32 Flags);
+int XAxiDma_BdRingReap(XAxiDma_BdRing * RingPtr,
+			XAxiDma_Completion *Done, int MaxCnt, u32 Flags);
+int XAxiDma_BdRingSetAdaptiveCoalesce(XAxiDma_BdRing * RingPtr,
+			u32 MinCount, u32 MaxCount, u32 Timer);
 
 /* The following functions are for debug only
  */
@@ -32,6 +32,8 @@
 * 3.8  mus  11/05/18 Support 64 bit DMA addresses for Microblaze-X platform.
 * 3.10 hk   05/16/19 Clear status registers properly in reset
 * 3.11 sd   02/14/20 Add clock support
+* 3.18 kc   10/18/26 Support the receive queue 1 pointer in
+*                    XEmacPs_SetQueuePtr.
 *
 * </pre>
 ******************************************************************************/
@@ -102,6 +104,7 @@ LONG XEmacPs_CfgInitialize(XEmacPs *InstancePtr, XEmacPs_Config * CfgPtr,
 	/* Set callbacks to an initial stub routine */
 	InstancePtr->SendHandler = ((XEmacPs_Handler)((void*)XEmacPs_StubHandler));
 	InstancePtr->RecvHandler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
+	InstancePtr->RecvQ1Handler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
 	InstancePtr->ErrorHandler = ((XEmacPs_ErrHandler)(void*)XEmacPs_StubHandler);
 
 	/* Reset the hardware and set default options */
@@ -465,10 +468,20 @@ void XEmacPs_SetQueuePtr(XEmacPs *InstancePtr, UINTPTR QPtr, u8 QueueNum,
 				(QPtr & ULONG64_LO_MASK));
 		}
 	}
-	 else {
+	 else if (Direction == XEMACPS_SEND) {
 		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
 			XEMACPS_TXQ1BASE_OFFSET,
 			(QPtr & ULONG64_LO_MASK));
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_RXQ1BASE_OFFSET,
+			(QPtr & ULONG64_LO_MASK));
+		/* Queue 1 uses the same receive buffer size as queue 0 */
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_RXQ1BUFSIZE_OFFSET,
+			((XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_DMACR_OFFSET) & XEMACPS_DMACR_RXBUF_MASK) >>
+			XEMACPS_DMACR_RXBUF_SHIFT));
 	}
 #ifdef __aarch64__
 	if (Direction == XEMACPS_SEND) {
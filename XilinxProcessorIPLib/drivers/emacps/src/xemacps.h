@@ -309,6 +309,8 @@
  * 3.9   hk   01/23/19 Add RX watermark support
  * 3.11  sd   02/14/20 Add clock support
  * 3.13  nsk  12/14/20 Updated the tcl to not to use the instance names.
+ * 3.18  kc   10/18/26 Add receive priority queue 1 and flow steering through
+ *                     the type 1 and type 2 screeners.
  *
  * </pre>
  *
@@ -438,6 +440,7 @@ extern "C" {
 #define XEMACPS_HANDLER_DMASEND 1U
 #define XEMACPS_HANDLER_DMARECV 2U
 #define XEMACPS_HANDLER_ERROR   3U
+#define XEMACPS_HANDLER_DMARECVQ1 4U
 /*@}*/
 
 /* Constants to determine the configuration of the hardware device. They are
@@ -540,8 +543,10 @@ typedef struct XEmacPs_Instance {
 
 	XEmacPs_Handler SendHandler;
 	XEmacPs_Handler RecvHandler;
+	XEmacPs_Handler RecvQ1Handler;
 	void *SendRef;
 	void *RecvRef;
+	void *RecvQ1Ref;
 
 	XEmacPs_ErrHandler ErrorHandler;
 	void *ErrorRef;
@@ -831,6 +836,13 @@ LONG XEmacPs_PhyRead(XEmacPs *InstancePtr, u32 PhyAddress,
 LONG XEmacPs_PhyWrite(XEmacPs *InstancePtr, u32 PhyAddress,
 		      u32 RegisterNum, u16 PhyData);
 LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index);
+LONG XEmacPs_SetScreenUdpPort(XEmacPs *InstancePtr, u8 Index, u16 Port,
+		u8 QueueNum);
+LONG XEmacPs_SetScreenVlanPrio(XEmacPs *InstancePtr, u8 Index, u8 Prio,
+		u8 QueueNum);
+LONG XEmacPs_SetScreenEthType(XEmacPs *InstancePtr, u8 Index, u16 EthType,
+		u8 QueueNum);
+void XEmacPs_ClearScreeners(XEmacPs *InstancePtr);
 
 LONG XEmacPs_SendPausePacket(XEmacPs *InstancePtr);
 void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength);
@@ -26,6 +26,7 @@
  * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
  * 3.0   hk   02/20/15 Added support for jumbo frames.
  * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+ * 3.18  kc   10/18/26 Added APIs to program the type 1 and type 2 screeners.
  * </pre>
  *****************************************************************************/
 
@@ -409,6 +410,153 @@ LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Steer received UDP frames with the given destination port to a priority
+ * queue using a type 1 screener.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the type 1 screener to use (0-3).
+ * @param Port is the UDP destination port to match.
+ * @param QueueNum is the receive queue the matching frames are written to.
+ *
+ * @return
+ * - XST_SUCCESS if the screener was set successfully
+ * - XST_NO_FEATURE if the device has no priority queues
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetScreenUdpPort(XEmacPs *InstancePtr, u8 Index, u16 Port,
+		u8 QueueNum)
+{
+	LONG Status;
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN_T1);
+
+	if (InstancePtr->Version <= 2U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else {
+		Reg = ((u32)QueueNum & XEMACPS_SCREENT1_QUEUE_MASK) |
+			(((u32)Port << XEMACPS_SCREENT1_UDP_SHIFT) &
+			XEMACPS_SCREENT1_UDP_MASK) | XEMACPS_SCREENT1_UDPEN_MASK;
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			((u32)XEMACPS_SCREENT1_OFFSET + ((u32)Index * (u32)4)), Reg);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Steer received VLAN tagged frames with the given priority to a priority
+ * queue using a type 2 screener.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the type 2 screener to use (0-3).
+ * @param Prio is the VLAN priority (PCP) to match.
+ * @param QueueNum is the receive queue the matching frames are written to.
+ *
+ * @return
+ * - XST_SUCCESS if the screener was set successfully
+ * - XST_NO_FEATURE if the device has no priority queues
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetScreenVlanPrio(XEmacPs *InstancePtr, u8 Index, u8 Prio,
+		u8 QueueNum)
+{
+	LONG Status;
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN_T2);
+
+	if (InstancePtr->Version <= 2U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else {
+		Reg = ((u32)QueueNum & XEMACPS_SCREENT2_QUEUE_MASK) |
+			(((u32)Prio << XEMACPS_SCREENT2_VLANPR_SHIFT) &
+			XEMACPS_SCREENT2_VLANPR_MASK) | XEMACPS_SCREENT2_VLANEN_MASK;
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			((u32)XEMACPS_SCREENT2_OFFSET + ((u32)Index * (u32)4)), Reg);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Steer received frames with the given EtherType to a priority queue using
+ * a type 2 screener. The ethertype register with the same index as the
+ * screener holds the EtherType to match.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the type 2 screener and ethertype register to use (0-3).
+ * @param EthType is the EtherType to match.
+ * @param QueueNum is the receive queue the matching frames are written to.
+ *
+ * @return
+ * - XST_SUCCESS if the screener was set successfully
+ * - XST_NO_FEATURE if the device has no priority queues
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetScreenEthType(XEmacPs *InstancePtr, u8 Index, u16 EthType,
+		u8 QueueNum)
+{
+	LONG Status;
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN_T2);
+
+	if (InstancePtr->Version <= 2U) {
+		Status = (LONG)(XST_NO_FEATURE);
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			((u32)XEMACPS_SCREENT2_ETHT_OFFSET + ((u32)Index * (u32)4)),
+			(u32)EthType);
+		Reg = ((u32)QueueNum & XEMACPS_SCREENT2_QUEUE_MASK) |
+			(((u32)Index << XEMACPS_SCREENT2_ETHIDX_SHIFT) &
+			XEMACPS_SCREENT2_ETHIDX_MASK) | XEMACPS_SCREENT2_ETHEN_MASK;
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			((u32)XEMACPS_SCREENT2_OFFSET + ((u32)Index * (u32)4)), Reg);
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Disable all type 1 and type 2 screeners, all received frames go to queue 0
+ * afterwards.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ *
+ * @return None
+ *
+ *****************************************************************************/
+void XEmacPs_ClearScreeners(XEmacPs *InstancePtr)
+{
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->Version > 2U) {
+		for (Index = 0U; Index < XEMACPS_MAX_SCREEN_T1; Index++) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				(XEMACPS_SCREENT1_OFFSET + (Index * 4U)), 0x0U);
+		}
+		for (Index = 0U; Index < XEMACPS_MAX_SCREEN_T2; Index++) {
+			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				(XEMACPS_SCREENT2_OFFSET + (Index * 4U)), 0x0U);
+		}
+	}
+}
+
 /*****************************************************************************/
 /**
  * Set options for the driver/device. The driver should be stopped with
@@ -38,6 +38,7 @@
 * 3.8  hk   09/17/18 Fix PTP interrupt masks.
 * 3.9  hk   01/23/19 Add RX watermark support
 * 3.10 hk   05/16/19 Clear status registers properly in reset
+* 3.18 kc   10/18/26 Add RX Q1 buffer size and screener register definitions.
 * </pre>
 *
 ******************************************************************************/
@@ -60,6 +61,10 @@ extern "C" {
 #define XEMACPS_MAX_MAC_ADDR     4U   /**< Maxmum number of mac address
                                            supported */
 #define XEMACPS_MAX_TYPE_ID      4U   /**< Maxmum number of type id supported */
+#define XEMACPS_MAX_SCREEN_T1    4U   /**< Maximum number of type 1 screeners
+                                           supported */
+#define XEMACPS_MAX_SCREEN_T2    4U   /**< Maximum number of type 2 screeners
+                                           and ethertype registers supported */
 
 #ifdef __aarch64__
 #define XEMACPS_BD_ALIGNMENT     64U   /**< Minimum buffer descriptor alignment
@@ -281,6 +286,14 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_RXQ1BASE_OFFSET	     0x00000480U /**< RX Q1 Base address
 							reg */
+#define XEMACPS_RXQ1BUFSIZE_OFFSET   0x000004A0U /**< RX Q1 buffer size
+							reg */
+#define XEMACPS_SCREENT1_OFFSET      0x00000500U /**< Screening type 1
+							reg 0 */
+#define XEMACPS_SCREENT2_OFFSET      0x00000540U /**< Screening type 2
+							reg 0 */
+#define XEMACPS_SCREENT2_ETHT_OFFSET 0x000006E0U /**< Screening type 2
+							ethertype reg 0 */
 #define XEMACPS_MSBBUF_TXQBASE_OFFSET  0x000004C8U /**< MSB Buffer TX Q Base
 							reg */
 #define XEMACPS_MSBBUF_RXQBASE_OFFSET  0x000004D4U /**< MSB Buffer RX Q Base
@@ -445,10 +458,43 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
  */
 #define XEMACPS_INTQ1SR_TXCOMPL_MASK	0x00000080U /**< Transmit completed OK */
 #define XEMACPS_INTQ1SR_TXERR_MASK	0x00000040U /**< Transmit AMBA Error */
+#define XEMACPS_INTQ1SR_RXCOMPL_MASK	0x00000002U /**< Frame received OK */
 
 #define XEMACPS_INTQ1_IXR_ALL_MASK	((u32)XEMACPS_INTQ1SR_TXCOMPL_MASK | \
-					 (u32)XEMACPS_INTQ1SR_TXERR_MASK)
+					 (u32)XEMACPS_INTQ1SR_TXERR_MASK | \
+					 (u32)XEMACPS_INTQ1SR_RXCOMPL_MASK)
+
+/*@}*/
+
+/**
+ * @name Screening type 1 register bit definitions
+ * @{
+ */
+#define XEMACPS_SCREENT1_QUEUE_MASK	0x0000000FU /**< Queue number */
+#define XEMACPS_SCREENT1_DSTC_MASK	0x00000FF0U /**< DS/TC match */
+#define XEMACPS_SCREENT1_DSTC_SHIFT	4U	    /**< DS/TC match shift */
+#define XEMACPS_SCREENT1_UDP_MASK	0x0FFFF000U /**< UDP port match */
+#define XEMACPS_SCREENT1_UDP_SHIFT	12U	    /**< UDP port match shift */
+#define XEMACPS_SCREENT1_DSTCEN_MASK	0x10000000U /**< DS/TC match enable */
+#define XEMACPS_SCREENT1_UDPEN_MASK	0x20000000U /**< UDP port match
+							 enable */
+/*@}*/
 
+/**
+ * @name Screening type 2 register bit definitions
+ * @{
+ */
+#define XEMACPS_SCREENT2_QUEUE_MASK	0x0000000FU /**< Queue number */
+#define XEMACPS_SCREENT2_VLANPR_MASK	0x00000070U /**< VLAN priority */
+#define XEMACPS_SCREENT2_VLANPR_SHIFT	4U	    /**< VLAN priority shift */
+#define XEMACPS_SCREENT2_VLANEN_MASK	0x00000100U /**< VLAN priority match
+							 enable */
+#define XEMACPS_SCREENT2_ETHIDX_MASK	0x00000E00U /**< Ethertype register
+							 index */
+#define XEMACPS_SCREENT2_ETHIDX_SHIFT	9U	    /**< Ethertype register
+							 index shift */
+#define XEMACPS_SCREENT2_ETHEN_MASK	0x00001000U /**< Ethertype match
+							 enable */
 /*@}*/
 
 /**
@@ -0,0 +1,483 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xmcdma_sched_example.c
+ *
+ * This file demonstrates how to use the work-queue scheduler of the mcdma
+ * driver on the Xilinx AXI MCDMA core (AXI MCDMA) in polling mode.
+ *
+ * One scheduler drives the MM2S channels with weighted round-robin, channel
+ * N getting weight N. A second scheduler posts the receive buffers on the
+ * S2MM channels. All packets are queued first, then both schedulers are
+ * polled until every packet is received. The data is checked and the per
+ * channel statistics are printed.
+ *
+ * H/W Requirements:
+ * In order to test this example at the h/w level AXI MCDMA MM2S should
+ * be connected to the S2MM channel.
+ *
+ * The example uses un-cached memory for buffer descriptors and uses
+ * Normal memory for buffers, see xmcdma_polled_example.c for the HPC
+ * design considerations.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date       Changes
+ * ----- ---- --------   -------------------------------------------------------
+ * 1.8   kc   18/10/26   Initial Version.
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+/***************************** Include Files *********************************/
+#include "xmcdma.h"
+#include "xmcdma_sched.h"
+#include "xparameters.h"
+#include "xdebug.h"
+#include "xmcdma_hw.h"
+
+#ifdef __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#if !defined (__MICROBLAZE__)
+#include "xtime_l.h"
+#endif
+
+/******************** Constant Definitions **********************************/
+
+/*
+ * Device hardware build related constants.
+ */
+
+#define MCDMA_DEV_ID	XPAR_MCDMA_0_DEVICE_ID
+
+#ifdef XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_BASE_ADDR	XPAR_MIG7SERIES_0_BASEADDR
+#elif XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR
+#define DDR_BASE_ADDR	XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR
+#elif XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#endif
+
+#ifdef XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#endif
+
+#ifdef XPAR_PSU_R5_DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_PSU_R5_DDR_0_S_AXI_BASEADDR
+#endif
+
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR		0x01000000
+#else
+#define MEM_BASE_ADDR		(DDR_BASE_ADDR + 0x10000000)
+#endif
+
+#define TX_BD_SPACE_BASE	(MEM_BASE_ADDR)
+#define RX_BD_SPACE_BASE	(MEM_BASE_ADDR + 0x10000000)
+#define TX_BUFFER_BASE		(MEM_BASE_ADDR + 0x20000000)
+#define RX_BUFFER_BASE		(MEM_BASE_ADDR + 0x50000000)
+
+#define BLOCK_SIZE_2MB 0x200000U
+
+/* BDs in the hardware chain of each channel */
+#define NUMBER_OF_BDS_PER_CHAN	16
+/* Packets sent on each channel */
+#define NUMBER_OF_PKTS_PER_CHAN	64
+/* BDs in hardware over all channels of a scheduler */
+#define MAX_IN_FLIGHT		32
+
+#define MAX_PKT_LEN		1024
+/* Buffer stride, keeps buffers 64 byte aligned without DRE */
+#define PKT_STRIDE		1024
+
+#define NUM_MAX_CHANNELS	16
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define TX_BUF(ChanId, Pkt)	((UINTPTR)TX_BUFFER_BASE + \
+		((((ChanId) - 1) * NUMBER_OF_PKTS_PER_CHAN) + (Pkt)) * PKT_STRIDE)
+#define RX_BUF(ChanId, Pkt)	((UINTPTR)RX_BUFFER_BASE + \
+		((((ChanId) - 1) * NUMBER_OF_PKTS_PER_CHAN) + (Pkt)) * PKT_STRIDE)
+
+/************************** Function Prototypes ******************************/
+static int ChanSetup(XMcdma *McDmaInstPtr, XMcdma_Sched *SchedPtr,
+		     u32 Direction, UINTPTR BdSpace);
+static int QueuePackets(XMcdma *McDmaInstPtr);
+static int CheckCompletions(XMcdma *McDmaInstPtr);
+static void PrintStats(void);
+#if !defined (__MICROBLAZE__)
+static u64 GetTime(void);
+#endif
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XMcdma AxiMcdma;
+XMcdma_Sched TxSched;
+XMcdma_Sched RxSched;
+
+static XMcdma_SchedReq TxSubRing[NUM_MAX_CHANNELS + 1][NUMBER_OF_PKTS_PER_CHAN];
+static XMcdma_SchedCpl TxCplRing[NUM_MAX_CHANNELS + 1][NUMBER_OF_PKTS_PER_CHAN];
+static XMcdma_SchedReq RxSubRing[NUM_MAX_CHANNELS + 1][NUMBER_OF_PKTS_PER_CHAN];
+static XMcdma_SchedCpl RxCplRing[NUM_MAX_CHANNELS + 1][NUMBER_OF_PKTS_PER_CHAN];
+
+int num_channels;
+u32 RxDone;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the scheduler example. It sets up the
+* channels and the two schedulers, queues the packets and polls until all
+* of them are received.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if test passes
+*		- XST_FAILURE if test fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	XMcdma_Config *Mcdma_Config;
+#ifdef __aarch64__
+	int i;
+#endif
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+
+#ifdef __aarch64__
+#if (TX_BD_SPACE_BASE < 0x100000000UL)
+	for (i = 0; i < (RX_BD_SPACE_BASE - TX_BD_SPACE_BASE) / BLOCK_SIZE_2MB; i++) {
+		Xil_SetTlbAttributes(TX_BD_SPACE_BASE + (i * BLOCK_SIZE_2MB), NORM_NONCACHE);
+		Xil_SetTlbAttributes(RX_BD_SPACE_BASE + (i * BLOCK_SIZE_2MB), NORM_NONCACHE);
+	}
+#else
+	Xil_SetTlbAttributes(TX_BD_SPACE_BASE, NORM_NONCACHE);
+#endif
+#endif
+
+	Mcdma_Config = XMcdma_LookupConfig(MCDMA_DEV_ID);
+	if (!Mcdma_Config) {
+		xil_printf("No config found for %d\r\n", MCDMA_DEV_ID);
+		return XST_FAILURE;
+	}
+
+	Status = XMcDma_CfgInitialize(&AxiMcdma, Mcdma_Config);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Read numbers of channels from IP config */
+	num_channels = Mcdma_Config->RxNumChannels;
+	if (Mcdma_Config->TxNumChannels < num_channels) {
+		num_channels = Mcdma_Config->TxNumChannels;
+	}
+
+	Status = XMcdma_SchedInitialize(&TxSched, &AxiMcdma, XMCDMA_MEM_TO_DEV,
+					XMCDMA_SCHED_WRR, MAX_IN_FLIGHT);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XMcdma_SchedInitialize(&RxSched, &AxiMcdma, XMCDMA_DEV_TO_MEM,
+					XMCDMA_SCHED_WRR, 0);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#if !defined (__MICROBLAZE__)
+	XMcdma_SchedSetTimeSource(&TxSched, GetTime);
+	XMcdma_SchedSetTimeSource(&RxSched, GetTime);
+#endif
+
+	Status = ChanSetup(&AxiMcdma, &RxSched, XMCDMA_DEV_TO_MEM,
+			   RX_BD_SPACE_BASE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = ChanSetup(&AxiMcdma, &TxSched, XMCDMA_MEM_TO_DEV,
+			   TX_BD_SPACE_BASE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = QueuePackets(&AxiMcdma);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed to queue packets\r\n");
+		return XST_FAILURE;
+	}
+
+	/* Receive buffers first, so the packets always find one */
+	(void)XMcdma_SchedDispatch(&RxSched);
+	(void)XMcdma_SchedDispatch(&TxSched);
+
+	while (RxDone < (u32)(NUMBER_OF_PKTS_PER_CHAN * num_channels)) {
+		(void)XMcdma_SchedPoll(&TxSched);
+		RxDone += XMcdma_SchedPoll(&RxSched);
+	}
+
+	Status = CheckCompletions(&AxiMcdma);
+
+	PrintStats();
+
+	xil_printf("AXI MCDMA Scheduler Test %s\r\n",
+		(Status == XST_SUCCESS)? "passed":"failed");
+
+	xil_printf("--- Exiting main() --- \r\n");
+
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the BD chains of one direction and adds the
+* channels to the scheduler of that direction.
+*
+* @param	McDmaInstPtr is the pointer to the instance of the AXI MCDMA engine.
+* @param	SchedPtr is the scheduler of the direction.
+* @param	Direction is XMCDMA_MEM_TO_DEV or XMCDMA_DEV_TO_MEM.
+* @param	BdSpace is the start of the BD memory of the direction.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int ChanSetup(XMcdma *McDmaInstPtr, XMcdma_Sched *SchedPtr,
+		     u32 Direction, UINTPTR BdSpace)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_SchedReq *SubRing;
+	XMcdma_SchedCpl *CplRing;
+	u32 Weight;
+	int ChanId;
+	int Status;
+
+	for (ChanId = 1; ChanId <= num_channels; ChanId++) {
+		if (Direction == XMCDMA_DEV_TO_MEM) {
+			Chan = XMcdma_GetMcdmaRxChan(McDmaInstPtr, ChanId);
+			SubRing = RxSubRing[ChanId];
+			CplRing = RxCplRing[ChanId];
+			/* Receive buffers are posted evenly */
+			Weight = 1;
+		} else {
+			Chan = XMcdma_GetMcdmaTxChan(McDmaInstPtr, ChanId);
+			SubRing = TxSubRing[ChanId];
+			CplRing = TxCplRing[ChanId];
+			/* Channel N sends N packets per round */
+			Weight = ChanId;
+		}
+
+		/* Disable all interrupts */
+		XMcdma_IntrDisable(Chan, XMCDMA_IRQ_ALL_MASK);
+
+		Status = XMcDma_ChanBdCreate(Chan, BdSpace,
+					     NUMBER_OF_BDS_PER_CHAN);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Bd create failed with %d\r\n", Status);
+			return XST_FAILURE;
+		}
+
+		Status = XMcdma_SchedChanAdd(SchedPtr, ChanId, Weight,
+					     SubRing, NUMBER_OF_PKTS_PER_CHAN,
+					     CplRing, NUMBER_OF_PKTS_PER_CHAN);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Sched chan add failed with %d\r\n", Status);
+			return XST_FAILURE;
+		}
+
+		BdSpace += NUMBER_OF_BDS_PER_CHAN * Chan->Separation;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the transmit buffers, clears the receive buffers and
+* queues all of them in the schedulers.
+*
+* @param	McDmaInstPtr is the pointer to the instance of the AXI MCDMA engine.
+*
+* @return	XST_SUCCESS if all packets are queued, XST_FAILURE otherwise.
+*
+* @note		The schedulers do the cache maintenance of the buffers.
+*
+******************************************************************************/
+static int QueuePackets(XMcdma *McDmaInstPtr)
+{
+	u8 *TxPacket;
+	int ChanId;
+	int Pkt;
+	int Index;
+	int Status;
+
+	(void)McDmaInstPtr;
+
+	for (ChanId = 1; ChanId <= num_channels; ChanId++) {
+		for (Pkt = 0; Pkt < NUMBER_OF_PKTS_PER_CHAN; Pkt++) {
+			TxPacket = (u8 *)TX_BUF(ChanId, Pkt);
+			for (Index = 0; Index < MAX_PKT_LEN; Index++) {
+				TxPacket[Index] = (u8)(ChanId + Pkt + Index);
+			}
+			memset((void *)RX_BUF(ChanId, Pkt), 0, MAX_PKT_LEN);
+
+			Status = XMcdma_SchedSubmit(&RxSched, ChanId,
+						    RX_BUF(ChanId, Pkt),
+						    MAX_PKT_LEN, Pkt);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+
+			Status = XMcdma_SchedSubmit(&TxSched, ChanId,
+						    TX_BUF(ChanId, Pkt),
+						    MAX_PKT_LEN, Pkt);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes the completions of both schedulers and checks the
+* received data.
+*
+* @param	McDmaInstPtr is the pointer to the instance of the AXI MCDMA engine.
+*
+* @return	XST_SUCCESS if all packets are correct, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int CheckCompletions(XMcdma *McDmaInstPtr)
+{
+	XMcdma_SchedCpl Cpl;
+	u8 *RxPacket;
+	int ChanId;
+	int Index;
+
+	(void)McDmaInstPtr;
+
+	for (ChanId = 1; ChanId <= num_channels; ChanId++) {
+		while (XMcdma_SchedGetCompletion(&TxSched, ChanId, &Cpl) ==
+		       XST_SUCCESS) {
+			if (Cpl.Status & XMCDMA_BD_STS_ALL_ERR_MASK) {
+				xil_printf("Tx error chan %d pkt %d sts %x\r\n",
+					   ChanId, Cpl.Id, Cpl.Status);
+				return XST_FAILURE;
+			}
+		}
+
+		while (XMcdma_SchedGetCompletion(&RxSched, ChanId, &Cpl) ==
+		       XST_SUCCESS) {
+			if (Cpl.Len != MAX_PKT_LEN) {
+				xil_printf("Rx length %d chan %d pkt %d\r\n",
+					   Cpl.Len, ChanId, Cpl.Id);
+				return XST_FAILURE;
+			}
+
+			RxPacket = (u8 *)RX_BUF(ChanId, Cpl.Id);
+			for (Index = 0; Index < MAX_PKT_LEN; Index++) {
+				if (RxPacket[Index] !=
+				    (u8)(ChanId + Cpl.Id + Index)) {
+					xil_printf("Data error chan %d pkt %d "
+						   "byte %d\r\n", ChanId,
+						   Cpl.Id, Index);
+					return XST_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the statistics of the transmit channels.
+*
+* @param	None
+*
+* @return	None.
+*
+* @note		Latency is printed in XTime counts, none on MicroBlaze.
+*
+******************************************************************************/
+static void PrintStats(void)
+{
+	XMcdma_SchedStats Stats;
+	int ChanId;
+
+	for (ChanId = 1; ChanId <= num_channels; ChanId++) {
+		XMcdma_SchedGetStats(&TxSched, ChanId, &Stats);
+		xil_printf("Tx chan %d: done %d err %d bytes %d", ChanId,
+			   Stats.DoneCnt, Stats.ErrCnt, (u32)Stats.Bytes);
+		if ((Stats.DoneCnt != 0U) && (Stats.LatSum != 0U)) {
+			xil_printf(" latency min %d avg %d max %d",
+				   (u32)Stats.LatMin,
+				   (u32)(Stats.LatSum / Stats.DoneCnt),
+				   (u32)Stats.LatMax);
+		}
+		xil_printf("\r\n");
+	}
+}
+
+#if !defined (__MICROBLAZE__)
+/*****************************************************************************/
+/**
+*
+* This function is the time source of the latency statistics.
+*
+* @param	None
+*
+* @return	Current XTime count.
+*
+* @note		None.
+*
+******************************************************************************/
+static u64 GetTime(void)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+
+	return (u64)Now;
+}
+#endif
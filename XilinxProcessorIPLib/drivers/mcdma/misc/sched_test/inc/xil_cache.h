@@ -0,0 +1,11 @@
+/* Host build, the cache maintenance is counted by the test */
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#include <string.h>
+#include "xil_types.h"
+
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len);
+void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len);
+
+#endif
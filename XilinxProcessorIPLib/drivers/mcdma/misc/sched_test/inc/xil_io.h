@@ -0,0 +1,23 @@
+/* Host build, the MCDMA registers are a mapping of the test */
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include <string.h>
+#include "xil_types.h"
+
+#define DATA_SYNC	__sync_synchronize()
+#define dmb()		__sync_synchronize()
+
+void xil_printf(const char8 *ctrl1, ...);
+
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+	return *(volatile u32 *)Addr;
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	*(volatile u32 *)Addr = Value;
+}
+
+#endif
@@ -0,0 +1,386 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file sched_test.c
+ *
+ * Host test of the MCDMA work-queue scheduler, with xmcdma.c, xmcdma_bd.c and
+ * xmcdma_sched.c compiled into this tool. The registers and the BD chains are
+ * an anonymous mapping below 4 GB, as the BDs hold 32 bit pointers. The
+ * hardware is modelled by marking the BDs given to it as completed, an S2MM
+ * BD with half of its buffer length.
+ *
+ * The test checks that WRR gives the channels their weights of MaxInFlight,
+ * that a turn cut short by MaxInFlight is resumed in the next dispatch, that
+ * DRR shares the bytes evenly between channels of 1500 and 100 byte packets
+ * and still sends a request larger than the quantum. On S2MM the length is
+ * taken from the BD status and a completion finding the completion ring full
+ * is counted as dropped. A full submission ring must be reported and a
+ * dispatch must stop at the BDs of the chain.
+ *
+ * Usage: sched_test
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   kc   18/10/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "xmcdma_sched.h"
+
+#define TEST_NUM_CHAN		3
+#define TEST_NUM_BDS		16U
+#define TEST_RING_SIZE		64U
+#define TEST_MAP_SIZE		0x10000U
+#define TEST_BD_OFFSET		0x2000U
+#define TEST_LEN_MASK		0x3FFFFFFU
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+				__LINE__, #Cond);			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+static u32 *Regs;
+static XMcdma_Bd (*BdSpace)[TEST_NUM_BDS];
+static XMcdma McDma;
+static XMcdma_Sched Sched;
+static XMcdma_SchedReq SubRing[TEST_NUM_CHAN + 1][TEST_RING_SIZE];
+static XMcdma_SchedCpl CplRing[TEST_NUM_CHAN + 1][TEST_RING_SIZE];
+static u64 Clock;
+static u32 DoneCalls;
+static u32 Invalidates;
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	(void)vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len)
+{
+	(void)adr;
+	(void)len;
+}
+
+void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len)
+{
+	(void)adr;
+	(void)len;
+	Invalidates++;
+}
+
+static u64 GetTime(void)
+{
+	return Clock;
+}
+
+static void DoneHandler(void *CallBackRef, u32 ChanId)
+{
+	(void)CallBackRef;
+	(void)ChanId;
+	DoneCalls++;
+}
+
+static u32 InHw(u32 ChanId)
+{
+	return Sched.SchedChan[ChanId].SubHw - Sched.SchedChan[ChanId].SubHead;
+}
+
+/* Completes the BDs given to the hardware on a channel, in order */
+static void HwComplete(u32 ChanId)
+{
+	XMcdma_ChanCtrl *Chan = Sched.SchedChan[ChanId].Chan;
+	XMcdma_Bd *BdPtr = Chan->BdHead;
+	u32 Count = InHw(ChanId);
+	u32 Len;
+	u32 Index;
+
+	for (Index = 0U; Index < Count; Index++) {
+		Len = XMcdma_BdRead(BdPtr, XMCDMA_BD_CTRL_OFFSET) &
+			TEST_LEN_MASK;
+		if (Chan->IsRxChan != 0U) {
+			XMcdma_BdWrite(BdPtr, XMCDMA_BD_STS_OFFSET,
+				XMCDMA_BD_STS_COMPLETE_MASK |
+				XMCDMA_BD_STS_RXEOF_MASK | (Len / 2U));
+		} else {
+			XMcdma_BdWrite(BdPtr, XMCDMA_BD_SIDEBAND_STS_OFFSET,
+				XMCDMA_BD_STS_COMPLETE_MASK);
+		}
+		BdPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdPtr);
+	}
+}
+
+static void HwCompleteAll(void)
+{
+	u32 ChanId;
+
+	for (ChanId = 1U; ChanId <= TEST_NUM_CHAN; ChanId++) {
+		if ((Sched.ChanMask & (1U << ChanId)) != 0U) {
+			HwComplete(ChanId);
+		}
+	}
+}
+
+static int Setup(u32 IsRx)
+{
+	XMcdma_Config Config;
+	XMcdma_ChanCtrl *Chan;
+	u32 ChanId;
+
+	memset(&Config, 0, sizeof(Config));
+	memset(Regs, 0, TEST_BD_OFFSET);
+	Config.BaseAddress = (UINTPTR)Regs;
+	Config.HasMM2S = 1;
+	Config.HasS2MM = 1;
+	Config.TxNumChannels = TEST_NUM_CHAN;
+	Config.RxNumChannels = TEST_NUM_CHAN;
+	Config.MaxTransferlen = 26U;
+	Config.MM2SDataWidth = 32;
+	Config.S2MMDataWidth = 32;
+	TEST_CHECK(XMcDma_Initialize(&McDma, &Config) == XST_SUCCESS);
+
+	for (ChanId = 1U; ChanId <= TEST_NUM_CHAN; ChanId++) {
+		if (IsRx != 0U) {
+			Chan = XMcdma_GetMcdmaRxChan(&McDma, ChanId);
+		} else {
+			Chan = XMcdma_GetMcdmaTxChan(&McDma, ChanId);
+		}
+		Chan->MaxTransferLen = TEST_LEN_MASK;
+		TEST_CHECK(XMcDma_ChanBdCreate(Chan, (UINTPTR)BdSpace[ChanId],
+			TEST_NUM_BDS) == XST_SUCCESS);
+	}
+
+	return XST_SUCCESS;
+}
+
+static int Wrr(void)
+{
+	XMcdma_SchedStats Stats;
+	XMcdma_SchedCpl Cpl;
+	u32 Index;
+
+	/* Weights 3:1 with 4 BDs in hardware */
+	TEST_CHECK(Setup(0U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedInitialize(&Sched, &McDma, XMCDMA_MEM_TO_DEV,
+		XMCDMA_SCHED_WRR, 4U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedChanAdd(&Sched, 1U, 3U, SubRing[1],
+		TEST_RING_SIZE, CplRing[1], TEST_RING_SIZE) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedChanAdd(&Sched, 2U, 1U, SubRing[2],
+		TEST_RING_SIZE, CplRing[2], TEST_RING_SIZE) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedChanAdd(&Sched, TEST_NUM_CHAN + 1U, 1U,
+		SubRing[3], TEST_RING_SIZE, CplRing[3], TEST_RING_SIZE) ==
+		XST_INVALID_PARAM);
+	TEST_CHECK(XMcdma_SchedSubmit(&Sched, 1U, 0x1000U, 0U, 0U) ==
+		XST_INVALID_PARAM);
+	TEST_CHECK(XMcdma_SchedSubmit(&Sched, 3U, 0x1000U, 8U, 0U) ==
+		XST_INVALID_PARAM);
+	XMcdma_SchedSetTimeSource(&Sched, GetTime);
+	TEST_CHECK(XMcdma_SchedSetCallBack(&Sched, XMCDMA_TX_HANDLER_DONE,
+		(void *)DoneHandler, &Sched) == XST_SUCCESS);
+
+	for (Index = 0U; Index < 12U; Index++) {
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 1U,
+			0x10000U + (Index * 64U), 64U, 100U + Index) ==
+			XST_SUCCESS);
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 2U,
+			0x20000U + (Index * 64U), 64U, 200U + Index) ==
+			XST_SUCCESS);
+	}
+	TEST_CHECK(XMcdma_SchedDispatch(&Sched) == 4U);
+	TEST_CHECK((InHw(1U) == 3U) && (InHw(2U) == 1U));
+	TEST_CHECK((Regs[XMCDMA_TDESC_OFFSET / 4U] != 0U) &&
+		(Regs[(XMCDMA_TDESC_OFFSET + XMCDMA_NXTCHAN_OFFSET) / 4U] != 0U));
+	TEST_CHECK(XMcdma_SchedDispatch(&Sched) == 0U);
+
+	/* Both channels stay backlogged for 4 rounds */
+	for (Index = 0U; Index < 4U; Index++) {
+		Clock += 10U;
+		HwCompleteAll();
+		TEST_CHECK(XMcdma_SchedPoll(&Sched) == 4U);
+	}
+	XMcdma_SchedGetStats(&Sched, 1U, &Stats);
+	printf("wrr: channel 1 done %u, %llu bytes, latency %llu..%llu\n",
+		Stats.DoneCnt, (unsigned long long)Stats.Bytes,
+		(unsigned long long)Stats.LatMin,
+		(unsigned long long)Stats.LatMax);
+	TEST_CHECK((Stats.DoneCnt == 12U) && (Stats.Bytes == 12U * 64U));
+	XMcdma_SchedGetStats(&Sched, 2U, &Stats);
+	TEST_CHECK(Stats.DoneCnt == 4U);
+	TEST_CHECK(XMcdma_SchedGetCompletion(&Sched, 1U, &Cpl) == XST_SUCCESS);
+	TEST_CHECK((Cpl.Id == 100U) && (Cpl.Len == 64U));
+	TEST_CHECK(DoneCalls != 0U);
+
+	return XST_SUCCESS;
+}
+
+static int WrrResume(void)
+{
+	char Seq[32];
+	u32 Pos = 0U;
+	u32 Index;
+
+	/* Weight 3 with 2 BDs in hardware, the turns are resumed */
+	TEST_CHECK(Setup(0U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedInitialize(&Sched, &McDma, XMCDMA_MEM_TO_DEV,
+		XMCDMA_SCHED_WRR, 2U) == XST_SUCCESS);
+	for (Index = 1U; Index <= 2U; Index++) {
+		TEST_CHECK(XMcdma_SchedChanAdd(&Sched, Index, 3U,
+			SubRing[Index], TEST_RING_SIZE, CplRing[Index],
+			TEST_RING_SIZE) == XST_SUCCESS);
+	}
+	for (Index = 0U; Index < 12U; Index++) {
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 1U, 0x10000U, 64U,
+			Index) == XST_SUCCESS);
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 2U, 0x20000U, 64U,
+			Index) == XST_SUCCESS);
+	}
+
+	(void)XMcdma_SchedDispatch(&Sched);
+	for (Index = 0U; Index < 7U; Index++) {
+		if (Index != 0U) {
+			HwCompleteAll();
+			(void)XMcdma_SchedPoll(&Sched);
+		}
+		Seq[Pos++] = (char)('0' + InHw(1U));
+		Seq[Pos++] = (char)('0' + InHw(2U));
+		Seq[Pos++] = ' ';
+	}
+	Seq[Pos] = '\0';
+	printf("wrr resume: %s\n", Seq);
+	TEST_CHECK(strcmp(Seq, "20 11 02 20 11 02 20 ") == 0);
+
+	return XST_SUCCESS;
+}
+
+static int Drr(void)
+{
+	XMcdma_SchedStats Stats;
+	u64 Bytes1;
+	u64 Bytes2;
+	u32 Index;
+
+	/* Quantum of 500 bytes, 1500 byte packets against 100 byte packets */
+	TEST_CHECK(Setup(0U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedInitialize(&Sched, &McDma, XMCDMA_MEM_TO_DEV,
+		XMCDMA_SCHED_DRR, 6U) == XST_SUCCESS);
+	for (Index = 1U; Index <= 2U; Index++) {
+		TEST_CHECK(XMcdma_SchedChanAdd(&Sched, Index, 500U,
+			SubRing[Index], TEST_RING_SIZE, CplRing[Index],
+			TEST_RING_SIZE) == XST_SUCCESS);
+	}
+	for (Index = 0U; Index < 60U; Index++) {
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 1U, 0x10000U, 1500U,
+			Index) == XST_SUCCESS);
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 2U, 0x20000U, 100U,
+			Index) == XST_SUCCESS);
+	}
+	(void)XMcdma_SchedDispatch(&Sched);
+	for (Index = 0U; Index < 5U; Index++) {
+		HwCompleteAll();
+		(void)XMcdma_SchedPoll(&Sched);
+	}
+	XMcdma_SchedGetStats(&Sched, 1U, &Stats);
+	Bytes1 = Stats.Bytes;
+	XMcdma_SchedGetStats(&Sched, 2U, &Stats);
+	Bytes2 = Stats.Bytes;
+	printf("drr: %llu and %llu bytes\n", (unsigned long long)Bytes1,
+		(unsigned long long)Bytes2);
+	TEST_CHECK(((Bytes1 * 10U) > (Bytes2 * 8U)) &&
+		((Bytes2 * 10U) > (Bytes1 * 8U)));
+
+	/* A quantum far below the request size */
+	TEST_CHECK(Setup(0U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedInitialize(&Sched, &McDma, XMCDMA_MEM_TO_DEV,
+		XMCDMA_SCHED_DRR, 0U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedChanAdd(&Sched, 1U, 3U, SubRing[1],
+		TEST_RING_SIZE, CplRing[1], TEST_RING_SIZE) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedSubmit(&Sched, 1U, 0x1000U, 100000U, 1U) ==
+		XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedDispatch(&Sched) == 1U);
+
+	return XST_SUCCESS;
+}
+
+static int Rx(void)
+{
+	XMcdma_SchedStats Stats;
+	XMcdma_SchedCpl Cpl;
+	u32 Index;
+
+	/* Completion ring of 2 entries for 3 buffers */
+	TEST_CHECK(Setup(1U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedInitialize(&Sched, &McDma, XMCDMA_DEV_TO_MEM,
+		XMCDMA_SCHED_WRR, 0U) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedChanAdd(&Sched, 3U, 2U, SubRing[3],
+		TEST_RING_SIZE, CplRing[3], 2U) == XST_SUCCESS);
+	for (Index = 0U; Index < 3U; Index++) {
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 3U,
+			0x30000U + (Index * 256U), 256U, Index) ==
+			XST_SUCCESS);
+	}
+	TEST_CHECK(XMcdma_SchedDispatch(&Sched) == 3U);
+	Invalidates = 0U;
+	HwComplete(3U);
+	TEST_CHECK(XMcdma_SchedPoll(&Sched) == 3U);
+	TEST_CHECK(Invalidates >= 3U);
+	TEST_CHECK(XMcdma_SchedGetCompletion(&Sched, 3U, &Cpl) == XST_SUCCESS);
+	TEST_CHECK((Cpl.Len == 128U) && (Cpl.Id == 0U));
+	XMcdma_SchedGetStats(&Sched, 3U, &Stats);
+	TEST_CHECK((Stats.CplDropCnt == 1U) && (Stats.Bytes == 384U));
+	TEST_CHECK(XMcdma_SchedGetCompletion(&Sched, 3U, &Cpl) == XST_SUCCESS);
+	TEST_CHECK(XMcdma_SchedGetCompletion(&Sched, 3U, &Cpl) == XST_NO_DATA);
+
+	/* Full submission ring, then a dispatch bounded by the BD chain */
+	for (Index = 0U; Index < TEST_RING_SIZE; Index++) {
+		TEST_CHECK(XMcdma_SchedSubmit(&Sched, 3U, 0x30000U, 64U,
+			Index) == XST_SUCCESS);
+	}
+	TEST_CHECK(XMcdma_SchedSubmit(&Sched, 3U, 0x30000U, 64U, 99U) ==
+		XST_DEVICE_BUSY);
+	TEST_CHECK(XMcdma_SchedDispatch(&Sched) == TEST_NUM_BDS);
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	void *Map;
+
+	Map = mmap(NULL, TEST_MAP_SIZE, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if (Map == MAP_FAILED) {
+		printf("mmap failed\n");
+		return 1;
+	}
+	Regs = Map;
+	BdSpace = (void *)((u8 *)Map + TEST_BD_OFFSET);
+
+	if ((Wrr() != XST_SUCCESS) || (WrrResume() != XST_SUCCESS) ||
+		(Drr() != XST_SUCCESS) || (Rx() != XST_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
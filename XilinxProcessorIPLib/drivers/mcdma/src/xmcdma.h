@@ -123,6 +123,7 @@
 * 			 the gcc warning in mcdma integration test suite.
 * 1.7   sa      08/12/22 Updated the examples to use latest MIG cannoical define
 * 		         i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+* 1.8   kc      18/10/26 Added WRR/DRR work-queue scheduler, see xmcdma_sched.h.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -0,0 +1,904 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.c
+* @addtogroup mcdma_v1_8
+* @{
+*
+* This file implements the work-queue scheduler for the MCDMA channels,
+* please see xmcdma_sched.h for more details.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.8   kc      18/10/26 Initial version.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xmcdma_sched.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XMCDMA_SCHED_CHAN_MASK(ChanId)	((u32)1U << (ChanId))
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Function Prototypes ******************************/
+
+static s32 XMcdma_SchedQueueBd(XMcdma_Sched *SchedPtr,
+			       XMcdma_SchedChan *SChan, XMcdma_SchedReq *Req);
+static u32 XMcdma_SchedServeChan(XMcdma_Sched *SchedPtr, u32 ChanId,
+				 u32 *BudgetPtr);
+static void XMcdma_SchedDrrSkip(XMcdma_Sched *SchedPtr);
+static u32 XMcdma_SchedDrainChan(XMcdma_Sched *SchedPtr, u32 ChanId);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a scheduler for one direction of an MCDMA core.
+* The MCDMA instance must be initialized with XMcDma_CfgInitialize().
+*
+* @param	SchedPtr is a pointer to the scheduler to initialize.
+* @param	InstancePtr is a pointer to the XMcdma instance.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S or XMCDMA_DEV_TO_MEM
+*		for S2MM.
+* @param	Policy is XMCDMA_SCHED_WRR or XMCDMA_SCHED_DRR.
+* @param	MaxInFlight is the maximum number of BDs in hardware over all
+*		channels of the scheduler, 0 for no limit.
+*
+* @return
+*		- XST_SUCCESS if initialization was successful.
+*		- XST_INVALID_PARAM if Direction or Policy is invalid.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedInitialize(XMcdma_Sched *SchedPtr, XMcdma *InstancePtr,
+			   u32 Direction, XMcdma_SchedPolicy Policy,
+			   u32 MaxInFlight)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady != 0U);
+
+	if ((Direction != XMCDMA_MEM_TO_DEV) &&
+	    (Direction != XMCDMA_DEV_TO_MEM)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((Policy != XMCDMA_SCHED_WRR) && (Policy != XMCDMA_SCHED_DRR)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(SchedPtr, 0, sizeof(XMcdma_Sched));
+
+	SchedPtr->InstancePtr = InstancePtr;
+	SchedPtr->IsRxChan = (Direction == XMCDMA_DEV_TO_MEM) ? 1U : 0U;
+	SchedPtr->Policy = Policy;
+	SchedPtr->MaxInFlight = MaxInFlight;
+	SchedPtr->Next = 1U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a channel to the scheduler. The BD chain of the channel
+* must have been created with XMcDma_ChanBdCreate().
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number, starting at 1.
+* @param	Weight is the number of requests (WRR) or bytes (DRR) the
+*		channel may send per round.
+* @param	SubRing is the submission ring storage.
+* @param	SubSize is the number of entries of SubRing.
+* @param	CplRing is the completion ring storage.
+* @param	CplSize is the number of entries of CplRing.
+*
+* @return
+*		- XST_SUCCESS if the channel was added.
+*		- XST_INVALID_PARAM if a parameter is invalid.
+*		- XST_FAILURE if the channel has no BD chain.
+*
+* @note		Adding a channel again resets its rings and statistics.
+*
+******************************************************************************/
+s32 XMcdma_SchedChanAdd(XMcdma_Sched *SchedPtr, u32 ChanId, u32 Weight,
+			XMcdma_SchedReq *SubRing, u32 SubSize,
+			XMcdma_SchedCpl *CplRing, u32 CplSize)
+{
+	XMcdma *InstancePtr;
+	XMcdma_SchedChan *SChan;
+	XMcdma_ChanCtrl *Chan;
+	u32 NumChannels;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(SchedPtr->InstancePtr != NULL);
+
+	InstancePtr = SchedPtr->InstancePtr;
+	NumChannels = (SchedPtr->IsRxChan != 0U) ?
+			(u32)InstancePtr->Config.RxNumChannels :
+			(u32)InstancePtr->Config.TxNumChannels;
+
+	if ((ChanId == 0U) || (ChanId > NumChannels) ||
+	    (ChanId >= XMCDMA_MAX_CHAN_PER_DEVICE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((Weight == 0U) || (SubRing == NULL) || (SubSize == 0U) ||
+	    (CplRing == NULL) || (CplSize == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (SchedPtr->IsRxChan != 0U) {
+		Chan = XMcdma_GetMcdmaRxChan(InstancePtr, ChanId);
+	} else {
+		Chan = XMcdma_GetMcdmaTxChan(InstancePtr, ChanId);
+	}
+
+	if (Chan->Length == 0U) {
+		xil_printf("Channel %d has no BD chain\n\r", ChanId);
+		return XST_FAILURE;
+	}
+
+	SChan = &SchedPtr->SchedChan[ChanId];
+	memset(SChan, 0, sizeof(XMcdma_SchedChan));
+
+	SChan->Chan = Chan;
+	SChan->SubRing = SubRing;
+	SChan->SubSize = SubSize;
+	SChan->CplRing = CplRing;
+	SChan->CplSize = CplSize;
+	SChan->Weight = Weight;
+	SChan->Stats.LatMin = ~((u64)0U);
+
+	SchedPtr->ChanMask |= XMCDMA_SCHED_CHAN_MASK(ChanId);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the time source used to measure the request latency.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	GetTime returns the current time, NULL disables the latency
+*		statistics. XTime_GetTime() based wrappers are typical.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMcdma_SchedSetTimeSource(XMcdma_Sched *SchedPtr,
+			       XMcdma_SchedTimeFn GetTime)
+{
+	Xil_AssertVoid(SchedPtr != NULL);
+
+	SchedPtr->GetTime = GetTime;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine installs an asynchronous callback function for the given
+* HandlerType.
+*
+* <pre>
+* HandlerType              Callback Function Type
+* -----------------------  --------------------------------------------------
+* XMCDMA_HANDLER_DONE      Called for each channel that completed requests,
+*                          from XMcdma_SchedPoll() and the interrupt handler
+* XMCDMA_HANDLER_ERROR     Called for each channel with an error interrupt
+*
+* </pre>
+*
+* The MM2S names XMCDMA_TX_HANDLER_DONE/XMCDMA_TX_HANDLER_ERROR are accepted
+* as well.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	HandlerType specifies which callback is to be attached.
+* @param	CallBackFunc is the address of the callback function.
+* @param	CallBackRef is a user data item that will be passed to the
+* 		callback function when it is invoked.
+*
+* @return
+*		- XST_SUCCESS when handler is installed.
+*		- XST_INVALID_PARAM when HandlerType is invalid.
+*
+* @note		Invoking this function for a handler that already has been
+*		installed replaces it with the new handler.
+*
+******************************************************************************/
+s32 XMcdma_SchedSetCallBack(XMcdma_Sched *SchedPtr, XMcdma_Handler HandlerType,
+			    void *CallBackFunc, void *CallBackRef)
+{
+	s32 Status;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(CallBackFunc != NULL);
+
+	switch (HandlerType) {
+	case XMCDMA_TX_HANDLER_DONE:
+	case XMCDMA_HANDLER_DONE:
+		SchedPtr->DoneHandler =
+			(XMcdma_DoneHandler)((void *)CallBackFunc);
+		SchedPtr->DoneRef = CallBackRef;
+		Status = (XST_SUCCESS);
+		break;
+
+	case XMCDMA_TX_HANDLER_ERROR:
+	case XMCDMA_HANDLER_ERROR:
+		SchedPtr->ErrorHandler =
+			(XMcdma_ErrorHandler)((void *)CallBackFunc);
+		SchedPtr->ErrorRef = CallBackRef;
+		Status = (XST_SUCCESS);
+		break;
+
+	default:
+		Status = (XST_INVALID_PARAM);
+		break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a request in the submission ring of a channel. The
+* request goes to hardware on the next XMcdma_SchedDispatch(), which the
+* interrupt handler and XMcdma_SchedPoll() also call.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+* @param	BufAddr is the buffer address.
+* @param	Len is the buffer length, at most the channel MaxTransferLen.
+* @param	Id is a cookie returned with the completion.
+*
+* @return
+*		- XST_SUCCESS if the request was queued.
+*		- XST_INVALID_PARAM if the channel or length is invalid.
+*		- XST_DEVICE_BUSY if the submission ring is full.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedSubmit(XMcdma_Sched *SchedPtr, u32 ChanId, UINTPTR BufAddr,
+		       u32 Len, u32 Id)
+{
+	XMcdma_SchedChan *SChan;
+	XMcdma_SchedReq *Req;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+
+	if ((ChanId >= XMCDMA_MAX_CHAN_PER_DEVICE) ||
+	    ((SchedPtr->ChanMask & XMCDMA_SCHED_CHAN_MASK(ChanId)) == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	SChan = &SchedPtr->SchedChan[ChanId];
+
+	if ((Len == 0U) || (Len > SChan->Chan->MaxTransferLen)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((SChan->SubTail - SChan->SubHead) >= SChan->SubSize) {
+		return XST_DEVICE_BUSY;
+	}
+
+	Req = &SChan->SubRing[SChan->SubTail % SChan->SubSize];
+	Req->BufAddr = BufAddr;
+	Req->Len = Len;
+	Req->Id = Id;
+	Req->SubmitTime = (SchedPtr->GetTime != NULL) ? SchedPtr->GetTime() : 0U;
+
+	SChan->SubTail++;
+	SChan->Stats.ReqCnt++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves queued requests to the hardware BD chains following the
+* scheduling policy, then starts the channels that received work with one
+* tail descriptor update each.
+*
+* A round visits the channels in channel number order, starting where the
+* previous dispatch stopped. A channel is skipped while its BD chain is full.
+* When MaxInFlight is reached in the middle of a channel turn, the next
+* dispatch resumes that turn.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	Number of requests given to hardware.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XMcdma_SchedDispatch(XMcdma_Sched *SchedPtr)
+{
+	u32 Budget;
+	u32 Touched = 0U;
+	u32 Sent = 0U;
+	u32 PassSent;
+	u32 Eligible;
+	u32 Skipped = 0U;
+	u32 ChanId;
+	u32 Cnt;
+	u32 Idx;
+	u32 Status;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+
+	if (SchedPtr->MaxInFlight == 0U) {
+		Budget = ~0U;
+	} else if (SchedPtr->InFlight >= SchedPtr->MaxInFlight) {
+		return 0U;
+	} else {
+		Budget = SchedPtr->MaxInFlight - SchedPtr->InFlight;
+	}
+
+	while (Budget > 0U) {
+		Eligible = 0U;
+		PassSent = 0U;
+
+		for (Idx = 0U; (Idx < XMCDMA_MAX_CHAN_PER_DEVICE) &&
+		     (Budget > 0U); Idx++) {
+			ChanId = SchedPtr->Next;
+			SchedPtr->Next = (ChanId + 1U) %
+					 XMCDMA_MAX_CHAN_PER_DEVICE;
+
+			if ((SchedPtr->ChanMask &
+			     XMCDMA_SCHED_CHAN_MASK(ChanId)) == 0U) {
+				continue;
+			}
+
+			if ((SchedPtr->SchedChan[ChanId].SubHw !=
+			     SchedPtr->SchedChan[ChanId].SubTail) &&
+			    (SchedPtr->SchedChan[ChanId].Chan->BdCnt > 0U)) {
+				Eligible++;
+			}
+
+			Cnt = XMcdma_SchedServeChan(SchedPtr, ChanId, &Budget);
+			if (Cnt > 0U) {
+				Touched |= XMCDMA_SCHED_CHAN_MASK(ChanId);
+				PassSent += Cnt;
+			}
+		}
+
+		Sent += PassSent;
+
+		if (Eligible == 0U) {
+			break;
+		}
+
+		/*
+		 * With DRR a whole round can pass without sending when the
+		 * quantum is smaller than the packets, add the credit of the
+		 * empty rounds at once. The pass after that sends.
+		 */
+		if (PassSent == 0U) {
+			if ((Skipped != 0U) || (Budget == 0U)) {
+				break;
+			}
+			XMcdma_SchedDrrSkip(SchedPtr);
+			Skipped = 1U;
+		} else {
+			Skipped = 0U;
+		}
+	}
+
+	SchedPtr->InFlight += Sent;
+
+	for (ChanId = 1U; ChanId < XMCDMA_MAX_CHAN_PER_DEVICE; ChanId++) {
+		if ((Touched & XMCDMA_SCHED_CHAN_MASK(ChanId)) != 0U) {
+			Status = XMcDma_ChanToHw(SchedPtr->SchedChan[ChanId].Chan);
+			if (Status != XST_SUCCESS) {
+				xil_printf("Channel %d to hw failed %x\n\r",
+					   ChanId, Status);
+			}
+		}
+	}
+
+	return Sent;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function collects the completed BDs of all channels of the scheduler,
+* fills the completion rings, calls the done callback for each channel that
+* completed requests and dispatches queued requests.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	Number of requests completed.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XMcdma_SchedPoll(XMcdma_Sched *SchedPtr)
+{
+	u32 ChanId;
+	u32 Cnt;
+	u32 Done = 0U;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+
+	for (ChanId = 1U; ChanId < XMCDMA_MAX_CHAN_PER_DEVICE; ChanId++) {
+		if ((SchedPtr->ChanMask & XMCDMA_SCHED_CHAN_MASK(ChanId)) == 0U) {
+			continue;
+		}
+
+		Cnt = XMcdma_SchedDrainChan(SchedPtr, ChanId);
+		if ((Cnt > 0U) && (SchedPtr->DoneHandler != NULL)) {
+			SchedPtr->DoneHandler(SchedPtr->DoneRef, ChanId);
+		}
+		Done += Cnt;
+	}
+
+	(void)XMcdma_SchedDispatch(SchedPtr);
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the scheduler, for the MM2S or
+* the S2MM interrupt depending on the scheduler direction.
+*
+* The pending interrupts of the channels flagged in the interrupt service
+* register are acknowledged, then the completed BDs of all channels are
+* collected in one pass by XMcdma_SchedPoll(). This repeats until no channel
+* is flagged.
+*
+* @param	Instance is a pointer to the XMcdma_Sched instance.
+*
+* @return	None.
+*
+* @note		Connect this handler in place of XMcdma_TxIntrHandler() or
+*		XMcdma_IntrHandler(), not in addition to them.
+*
+******************************************************************************/
+void XMcdma_SchedIntrHandler(void *Instance)
+{
+	XMcdma_Sched *SchedPtr = (XMcdma_Sched *)((void *)Instance);
+	XMcdma *InstancePtr = SchedPtr->InstancePtr;
+	XMcdma_ChanCtrl *Chan;
+	u32 SerOffset;
+	u32 SerMask;
+	u32 IrqStatus;
+	u32 ChanId;
+
+	SerOffset = (SchedPtr->IsRxChan != 0U) ?
+		    (XMCDMA_RX_OFFSET + XMCDMA_RXINT_SER_OFFSET) :
+		    XMCDMA_TXINT_SER_OFFSET;
+
+	while (1) {
+		SerMask = XMcdma_ReadReg(InstancePtr->Config.BaseAddress,
+					 SerOffset);
+		if (SerMask == 0U) {
+			break;
+		}
+
+		for (ChanId = 1U; ChanId < XMCDMA_MAX_CHAN_PER_DEVICE; ChanId++) {
+			if ((SerMask & ((u32)1U << (ChanId - 1U))) == 0U) {
+				continue;
+			}
+
+			if (SchedPtr->IsRxChan != 0U) {
+				Chan = XMcdma_GetMcdmaRxChan(InstancePtr, ChanId);
+			} else {
+				Chan = XMcdma_GetMcdmaTxChan(InstancePtr, ChanId);
+			}
+
+			/* Acknowledge pending interrupts */
+			IrqStatus = XMcdma_ChanGetIrq(Chan);
+			XMcdma_ChanAckIrq(Chan, IrqStatus);
+
+			if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK) != 0U) {
+				Chan->ChanState = XMCDMA_CHAN_PAUSE;
+				if (SchedPtr->ErrorHandler != NULL) {
+					SchedPtr->ErrorHandler(SchedPtr->ErrorRef,
+							       ChanId, IrqStatus);
+				}
+			}
+		}
+
+		(void)XMcdma_SchedPoll(SchedPtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes the oldest completion of a channel.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+* @param	CplPtr is filled with the completion.
+*
+* @return
+*		- XST_SUCCESS if a completion was returned.
+*		- XST_NO_DATA if the completion ring is empty.
+*		- XST_INVALID_PARAM if the channel is not in the scheduler.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XMcdma_SchedGetCompletion(XMcdma_Sched *SchedPtr, u32 ChanId,
+			      XMcdma_SchedCpl *CplPtr)
+{
+	XMcdma_SchedChan *SChan;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(CplPtr != NULL);
+
+	if ((ChanId >= XMCDMA_MAX_CHAN_PER_DEVICE) ||
+	    ((SchedPtr->ChanMask & XMCDMA_SCHED_CHAN_MASK(ChanId)) == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	SChan = &SchedPtr->SchedChan[ChanId];
+	if (SChan->CplHead == SChan->CplTail) {
+		return XST_NO_DATA;
+	}
+
+	*CplPtr = SChan->CplRing[SChan->CplHead % SChan->CplSize];
+	SChan->CplHead++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies the statistics of a channel.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+* @param	StatsPtr is filled with the statistics.
+*
+* @return	None.
+*
+* @note		LatMin stays at its maximum value until a latency is
+*		measured.
+*
+******************************************************************************/
+void XMcdma_SchedGetStats(XMcdma_Sched *SchedPtr, u32 ChanId,
+			  XMcdma_SchedStats *StatsPtr)
+{
+	Xil_AssertVoid(SchedPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+	Xil_AssertVoid(ChanId < XMCDMA_MAX_CHAN_PER_DEVICE);
+
+	*StatsPtr = SchedPtr->SchedChan[ChanId].Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the statistics of a channel.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XMcdma_SchedResetStats(XMcdma_Sched *SchedPtr, u32 ChanId)
+{
+	XMcdma_SchedStats *StatsPtr;
+
+	Xil_AssertVoid(SchedPtr != NULL);
+	Xil_AssertVoid(ChanId < XMCDMA_MAX_CHAN_PER_DEVICE);
+
+	StatsPtr = &SchedPtr->SchedChan[ChanId].Stats;
+	memset(StatsPtr, 0, sizeof(XMcdma_SchedStats));
+	StatsPtr->LatMin = ~((u64)0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gives one request to the BD chain of a channel.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	SChan is the scheduler channel.
+* @param	Req is the request.
+*
+* @return	XST_SUCCESS or the error of XMcDma_ChanSubmit().
+*
+* @note		The caller checks that the BD chain has a free BD.
+*
+******************************************************************************/
+static s32 XMcdma_SchedQueueBd(XMcdma_Sched *SchedPtr,
+			       XMcdma_SchedChan *SChan, XMcdma_SchedReq *Req)
+{
+	XMcdma_ChanCtrl *Chan = SChan->Chan;
+	u8 Coherent;
+	s32 Status;
+
+	Coherent = (SchedPtr->IsRxChan != 0U) ?
+		   SchedPtr->InstancePtr->Config.IsRxCacheCoherent :
+		   SchedPtr->InstancePtr->Config.IsTxCacheCoherent;
+
+	if (Coherent == 0U) {
+		Xil_DCacheFlushRange(Req->BufAddr, Req->Len);
+	}
+
+	Status = (s32)XMcDma_ChanSubmit(Chan, Req->BufAddr, Req->Len);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Every MM2S request is a complete packet */
+	if (SchedPtr->IsRxChan == 0U) {
+		XMcDma_BdSetCtrl(Chan->BdTail, XMCDMA_BD_CTRL_SOF_MASK |
+				 XMCDMA_BD_CTRL_EOF_MASK);
+		XMCDMA_CACHE_FLUSH((UINTPTR)(Chan->BdTail));
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function gives a channel its turn of the current round.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+* @param	BudgetPtr is the number of BDs that may still go to hardware,
+*		decremented for each request sent.
+*
+* @return	Number of requests given to hardware.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XMcdma_SchedServeChan(XMcdma_Sched *SchedPtr, u32 ChanId,
+				 u32 *BudgetPtr)
+{
+	XMcdma_SchedChan *SChan = &SchedPtr->SchedChan[ChanId];
+	XMcdma_SchedReq *Req;
+	u32 Cost;
+	u32 Cnt = 0U;
+
+	if (SChan->SubHw == SChan->SubTail) {
+		/* Idle channels do not save credit */
+		SChan->Credit = 0U;
+		SChan->InTurn = 0U;
+		return 0U;
+	}
+
+	if (SChan->Chan->BdCnt == 0U) {
+		/* BD chain full, the channel already has the hardware */
+		SChan->InTurn = 0U;
+		return 0U;
+	}
+
+	if (SChan->InTurn == 0U) {
+		if (SchedPtr->Policy == XMCDMA_SCHED_WRR) {
+			SChan->Credit = SChan->Weight;
+		} else {
+			SChan->Credit += SChan->Weight;
+		}
+	}
+	SChan->InTurn = 0U;
+
+	while ((SChan->SubHw != SChan->SubTail) && (SChan->Chan->BdCnt > 0U)) {
+		Req = &SChan->SubRing[SChan->SubHw % SChan->SubSize];
+		Cost = (SchedPtr->Policy == XMCDMA_SCHED_WRR) ? 1U : Req->Len;
+		if (Cost > SChan->Credit) {
+			break;
+		}
+
+		if (*BudgetPtr == 0U) {
+			/* Resume this turn on the next dispatch */
+			SChan->InTurn = 1U;
+			SchedPtr->Next = ChanId;
+			break;
+		}
+
+		if (XMcdma_SchedQueueBd(SchedPtr, SChan, Req) != XST_SUCCESS) {
+			break;
+		}
+
+		SChan->Credit -= Cost;
+		SChan->SubHw++;
+		(*BudgetPtr)--;
+		Cnt++;
+	}
+
+	if (SChan->SubHw == SChan->SubTail) {
+		SChan->Credit = 0U;
+	}
+
+	return Cnt;
+}
+
+/*****************************************************************************/
+/**
+*
+* With DRR, adds to every backlogged channel the credit of the rounds that
+* would pass before the first of them can send, minus one round that the next
+* pass adds.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	None.
+*
+* @note		Only called after a pass that sent nothing with budget left,
+*		so the head request of each backlogged channel exceeds its
+*		credit.
+*
+******************************************************************************/
+static void XMcdma_SchedDrrSkip(XMcdma_Sched *SchedPtr)
+{
+	XMcdma_SchedChan *SChan;
+	u32 Rounds = ~0U;
+	u32 Need;
+	u32 Len;
+	u32 ChanId;
+
+	if (SchedPtr->Policy != XMCDMA_SCHED_DRR) {
+		return;
+	}
+
+	for (ChanId = 1U; ChanId < XMCDMA_MAX_CHAN_PER_DEVICE; ChanId++) {
+		SChan = &SchedPtr->SchedChan[ChanId];
+		if (((SchedPtr->ChanMask & XMCDMA_SCHED_CHAN_MASK(ChanId)) == 0U) ||
+		    (SChan->SubHw == SChan->SubTail) ||
+		    (SChan->Chan->BdCnt == 0U)) {
+			continue;
+		}
+
+		Len = SChan->SubRing[SChan->SubHw % SChan->SubSize].Len;
+		Need = (Len - SChan->Credit + SChan->Weight - 1U) /
+			SChan->Weight;
+		if (Need < Rounds) {
+			Rounds = Need;
+		}
+	}
+
+	if ((Rounds == ~0U) || (Rounds <= 1U)) {
+		return;
+	}
+
+	for (ChanId = 1U; ChanId < XMCDMA_MAX_CHAN_PER_DEVICE; ChanId++) {
+		SChan = &SchedPtr->SchedChan[ChanId];
+		if (((SchedPtr->ChanMask & XMCDMA_SCHED_CHAN_MASK(ChanId)) == 0U) ||
+		    (SChan->SubHw == SChan->SubTail) ||
+		    (SChan->Chan->BdCnt == 0U)) {
+			continue;
+		}
+
+		SChan->Credit += (Rounds - 1U) * SChan->Weight;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function collects the completed BDs of a channel, updates the
+* statistics and fills the completion ring.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+*
+* @return	Number of requests completed.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XMcdma_SchedDrainChan(XMcdma_Sched *SchedPtr, u32 ChanId)
+{
+	XMcdma_SchedChan *SChan = &SchedPtr->SchedChan[ChanId];
+	XMcdma_ChanCtrl *Chan = SChan->Chan;
+	XMcdma_SchedStats *StatsPtr = &SChan->Stats;
+	XMcdma_SchedReq *Req;
+	XMcdma_SchedCpl *Cpl;
+	XMcdma_Bd *BdPtr;
+	XMcdma_Bd *BdCurPtr;
+	u64 Now = 0U;
+	u64 Lat;
+	u32 Status;
+	u32 Len;
+	int Cnt;
+	int Index;
+
+	if (SChan->SubHw == SChan->SubHead) {
+		return 0U;
+	}
+
+	Cnt = XMcdma_BdChainFromHW(Chan, SChan->SubHw - SChan->SubHead, &BdPtr);
+	if (Cnt <= 0) {
+		return 0U;
+	}
+
+	if (SchedPtr->GetTime != NULL) {
+		Now = SchedPtr->GetTime();
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0; Index < Cnt; Index++) {
+		Req = &SChan->SubRing[SChan->SubHead % SChan->SubSize];
+
+		if (SchedPtr->IsRxChan != 0U) {
+			Status = XMcDma_BdGetSts(BdCurPtr);
+			Len = XMcDma_BdGetActualLength(BdCurPtr,
+						       Chan->MaxTransferLen);
+			if (SchedPtr->InstancePtr->Config.IsRxCacheCoherent == 0U) {
+				Xil_DCacheInvalidateRange(Req->BufAddr, Len);
+			}
+		} else {
+			Status = XMcDma_TxBdGetSts(BdCurPtr);
+			Len = Req->Len;
+		}
+
+		StatsPtr->DoneCnt++;
+		if ((Status & XMCDMA_BD_STS_ALL_ERR_MASK) != 0U) {
+			StatsPtr->ErrCnt++;
+		} else {
+			StatsPtr->Bytes += Len;
+		}
+
+		if (SchedPtr->GetTime != NULL) {
+			Lat = Now - Req->SubmitTime;
+			if (Lat < StatsPtr->LatMin) {
+				StatsPtr->LatMin = Lat;
+			}
+			if (Lat > StatsPtr->LatMax) {
+				StatsPtr->LatMax = Lat;
+			}
+			StatsPtr->LatSum += Lat;
+		}
+
+		if ((SChan->CplTail - SChan->CplHead) >= SChan->CplSize) {
+			StatsPtr->CplDropCnt++;
+		} else {
+			Cpl = &SChan->CplRing[SChan->CplTail % SChan->CplSize];
+			Cpl->Id = Req->Id;
+			Cpl->Len = Len;
+			Cpl->Status = Status;
+			SChan->CplTail++;
+		}
+
+		SChan->SubHead++;
+		BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdCurPtr);
+	}
+
+	(void)XMcdma_BdChainFree(Chan, Cnt, BdPtr);
+	SchedPtr->InFlight -= (u32)Cnt;
+
+	return (u32)Cnt;
+}
+
+/** @} */
@@ -0,0 +1,187 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.h
+* @addtogroup mcdma_v1_8
+* @{
+* @details
+*
+* Software work-queue scheduler on top of the MCDMA channel BD chains.
+*
+* Every channel added to a scheduler owns a submission ring and a completion
+* ring, both provided by the application. XMcdma_SchedSubmit() only queues a
+* request in the submission ring. XMcdma_SchedDispatch() moves queued requests
+* to the hardware BD chains, visiting the channels in round-robin order:
+*
+* - XMCDMA_SCHED_WRR: a channel may send up to Weight requests per round.
+* - XMCDMA_SCHED_DRR: a channel earns Weight bytes of credit per round and
+*   sends requests as long as the credit covers them (deficit round-robin).
+*   This gives byte fairness between channels with different packet sizes.
+*
+* MaxInFlight bounds the number of BDs the scheduler keeps in hardware over
+* all its channels. It is the share of the engine that the policy
+* distributes, a busy channel cannot fill the hardware in front of the
+* others. Zero means that only the size of the BD chains limits it.
+*
+* XMcdma_SchedIntrHandler() is connected to the MM2S or S2MM interrupt in
+* place of XMcdma_TxIntrHandler()/XMcdma_IntrHandler(). It acknowledges the
+* pending channel interrupts, collects the completed BDs of all channels of
+* the scheduler in one pass, fills the completion rings and dispatches more
+* work. XMcdma_SchedPoll() does the same without interrupts.
+*
+* Each request uses one BD, on MM2S it is sent as a complete packet. On S2MM
+* a request is a receive buffer. A scheduler drives one direction, use two
+* schedulers for both directions. Channels given to a scheduler must not be
+* used with XMcDma_ChanSubmit()/XMcdma_BdChainFromHW() directly.
+*
+* Statistics are kept per channel. Latency is measured from submit to
+* completion with the time source set by XMcdma_SchedSetTimeSource(), in its
+* units. Throughput is Bytes over the interval the application measures.
+*
+* The scheduler is not thread safe. When the interrupt handler is used,
+* calls from thread context must run with the MCDMA interrupt disabled.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.8   kc      18/10/26 Initial version.
+******************************************************************************/
+#ifndef XMCDMA_SCHED_H_
+#define XMCDMA_SCHED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/**************************** Type Definitions *******************************/
+
+typedef enum {
+	XMCDMA_SCHED_WRR,	/**< Weighted round-robin, Weight in requests */
+	XMCDMA_SCHED_DRR,	/**< Deficit round-robin, Weight in bytes */
+} XMcdma_SchedPolicy;
+
+typedef u64 (*XMcdma_SchedTimeFn) (void);
+
+/**
+ * Entry of a channel submission ring
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Buffer length in bytes */
+	u32 Id;			/**< Application cookie */
+	u64 SubmitTime;		/**< Set by XMcdma_SchedSubmit() */
+} XMcdma_SchedReq;
+
+/**
+ * Entry of a channel completion ring
+ */
+typedef struct {
+	u32 Id;			/**< Cookie of the request */
+	u32 Len;		/**< Bytes transferred */
+	u32 Status;		/**< BD status, XMCDMA_BD_STS_* */
+} XMcdma_SchedCpl;
+
+/**
+ * Per channel statistics
+ */
+typedef struct {
+	u32 ReqCnt;		/**< Requests submitted */
+	u32 DoneCnt;		/**< Requests completed */
+	u32 ErrCnt;		/**< Requests completed with an error */
+	u32 CplDropCnt;		/**< Completions lost, completion ring full */
+	u64 Bytes;		/**< Bytes transferred */
+	u64 LatMin;		/**< Lowest submit to completion latency */
+	u64 LatMax;		/**< Highest submit to completion latency */
+	u64 LatSum;		/**< Sum of latencies, divide by DoneCnt */
+} XMcdma_SchedStats;
+
+typedef struct {
+	XMcdma_ChanCtrl *Chan;	/**< MCDMA channel */
+	XMcdma_SchedReq *SubRing;	/**< Submission ring */
+	u32 SubSize;		/**< Entries in the submission ring */
+	u32 SubHead;		/**< Oldest request in hardware */
+	u32 SubHw;		/**< Next request to give to hardware */
+	u32 SubTail;		/**< Next free submission entry */
+	XMcdma_SchedCpl *CplRing;	/**< Completion ring */
+	u32 CplSize;		/**< Entries in the completion ring */
+	u32 CplHead;		/**< Oldest completion */
+	u32 CplTail;		/**< Next free completion entry */
+	u32 Weight;		/**< Requests (WRR) or bytes (DRR) per round */
+	u32 Credit;		/**< Left in the current round */
+	u32 InTurn;		/**< Round interrupted by MaxInFlight */
+	XMcdma_SchedStats Stats;
+} XMcdma_SchedChan;
+
+typedef struct {
+	XMcdma *InstancePtr;	/**< MCDMA driver instance */
+	u32 IsRxChan;		/**< Direction, S2MM if set */
+	XMcdma_SchedPolicy Policy;
+	u32 MaxInFlight;	/**< BDs in hardware limit, 0 for none */
+	u32 InFlight;		/**< BDs in hardware */
+	u32 ChanMask;		/**< Channels added, bit per channel id */
+	u32 Next;		/**< Channel id where the next round starts */
+	XMcdma_SchedTimeFn GetTime;	/**< Latency time source */
+	XMcdma_DoneHandler DoneHandler;	/**< Called after completions */
+	void *DoneRef;
+	XMcdma_ErrorHandler ErrorHandler;	/**< Called on error irq */
+	void *ErrorRef;
+	XMcdma_SchedChan SchedChan[XMCDMA_MAX_CHAN_PER_DEVICE];
+} XMcdma_Sched;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Gets the number of requests queued on a channel and not completed yet.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	ChanId is the channel number.
+*
+* @return	Number of requests.
+*
+* @note		C-style signature:
+*		u32 XMcdma_SchedGetPendingCnt(XMcdma_Sched *SchedPtr, u32 ChanId)
+*****************************************************************************/
+#define XMcdma_SchedGetPendingCnt(SchedPtr, ChanId) \
+	((SchedPtr)->SchedChan[ChanId].SubTail - \
+	 (SchedPtr)->SchedChan[ChanId].SubHead)
+
+/************************ Prototypes of functions **************************/
+
+s32 XMcdma_SchedInitialize(XMcdma_Sched *SchedPtr, XMcdma *InstancePtr,
+			   u32 Direction, XMcdma_SchedPolicy Policy,
+			   u32 MaxInFlight);
+s32 XMcdma_SchedChanAdd(XMcdma_Sched *SchedPtr, u32 ChanId, u32 Weight,
+			XMcdma_SchedReq *SubRing, u32 SubSize,
+			XMcdma_SchedCpl *CplRing, u32 CplSize);
+void XMcdma_SchedSetTimeSource(XMcdma_Sched *SchedPtr,
+			       XMcdma_SchedTimeFn GetTime);
+s32 XMcdma_SchedSetCallBack(XMcdma_Sched *SchedPtr, XMcdma_Handler HandlerType,
+			    void *CallBackFunc, void *CallBackRef);
+s32 XMcdma_SchedSubmit(XMcdma_Sched *SchedPtr, u32 ChanId, UINTPTR BufAddr,
+		       u32 Len, u32 Id);
+u32 XMcdma_SchedDispatch(XMcdma_Sched *SchedPtr);
+u32 XMcdma_SchedPoll(XMcdma_Sched *SchedPtr);
+s32 XMcdma_SchedGetCompletion(XMcdma_Sched *SchedPtr, u32 ChanId,
+			      XMcdma_SchedCpl *CplPtr);
+void XMcdma_SchedGetStats(XMcdma_Sched *SchedPtr, u32 ChanId,
+			  XMcdma_SchedStats *StatsPtr);
+void XMcdma_SchedResetStats(XMcdma_Sched *SchedPtr, u32 ChanId);
+void XMcdma_SchedIntrHandler(void *Instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XMCDMA_SCHED_H_ */
+/** @} */
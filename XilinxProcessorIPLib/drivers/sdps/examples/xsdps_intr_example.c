@@ -0,0 +1,323 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_intr_example.c
+*
+* This example is used to test queued, interrupt driven read and write
+* transfers on SD/eMMC interface.
+*
+* The data is written and read back as NUM_REQUESTS requests of
+* NUM_BLOCKS blocks each on consecutive sectors. The requests are all
+* submitted at once, the driver merges them into multi-block transfers and
+* reports completion through callbacks.
+*
+* Please note that running this example will modify the card contents and
+* file system information will be erased in the card. Card will need to be
+* re-formatted.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date     Changes
+* ----- --- -------- ---------------------------------------------
+* 4.1 	kc  10/18/26 First release
+*
+*</pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xsdps.h"		/* SD device driver */
+#include "xparameters.h"
+#include "xscugic.h"
+#include "xil_exception.h"
+
+/************************** Constant Definitions *****************************/
+
+#define SDPS_DEVICE_ID		XPAR_XSDPS_0_DEVICE_ID
+#define SDPS_INTR_ID		XPAR_XSDIOPS_0_INTR
+#define INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+
+#define TEST 7
+/* Number of requests submitted per direction */
+#define NUM_REQUESTS 8
+/* Number of SD blocks per request */
+#define NUM_BLOCKS 16
+/* Sector offset to test */
+#define SECTOR_OFFSET 204800
+
+#define BUFF_SIZE (NUM_REQUESTS * NUM_BLOCKS * 512)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static int SdpsIntrTest(void);
+static int SdpsSetupIntrSystem(XScuGic *IntcInstancePtr, XSdPs *SdInstancePtr,
+		u16 SdIntrId);
+static int SdpsTransfer(XSdPs *SdInstancePtr, u32 Sector, u8 *Buff,
+		u8 IsWrite);
+static void SdpsCallback(void *CallBackRef, s32 Status);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+u8 DestinationAddress[BUFF_SIZE];
+#pragma data_alignment = 32
+u8 SourceAddress[BUFF_SIZE];
+#else
+u8 DestinationAddress[BUFF_SIZE] __attribute__ ((aligned(32)));
+u8 SourceAddress[BUFF_SIZE] __attribute__ ((aligned(32)));
+#endif
+
+static XScuGic IntcInstance;
+static XSdPs_Request Requests[NUM_REQUESTS];
+static volatile u32 DoneCount;
+static volatile u32 ErrorCount;
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the SD interrupt example.
+*
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	xil_printf("SD Interrupt Read/ Write Test \r\n");
+
+	Status = SdpsIntrTest();
+	if (Status != XST_SUCCESS) {
+		xil_printf("SD Interrupt Read/ Write Test failed \r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran SD Interrupt Read/ Write Test \r\n");
+
+	return XST_SUCCESS;
+
+}
+
+/*****************************************************************************/
+/**
+*
+* This function performs the SD Interrupt Read/ Write Test.
+*
+* @param	None
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None
+*
+******************************************************************************/
+static int SdpsIntrTest(void)
+{
+	static XSdPs SdInstance;
+	XSdPs_Config *SdConfig;
+	int Status;
+	u32 BuffCnt;
+	u32 Sector = SECTOR_OFFSET;
+
+	for(BuffCnt = 0; BuffCnt < BUFF_SIZE; BuffCnt++){
+		SourceAddress[BuffCnt] = TEST + BuffCnt;
+	}
+
+	/*
+	 * Initialize the host controller
+	 */
+	SdConfig = XSdPs_LookupConfig(SDPS_DEVICE_ID);
+	if (NULL == SdConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_CfgInitialize(&SdInstance, SdConfig,
+					SdConfig->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_CardInitialize(&SdInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = SdpsSetupIntrSystem(&IntcInstance, &SdInstance, SDPS_INTR_ID);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Standard capacity cards are byte addressed.
+	 */
+	if (!(SdInstance.HCS)) {
+		Sector *= XSDPS_BLK_SIZE_512_MASK;
+	}
+
+	/*
+	 * Write data to SD/eMMC.
+	 */
+	Status = SdpsTransfer(&SdInstance, Sector, SourceAddress, TRUE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Read data from SD/eMMC.
+	 */
+	Status = SdpsTransfer(&SdInstance, Sector, DestinationAddress, FALSE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Data verification
+	 */
+	for(BuffCnt = 0; BuffCnt < BUFF_SIZE; BuffCnt++){
+		if(SourceAddress[BuffCnt] != DestinationAddress[BuffCnt]){
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits NUM_REQUESTS requests on consecutive sectors and
+* waits for all of them to complete.
+*
+* @param	SdInstancePtr is a pointer to the instance of the SdPs driver.
+* @param	Sector is the card address of the first block.
+* @param	Buff is the data buffer.
+* @param	IsWrite is TRUE for a write.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None
+*
+******************************************************************************/
+static int SdpsTransfer(XSdPs *SdInstancePtr, u32 Sector, u8 *Buff,
+		u8 IsWrite)
+{
+	u32 Index;
+	u32 Step;
+	int Status;
+
+	Step = (SdInstancePtr->HCS != 0U) ? NUM_BLOCKS :
+			(NUM_BLOCKS * XSDPS_BLK_SIZE_512_MASK);
+
+	DoneCount = 0U;
+	ErrorCount = 0U;
+
+	for (Index = 0U; Index < NUM_REQUESTS; Index++) {
+		Requests[Index].Arg = Sector + (Index * Step);
+		Requests[Index].BlkCnt = NUM_BLOCKS;
+		Requests[Index].Buff = Buff + (Index * NUM_BLOCKS * 512U);
+		Requests[Index].IsWrite = IsWrite;
+		Requests[Index].Callback = SdpsCallback;
+		Requests[Index].CallBackRef = SdInstancePtr;
+
+		Status = XSdPs_QueueSubmit(SdInstancePtr, &Requests[Index]);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	/*
+	 * The CPU is free to do other work here.
+	 */
+	while (DoneCount < NUM_REQUESTS) {
+	}
+
+	return (ErrorCount == 0U) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Completion callback of the queued requests.
+*
+* @param	CallBackRef is the argument given with the request.
+* @param	Status is the completion status of the request.
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void SdpsCallback(void *CallBackRef, s32 Status)
+{
+	(void)CallBackRef;
+
+	if (Status != XST_SUCCESS) {
+		ErrorCount++;
+	}
+	DoneCount++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up the interrupt system so interrupts can occur for the
+* SD controller.
+*
+* @param	IntcInstancePtr is a pointer to the instance of the Intc driver.
+* @param	SdInstancePtr is a pointer to the instance of the SdPs driver.
+* @param	SdIntrId is the interrupt Id of the SD controller.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None
+*
+******************************************************************************/
+static int SdpsSetupIntrSystem(XScuGic *IntcInstancePtr, XSdPs *SdInstancePtr,
+		u16 SdIntrId)
+{
+	XScuGic_Config *IntcConfig;
+	int Status;
+
+	Xil_ExceptionInit();
+
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+					IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				(Xil_ExceptionHandler)XScuGic_InterruptHandler,
+				IntcInstancePtr);
+
+	Status = XScuGic_Connect(IntcInstancePtr, SdIntrId,
+				(Xil_ExceptionHandler)XSdPs_IntrHandler,
+				(void *)SdInstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_Enable(IntcInstancePtr, SdIntrId);
+
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
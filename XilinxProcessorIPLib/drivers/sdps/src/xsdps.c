@@ -89,6 +89,7 @@
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 *       sk     04/07/22 Add support to read custom tap delay values from design
 *                       for SD/eMMC.
+* 4.1   kc     10/18/26 Initialize the transfer queue.
 *
 * </pre>
 *
@@ -181,6 +182,9 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->IsBusy = FALSE;
 	InstancePtr->BlkSize = 0U;
 	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->QueueHead = NULL;
+	InstancePtr->QueueTail = NULL;
+	InstancePtr->ActiveHead = NULL;
 
 	/* Host Controller version is read. */
 	InstancePtr->HC_Version =
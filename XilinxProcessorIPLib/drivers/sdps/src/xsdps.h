@@ -156,6 +156,7 @@
 *       sk     04/07/22 Add support to read custom tap delay values from design
 *                       for SD/eMMC.
 *       sk     06/03/22 Fix issue in internal clock divider calculation logic.
+* 4.1   kc     10/18/26 Added interrupt driven queued transfer API.
 *
 * </pre>
 *
@@ -232,6 +233,17 @@ extern "C" {
 
 /** @} */
 
+/** @name Queued transfer limits
+ *
+ * Limits of one ADMA2 chain built from coalesced queued requests.
+ * @{
+ */
+
+#define XSDPS_QUEUE_DESC_MAX	64U	/**< ADMA2 lines per batch */
+#define XSDPS_QUEUE_BLKCNT_MAX	0xFFFFU	/**< Blocks per batch */
+
+/** @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -287,6 +299,26 @@ typedef struct {
 }  __attribute__((__packed__))XSdPs_Adma2Descriptor64;
 #endif
 
+/**
+ * Completion callback of a queued transfer request. Status is XST_SUCCESS
+ * or XST_FAILURE.
+ */
+typedef void (*XSdPs_Callback)(void *CallBackRef, s32 Status);
+
+/**
+ * Queued transfer request. The request and its buffer belong to the driver
+ * from XSdPs_QueueSubmit() until the callback is invoked.
+ */
+typedef struct XSdPs_RequestS {
+	u32 Arg;		/**< Card address, as for XSdPs_ReadPolled */
+	u32 BlkCnt;		/**< Number of blocks */
+	u8 *Buff;		/**< Data buffer */
+	u8 IsWrite;		/**< TRUE for a write, FALSE for a read */
+	XSdPs_Callback Callback;	/**< Completion callback, may be NULL */
+	void *CallBackRef;	/**< Argument passed to the callback */
+	struct XSdPs_RequestS *Next;	/**< Used by the driver */
+} XSdPs_Request;
+
 /**
  * The XSdPs driver instance data. The user is required to allocate a
  * variable of this type for every SD device in the system. A pointer
@@ -318,6 +350,9 @@ typedef struct {
 	u8  IsBusy;			/**< Busy Flag*/
 	u32 BlkSize;		/**< Block Size*/
 	u8  IsTuningDone;	/**< Flag to indicate HS200 tuning complete */
+	XSdPs_Request *QueueHead;	/**< First pending queued request */
+	XSdPs_Request *QueueTail;	/**< Last pending queued request */
+	XSdPs_Request *ActiveHead;	/**< Queued requests in flight */
 } XSdPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -362,6 +397,8 @@ s32 XSdPs_CheckReadTransfer(XSdPs *InstancePtr);
 s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
+s32 XSdPs_QueueSubmit(XSdPs *InstancePtr, XSdPs_Request *ReqPtr);
+void XSdPs_IntrHandler(void *InstancePtr);
 
 #ifdef __cplusplus
 }
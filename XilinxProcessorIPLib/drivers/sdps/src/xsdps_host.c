@@ -34,6 +34,7 @@
 *       sk     04/07/22 Add support to read custom tap delay values from design
 *                       for SD/eMMC.
 *       sk     06/03/22 Fix issue in internal clock divider calculation logic.
+* 4.1   kc     10/18/26 CMD23 and ACMD23 do not use the DAT lines.
 *
 * </pre>
 *
@@ -1717,6 +1718,8 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 		break;
 	case CMD23:
 	case ACMD23:
+		RetVal |= RESP_R1;
+		break;
 	case CMD24:
 	case CMD25:
 		RetVal |= RESP_R1 | (u32)XSDPS_DAT_PRESENT_SEL_MASK;
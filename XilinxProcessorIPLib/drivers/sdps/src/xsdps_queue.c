@@ -0,0 +1,538 @@
+/******************************************************************************
+* Copyright (C) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_queue.c
+* @addtogroup sdps Overview
+* @{
+*
+* The xsdps_queue.c file contains the interrupt driven queued transfer APIs.
+* See xsdps.h for a detailed description of the device and driver.
+*
+* Requests submitted with XSdPs_QueueSubmit() are kept in a FIFO. Requests
+* at the head of the queue with the same direction and consecutive card
+* addresses are merged into one ADMA2 chain and issued as a single
+* multi-block command. For eMMC the block count is set with CMD23 instead
+* of using Auto CMD12. XSdPs_IntrHandler() must be connected to the SD
+* interrupt; it completes the batch in flight, starts the next one and then
+* invokes the callbacks of the completed requests.
+*
+* The polled transfer APIs return XST_FAILURE while queued requests are in
+* flight.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.1   kc     10/18/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+/************************** Constant Definitions *****************************/
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XSdPs_QueueNextArg(const XSdPs *InstancePtr,
+		const XSdPs_Request *ReqPtr);
+static u32 XSdPs_QueueDescLines(const XSdPs_Request *ReqPtr);
+static void XSdPs_QueueSetupDescTbl(XSdPs *InstancePtr);
+static s32 XSdPs_QueueIssue(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt,
+		u8 IsWrite);
+static void XSdPs_QueueStart(XSdPs *InstancePtr);
+static void XSdPs_QueueComplete(XSdPs *InstancePtr, XSdPs_Request *Head,
+		s32 Status);
+
+/************************** Variable Definitions *****************************/
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+static XSdPs_Adma2Descriptor32 Adma2_QueueTbl32[XSDPS_QUEUE_DESC_MAX];
+#pragma data_alignment = 32
+static XSdPs_Adma2Descriptor64 Adma2_QueueTbl64[XSDPS_QUEUE_DESC_MAX];
+#else
+static XSdPs_Adma2Descriptor32 Adma2_QueueTbl32[XSDPS_QUEUE_DESC_MAX]
+		__attribute__ ((aligned(32)));
+static XSdPs_Adma2Descriptor64 Adma2_QueueTbl64[XSDPS_QUEUE_DESC_MAX]
+		__attribute__ ((aligned(32)));
+#endif
+
+/*****************************************************************************/
+/**
+* @brief
+* This function queues a read or write request. The request is started
+* immediately if no other queued request is in flight, otherwise it is
+* merged with or issued after the requests already queued.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is a pointer to the request. Arg, BlkCnt, Buff,
+* 		IsWrite, Callback and CallBackRef must be filled in by the
+* 		caller. The request must stay valid until its callback is
+* 		invoked.
+*
+* @return
+* 		- XST_SUCCESS if the request was queued
+* 		- XST_FAILURE if the request exceeds the limits of one
+* 		ADMA2 chain or 64-bit DMA addressing is configured
+*
+* @note		This function may be called from a completion callback.
+*
+******************************************************************************/
+s32 XSdPs_QueueSubmit(XSdPs *InstancePtr, XSdPs_Request *ReqPtr)
+{
+	u16 SigEn;
+	u16 ErrSigEn;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr->Buff != NULL);
+
+	if ((ReqPtr->BlkCnt == 0U) ||
+			(ReqPtr->BlkCnt > XSDPS_QUEUE_BLKCNT_MAX) ||
+			(XSdPs_QueueDescLines(ReqPtr) >
+			XSDPS_QUEUE_DESC_MAX) ||
+			(InstancePtr->Dma64BitAddr >= ADDRESS_BEYOND_32BIT)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Keep the interrupt handler out while the queue is updated */
+	SigEn = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET);
+	ErrSigEn = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET, 0x0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET, 0x0U);
+
+	/*
+	 * A transfer started with the non-blocking APIs has to be
+	 * completed before queued requests can be issued.
+	 */
+	if ((InstancePtr->ActiveHead == NULL) && (InstancePtr->IsBusy == TRUE)) {
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_SIG_EN_OFFSET, ErrSigEn);
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_SIG_EN_OFFSET, SigEn);
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	ReqPtr->Next = NULL;
+	if (InstancePtr->QueueTail == NULL) {
+		InstancePtr->QueueHead = ReqPtr;
+	} else {
+		InstancePtr->QueueTail->Next = ReqPtr;
+	}
+	InstancePtr->QueueTail = ReqPtr;
+
+	if (InstancePtr->ActiveHead == NULL) {
+		/* Enables the interrupt signals once a batch is in flight */
+		XSdPs_QueueStart(InstancePtr);
+	} else {
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_SIG_EN_OFFSET, ErrSigEn);
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_SIG_EN_OFFSET, SigEn);
+	}
+
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function is the interrupt handler of the queued transfer API. It
+* completes the batch in flight, starts the next batch and invokes the
+* callbacks of the completed requests.
+*
+* @param	InstancePtr is a pointer to the XSdPs instance.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_IntrHandler(void *InstancePtr)
+{
+	XSdPs *SdPsPtr = (XSdPs *)InstancePtr;
+	XSdPs_Request *Done;
+	u16 StatusReg;
+	s32 Status;
+
+	Xil_AssertVoid(SdPsPtr != NULL);
+
+	/* Mask further interrupts until the next batch is issued */
+	XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET, 0x0U);
+	XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET, 0x0U);
+
+	StatusReg = XSdPs_ReadReg16(SdPsPtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_STS_OFFSET);
+
+	if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+		XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+				XSDPS_ERR_INTR_STS_OFFSET, XSDPS_ERROR_INTR_ALL_MASK);
+		XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_STS_OFFSET, XSDPS_NORM_INTR_ALL_MASK);
+		/* Bring the CMD and DAT lines back to idle */
+		(void)XSdPs_Reset(SdPsPtr, XSDPS_SWRST_CMD_LINE_MASK |
+				XSDPS_SWRST_DAT_LINE_MASK);
+		Status = XST_FAILURE;
+	} else if ((StatusReg & XSDPS_INTR_TC_MASK) != 0U) {
+		XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_STS_OFFSET, XSDPS_INTR_TC_MASK);
+		Status = XST_SUCCESS;
+	} else {
+		Status = XST_DEVICE_BUSY;
+	}
+
+	Done = SdPsPtr->ActiveHead;
+	if ((Status == XST_DEVICE_BUSY) || (Done == NULL)) {
+		/* Not a completion, restore the interrupt signals if in flight */
+		if (Done != NULL) {
+			XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+					XSDPS_NORM_INTR_SIG_EN_OFFSET,
+					XSDPS_INTR_TC_MASK | XSDPS_INTR_ERR_MASK);
+			XSdPs_WriteReg16(SdPsPtr->Config.BaseAddress,
+					XSDPS_ERR_INTR_SIG_EN_OFFSET,
+					XSDPS_ERROR_INTR_ALL_MASK);
+		}
+		goto RETURN_PATH;
+	}
+
+	SdPsPtr->ActiveHead = NULL;
+	SdPsPtr->IsBusy = FALSE;
+
+	/* Keep the card busy while the callbacks run */
+	if (SdPsPtr->QueueHead != NULL) {
+		XSdPs_QueueStart(SdPsPtr);
+	}
+
+	XSdPs_QueueComplete(SdPsPtr, Done, Status);
+
+RETURN_PATH:
+	return;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function returns the card address following the last block of a
+* request.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is a pointer to the request.
+*
+* @return	Card address following the request
+*
+******************************************************************************/
+static u32 XSdPs_QueueNextArg(const XSdPs *InstancePtr,
+		const XSdPs_Request *ReqPtr)
+{
+	u32 NextArg;
+
+	/* Standard capacity cards are byte addressed */
+	if (InstancePtr->HCS != 0U) {
+		NextArg = ReqPtr->Arg + ReqPtr->BlkCnt;
+	} else {
+		NextArg = ReqPtr->Arg + (ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+	}
+
+	return NextArg;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function returns the number of ADMA2 lines describing a request.
+*
+* @param	ReqPtr is a pointer to the request.
+*
+* @return	Number of descriptor lines
+*
+******************************************************************************/
+static u32 XSdPs_QueueDescLines(const XSdPs_Request *ReqPtr)
+{
+	u32 Len = ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+
+	return (Len + XSDPS_DESC_MAX_LENGTH - 1U) / XSDPS_DESC_MAX_LENGTH;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function builds the ADMA2 chain of the active batch and points the
+* ADMA SAR to it. Each request buffer gets its own descriptor lines.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_QueueSetupDescTbl(XSdPs *InstancePtr)
+{
+	const XSdPs_Request *Req;
+	UINTPTR TblAddr;
+	INTPTR TblSize;
+	u32 DescNum = 0U;
+	u32 Offset;
+	u32 Len;
+	u16 DescLen;
+	u16 Attr;
+
+	for (Req = InstancePtr->ActiveHead; Req != NULL; Req = Req->Next) {
+		Len = Req->BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+		for (Offset = 0U; Offset < Len; Offset += XSDPS_DESC_MAX_LENGTH) {
+			Attr = XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+			if ((Req->Next == NULL) &&
+					((Offset + XSDPS_DESC_MAX_LENGTH) >= Len)) {
+				Attr |= XSDPS_DESC_END;
+			}
+
+			/* A length of 0 stands for XSDPS_DESC_MAX_LENGTH */
+			if ((Len - Offset) >= XSDPS_DESC_MAX_LENGTH) {
+				DescLen = 0U;
+			} else {
+				DescLen = (u16)(Len - Offset);
+			}
+
+			if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+				Adma2_QueueTbl64[DescNum].Address =
+						(u64)((UINTPTR)Req->Buff + Offset);
+				Adma2_QueueTbl64[DescNum].Attribute = Attr;
+				Adma2_QueueTbl64[DescNum].Length = DescLen;
+			} else {
+				Adma2_QueueTbl32[DescNum].Address =
+						(u32)((UINTPTR)Req->Buff + Offset);
+				Adma2_QueueTbl32[DescNum].Attribute = Attr;
+				Adma2_QueueTbl32[DescNum].Length = DescLen;
+			}
+			DescNum++;
+		}
+	}
+
+	if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+		TblAddr = (UINTPTR)&(Adma2_QueueTbl64[0]);
+		TblSize = (INTPTR)sizeof(XSdPs_Adma2Descriptor64) * (INTPTR)DescNum;
+	} else {
+		TblAddr = (UINTPTR)&(Adma2_QueueTbl32[0]);
+		TblSize = (INTPTR)sizeof(XSdPs_Adma2Descriptor32) * (INTPTR)DescNum;
+	}
+
+#if defined(__aarch64__) || defined(__arch64__)
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_EXT_OFFSET,
+			(u32)(TblAddr >> 32U));
+#endif
+
+	XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			(u32)(TblAddr & ~(u32)0x0U));
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)TblAddr, TblSize);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function issues the data command of the active batch. eMMC devices
+* get the block count through CMD23 and SD cards use Auto CMD12.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Arg is the card address of the first block.
+* @param	BlkCnt is the number of blocks of the batch.
+* @param	IsWrite is TRUE for a write.
+*
+* @return
+* 		- XST_SUCCESS if the command was sent
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+static s32 XSdPs_QueueIssue(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt,
+		u8 IsWrite)
+{
+	u16 TransferMode;
+	u32 Cmd;
+	s32 Status;
+
+	TransferMode = XSDPS_TM_BLK_CNT_EN_MASK | XSDPS_TM_DMA_EN_MASK;
+	if (IsWrite == FALSE) {
+		TransferMode |= XSDPS_TM_DAT_DIR_SEL_MASK;
+	}
+
+	if (BlkCnt == 1U) {
+		Cmd = (IsWrite == FALSE) ? CMD17 : CMD24;
+	} else {
+		Cmd = (IsWrite == FALSE) ? CMD18 : CMD25;
+		TransferMode |= XSDPS_TM_MUL_SIN_BLK_SEL_MASK;
+		if ((InstancePtr->CardType == XSDPS_CARD_MMC) ||
+				(InstancePtr->CardType == XSDPS_CHIP_EMMC)) {
+			/* Closed ended transfer, no stop command required */
+			InstancePtr->TransferMode = 0U;
+			Status = XSdPs_CmdTransfer(InstancePtr, CMD23, BlkCnt, 0U);
+			if (Status != XST_SUCCESS) {
+				Status = XST_FAILURE;
+				goto RETURN_PATH;
+			}
+		} else {
+			TransferMode |= XSDPS_TM_AUTO_CMD12_EN_MASK;
+		}
+	}
+
+	InstancePtr->TransferMode = TransferMode;
+	Status = XSdPs_CmdTransfer(InstancePtr, Cmd, Arg, BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function takes the next batch from the queue and starts it. Requests
+* at the head of the queue are merged as long as they have the same
+* direction, continue at the card address where the previous one ended and
+* fit in one ADMA2 chain. Batches which fail to start are completed with
+* XST_FAILURE once a batch is in flight or the queue is empty, so a callback
+* resubmitting a request cannot start a batch from within this loop.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_QueueStart(XSdPs *InstancePtr)
+{
+	XSdPs_Request *Failed = NULL;
+	XSdPs_Request *FailedTail = NULL;
+	XSdPs_Request *Last;
+	XSdPs_Request *Req;
+	u32 BlkCnt;
+	u32 DescLines;
+	s32 Status;
+
+	while (InstancePtr->QueueHead != NULL) {
+		Last = InstancePtr->QueueHead;
+		BlkCnt = Last->BlkCnt;
+		DescLines = XSdPs_QueueDescLines(Last);
+
+		/* Coalesce adjacent requests into one batch */
+		while (Last->Next != NULL) {
+			Req = Last->Next;
+			if ((Req->IsWrite != Last->IsWrite) ||
+					(Req->Arg != XSdPs_QueueNextArg(InstancePtr, Last)) ||
+					((BlkCnt + Req->BlkCnt) > XSDPS_QUEUE_BLKCNT_MAX) ||
+					((DescLines + XSdPs_QueueDescLines(Req)) >
+					XSDPS_QUEUE_DESC_MAX)) {
+				break;
+			}
+			BlkCnt += Req->BlkCnt;
+			DescLines += XSdPs_QueueDescLines(Req);
+			Last = Req;
+		}
+
+		InstancePtr->ActiveHead = InstancePtr->QueueHead;
+		InstancePtr->QueueHead = Last->Next;
+		if (InstancePtr->QueueHead == NULL) {
+			InstancePtr->QueueTail = NULL;
+		}
+		Last->Next = NULL;
+
+		for (Req = InstancePtr->ActiveHead; Req != NULL; Req = Req->Next) {
+			if (InstancePtr->Config.IsCacheCoherent == 0U) {
+				if (Req->IsWrite != FALSE) {
+					Xil_DCacheFlushRange((INTPTR)Req->Buff,
+						(INTPTR)Req->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+				} else {
+					Xil_DCacheInvalidateRange((INTPTR)Req->Buff,
+						(INTPTR)Req->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+				}
+			}
+		}
+
+		Status = XSdPs_SetupTransfer(InstancePtr);
+		if (Status == XST_SUCCESS) {
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_BLK_SIZE_OFFSET, XSDPS_BLK_SIZE_512_MASK);
+			XSdPs_QueueSetupDescTbl(InstancePtr);
+			Status = XSdPs_QueueIssue(InstancePtr,
+					InstancePtr->ActiveHead->Arg, BlkCnt,
+					InstancePtr->ActiveHead->IsWrite);
+		}
+
+		if (Status == XST_SUCCESS) {
+			InstancePtr->IsBusy = TRUE;
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_ERR_INTR_SIG_EN_OFFSET,
+					XSDPS_ERROR_INTR_ALL_MASK);
+			XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+					XSDPS_NORM_INTR_SIG_EN_OFFSET,
+					XSDPS_INTR_TC_MASK | XSDPS_INTR_ERR_MASK);
+			break;
+		}
+
+		if (FailedTail == NULL) {
+			Failed = InstancePtr->ActiveHead;
+		} else {
+			FailedTail->Next = InstancePtr->ActiveHead;
+		}
+		FailedTail = Last;
+		InstancePtr->ActiveHead = NULL;
+	}
+
+	if (Failed != NULL) {
+		XSdPs_QueueComplete(InstancePtr, Failed, XST_FAILURE);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function invokes the callbacks of a completed batch.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Head is the first request of the batch.
+* @param	Status is the completion status of the batch.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_QueueComplete(XSdPs *InstancePtr, XSdPs_Request *Head,
+		s32 Status)
+{
+	XSdPs_Request *Req = Head;
+	XSdPs_Request *Next;
+
+	while (Req != NULL) {
+		/* The callback may resubmit the request */
+		Next = Req->Next;
+		if ((Req->IsWrite == FALSE) &&
+				(InstancePtr->Config.IsCacheCoherent == 0U)) {
+			Xil_DCacheInvalidateRange((INTPTR)Req->Buff,
+				(INTPTR)Req->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		}
+		if (Req->Callback != NULL) {
+			Req->Callback(Req->CallBackRef, Status);
+		}
+		Req = Next;
+	}
+}
+/** @} */
@@ -8,10 +8,30 @@
 #  1.0      rco    07/21/15 Initial version of vprocss hscaler subcore tcl
 #  2.0      dmc    12/17/15 Include new arg ENABLE_422
 #  3.0      mpe    04/28/16 Include new arg ENABLE_420, and ENABLE_CSC
+#  3.5      kc     10/18/26 Define the phase cache size and the widest core
 #
 ###############################################################################
 
 proc generate {drv_handle} {
+    # Phase cache entries and the width the phase registers are sized for
+    set entries [common::get_property CONFIG.phase_cache_entries $drv_handle]
+    if { [llength $entries] == 0 } {
+        set entries 4
+    }
+    set maxcols 0
+    foreach periph [::hsi::utils::get_common_driver_ips $drv_handle] {
+        set cols [common::get_property CONFIG.MAX_COLS $periph]
+        if { [llength $cols] != 0 && $cols > $maxcols } {
+            set maxcols $cols
+        }
+    }
+    set file_handle [::hsi::utils::open_include_file "xparameters.h"]
+    puts $file_handle "#define XPAR_XV_HSCALER_PHASE_CACHE_ENTRIES $entries"
+    if { $maxcols != 0 } {
+        puts $file_handle "#define XPAR_XV_HSCALER_PHASE_MAX_WIDTH $maxcols"
+    }
+    close $file_handle
+
     xdefine_include_file $drv_handle "xparameters.h" "XV_hscaler" \
         "NUM_INSTANCES" \
         "DEVICE_ID" \
@@ -0,0 +1,7 @@
+/* Host build, the width of the widest core of the test */
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define XPAR_XV_HSCALER_PHASE_MAX_WIDTH 3840
+
+#endif
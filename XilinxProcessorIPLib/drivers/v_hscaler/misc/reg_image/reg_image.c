@@ -0,0 +1,231 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file reg_image.c
+ *
+ * Host test of the phase cache and register shadow of the H scaler layer-2
+ * driver, with xv_hscaler_l2.c compiled into this tool. The core registers
+ * are arrays of the test.
+ *
+ * For every pixels per clock and taps setting, a sequence of setups with
+ * random widths is run on one instance, which reuses its cache and shadow.
+ * After each setup its register image must be the same as the one of a new
+ * instance programmed from scratch with the same widths, which writes every
+ * register like the driver did before the cache. The register writes of
+ * both are counted. A repeated setup must write no phase or coefficient
+ * register.
+ *
+ * The Makefile builds the test with the default cache and with
+ * XV_HSCALER_PHASE_CACHE_ENTRIES set to 0.
+ *
+ * Usage: reg_image [-n <setups per setting>]
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   kc   10/18/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <getopt.h>
+#include "xv_hscaler_l2.h"
+
+#define TEST_REG_SIZE		0x8000U
+#define TEST_MAX_WIDTH		3840U
+#define TEST_MAX_HEIGHT		2160U
+#define TEST_CTRL_REGS		6U	/* Height, widths, color modes, rate */
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+				__LINE__, #Cond);			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+static u32 Regs[TEST_REG_SIZE / 4U];		/* Reused instance */
+static u32 RefRegs[TEST_REG_SIZE / 4U];		/* Instance from scratch */
+static XV_Hscaler_l2 Hsc;
+static XV_Hscaler_l2 RefHsc;
+static unsigned long Writes;
+static unsigned int Seed = 1U;
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	(void)vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+const char *XVidC_GetColorFormatStr(XVidC_ColorFormat ColorFormatId)
+{
+	(void)ColorFormatId;
+	return "";
+}
+
+int XV_hscaler_Initialize(XV_hscaler *InstancePtr, u16 DeviceId)
+{
+	(void)InstancePtr;
+	(void)DeviceId;
+	return XST_DEVICE_NOT_FOUND;
+}
+
+u32 Xil_In32(UINTPTR Addr)
+{
+	return *(volatile u32 *)Addr;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Writes++;
+	*(volatile u32 *)Addr = Value;
+}
+
+static void InitInstance(XV_Hscaler_l2 *InstancePtr, u32 *RegsPtr,
+	u32 PixPerClk, u32 Taps)
+{
+	memset(InstancePtr, 0, sizeof(*InstancePtr));
+	InstancePtr->Hsc.Config.BaseAddress = (UINTPTR)RegsPtr;
+	InstancePtr->Hsc.Config.PixPerClk = (u16)PixPerClk;
+	InstancePtr->Hsc.Config.MaxWidth = TEST_MAX_WIDTH;
+	InstancePtr->Hsc.Config.MaxHeight = TEST_MAX_HEIGHT;
+	InstancePtr->Hsc.Config.PhaseShift = 6U;
+	InstancePtr->Hsc.Config.NumTaps = (u16)Taps;
+	InstancePtr->Hsc.Config.ScalerType = XV_HSCALER_POLYPHASE;
+	InstancePtr->Hsc.Config.NumVidComponents = 3U;
+	InstancePtr->Hsc.IsReady = XIL_COMPONENT_IS_READY;
+}
+
+static u32 PickWidth(void)
+{
+	static const u32 Widths[] = {1920U, 3840U, 1280U, 960U, 720U, 640U};
+
+	/* Mostly common widths, which hit the cache, and some odd ones */
+	if ((rand_r(&Seed) % 8U) == 0U) {
+		return 8U * (1U + ((u32)rand_r(&Seed) % (TEST_MAX_WIDTH / 8U)));
+	}
+
+	return Widths[(u32)rand_r(&Seed) % (sizeof(Widths) / sizeof(Widths[0]))];
+}
+
+static int RunSetting(u32 PixPerClk, u32 Taps, u32 NumSetups,
+	unsigned long *WritesPtr, unsigned long *RefWritesPtr)
+{
+	unsigned long FullWrites = 0U;
+	u32 WidthIn = 0U;
+	u32 WidthOut = 0U;
+	u32 Idx;
+
+	memset(Regs, 0, sizeof(Regs));
+	InitInstance(&Hsc, Regs, PixPerClk, Taps);
+
+	for (Idx = 0U; Idx < NumSetups; Idx++) {
+		WidthIn = PickWidth();
+		WidthOut = PickWidth();
+
+		Writes = 0U;
+		TEST_CHECK(XV_HScalerSetup(&Hsc, 1080U, WidthIn, WidthOut,
+			XVIDC_CSF_RGB, XVIDC_CSF_RGB) == XST_SUCCESS);
+		*WritesPtr += Writes;
+
+		memset(RefRegs, 0, sizeof(RefRegs));
+		InitInstance(&RefHsc, RefRegs, PixPerClk, Taps);
+		Writes = 0U;
+		TEST_CHECK(XV_HScalerSetup(&RefHsc, 1080U, WidthIn, WidthOut,
+			XVIDC_CSF_RGB, XVIDC_CSF_RGB) == XST_SUCCESS);
+		*RefWritesPtr += Writes;
+		FullWrites = Writes;
+
+		if (memcmp(Regs, RefRegs, sizeof(Regs)) != 0) {
+			printf("%u ppc %u taps, %u to %u: register images "
+				"differ\n", PixPerClk, Taps, WidthIn, WidthOut);
+			return XST_FAILURE;
+		}
+	}
+
+	/* Same setup again, only the control registers are written */
+	Writes = 0U;
+	TEST_CHECK(XV_HScalerSetup(&Hsc, 1080U, WidthIn, WidthOut,
+		XVIDC_CSF_RGB, XVIDC_CSF_RGB) == XST_SUCCESS);
+	TEST_CHECK(Writes == TEST_CTRL_REGS);
+
+	/* After an invalidate, every register is written again */
+	XV_HScalerShadowInvalidate(&Hsc);
+	Writes = 0U;
+	TEST_CHECK(XV_HScalerSetup(&Hsc, 1080U, WidthIn, WidthOut,
+		XVIDC_CSF_RGB, XVIDC_CSF_RGB) == XST_SUCCESS);
+	TEST_CHECK(Writes == FullWrites);
+
+	return XST_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+	static const u32 PixPerClk[] = {XVIDC_PPC_1, XVIDC_PPC_2, XVIDC_PPC_4,
+		XVIDC_PPC_8};
+	static const u32 Taps[] = {XV_HSCALER_TAPS_6, XV_HSCALER_TAPS_8,
+		XV_HSCALER_TAPS_10, XV_HSCALER_TAPS_12};
+	unsigned long TotalWrites = 0U;
+	unsigned long TotalRefWrites = 0U;
+	unsigned long SettingWrites;
+	unsigned long SettingRefWrites;
+	u32 NumSetups = 200U;
+	u32 P;
+	u32 T;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:")) != -1) {
+		switch (Opt) {
+		case 'n':
+			NumSetups = (u32)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n <setups per setting>]\n",
+				argv[0]);
+			return 1;
+		}
+	}
+	if (NumSetups == 0U) {
+		NumSetups = 1U;
+	}
+
+	printf("%d phase cache entries, phase registers for %d pixels\n",
+		XV_HSCALER_PHASE_CACHE_ENTRIES, XV_HSCALER_PHASE_MAX_WIDTH);
+
+	for (P = 0U; P < sizeof(PixPerClk) / sizeof(PixPerClk[0]); P++) {
+		for (T = 0U; T < sizeof(Taps) / sizeof(Taps[0]); T++) {
+			SettingWrites = 0U;
+			SettingRefWrites = 0U;
+			if (RunSetting(PixPerClk[P], Taps[T], NumSetups,
+				&SettingWrites, &SettingRefWrites) !=
+				XST_SUCCESS) {
+				printf("FAILED\n");
+				return 1;
+			}
+			TotalWrites += SettingWrites;
+			TotalRefWrites += SettingRefWrites;
+		}
+	}
+
+	printf("%lu register writes, %lu when programmed from scratch\n",
+		TotalWrites, TotalRefWrites);
+	printf("PASSED\n");
+
+	return 0;
+}
@@ -30,6 +30,10 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.5   kc    10/18/26   Cache the computed phases and write only the phase
+*                        and coefficient registers that change
+*                        Phase cache entries set by a driver parameter, 0
+*                        for none
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +57,11 @@
 static const int STEP_PRECISION_SHIFT = 16;
 static const u64 XHSC_MASK_LOW_32BITS = ((u64)1<<32)-1;
 
+#if (XV_HSCALER_PHASE_CACHE_ENTRIES == 0)
+/* Phase registers of the current setup, shared by the instances */
+static u32 XV_HScalerPhaseRegs[XV_HSCALER_PHASE_REG_WORDS];
+#endif
+
 extern const short XV_hscaler_Lanczos2_taps6[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
 extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
 extern const short XV_hscaler_fixedcoeff_taps6_ScalingRatio2[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_6];
@@ -74,8 +83,14 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
                             u32 WidthOut,
                             u32 PixelRate);
 
+static void XV_HScalerPackPhase(XV_Hscaler_l2 *HscPtr, u32 *PhaseRegs);
+static const u32 *XV_HScalerGetPhase(XV_Hscaler_l2 *HscPtr,
+                                     u32 WidthIn,
+                                     u32 WidthOut,
+                                     u32 PixelRate);
+
 static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr);
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr);
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, const u32 *PhaseRegs);
 
 /*****************************************************************************/
 /**
@@ -133,6 +148,26 @@ void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr)
   XV_hscaler_DisableAutoRestart(&InstancePtr->Hsc);
 }
 
+/*****************************************************************************/
+/**
+* This function invalidates the shadow copy of the phase and coefficient
+* registers, so that the next setup programs all of them. It must be called
+* if these registers are written outside of the layer-2 API or lose their
+* contents.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerShadowInvalidate(XV_Hscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->PhaseShadowValid = FALSE;
+  InstancePtr->CoeffShadowValid = FALSE;
+}
+
 /*****************************************************************************/
 /**
 * This function determines the internal coeffiecient table to be used based on
@@ -425,120 +460,100 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
         if (nrRds >= HscPtr->Hsc.Config.PixPerClk)
             nrRds -= HscPtr->Hsc.Config.PixPerClk;
     }
+
+    /* Clear the entries past the line, left over from a wider setup */
+    for (x=loopWidth; x<(int)(HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk); x++)
+    {
+        HscPtr->phasesH[x] = 0;
+        HscPtr->phasesH_H[x] = 0;
+    }
 }
 
 /*****************************************************************************/
 /**
-* This function programs the phase data into core registers
+* This function packs the phase data into the 32b words of the core phase
+* registers, in register order
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  PhaseRegs is the array of XV_HSCALER_PHASE_REG_WORDS words that
+*         receives the register values
 *
 * @return None
 *
-* @Note  This version of driver does not make use of computed coefficients.
-*        User must load the coefficients, using the provided API, before
-*        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
+static void XV_HScalerPackPhase(XV_Hscaler_l2 *HscPtr, u32 *PhaseRegs)
 {
   u32 loopWidth;
-  UINTPTR baseAddr;
-  //program phases
-  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+  u32 index, i;
+
   loopWidth = HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk;
+  index = 0;
   switch(HscPtr->Hsc.Config.PixPerClk)
   {
     case XVIDC_PPC_1:
             {
-              u32 val, lsb, msb, index, i;
+              u32 lsb, msb;
 
               /* PhaseH is 64bits but only lower 16b of each entry is valid
                * Form 32b word with 16bit LSB from 2 consecutive entries
-               * Need 1 32b write to get 2 entries into IP registers
-               * (i is array loc and index is address offset)
                */
-              index = 0;
               for(i=0; i < loopWidth; i+=2)
               {
                 lsb = (u32)(HscPtr->phasesH[i]   & (u64)XHSC_MASK_LOW_16BITS);
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
-                val = (msb<<16 | lsb);
-                Xil_Out32(baseAddr+(index*4), val);
-                ++index;
+                PhaseRegs[index++] = (msb<<16 | lsb);
               }
             }
             break;
 
     case XVIDC_PPC_2:
             {
-              u32 val, i;
-
               /* PhaseH is 64bits but only lower 32b of each entry is valid
-               * Need 1 32b write to get each entry into IP registers
+               * Need 1 32b word for each entry
                */
               for(i=0; i < loopWidth; ++i)
               {
-                val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(i*4), val);
+                PhaseRegs[index++] = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
               }
             }
             break;
 
     case XVIDC_PPC_4:
             {
-              u32 lsb, msb, index, offset, i;
               u64 phaseHData;
 
               /* PhaseH is 64bits and each entry has valid 32b MSB & LSB
-               * Need 2 32b writes to get each entry into IP registers
-               * (index is array loc and offset is address offset)
+               * Need 2 32b words for each entry
                */
-              index = 0;
-              offset = 0;
               for(i=0; i < loopWidth; ++i)
               {
-                phaseHData = HscPtr->phasesH[index];
-                lsb = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
-                msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(offset*4), lsb);
-                Xil_Out32(baseAddr+((offset+1)*4), msb);
-                ++index;
-                offset += 2;
+                phaseHData = HscPtr->phasesH[i];
+                PhaseRegs[index++] = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
+                PhaseRegs[index++] = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
               }
             }
             break;
     case XVIDC_PPC_8:
 	    {
 		u32 bits_0_31, bits_32_63, bits_64_95;
-		u32 index, offset, i;
 		u64 phaseHData, phaseHData_H;
 		/*
 		 * PhaseH and PhaseH_H are 64bits and each entry has valid 44
 		 * bits. PhaseH has lower 44 bits and PhaseH_H has higer 44 bits
-		 * Need to form 3 32b writes form the total 88 bits, and
-		 * write each 32bits into IP registers.
-		 * (index is array loc and offset is address offset)
+		 * Need to form 3 32b words form the total 88 bits.
 		 */
-		index = 0;
-		offset = 0;
 		for(i=0; i < loopWidth; i++) {
-			bits_0_31 = 0;
-			bits_32_63 = 0;
-			bits_64_95 = 0;
-			phaseHData = HscPtr->phasesH[index];
-			phaseHData_H = HscPtr->phasesH_H[index];
+			phaseHData = HscPtr->phasesH[i];
+			phaseHData_H = HscPtr->phasesH_H[i];
 
 			bits_0_31 = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
 			bits_32_63 = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
 			bits_32_63 |= ((u32)((phaseHData_H & XHSC_MASK_LOW_20BITS)) << 12);
 			bits_64_95 = (((u32)(phaseHData_H & XHSC_MASK_LOW_32BITS)) >> 20);
 			bits_64_95 |= (((u32)(phaseHData_H>>32) & XHSC_MASK_LOW_12BITS) << 12);
-			Xil_Out32(baseAddr+(offset*4), bits_0_31);
-			Xil_Out32(baseAddr+((offset+1)*4), bits_32_63);
-			Xil_Out32(baseAddr+((offset+2)*4), bits_64_95);
-			/*(offset+3)*4 register is reserved,so increment offset by 4*/
-			offset += 4;
-			index++;
+			PhaseRegs[index++] = bits_0_31;
+			PhaseRegs[index++] = bits_32_63;
+			PhaseRegs[index++] = bits_64_95;
 		}
 	    }
 	    break;
@@ -549,11 +564,132 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
   }
 }
 
+/*****************************************************************************/
+/**
+* This function returns the phase registers for the given widths. The phases
+* are taken from the phase cache, or computed and packed into the least
+* recently used cache entry. Without the cache, they are always computed.
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input frame width
+* @param  WidthOut is the scaled frame width
+* @param  PixelRate is the number of pixels per clock being processed
+*
+* @return Pointer to the phase register words
+*
+******************************************************************************/
+static const u32 *XV_HScalerGetPhase(XV_Hscaler_l2 *HscPtr,
+                                     u32 WidthIn,
+                                     u32 WidthOut,
+                                     u32 PixelRate)
+{
+#if (XV_HSCALER_PHASE_CACHE_ENTRIES == 0)
+  /* Compute Phase for 1 line */
+  CalculatePhases(HscPtr, WidthIn, WidthOut, PixelRate);
+  XV_HScalerPackPhase(HscPtr, XV_HScalerPhaseRegs);
+
+  return(XV_HScalerPhaseRegs);
+#else
+  XV_Hscaler_PhaseCache *entry;
+  XV_Hscaler_PhaseCache *victim;
+  u32 i;
+
+  ++HscPtr->UseCount;
+  victim = &HscPtr->PhaseCache[0];
+  for(i=0; i < XV_HSCALER_PHASE_CACHE_ENTRIES; ++i)
+  {
+    entry = &HscPtr->PhaseCache[i];
+    if(!entry->Valid)
+    {
+      victim = entry;
+      continue;
+    }
+    if((entry->WidthIn == WidthIn) && (entry->WidthOut == WidthOut))
+    {
+      entry->LastUse = HscPtr->UseCount;
+      return(entry->PhaseRegs);
+    }
+    /* Age is computed modulo 2^32, so a wrapped count is handled */
+    if(victim->Valid &&
+       ((HscPtr->UseCount - entry->LastUse) > (HscPtr->UseCount - victim->LastUse)))
+    {
+      victim = entry;
+    }
+  }
+
+  /* Compute Phase for 1 line */
+  CalculatePhases(HscPtr, WidthIn, WidthOut, PixelRate);
+  XV_HScalerPackPhase(HscPtr, victim->PhaseRegs);
+
+  victim->WidthIn  = WidthIn;
+  victim->WidthOut = WidthOut;
+  victim->LastUse  = HscPtr->UseCount;
+  victim->Valid    = TRUE;
+
+  return(victim->PhaseRegs);
+#endif
+}
+
+/*****************************************************************************/
+/**
+* This function programs the phase data into core registers. Only the
+* registers that differ from the shadow copy are written.
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  PhaseRegs is the packed phase data returned by XV_HScalerGetPhase()
+*
+* @return None
+*
+* @Note  This version of driver does not make use of computed coefficients.
+*        User must load the coefficients, using the provided API, before
+*        scaler can be used
+******************************************************************************/
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr, const u32 *PhaseRegs)
+{
+  u32 loopWidth;
+  u32 numRegs, i, offset;
+  UINTPTR baseAddr;
+
+  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+  loopWidth = HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk;
+  switch(HscPtr->Hsc.Config.PixPerClk)
+  {
+    case XVIDC_PPC_1:
+            numRegs = (loopWidth+1)/2;
+            break;
+    case XVIDC_PPC_2:
+            numRegs = loopWidth;
+            break;
+    case XVIDC_PPC_4:
+            numRegs = loopWidth*2;
+            break;
+    case XVIDC_PPC_8:
+            numRegs = loopWidth*3;
+            break;
+    default:
+            return;
+  }
+
+  for(i=0; i < numRegs; ++i)
+  {
+    if(HscPtr->PhaseShadowValid && (HscPtr->PhaseShadow[i] == PhaseRegs[i]))
+    {
+      continue;
+    }
+    /* At 8 PPC an entry takes 3 words and a reserved 4th register */
+    offset = ((HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_8) ?
+              ((i/3)*4 + (i%3)) : i);
+    Xil_Out32(baseAddr+(offset*4), PhaseRegs[i]);
+    HscPtr->PhaseShadow[i] = PhaseRegs[i];
+  }
+  HscPtr->PhaseShadowValid = TRUE;
+}
+
 
 /*****************************************************************************/
 /**
-* This function programs the filter coefficients and phase data into core
-* registers
+* This function programs the filter coefficients into core registers. Only
+* the registers that differ from the shadow copy are written.
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
 *
@@ -578,9 +714,17 @@ static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr)
     {
        rdIndx = j*2+offset;
        val = (HscPtr->coeff[i][rdIndx+1] << 16) | (HscPtr->coeff[i][rdIndx] & XHSC_MASK_LOW_16BITS);
+       /* Skip the registers that already hold the value */
+       if (HscPtr->CoeffShadowValid &&
+           (HscPtr->CoeffShadow[i*num_taps+j] == (u32)val))
+       {
+         continue;
+       }
        Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       HscPtr->CoeffShadow[i*num_taps+j] = (u32)val;
     }
   }
+  HscPtr->CoeffShadowValid = TRUE;
 }
 
 /*****************************************************************************/
@@ -607,6 +751,7 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
                      u32 ColorFormatOut)
 {
   u32 PixelRate;
+  const u32 *PhaseRegs;
 
   /*
    * Assert validates the input arguments
@@ -615,6 +760,7 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
   Xil_AssertNonvoid((HeightIn>0) && (HeightIn<=InstancePtr->Hsc.Config.MaxHeight));
   Xil_AssertNonvoid((WidthIn>0) && (WidthIn<=InstancePtr->Hsc.Config.MaxWidth));
   Xil_AssertNonvoid((WidthOut>0) && (WidthOut<=InstancePtr->Hsc.Config.MaxWidth));
+  Xil_AssertNonvoid(InstancePtr->Hsc.Config.MaxWidth <= XV_HSCALER_PHASE_MAX_WIDTH);
   Xil_AssertNonvoid((InstancePtr->Hsc.Config.PixPerClk >= XVIDC_PPC_1) &&
 		  (InstancePtr->Hsc.Config.PixPerClk <= XVIDC_PPC_8));
 
@@ -636,11 +782,11 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
     XV_HScalerSetCoeff(InstancePtr);
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+  /* Compute Phase for 1 line, or reuse the cached one */
+  PhaseRegs = XV_HScalerGetPhase(InstancePtr, WidthIn, WidthOut, PixelRate);
 
   /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+  XV_HScalerSetPhase(InstancePtr, PhaseRegs);
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
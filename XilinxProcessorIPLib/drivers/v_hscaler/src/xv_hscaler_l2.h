@@ -58,6 +58,21 @@
 * This driver is not thread safe. Any needs for threads or thread mutual
 * exclusion must be satisfied by the layer above this driver.
 *
+* <b> Register Programming </b>
+*
+* The driver keeps a shadow copy of the phase and coefficient registers it
+* has written and XV_HScalerSetup() only writes the registers whose value
+* changes. The phase registers computed for the last
+* XV_HSCALER_PHASE_CACHE_ENTRIES (WidthIn, WidthOut) pairs are kept in a
+* cache, least recently used entry replaced first, so that switching back to
+* a recently used resolution does not compute the phases again. The number of
+* entries is set with the phase_cache_entries driver parameter. Each entry
+* and the shadow take 2 bytes per pixel of the widest core, set 0 to save
+* this memory when the resolution seldom changes. If the core
+* registers are written outside of the layer-2 API, or the core loses its
+* register contents, XV_HScalerShadowInvalidate() must be called so that the
+* next setup programs all registers.
+*
 * <b>Limitations</b>
 *
 * <pre>
@@ -70,6 +85,9 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.5   kc    10/18/26   Added phase cache and register shadow for faster
+*                        resolution switching, sized by the driver parameter
+*                        phase_cache_entries and the widest core
 * </pre>
 *
 ******************************************************************************/
@@ -80,6 +98,9 @@
 extern "C" {
 #endif
 
+#ifndef __linux__
+#include "xparameters.h"
+#endif
 #include "xvidc.h"
 #include "xv_hscaler.h"
 
@@ -91,6 +112,33 @@ extern "C" {
 #define XV_HSCALER_MAX_H_TAPS           (12)
 #define XV_HSCALER_MAX_H_PHASES         (64)
 #define XV_HSCALER_MAX_LINE_WIDTH       (8192)
+/*@}*/
+
+/** @name Phase Cache
+ * @{
+ * The following constants define the size of the phase cache and of the
+ * register shadow. The number of cache entries is the phase_cache_entries
+ * driver parameter, 0 disables the cache. The phase registers are sized for
+ * the widest core in the design, they take at most 1 32b word per 2 pixels.
+ */
+#ifndef XV_HSCALER_PHASE_CACHE_ENTRIES
+#ifdef XPAR_XV_HSCALER_PHASE_CACHE_ENTRIES
+#define XV_HSCALER_PHASE_CACHE_ENTRIES  XPAR_XV_HSCALER_PHASE_CACHE_ENTRIES
+#else
+#define XV_HSCALER_PHASE_CACHE_ENTRIES  (4)
+#endif
+#endif
+#ifndef XV_HSCALER_PHASE_MAX_WIDTH
+#ifdef XPAR_XV_HSCALER_PHASE_MAX_WIDTH
+#define XV_HSCALER_PHASE_MAX_WIDTH      XPAR_XV_HSCALER_PHASE_MAX_WIDTH
+#else
+#define XV_HSCALER_PHASE_MAX_WIDTH      XV_HSCALER_MAX_LINE_WIDTH
+#endif
+#endif
+#define XV_HSCALER_PHASE_REG_WORDS      ((XV_HSCALER_PHASE_MAX_WIDTH+1)/2)
+#define XV_HSCALER_COEFF_REG_WORDS      \
+        (XV_HSCALER_MAX_H_PHASES*XV_HSCALER_MAX_H_TAPS/2)
+/*@}*/
 
 /**************************** Type Definitions *******************************/
 /**
@@ -114,6 +162,18 @@ typedef enum
   XV_HSCALER_TAPS_12 = 12
 }XV_HSCALER_TAPS;
 
+/**
+ * Phase registers computed for one (WidthIn, WidthOut) pair
+ */
+typedef struct
+{
+  u32 WidthIn;
+  u32 WidthOut;
+  u32 LastUse;  /*<< Setup count at the last use */
+  u8 Valid;     /*<< Entry holds computed phases */
+  u32 PhaseRegs[XV_HSCALER_PHASE_REG_WORDS];
+}XV_Hscaler_PhaseCache;
+
 /**
  * H Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every H Scaler device in the system. A pointer to a
@@ -126,6 +186,14 @@ typedef struct
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
+  u8 PhaseShadowValid;  /*<< PhaseShadow holds the phase registers */
+  u8 CoeffShadowValid;  /*<< CoeffShadow holds the coefficient registers */
+  u32 PhaseShadow[XV_HSCALER_PHASE_REG_WORDS];
+  u32 CoeffShadow[XV_HSCALER_COEFF_REG_WORDS];
+#if (XV_HSCALER_PHASE_CACHE_ENTRIES > 0)
+  u32 UseCount;         /*<< Setup count, for the cache replacement */
+  XV_Hscaler_PhaseCache PhaseCache[XV_HSCALER_PHASE_CACHE_ENTRIES];
+#endif
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -183,6 +251,7 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
 int XV_HScalerValidateConfig(XV_Hscaler_l2 *InstancePtr,
                              u32 ColorFormatIn,
                              u32 ColorFormatOut);
+void XV_HScalerShadowInvalidate(XV_Hscaler_l2 *InstancePtr);
 void XV_HScalerDbgReportStatus(XV_Hscaler_l2 *InstancePtr);
 
 #ifdef __cplusplus
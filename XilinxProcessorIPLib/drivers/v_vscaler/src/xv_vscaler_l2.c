@@ -27,6 +27,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.3   kc    10/18/26   Write only the coefficient registers that change
 *
 * </pre>
 *
@@ -121,6 +122,24 @@ void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr)
   XV_vscaler_DisableAutoRestart(&InstancePtr->Vsc);
 }
 
+/*****************************************************************************/
+/**
+* This function invalidates the shadow copy of the coefficient registers, so
+* that the next setup programs all of them. It must be called if these
+* registers are written outside of the layer-2 API or lose their contents.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerShadowInvalidate(XV_Vscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffShadowValid = FALSE;
+}
+
 /*****************************************************************************/
 /**
 * This function loads default filter coefficients in the scaler coefficient
@@ -319,7 +338,8 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 /*****************************************************************************/
 /**
 * This function programs the computed filter coefficients and phase data into
-* core registers
+* core registers. Only the registers that differ from the shadow copy are
+* written.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
 * @param  VCoeff is the array that holds computed coefficients
@@ -348,9 +368,17 @@ static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr)
     {
        rdIndx = j*2+offset;
        val = (VscPtr->coeff[i][rdIndx+1] << 16) | (VscPtr->coeff[i][rdIndx] & XVSC_MASK_LOW_16BITS);
+       /* Skip the registers that already hold the value */
+       if (VscPtr->CoeffShadowValid &&
+           (VscPtr->CoeffShadow[i*num_taps+j] == (u32)val))
+       {
+         continue;
+       }
        Xil_Out32(baseAddr+((i*num_taps+j)*4), val);
+       VscPtr->CoeffShadow[i*num_taps+j] = (u32)val;
     }
   }
+  VscPtr->CoeffShadowValid = TRUE;
 }
 
 /*****************************************************************************/
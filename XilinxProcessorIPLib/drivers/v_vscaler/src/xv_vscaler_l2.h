@@ -58,6 +58,14 @@
 * This driver is not thread safe. Any needs for threads or thread mutual
 * exclusion must be satisfied by the layer above this driver.
 *
+* <b> Register Programming </b>
+*
+* The driver keeps a shadow copy of the coefficient registers it has written
+* and XV_VScalerSetup() only writes the registers whose value changes. If
+* the core registers are written outside of the layer-2 API, or the core
+* loses its register contents, XV_VScalerShadowInvalidate() must be called
+* so that the next setup programs all registers.
+*
 * <b>Limitations</b>
 *
 * <pre>
@@ -69,6 +77,7 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.3   kc    10/18/26   Added register shadow of the coefficients
 *
 * </pre>
 *
@@ -91,6 +100,8 @@ extern "C" {
   */
  #define XV_VSCALER_MAX_V_TAPS           (12)
  #define XV_VSCALER_MAX_V_PHASES         (64)
+ #define XV_VSCALER_COEFF_REG_WORDS      \
+         (XV_VSCALER_MAX_V_PHASES*XV_VSCALER_MAX_V_TAPS/2)
 
 /**************************** Type Definitions *******************************/
 /**
@@ -124,6 +135,8 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  u8 CoeffShadowValid;  /*<< CoeffShadow holds the coefficient registers */
+  u32 CoeffShadow[XV_VSCALER_COEFF_REG_WORDS];
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -153,6 +166,7 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32 HeightIn,
                     u32 HeightOut,
                     u32 ColorFormat);
+void XV_VScalerShadowInvalidate(XV_Vscaler_l2 *InstancePtr);
 void XV_VScalerDbgReportStatus(XV_Vscaler_l2 *InstancePtr);
 
 #ifdef __cplusplus
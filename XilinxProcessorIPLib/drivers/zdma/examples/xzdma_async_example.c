@@ -0,0 +1,260 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async_example.c
+*
+* This file contains an example of the asynchronous copy and fill service of
+* the XZDma driver. Eight channels are added to the service, which runs
+* without interrupts. Copies, a fill and a scatter gather job are queued,
+* the fences are waited for and the data is checked. The number of jobs run
+* by every channel is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.15  kc      10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma_async.h"
+#include "xparameters.h"
+#include "xil_printf.h"
+
+/************************** Constant Definitions ******************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place. The channels are
+ * ZDMA_DEVICE_ID to ZDMA_DEVICE_ID + ZDMA_NUM_CHANNELS - 1.
+ */
+#define ZDMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID /* First ZDMA channel */
+#define ZDMA_NUM_CHANNELS	8U	/**< Channels used */
+
+#define CHUNK_SIZE		4096U	/**< Bytes per copy job */
+#define NUM_CHUNKS		16U	/**< Copy jobs */
+#define BUF_SIZE		(CHUNK_SIZE * NUM_CHUNKS)
+#define FILL_SIZE		8192U	/**< Bytes of the fill job */
+#define FILL_VALUE		0xA5A55A5AU
+#define SG_ENTRIES		4U	/**< Entries of the scatter gather job */
+#define SG_ENTRY_SIZE		1024U
+#define DSCR_BYTES		(SG_ENTRIES * 32U)	/**< Per channel */
+#define NUM_FENCES		(NUM_CHUNKS + 2U)
+
+/************************** Function Prototypes ******************************/
+
+int XZDma_AsyncExample(u16 DeviceId);
+static void FillDone(void *CallBackRef, XZDma_Fence Fence, s32 Status);
+
+/************************** Variable Definitions *****************************/
+
+XZDma ZDma[ZDMA_NUM_CHANNELS];	/**< Instances of the ZDMA channels */
+XZDma_Async Async;		/**< Asynchronous service */
+#if defined(__ICCARM__)
+    #pragma data_alignment = 64
+	u8 SrcBuf[BUF_SIZE];	/**< Source buffer */
+    #pragma data_alignment = 64
+	u8 DstBuf[BUF_SIZE];	/**< Destination buffer */
+    #pragma data_alignment = 64
+	u32 FillBuf[FILL_SIZE / 4U];	/**< Fill buffer */
+    #pragma data_alignment = 64
+	u8 SgBuf[SG_ENTRIES * SG_ENTRY_SIZE];	/**< Gather buffer */
+    #pragma data_alignment = 64
+	u8 DscrMem[ZDMA_NUM_CHANNELS][DSCR_BYTES]; /**< Descriptors */
+#else
+u8 SrcBuf[BUF_SIZE] __attribute__ ((aligned (64)));	/**< Source buffer */
+u8 DstBuf[BUF_SIZE] __attribute__ ((aligned (64)));	/**< Destination
+							  *  buffer */
+u32 FillBuf[FILL_SIZE / 4U] __attribute__ ((aligned (64)));
+							/**< Fill buffer */
+u8 SgBuf[SG_ENTRIES * SG_ENTRY_SIZE] __attribute__ ((aligned (64)));
+							/**< Gather buffer */
+u8 DscrMem[ZDMA_NUM_CHANNELS][DSCR_BYTES] __attribute__ ((aligned (64)));
+							/**< Descriptors */
+#endif
+XZDma_Transfer SgList[SG_ENTRIES];	/**< Scatter gather job */
+static volatile s32 FillStatus = XST_DEVICE_BUSY; /**< Fill callback status */
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	/* Run the asynchronous service example */
+	Status = XZDma_AsyncExample((u16)ZDMA_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("ZDMA Async Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran ZDMA Async Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs copy, fill and scatter gather jobs on eight ZDMA
+* channels through the asynchronous service and checks the data.
+*
+* @param	DeviceId is the XPAR_<ZDMA Instance>_DEVICE_ID value of the
+*		first channel from xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int XZDma_AsyncExample(u16 DeviceId)
+{
+	XZDma_Config *Config;
+	XZDma_Fence Fence[NUM_FENCES];
+	u32 Index;
+	int Status;
+
+	Status = XZDma_AsyncInitialize(&Async, FALSE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < ZDMA_NUM_CHANNELS; Index++) {
+		Config = XZDma_LookupConfig((u16)(DeviceId + Index));
+		if (NULL == Config) {
+			return XST_FAILURE;
+		}
+		Status = XZDma_CfgInitialize(&ZDma[Index], Config,
+					     Config->BaseAddress);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Status = XZDma_AsyncAddChannel(&Async, &ZDma[Index],
+					       (UINTPTR)DscrMem[Index],
+					       DSCR_BYTES);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	for (Index = 0U; Index < BUF_SIZE; Index++) {
+		SrcBuf[Index] = (u8)(Index * 7U);
+		DstBuf[Index] = 0U;
+	}
+
+	/* The chunks are spread over the channels */
+	for (Index = 0U; Index < NUM_CHUNKS; Index++) {
+		Status = XZDma_AsyncCopy(&Async,
+				(UINTPTR)&DstBuf[Index * CHUNK_SIZE],
+				(UINTPTR)&SrcBuf[Index * CHUNK_SIZE],
+				CHUNK_SIZE, &Fence[Index]);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	Status = XZDma_AsyncFill(&Async, (UINTPTR)FillBuf, FILL_VALUE,
+				 FILL_SIZE, &Fence[NUM_CHUNKS]);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	(void)XZDma_FenceSetCallback(&Async, Fence[NUM_CHUNKS], FillDone,
+				     (void *)&Async);
+
+	/* Gather the first SG_ENTRY_SIZE bytes of every other chunk */
+	for (Index = 0U; Index < SG_ENTRIES; Index++) {
+		SgList[Index].SrcAddr =
+			(UINTPTR)&SrcBuf[2U * Index * CHUNK_SIZE];
+		SgList[Index].DstAddr = (UINTPTR)&SgBuf[Index * SG_ENTRY_SIZE];
+		SgList[Index].Size = SG_ENTRY_SIZE;
+		SgList[Index].SrcCoherent = ZDma[0].Config.IsCacheCoherent;
+		SgList[Index].DstCoherent = ZDma[0].Config.IsCacheCoherent;
+		SgList[Index].Pause = FALSE;
+	}
+	Status = XZDma_AsyncSg(&Async, SgList, SG_ENTRIES,
+			       &Fence[NUM_CHUNKS + 1U]);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < NUM_FENCES; Index++) {
+		Status = XZDma_FenceWait(&Async, Fence[Index], 1000000U);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Fence %d status %d\r\n", Index, Status);
+			return XST_FAILURE;
+		}
+	}
+	if (FillStatus != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Validation */
+	for (Index = 0U; Index < BUF_SIZE; Index++) {
+		if (DstBuf[Index] != SrcBuf[Index]) {
+			return XST_FAILURE;
+		}
+	}
+	for (Index = 0U; Index < (FILL_SIZE / 4U); Index++) {
+		if (FillBuf[Index] != FILL_VALUE) {
+			return XST_FAILURE;
+		}
+	}
+	for (Index = 0U; Index < (SG_ENTRIES * SG_ENTRY_SIZE); Index++) {
+		if (SgBuf[Index] != SrcBuf[(2U * (Index / SG_ENTRY_SIZE) *
+					    CHUNK_SIZE) +
+					   (Index % SG_ENTRY_SIZE)]) {
+			return XST_FAILURE;
+		}
+	}
+
+	for (Index = 0U; Index < ZDMA_NUM_CHANNELS; Index++) {
+		xil_printf("Channel %d: %d jobs\r\n", Index,
+			   XZDma_AsyncGetChan(&Async, Index)->JobCnt);
+		/* Remove all configurations done in this example */
+		XZDma_Reset(&ZDma[Index]);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This is the callback of the fill job.
+*
+* @param	CallBackRef is the service instance.
+* @param	Fence is the fence of the fill job.
+* @param	Status is the status of the job.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void FillDone(void *CallBackRef, XZDma_Fence Fence, s32 Status)
+{
+	(void)CallBackRef;
+	(void)Fence;
+
+	FillStatus = Status;
+}
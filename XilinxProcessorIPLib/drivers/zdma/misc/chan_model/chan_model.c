@@ -0,0 +1,507 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file chan_model.c
+ *
+ * Host test of the ZDMA asynchronous copy and fill service, with xzdma.c and
+ * xzdma_async.c compiled into this tool. The register accesses of the driver
+ * go to a model of the ZDMA channels. A channel latches its transfer when it
+ * is enabled and moves the data when the test completes it: a simple copy,
+ * a write only fill or the linear descriptors of a scatter gather transfer.
+ * It then sets the done interrupt, with an AXI read error if one was
+ * injected, and goes idle.
+ *
+ * The test checks that jobs are spread over the channels with the least
+ * bytes queued, that copies, fills and scatter gather lists move the right
+ * data with the cache maintenance of the service, that jobs complete in order
+ * on their channel and a full service reports busy, that a fence callback
+ * runs once, also for a completed fence, and that a failed job does not stop
+ * the channel. In interrupt mode a job submitted from a fence callback must
+ * run, its done interrupt must not be cleared with the one of the previous
+ * job. XZDma_FenceWait() must time out on a job that does not complete.
+ *
+ * Usage: chan_model
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   kc   10/18/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "xzdma_async.h"
+
+#define TEST_NUM_CHAN		XZDMA_ASYNC_MAX_CHANNELS
+#define TEST_SG_CHAN		4U	/* Channels with descriptor memory */
+#define TEST_CHAN_SPAN		0x1000U
+#define TEST_NUM_DSCR		8U
+#define TEST_BUF_SIZE		0x4000U
+#define TEST_CHAIN_LEN		3U
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+				__LINE__, #Cond);			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+typedef struct {
+	u32 Regs[TEST_CHAN_SPAN / 4U];
+	u32 Running;		/* Enabled, transfer not completed yet */
+	u32 InjectErr;		/* Next completion has an AXI read error */
+} TestChan;
+
+static TestChan *Model;
+static XZDma ZDma[TEST_NUM_CHAN];
+static XZDma_Async Async;
+static XZDma_LiDscr Dscr[TEST_SG_CHAN][2U * TEST_NUM_DSCR]
+	__attribute__ ((aligned (64)));
+static u8 Src[TEST_NUM_CHAN][TEST_BUF_SIZE];
+static u8 Dst[TEST_NUM_CHAN][TEST_BUF_SIZE];
+static u32 Flushes;
+static u32 Invalidates;
+static u32 Sleeps;
+static u32 CompleteOnSleep;	/* Sleep completing the channels, 0 none */
+
+typedef struct {
+	u32 Calls;
+	XZDma_Fence Fence;
+	s32 Status;
+	u32 Chain;		/* Jobs left to submit from the callback */
+} TestCallback;
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	(void)vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len)
+{
+	(void)adr;
+	(void)len;
+	Flushes++;
+}
+
+void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len)
+{
+	(void)adr;
+	(void)len;
+	Invalidates++;
+}
+
+static TestChan *ModelChan(UINTPTR Addr, u32 *OffsetPtr)
+{
+	UINTPTR Offset = Addr - (UINTPTR)Model;
+
+	*OffsetPtr = (u32)(Offset % sizeof(TestChan));
+	return &Model[Offset / sizeof(TestChan)];
+}
+
+u32 Xil_In32(UINTPTR Addr)
+{
+	u32 Offset;
+	TestChan *Chan = ModelChan(Addr, &Offset);
+
+	return Chan->Regs[Offset / 4U];
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Offset;
+	TestChan *Chan = ModelChan(Addr, &Offset);
+
+	switch (Offset) {
+	case XZDMA_CH_ISR_OFFSET:
+		/* Write one to clear */
+		Chan->Regs[Offset / 4U] &= ~Value;
+		break;
+	case XZDMA_CH_IEN_OFFSET:
+		Chan->Regs[XZDMA_CH_IMR_OFFSET / 4U] &= ~Value;
+		break;
+	case XZDMA_CH_IDS_OFFSET:
+		Chan->Regs[XZDMA_CH_IMR_OFFSET / 4U] |= Value;
+		break;
+	case XZDMA_CH_CTRL2_OFFSET:
+		Chan->Regs[Offset / 4U] = Value;
+		if ((Value & XZDMA_CH_CTRL2_EN_MASK) != 0U) {
+			Chan->Running = 1U;
+			Chan->Regs[XZDMA_CH_STS_OFFSET / 4U] =
+				XZDMA_STS_BUSY_MASK;
+		} else {
+			Chan->Running = 0U;
+		}
+		break;
+	default:
+		Chan->Regs[Offset / 4U] = Value;
+		break;
+	}
+}
+
+static u64 RegAddr(TestChan *Chan, u32 LsbOffset)
+{
+	return (u64)Chan->Regs[LsbOffset / 4U] |
+		((u64)Chan->Regs[(LsbOffset + 4U) / 4U] << 32U);
+}
+
+static void FillPattern(u8 *Buf, u32 Size, u32 Value)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Size; Index += 4U) {
+		(void)memcpy(&Buf[Index], &Value, 4U);
+	}
+}
+
+/* Moves the data of the transfer latched on a channel */
+static u32 ModelComplete(u32 ChanIdx)
+{
+	TestChan *Chan = &Model[ChanIdx];
+	u32 Ctrl0 = Chan->Regs[XZDMA_CH_CTRL0_OFFSET / 4U];
+	XZDma_LiDscr *SrcDscr;
+	XZDma_LiDscr *DstDscr;
+	u32 Size;
+	u32 Isr = XZDMA_IXR_DMA_DONE_MASK;
+
+	if (Chan->Running == 0U) {
+		return 0U;
+	}
+
+	if ((Ctrl0 & XZDMA_CTRL0_POINT_TYPE_MASK) != 0U) {
+		SrcDscr = (XZDma_LiDscr *)(UINTPTR)RegAddr(Chan,
+			XZDMA_CH_SRC_START_LSB_OFFSET);
+		DstDscr = (XZDma_LiDscr *)(UINTPTR)RegAddr(Chan,
+			XZDMA_CH_DST_START_LSB_OFFSET);
+		while (1) {
+			(void)memcpy((void *)(UINTPTR)DstDscr->Address,
+				(void *)(UINTPTR)SrcDscr->Address,
+				SrcDscr->Size);
+			if ((SrcDscr->Cntl & XZDMA_WORD3_CMD_MASK) ==
+				XZDMA_WORD3_CMD_STOP_MASK) {
+				break;
+			}
+			SrcDscr++;
+			DstDscr++;
+		}
+	} else {
+		Size = Chan->Regs[XZDMA_CH_DST_DSCR_WORD2_OFFSET / 4U];
+		if ((Ctrl0 & XZDMA_CTRL0_MODE_MASK) == XZDMA_CTRL0_WRONLY_MASK) {
+			FillPattern((u8 *)(UINTPTR)RegAddr(Chan,
+				XZDMA_CH_DST_DSCR_WORD0_OFFSET), Size,
+				Chan->Regs[XZDMA_CH_WR_ONLY_WORD0_OFFSET / 4U]);
+		} else {
+			(void)memcpy((void *)(UINTPTR)RegAddr(Chan,
+				XZDMA_CH_DST_DSCR_WORD0_OFFSET),
+				(void *)(UINTPTR)RegAddr(Chan,
+				XZDMA_CH_SRC_DSCR_WORD0_OFFSET), Size);
+		}
+	}
+
+	if (Chan->InjectErr != 0U) {
+		Chan->InjectErr = 0U;
+		Isr |= XZDMA_IXR_AXI_RD_DATA_MASK;
+	}
+	Chan->Regs[XZDMA_CH_ISR_OFFSET / 4U] |= Isr;
+	Chan->Regs[XZDMA_CH_STS_OFFSET / 4U] = XZDMA_STS_DONE_MASK;
+	Chan->Regs[XZDMA_CH_CTRL2_OFFSET / 4U] = 0U;
+	Chan->Running = 0U;
+
+	return 1U;
+}
+
+static u32 ModelCompleteAll(void)
+{
+	u32 Count = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < TEST_NUM_CHAN; Index++) {
+		Count += ModelComplete(Index);
+	}
+
+	return Count;
+}
+
+/* The service waits in XZDma_FenceWait(), the channels may complete then */
+void usleep(ULONG useconds)
+{
+	(void)useconds;
+	Sleeps++;
+	if (Sleeps == CompleteOnSleep) {
+		(void)ModelCompleteAll();
+	}
+}
+
+static void FenceDone(void *CallBackRef, XZDma_Fence Fence, s32 Status)
+{
+	TestCallback *Cb = (TestCallback *)CallBackRef;
+
+	Cb->Calls++;
+	Cb->Fence = Fence;
+	Cb->Status = Status;
+	if (Cb->Chain != 0U) {
+		Cb->Chain--;
+		if (XZDma_AsyncCopy(&Async, (UINTPTR)Dst[0],
+			(UINTPTR)Src[0], 256U, &Cb->Fence) == XST_SUCCESS) {
+			(void)XZDma_FenceSetCallback(&Async, Cb->Fence,
+				FenceDone, Cb);
+		}
+	}
+}
+
+static int Setup(u32 UseIntr, u32 NumChan)
+{
+	XZDma_Config Config;
+	u32 Index;
+	UINTPTR DscrMem;
+
+	memset(Model, 0, TEST_NUM_CHAN * sizeof(TestChan));
+	TEST_CHECK(XZDma_AsyncInitialize(&Async, UseIntr) == XST_SUCCESS);
+	for (Index = 0U; Index < NumChan; Index++) {
+		memset(&Config, 0, sizeof(Config));
+		Config.DeviceId = (u16)Index;
+		Config.BaseAddress = (u32)(UINTPTR)&Model[Index];
+		/* GDMA channels first, then ADMA */
+		Config.DmaType = (Index < TEST_SG_CHAN) ? 0U : 1U;
+		TEST_CHECK(XZDma_CfgInitialize(&ZDma[Index], &Config,
+			Config.BaseAddress) == XST_SUCCESS);
+		DscrMem = (Index < TEST_SG_CHAN) ? (UINTPTR)Dscr[Index] : 0U;
+		TEST_CHECK(XZDma_AsyncAddChannel(&Async, &ZDma[Index], DscrMem,
+			(DscrMem != 0U) ? sizeof(Dscr[0]) : 0U) ==
+			XST_SUCCESS);
+	}
+	for (Index = 0U; Index < TEST_NUM_CHAN; Index++) {
+		memset(Src[Index], (int)(0x10U + Index), TEST_BUF_SIZE);
+		memset(Dst[Index], 0, TEST_BUF_SIZE);
+	}
+
+	return XST_SUCCESS;
+}
+
+static int Spread(void)
+{
+	XZDma_Fence Fence[TEST_NUM_CHAN];
+	XZDma_Fence Big;
+	u32 Index;
+
+	TEST_CHECK(Setup(FALSE, TEST_NUM_CHAN) == XST_SUCCESS);
+
+	/* One large job, then small ones avoid its channel */
+	TEST_CHECK(XZDma_AsyncCopy(&Async, (UINTPTR)Dst[0], (UINTPTR)Src[0],
+		TEST_BUF_SIZE, &Big) == XST_SUCCESS);
+	Flushes = 0U;
+	for (Index = 1U; Index < TEST_NUM_CHAN; Index++) {
+		TEST_CHECK(XZDma_AsyncCopy(&Async, (UINTPTR)Dst[Index],
+			(UINTPTR)Src[Index], 1024U, &Fence[Index]) ==
+			XST_SUCCESS);
+	}
+	TEST_CHECK(Flushes == 2U * (TEST_NUM_CHAN - 1U));
+	for (Index = 0U; Index < TEST_NUM_CHAN; Index++) {
+		TEST_CHECK((Async.Chan[Index].Tail - Async.Chan[Index].Head) ==
+			1U);
+		TEST_CHECK(Model[Index].Running == 1U);
+	}
+	TEST_CHECK(XZDma_FencePoll(&Async, Big) == XST_DEVICE_BUSY);
+
+	Invalidates = 0U;
+	TEST_CHECK(ModelCompleteAll() == TEST_NUM_CHAN);
+	TEST_CHECK(XZDma_AsyncPoll(&Async) == TEST_NUM_CHAN);
+	TEST_CHECK(Invalidates == TEST_NUM_CHAN);
+	TEST_CHECK(XZDma_FencePoll(&Async, Big) == XST_SUCCESS);
+	TEST_CHECK(memcmp(Dst[0], Src[0], TEST_BUF_SIZE) == 0);
+	for (Index = 1U; Index < TEST_NUM_CHAN; Index++) {
+		TEST_CHECK(XZDma_FencePoll(&Async, Fence[Index]) ==
+			XST_SUCCESS);
+		TEST_CHECK(memcmp(Dst[Index], Src[Index], 1024U) == 0);
+		TEST_CHECK(Dst[Index][1024U] == 0U);
+	}
+
+	return XST_SUCCESS;
+}
+
+static int FillSg(void)
+{
+	XZDma_Transfer List[TEST_CHAIN_LEN];
+	XZDma_Fence Fill;
+	XZDma_Fence Sg;
+	u32 Word;
+	u32 Index;
+
+	TEST_CHECK(Setup(FALSE, TEST_NUM_CHAN) == XST_SUCCESS);
+
+	TEST_CHECK(XZDma_AsyncFill(&Async, (UINTPTR)Dst[0], 0xA5A55A5AU, 6U,
+		&Fill) == XST_INVALID_PARAM);
+	TEST_CHECK(XZDma_AsyncFill(&Async, (UINTPTR)Dst[0], 0xA5A55A5AU,
+		1000U, &Fill) == XST_SUCCESS);
+
+	/* Three copies in one job, on a channel with descriptors */
+	memset(List, 0, sizeof(List));
+	for (Index = 0U; Index < TEST_CHAIN_LEN; Index++) {
+		List[Index].SrcAddr = (UINTPTR)Src[Index + 1U];
+		List[Index].DstAddr = (UINTPTR)Dst[Index + 1U];
+		List[Index].Size = 512U * (Index + 1U);
+	}
+	TEST_CHECK(XZDma_AsyncSg(&Async, List, TEST_CHAIN_LEN, &Sg) ==
+		XST_SUCCESS);
+	/* The low bits of a fence are its channel */
+	TEST_CHECK((Sg & (XZDMA_ASYNC_MAX_CHANNELS - 1U)) < TEST_SG_CHAN);
+
+	(void)ModelCompleteAll();
+	TEST_CHECK(XZDma_AsyncPoll(&Async) == 2U);
+	TEST_CHECK(XZDma_FencePoll(&Async, Fill) == XST_SUCCESS);
+	TEST_CHECK(XZDma_FencePoll(&Async, Sg) == XST_SUCCESS);
+	for (Index = 0U; Index < 1000U; Index += 4U) {
+		(void)memcpy(&Word, &Dst[0][Index], 4U);
+		TEST_CHECK(Word == 0xA5A55A5AU);
+	}
+	TEST_CHECK(Dst[0][1000U] == 0U);
+	for (Index = 0U; Index < TEST_CHAIN_LEN; Index++) {
+		TEST_CHECK(memcmp(Dst[Index + 1U], Src[Index + 1U],
+			List[Index].Size) == 0);
+		TEST_CHECK(Dst[Index + 1U][List[Index].Size] == 0U);
+	}
+
+	/* More copies than descriptors */
+	TEST_CHECK(XZDma_AsyncSg(&Async, List, TEST_NUM_DSCR + 1U, &Sg) ==
+		XST_INVALID_PARAM);
+
+	return XST_SUCCESS;
+}
+
+static int OrderFull(void)
+{
+	XZDma_Fence Fence[XZDMA_ASYNC_QUEUE_DEPTH];
+	XZDma_Fence Extra;
+	TestCallback Cb;
+	u32 Index;
+
+	/* A single channel */
+	TEST_CHECK(Setup(FALSE, 1U) == XST_SUCCESS);
+	for (Index = 0U; Index < XZDMA_ASYNC_QUEUE_DEPTH; Index++) {
+		TEST_CHECK(XZDma_AsyncCopy(&Async,
+			(UINTPTR)&Dst[0][Index * 16U],
+			(UINTPTR)&Src[1][Index * 16U], 16U, &Fence[Index]) ==
+			XST_SUCCESS);
+	}
+	TEST_CHECK(XZDma_AsyncCopy(&Async, (UINTPTR)Dst[1], (UINTPTR)Src[1],
+		16U, &Extra) == XST_DEVICE_BUSY);
+
+	memset(&Cb, 0, sizeof(Cb));
+	TEST_CHECK(XZDma_FenceSetCallback(&Async, Fence[2], FenceDone, &Cb) ==
+		XST_SUCCESS);
+	Model[0].InjectErr = 1U;
+	for (Index = 0U; Index < XZDMA_ASYNC_QUEUE_DEPTH; Index++) {
+		TEST_CHECK(XZDma_FencePoll(&Async, Fence[Index]) ==
+			XST_DEVICE_BUSY);
+		TEST_CHECK(ModelComplete(0U) == 1U);
+		TEST_CHECK(XZDma_AsyncPoll(&Async) == 1U);
+		if (Index == 0U) {
+			/* The AXI error fails the job, not the channel */
+			TEST_CHECK(XZDma_FencePoll(&Async, Fence[0]) ==
+				XST_FAILURE);
+		} else {
+			TEST_CHECK(XZDma_FencePoll(&Async, Fence[Index]) ==
+				XST_SUCCESS);
+		}
+		if (Index + 1U < XZDMA_ASYNC_QUEUE_DEPTH) {
+			TEST_CHECK(XZDma_FencePoll(&Async, Fence[Index + 1U]) ==
+				XST_DEVICE_BUSY);
+		}
+	}
+	TEST_CHECK((Cb.Calls == 1U) && (Cb.Fence == Fence[2]) &&
+		(Cb.Status == XST_SUCCESS));
+	TEST_CHECK(memcmp(&Dst[0][16U], &Src[1][16U],
+		(XZDMA_ASYNC_QUEUE_DEPTH - 1U) * 16U) == 0);
+	TEST_CHECK((Async.Chan[0].JobCnt == XZDMA_ASYNC_QUEUE_DEPTH) &&
+		(Async.Chan[0].ErrCnt == 1U));
+
+	/* A completed fence calls back at once */
+	TEST_CHECK(XZDma_FenceSetCallback(&Async, Fence[0], FenceDone, &Cb) ==
+		XST_SUCCESS);
+	TEST_CHECK((Cb.Calls == 2U) && (Cb.Status == XST_FAILURE));
+
+	/* Time out, then complete while waiting */
+	TEST_CHECK(XZDma_AsyncCopy(&Async, (UINTPTR)Dst[1], (UINTPTR)Src[1],
+		64U, &Extra) == XST_SUCCESS);
+	Sleeps = 0U;
+	TEST_CHECK(XZDma_FenceWait(&Async, Extra, 10U) == XST_TIMEOUT);
+	TEST_CHECK(Sleeps == 10U);
+	CompleteOnSleep = 3U;
+	Sleeps = 0U;
+	TEST_CHECK(XZDma_FenceWait(&Async, Extra, 10U) == XST_SUCCESS);
+	TEST_CHECK(Sleeps == 3U);
+	CompleteOnSleep = 0U;
+
+	return XST_SUCCESS;
+}
+
+static int IntrChain(void)
+{
+	TestCallback Cb;
+	XZDma_Fence Fence;
+	u32 Rounds = 0U;
+
+	/* Each callback submits the next job, from the interrupt handler */
+	TEST_CHECK(Setup(TRUE, 1U) == XST_SUCCESS);
+	memset(&Cb, 0, sizeof(Cb));
+	Cb.Chain = 3U;
+	TEST_CHECK(XZDma_AsyncCopy(&Async, (UINTPTR)Dst[0], (UINTPTR)Src[0],
+		256U, &Fence) == XST_SUCCESS);
+	TEST_CHECK(XZDma_FenceSetCallback(&Async, Fence, FenceDone, &Cb) ==
+		XST_SUCCESS);
+	TEST_CHECK((Model[0].Regs[XZDMA_CH_IMR_OFFSET / 4U] &
+		XZDMA_IXR_DMA_DONE_MASK) == 0U);
+
+	while ((ModelComplete(0U) != 0U) && (Rounds < 10U)) {
+		XZDma_AsyncIntrHandler(XZDma_AsyncGetChan(&Async, 0U));
+		Rounds++;
+	}
+	printf("interrupt chain: %u jobs\n", Rounds);
+	TEST_CHECK((Rounds == 4U) && (Cb.Calls == 4U) &&
+		(Cb.Status == XST_SUCCESS));
+	TEST_CHECK(XZDma_FencePoll(&Async, Cb.Fence) == XST_SUCCESS);
+	TEST_CHECK(memcmp(Dst[0], Src[0], 256U) == 0);
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	void *Map;
+
+	/* XZDma_CfgInitialize() takes a 32 bit register base */
+	Map = mmap(NULL, TEST_NUM_CHAN * sizeof(TestChan),
+		PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if (Map == MAP_FAILED) {
+		printf("mmap failed\n");
+		return 1;
+	}
+	Model = Map;
+
+	if ((Spread() != XST_SUCCESS) || (FillSg() != XST_SUCCESS) ||
+		(OrderFull() != XST_SUCCESS) || (IntrChain() != XST_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
@@ -0,0 +1,5 @@
+/* Host build, no processor configuration */
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#endif
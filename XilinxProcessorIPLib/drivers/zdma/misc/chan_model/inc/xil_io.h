@@ -0,0 +1,11 @@
+/* Host build, the register accesses go to the channel model of the test */
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+
+void xil_printf(const char8 *ctrl1, ...);
+u32 Xil_In32(UINTPTR Addr);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+
+#endif
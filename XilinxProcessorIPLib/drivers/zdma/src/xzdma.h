@@ -115,6 +115,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.15  kc      10/18/26 Added asynchronous copy and fill service with
+*                        completion fences, see xzdma_async.h.
 * </pre>
 *
 ******************************************************************************/
@@ -0,0 +1,884 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async.c
+* @addtogroup zdma_v1_15
+* @{
+*
+* This file contains the asynchronous copy and fill service of the ZDMA
+* driver. Refer to the header file xzdma_async.h for more detailed
+* information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.15  kc      10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma_async.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XZDMA_ASYNC_CHAN_MASK	(XZDMA_ASYNC_MAX_CHANNELS - 1U)
+#define XZDMA_ASYNC_FENCE_INC	XZDMA_ASYNC_MAX_CHANNELS
+
+/* Interrupts that end a job */
+#define XZDMA_ASYNC_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+				 XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+#define XZDMA_ASYNC_INTR_MASK	(XZDMA_IXR_DMA_DONE_MASK | \
+				 XZDMA_ASYNC_ERR_MASK)
+
+/************************** Function Prototypes ******************************/
+
+static XZDma_AsyncChan *XZDma_AsyncPickChan(XZDma_Async *AsyncPtr,
+					    u32 SgNum, s32 *StatusPtr);
+static s32 XZDma_AsyncSubmit(XZDma_Async *AsyncPtr, XZDma_AsyncJob *JobPtr,
+			     u32 SgNum, XZDma_Fence *FencePtr);
+static s32 XZDma_AsyncStartJob(XZDma_AsyncChan *ChanPtr,
+			       XZDma_AsyncJob *JobPtr);
+static void XZDma_AsyncRetire(XZDma_AsyncChan *ChanPtr, s32 Status,
+			      XZDma_AsyncJob *DonePtr);
+static void XZDma_AsyncKick(XZDma_AsyncChan *ChanPtr);
+static u32 XZDma_AsyncChanService(XZDma_AsyncChan *ChanPtr);
+static XZDma_AsyncChan *XZDma_AsyncFenceChan(XZDma_Async *AsyncPtr,
+					     XZDma_Fence Fence);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes an asynchronous service without channels.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	UseIntr specifies how the channels are driven.
+*		- TRUE  - XZDma_AsyncIntrHandler() is connected to the
+*			  interrupt of every channel.
+*		- FALSE - The application calls XZDma_AsyncPoll().
+*
+* @return	- XST_SUCCESS always.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_AsyncInitialize(XZDma_Async *AsyncPtr, u32 UseIntr)
+{
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid((UseIntr == TRUE) || (UseIntr == FALSE));
+
+	AsyncPtr->UseIntr = UseIntr;
+	AsyncPtr->NumChan = 0U;
+	AsyncPtr->Next = 0U;
+	for (Index = 0U; Index < XZDMA_ASYNC_MAX_CHANNELS; Index++) {
+		AsyncPtr->Chan[Index].InstancePtr = NULL;
+	}
+	AsyncPtr->IsReady = XIL_COMPONENT_IS_READY;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a ZDMA channel to the service. Channels of GDMA and ADMA
+* can be mixed.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	InstancePtr is a pointer to the initialized XZDma instance of
+*		the channel. It is owned by the service from now on.
+* @param	DscrMemPtr is the memory for the linear descriptors of the
+*		scatter gather jobs, 64 byte aligned, or 0 if the channel does
+*		not run scatter gather jobs.
+* @param	NoOfBytes is the size of DscrMemPtr in bytes, 32 bytes per
+*		entry of a scatter gather list.
+*
+* @return
+*		- XST_SUCCESS if the channel was added.
+*		- XST_FAILURE if the channel is not idle.
+*		- XST_NO_FEATURE if the service has all its channels.
+*
+* @note		The channel interrupts are disabled and cleared.
+*
+******************************************************************************/
+s32 XZDma_AsyncAddChannel(XZDma_Async *AsyncPtr, XZDma *InstancePtr,
+			  UINTPTR DscrMemPtr, u32 NoOfBytes)
+{
+	XZDma_AsyncChan *ChanPtr;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((DscrMemPtr == 0U) || (NoOfBytes != 0U));
+
+	if (AsyncPtr->NumChan == XZDMA_ASYNC_MAX_CHANNELS) {
+		Status = XST_NO_FEATURE;
+		goto END;
+	}
+	if (InstancePtr->ChannelState != XZDMA_IDLE) {
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	ChanPtr = &AsyncPtr->Chan[AsyncPtr->NumChan];
+	ChanPtr->InstancePtr = InstancePtr;
+	ChanPtr->IsCoherent = (InstancePtr->Config.IsCacheCoherent != 0U) ?
+				TRUE : FALSE;
+	ChanPtr->Head = 0U;
+	ChanPtr->Tail = 0U;
+	ChanPtr->Active = FALSE;
+	ChanPtr->QueuedBytes = 0U;
+	ChanPtr->NextFence = AsyncPtr->NumChan + XZDMA_ASYNC_FENCE_INC;
+	ChanPtr->DoneFence = AsyncPtr->NumChan;
+	ChanPtr->ErrFence = XZDMA_FENCE_NONE;
+	ChanPtr->JobCnt = 0U;
+	ChanPtr->ErrCnt = 0U;
+
+	if (DscrMemPtr != 0U) {
+		(void)XZDma_CreateBDList(InstancePtr, XZDMA_LINEAR, DscrMemPtr,
+					 NoOfBytes);
+	}
+	else {
+		InstancePtr->Descriptor.DscrCount = 0U;
+	}
+
+	XZDma_DisableIntr(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+	InstancePtr->IntrMask = (AsyncPtr->UseIntr == TRUE) ?
+				XZDMA_ASYNC_INTR_MASK : 0U;
+
+	AsyncPtr->NumChan++;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a copy of a buffer.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address.
+* @param	Size is the number of bytes to copy, at most
+*		XZDMA_WORD2_SIZE_MASK.
+* @param	FencePtr is where the fence of the job is returned.
+*
+* @return
+*		- XST_SUCCESS if the job was queued.
+*		- XST_INVALID_PARAM if Size is out of range.
+*		- XST_DEVICE_BUSY if the queues of all channels are full.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_AsyncCopy(XZDma_Async *AsyncPtr, UINTPTR DstAddr, UINTPTR SrcAddr,
+		    u32 Size, XZDma_Fence *FencePtr)
+{
+	XZDma_AsyncJob Job;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(DstAddr != 0U);
+	Xil_AssertNonvoid(SrcAddr != 0U);
+	Xil_AssertNonvoid(FencePtr != NULL);
+
+	if ((Size == 0U) || (Size > XZDMA_WORD2_SIZE_MASK)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Job.Type = XZDMA_JOB_COPY;
+	Job.Xfer.SrcAddr = SrcAddr;
+	Job.Xfer.DstAddr = DstAddr;
+	Job.Xfer.Size = Size;
+	Job.Xfer.Pause = FALSE;
+	Job.Bytes = Size;
+
+	return XZDma_AsyncSubmit(AsyncPtr, &Job, 0U, FencePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a fill of a buffer with a 32 bit value.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	DstAddr is the destination address, 4 byte aligned.
+* @param	Value is written to every word of the buffer.
+* @param	Size is the number of bytes to fill, a multiple of 4 and at
+*		most XZDMA_WORD2_SIZE_MASK.
+* @param	FencePtr is where the fence of the job is returned.
+*
+* @return
+*		- XST_SUCCESS if the job was queued.
+*		- XST_INVALID_PARAM if DstAddr or Size is invalid.
+*		- XST_DEVICE_BUSY if the queues of all channels are full.
+*
+* @note		The channel runs the job in write only mode.
+*
+******************************************************************************/
+s32 XZDma_AsyncFill(XZDma_Async *AsyncPtr, UINTPTR DstAddr, u32 Value,
+		    u32 Size, XZDma_Fence *FencePtr)
+{
+	XZDma_AsyncJob Job;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(DstAddr != 0U);
+	Xil_AssertNonvoid(FencePtr != NULL);
+
+	if ((Size == 0U) || (Size > XZDMA_WORD2_SIZE_MASK) ||
+	    ((Size & 0x3U) != 0U) || ((DstAddr & 0x3U) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Job.Type = XZDMA_JOB_FILL;
+	Job.Xfer.SrcAddr = 0U;
+	Job.Xfer.DstAddr = DstAddr;
+	Job.Xfer.Size = Size;
+	Job.Xfer.Pause = FALSE;
+	Job.Value = Value;
+	Job.Bytes = Size;
+
+	return XZDma_AsyncSubmit(AsyncPtr, &Job, 0U, FencePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a scatter gather list of copies. The list runs on the
+* linear descriptors of one channel and completes as one job.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	List is the array of copies. SrcAddr, DstAddr, Size,
+*		SrcCoherent and DstCoherent of each entry are used, Pause must
+*		be FALSE.
+* @param	Num is the number of entries in List.
+* @param	FencePtr is where the fence of the job is returned.
+*
+* @return
+*		- XST_SUCCESS if the job was queued.
+*		- XST_INVALID_PARAM if an entry is invalid or no channel has
+*		  descriptors for Num entries.
+*		- XST_DEVICE_BUSY if the queues of the channels that can run
+*		  the list are full.
+*
+* @note		List is used when the job starts and when it completes, it
+*		must not change until the fence completes.
+*
+******************************************************************************/
+s32 XZDma_AsyncSg(XZDma_Async *AsyncPtr, XZDma_Transfer *List, u32 Num,
+		  XZDma_Fence *FencePtr)
+{
+	XZDma_AsyncJob Job;
+	u64 Bytes = 0U;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(List != NULL);
+	Xil_AssertNonvoid(Num != 0U);
+	Xil_AssertNonvoid(FencePtr != NULL);
+
+	for (Index = 0U; Index < Num; Index++) {
+		if ((List[Index].SrcAddr == 0U) ||
+		    (List[Index].DstAddr == 0U) ||
+		    (List[Index].Size == 0U) ||
+		    (List[Index].Size > XZDMA_WORD2_SIZE_MASK) ||
+		    (List[Index].Pause != FALSE)) {
+			return XST_INVALID_PARAM;
+		}
+		Bytes += List[Index].Size;
+	}
+
+	Job.Type = XZDMA_JOB_SG;
+	Job.List = List;
+	Job.Num = Num;
+	Job.Bytes = (Bytes > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (u32)Bytes;
+
+	return XZDma_AsyncSubmit(AsyncPtr, &Job, Num, FencePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the state of a fence.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	Fence is a fence returned by a submit function.
+*
+* @return
+*		- XST_SUCCESS if the job is done.
+*		- XST_FAILURE if the job is done and it is the last job of
+*		  its channel that failed.
+*		- XST_DEVICE_BUSY if the job is not done yet.
+*		- XST_INVALID_PARAM if Fence was not returned by the service.
+*
+* @note		The error of a job is only kept until the next job of the same
+*		channel fails. Use a fence callback to get the status of every
+*		job.
+*
+******************************************************************************/
+s32 XZDma_FencePoll(XZDma_Async *AsyncPtr, XZDma_Fence Fence)
+{
+	XZDma_AsyncChan *ChanPtr;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	ChanPtr = XZDma_AsyncFenceChan(AsyncPtr, Fence);
+	if (ChanPtr == NULL) {
+		Status = XST_INVALID_PARAM;
+	}
+	else if ((s32)(ChanPtr->DoneFence - Fence) < 0) {
+		Status = XST_DEVICE_BUSY;
+	}
+	else if (ChanPtr->ErrFence == Fence) {
+		Status = XST_FAILURE;
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits until a fence completes. Without interrupts it runs
+* XZDma_AsyncPoll() while it waits.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	Fence is a fence returned by a submit function.
+* @param	TimeoutUs is the maximum time to wait in microseconds, or
+*		XZDMA_ASYNC_WAIT_FOREVER.
+*
+* @return
+*		- XST_SUCCESS if the job is done.
+*		- XST_FAILURE if the job failed.
+*		- XST_TIMEOUT if the job did not complete in time.
+*		- XST_INVALID_PARAM if Fence was not returned by the service.
+*
+* @note		With interrupts, the ZDMA interrupts must be enabled while
+*		waiting.
+*
+******************************************************************************/
+s32 XZDma_FenceWait(XZDma_Async *AsyncPtr, XZDma_Fence Fence, u32 TimeoutUs)
+{
+	u32 Timeout = TimeoutUs;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	while (TRUE) {
+		if (AsyncPtr->UseIntr == FALSE) {
+			(void)XZDma_AsyncPoll(AsyncPtr);
+		}
+		Status = XZDma_FencePoll(AsyncPtr, Fence);
+		if (Status != XST_DEVICE_BUSY) {
+			break;
+		}
+		if (Timeout == 0U) {
+			Status = XST_TIMEOUT;
+			break;
+		}
+		if (Timeout != XZDMA_ASYNC_WAIT_FOREVER) {
+			Timeout--;
+			usleep(1U);
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the callback of a fence. If the fence is already done,
+* the callback is called before this function returns.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	Fence is a fence returned by a submit function.
+* @param	Handler is the callback, NULL to remove it.
+* @param	CallBackRef is passed to the callback.
+*
+* @return
+*		- XST_SUCCESS if the callback was set or called.
+*		- XST_INVALID_PARAM if Fence was not returned by the service.
+*
+* @note		The callback runs from XZDma_AsyncIntrHandler() or
+*		XZDma_AsyncPoll(). It may submit new jobs.
+*
+******************************************************************************/
+s32 XZDma_FenceSetCallback(XZDma_Async *AsyncPtr, XZDma_Fence Fence,
+			   XZDma_FenceHandler Handler, void *CallBackRef)
+{
+	XZDma_AsyncChan *ChanPtr;
+	XZDma_AsyncJob *JobPtr;
+	u32 Index;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	ChanPtr = XZDma_AsyncFenceChan(AsyncPtr, Fence);
+	if (ChanPtr == NULL) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	Status = XZDma_FencePoll(AsyncPtr, Fence);
+	if (Status != XST_DEVICE_BUSY) {
+		if (Handler != NULL) {
+			Handler(CallBackRef, Fence, Status);
+		}
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	for (Index = ChanPtr->Head; Index != ChanPtr->Tail; Index++) {
+		JobPtr = &ChanPtr->Job[Index % XZDMA_ASYNC_QUEUE_DEPTH];
+		if (JobPtr->Fence == Fence) {
+			JobPtr->Handler = Handler;
+			JobPtr->HandlerRef = CallBackRef;
+			break;
+		}
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function completes the finished jobs of all channels, starts the next
+* queued jobs and calls the fence callbacks. It is used instead of
+* XZDma_AsyncIntrHandler() when the service runs without interrupts.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+*
+* @return	Number of jobs completed.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XZDma_AsyncPoll(XZDma_Async *AsyncPtr)
+{
+	u32 Index;
+	u32 Count = 0U;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(AsyncPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	for (Index = 0U; Index < AsyncPtr->NumChan; Index++) {
+		Count += XZDma_AsyncChanService(&AsyncPtr->Chan[Index]);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of a channel of the service. It
+* completes the running job, starts the next queued job and then calls the
+* fence callback of the completed job, so that the channel is busy again
+* while the callback runs.
+*
+* @param	Instance is the channel, see XZDma_AsyncGetChan().
+*
+* @return	None.
+*
+* @note		Connect it to the ZDMA channel interrupt in place of
+*		XZDma_IntrHandler().
+*
+******************************************************************************/
+void XZDma_AsyncIntrHandler(void *Instance)
+{
+	XZDma_AsyncChan *ChanPtr = (XZDma_AsyncChan *)Instance;
+
+	/* Verify arguments */
+	Xil_AssertVoid(ChanPtr != NULL);
+	Xil_AssertVoid(ChanPtr->InstancePtr != NULL);
+
+	(void)XZDma_AsyncChanService(ChanPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function picks the channel of a new job, the one with the least
+* bytes queued that has room for the job. Ties go to the channel after the
+* last pick.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	SgNum is the number of descriptors the job needs, 0 if none.
+* @param	StatusPtr is set to XST_DEVICE_BUSY or XST_INVALID_PARAM
+*		when no channel is returned.
+*
+* @return	The channel, or NULL.
+*
+* @note		None.
+*
+******************************************************************************/
+static XZDma_AsyncChan *XZDma_AsyncPickChan(XZDma_Async *AsyncPtr,
+					    u32 SgNum, s32 *StatusPtr)
+{
+	XZDma_AsyncChan *ChanPtr;
+	XZDma_AsyncChan *BestPtr = NULL;
+	u32 BestIndex = 0U;
+	u32 Count;
+	u32 Index;
+
+	*StatusPtr = XST_INVALID_PARAM;
+	Index = AsyncPtr->Next;
+	for (Count = 0U; Count < AsyncPtr->NumChan; Count++) {
+		ChanPtr = &AsyncPtr->Chan[Index];
+		if (SgNum <= ChanPtr->InstancePtr->Descriptor.DscrCount) {
+			*StatusPtr = XST_DEVICE_BUSY;
+			if (((ChanPtr->Tail - ChanPtr->Head) <
+			     XZDMA_ASYNC_QUEUE_DEPTH) &&
+			    ((BestPtr == NULL) ||
+			     (ChanPtr->QueuedBytes < BestPtr->QueuedBytes))) {
+				BestPtr = ChanPtr;
+				BestIndex = Index;
+			}
+		}
+		Index++;
+		if (Index == AsyncPtr->NumChan) {
+			Index = 0U;
+		}
+	}
+
+	if (BestPtr != NULL) {
+		AsyncPtr->Next = BestIndex + 1U;
+		if (AsyncPtr->Next == AsyncPtr->NumChan) {
+			AsyncPtr->Next = 0U;
+		}
+	}
+
+	return BestPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function does the cache maintenance of a job, queues it on the
+* picked channel and starts it if the channel is idle.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	JobPtr is the job to queue. Type, Bytes and the fields of the
+*		type are set.
+* @param	SgNum is the number of descriptors the job needs, 0 if none.
+* @param	FencePtr is where the fence of the job is returned.
+*
+* @return
+*		- XST_SUCCESS if the job was queued.
+*		- XST_INVALID_PARAM if no channel can run the job.
+*		- XST_DEVICE_BUSY if the channel queues are full.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_AsyncSubmit(XZDma_Async *AsyncPtr, XZDma_AsyncJob *JobPtr,
+			     u32 SgNum, XZDma_Fence *FencePtr)
+{
+	XZDma_AsyncChan *ChanPtr;
+	XZDma_AsyncJob *SlotPtr;
+	u32 Index;
+	s32 Status;
+
+	ChanPtr = XZDma_AsyncPickChan(AsyncPtr, SgNum, &Status);
+	if (ChanPtr == NULL) {
+		goto END;
+	}
+
+	if (ChanPtr->IsCoherent == FALSE) {
+		if (JobPtr->Type == XZDMA_JOB_SG) {
+			for (Index = 0U; Index < JobPtr->Num; Index++) {
+				Xil_DCacheFlushRange(JobPtr->List[Index].SrcAddr,
+						     JobPtr->List[Index].Size);
+				Xil_DCacheFlushRange(JobPtr->List[Index].DstAddr,
+						     JobPtr->List[Index].Size);
+			}
+		}
+		else {
+			if (JobPtr->Type == XZDMA_JOB_COPY) {
+				Xil_DCacheFlushRange(JobPtr->Xfer.SrcAddr,
+						     JobPtr->Xfer.Size);
+			}
+			Xil_DCacheFlushRange(JobPtr->Xfer.DstAddr,
+					     JobPtr->Xfer.Size);
+		}
+	}
+	JobPtr->Xfer.SrcCoherent = (u8)ChanPtr->IsCoherent;
+	JobPtr->Xfer.DstCoherent = (u8)ChanPtr->IsCoherent;
+	JobPtr->Handler = NULL;
+	JobPtr->HandlerRef = NULL;
+	JobPtr->Fence = ChanPtr->NextFence;
+
+	ChanPtr->NextFence += XZDMA_ASYNC_FENCE_INC;
+	if (ChanPtr->NextFence == XZDMA_FENCE_NONE) {
+		ChanPtr->NextFence += XZDMA_ASYNC_FENCE_INC;
+	}
+
+	SlotPtr = &ChanPtr->Job[ChanPtr->Tail % XZDMA_ASYNC_QUEUE_DEPTH];
+	*SlotPtr = *JobPtr;
+	ChanPtr->QueuedBytes += JobPtr->Bytes;
+	ChanPtr->Tail++;
+	*FencePtr = JobPtr->Fence;
+
+	XZDma_AsyncKick(ChanPtr);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function programs the channel for a job and starts it.
+*
+* @param	ChanPtr is the channel, idle.
+* @param	JobPtr is the job.
+*
+* @return
+*		- XST_SUCCESS if the job was started.
+*		- XST_FAILURE if the channel mode could not be set.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_AsyncStartJob(XZDma_AsyncChan *ChanPtr,
+			       XZDma_AsyncJob *JobPtr)
+{
+	XZDma *InstancePtr = ChanPtr->InstancePtr;
+	u32 Pattern[4];
+	s32 Status;
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+
+	if (JobPtr->Type == XZDMA_JOB_SG) {
+		Status = XZDma_SetMode(InstancePtr, TRUE, XZDMA_NORMAL_MODE);
+		if (Status == XST_SUCCESS) {
+			Status = XZDma_Start(InstancePtr, JobPtr->List,
+					     JobPtr->Num);
+		}
+	}
+	else if (JobPtr->Type == XZDMA_JOB_FILL) {
+		Status = XZDma_SetMode(InstancePtr, FALSE, XZDMA_WRONLY_MODE);
+		if (Status == XST_SUCCESS) {
+			Pattern[0] = JobPtr->Value;
+			Pattern[1] = JobPtr->Value;
+			Pattern[2] = JobPtr->Value;
+			Pattern[3] = JobPtr->Value;
+			XZDma_WOData(InstancePtr, Pattern);
+			Status = XZDma_Start(InstancePtr, &JobPtr->Xfer, 1U);
+		}
+	}
+	else {
+		Status = XZDma_SetMode(InstancePtr, FALSE, XZDMA_NORMAL_MODE);
+		if (Status == XST_SUCCESS) {
+			Status = XZDma_Start(InstancePtr, &JobPtr->Xfer, 1U);
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function removes the head job of a channel once it is done and
+* invalidates its destination buffers.
+*
+* @param	ChanPtr is the channel.
+* @param	Status is XST_SUCCESS or XST_FAILURE.
+* @param	DonePtr is where the removed job is copied, its callback is
+*		called by the caller.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_AsyncRetire(XZDma_AsyncChan *ChanPtr, s32 Status,
+			      XZDma_AsyncJob *DonePtr)
+{
+	XZDma_AsyncJob *JobPtr;
+	u32 Index;
+
+	JobPtr = &ChanPtr->Job[ChanPtr->Head % XZDMA_ASYNC_QUEUE_DEPTH];
+
+	/* Drop lines the processor may have fetched during the transfer */
+	if ((ChanPtr->IsCoherent == FALSE) && (Status == XST_SUCCESS)) {
+		if (JobPtr->Type == XZDMA_JOB_SG) {
+			for (Index = 0U; Index < JobPtr->Num; Index++) {
+				Xil_DCacheInvalidateRange(
+					JobPtr->List[Index].DstAddr,
+					JobPtr->List[Index].Size);
+			}
+		}
+		else {
+			Xil_DCacheInvalidateRange(JobPtr->Xfer.DstAddr,
+						  JobPtr->Xfer.Size);
+		}
+	}
+
+	*DonePtr = *JobPtr;
+	ChanPtr->InstancePtr->ChannelState = XZDMA_IDLE;
+	ChanPtr->QueuedBytes -= JobPtr->Bytes;
+	ChanPtr->Head++;
+	ChanPtr->Active = FALSE;
+	ChanPtr->JobCnt++;
+	if (Status != XST_SUCCESS) {
+		ChanPtr->ErrFence = JobPtr->Fence;
+		ChanPtr->ErrCnt++;
+	}
+	ChanPtr->DoneFence = JobPtr->Fence;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function starts the head job of an idle channel. Jobs that
+* cannot be started are completed as failed.
+*
+* @param	ChanPtr is the channel.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_AsyncKick(XZDma_AsyncChan *ChanPtr)
+{
+	XZDma_AsyncJob *JobPtr;
+	XZDma_AsyncJob Done;
+
+	while ((ChanPtr->Active == FALSE) && (ChanPtr->Head != ChanPtr->Tail)) {
+		JobPtr = &ChanPtr->Job[ChanPtr->Head % XZDMA_ASYNC_QUEUE_DEPTH];
+		if (XZDma_AsyncStartJob(ChanPtr, JobPtr) == XST_SUCCESS) {
+			ChanPtr->Active = TRUE;
+		}
+		else {
+			XZDma_AsyncRetire(ChanPtr, XST_FAILURE, &Done);
+			if (Done.Handler != NULL) {
+				Done.Handler(Done.HandlerRef, Done.Fence,
+					     XST_FAILURE);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function checks whether the running job of a channel is done.
+* If it is, the job is completed, the next one started and the callback of
+* the completed job called.
+*
+* @param	ChanPtr is the channel.
+*
+* @return	1 if a job was completed, 0 otherwise.
+*
+* @note		The interrupt status is cleared here rather than by
+*		XZDma_IntrHandler(), which clears it after its callbacks and
+*		would drop the done interrupt of a short job started from them.
+*
+******************************************************************************/
+static u32 XZDma_AsyncChanService(XZDma_AsyncChan *ChanPtr)
+{
+	XZDma *InstancePtr = ChanPtr->InstancePtr;
+	XZDma_AsyncJob Done;
+	u32 Pending;
+	s32 Status;
+
+	Pending = XZDma_IntrGetStatus(InstancePtr);
+	if ((ChanPtr->Active == FALSE) ||
+	    ((Pending & XZDMA_ASYNC_INTR_MASK) == 0U)) {
+		XZDma_IntrClear(InstancePtr, Pending);
+		return 0U;
+	}
+	XZDma_IntrClear(InstancePtr, Pending);
+
+	if ((Pending & XZDMA_ASYNC_ERR_MASK) != 0U) {
+		Status = XST_FAILURE;
+		/* Stop the channel if the error did not end the transfer */
+		if ((Pending & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+			XZDma_DisableCh(InstancePtr);
+		}
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+
+	XZDma_AsyncRetire(ChanPtr, Status, &Done);
+	XZDma_AsyncKick(ChanPtr);
+	if (Done.Handler != NULL) {
+		Done.Handler(Done.HandlerRef, Done.Fence, Status);
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function returns the channel of a fence.
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	Fence is the fence.
+*
+* @return	The channel, or NULL if the service did not return Fence.
+*
+* @note		None.
+*
+******************************************************************************/
+static XZDma_AsyncChan *XZDma_AsyncFenceChan(XZDma_Async *AsyncPtr,
+					     XZDma_Fence Fence)
+{
+	XZDma_AsyncChan *ChanPtr = NULL;
+	u32 Index = Fence & XZDMA_ASYNC_CHAN_MASK;
+
+	if ((Fence != XZDMA_FENCE_NONE) && (Index < AsyncPtr->NumChan) &&
+	    ((s32)(Fence - AsyncPtr->Chan[Index].NextFence) < 0)) {
+		ChanPtr = &AsyncPtr->Chan[Index];
+	}
+
+	return ChanPtr;
+}
+/** @} */
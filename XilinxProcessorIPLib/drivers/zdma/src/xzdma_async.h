@@ -0,0 +1,203 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async.h
+* @addtogroup zdma_v1_15
+* @{
+* @details
+*
+* Asynchronous copy and fill service on top of the ZDMA channels.
+*
+* The service takes the channels of one or both ZDMA instances (up to 8) and
+* queues jobs on them. A job is one of:
+*
+* - a copy of a buffer, XZDma_AsyncCopy(),
+* - a fill of a buffer with a 32 bit value, XZDma_AsyncFill(), using the
+*   write only mode of the channel,
+* - a scatter gather list of copies, XZDma_AsyncSg(), running on the linear
+*   descriptors of the channel.
+*
+* Every submit returns a fence. The fence completes when its job is done and
+* can be polled with XZDma_FencePoll(), waited for with XZDma_FenceWait() or
+* given a callback with XZDma_FenceSetCallback(). Jobs run in order on their
+* channel. Jobs on different channels complete in any order.
+*
+* Each job goes to the channel with the least bytes queued, so large and small
+* jobs are spread over all channels. A channel holds up to
+* XZDMA_ASYNC_QUEUE_DEPTH jobs, submit returns XST_DEVICE_BUSY when all the
+* channels are full.
+*
+* When the ZDMA is not cache coherent the service does the data cache
+* maintenance. Source buffers are flushed and destination buffers are
+* flushed at submit and invalidated again at completion. The buffers must
+* not be accessed by the processor between submit and completion. Buffers
+* should be aligned to the cache line, or the processor must not write the
+* rest of their first and last cache line during the transfer.
+*
+* The channels are driven either by XZDma_AsyncIntrHandler(), connected to
+* the interrupt of each channel in place of XZDma_IntrHandler(), or by calls
+* to XZDma_AsyncPoll(). Fence callbacks run from there. The channel data
+* attributes (XZDma_SetChDataConfig()) are left as the application set them.
+*
+* The service is not thread safe. When the interrupt handler is used, the
+* submit functions and XZDma_FenceSetCallback() must be called with the ZDMA
+* interrupts disabled or from a fence callback. XZDma_FencePoll() and
+* XZDma_FenceWait() may be called at any time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.15  kc      10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef XZDMA_ASYNC_H_
+#define XZDMA_ASYNC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XZDMA_ASYNC_MAX_CHANNELS	8U	/**< Channels per service */
+#ifndef XZDMA_ASYNC_QUEUE_DEPTH
+#define XZDMA_ASYNC_QUEUE_DEPTH		16U	/**< Jobs queued per channel */
+#endif
+
+#define XZDMA_FENCE_NONE		0U	/**< Never a valid fence */
+#define XZDMA_ASYNC_WAIT_FOREVER	0xFFFFFFFFU	/**< No timeout for
+							  * XZDma_FenceWait */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Fence of a job. The low 3 bits are the channel index in the service, the
+ * others the sequence number of the job on its channel.
+ */
+typedef u32 XZDma_Fence;
+
+/******************************************************************************/
+/**
+* Callback type for the completion of a fence.
+*
+* @param	CallBackRef is the reference given to XZDma_FenceSetCallback().
+* @param	Fence is the fence that completed.
+* @param	Status is XST_SUCCESS, or XST_FAILURE if the ZDMA reported an
+*		AXI error for the job.
+*
+*******************************************************************************/
+typedef void (*XZDma_FenceHandler) (void *CallBackRef, XZDma_Fence Fence,
+				    s32 Status);
+
+/**
+ * This typedef contains the job types.
+ */
+typedef enum {
+	XZDMA_JOB_COPY,		/**< Buffer copy */
+	XZDMA_JOB_FILL,		/**< Fill with a 32 bit value */
+	XZDMA_JOB_SG,		/**< Scatter gather list of copies */
+} XZDma_JobType;
+
+/**
+ * This typedef contains a queued job.
+ */
+typedef struct {
+	XZDma_Fence Fence;		/**< Fence of the job */
+	XZDma_JobType Type;		/**< Type of the job */
+	XZDma_Transfer Xfer;		/**< Copy or fill transfer */
+	u32 Value;			/**< Fill value */
+	XZDma_Transfer *List;		/**< Scatter gather list */
+	u32 Num;			/**< Entries in List */
+	u32 Bytes;			/**< Bytes moved by the job */
+	XZDma_FenceHandler Handler;	/**< Completion callback */
+	void *HandlerRef;		/**< Reference for Handler */
+} XZDma_AsyncJob;
+
+/**
+ * This typedef contains the state of a channel of the service.
+ */
+typedef struct {
+	XZDma *InstancePtr;		/**< ZDMA channel */
+	u32 IsCoherent;			/**< No cache maintenance needed */
+	XZDma_AsyncJob Job[XZDMA_ASYNC_QUEUE_DEPTH];	/**< Job queue */
+	u32 Head;			/**< Oldest job, running if Active */
+	u32 Tail;			/**< Next free job entry */
+	u32 Active;			/**< Head job runs in hardware */
+	u64 QueuedBytes;		/**< Bytes of the queued jobs */
+	XZDma_Fence NextFence;		/**< Fence of the next job */
+	volatile XZDma_Fence DoneFence;	/**< Fence of the last completed
+					  *  job */
+	XZDma_Fence ErrFence;		/**< Fence of the last failed job */
+	u32 JobCnt;			/**< Jobs completed */
+	u32 ErrCnt;			/**< Jobs failed */
+} XZDma_AsyncChan;
+
+/**
+ * The asynchronous service instance.
+ */
+typedef struct {
+	u32 IsReady;			/**< Service is initialized */
+	u32 UseIntr;			/**< Channels are interrupt driven */
+	u32 NumChan;			/**< Channels added */
+	u32 Next;			/**< First channel of the next pick */
+	XZDma_AsyncChan Chan[XZDMA_ASYNC_MAX_CHANNELS];	/**< Channels */
+} XZDma_Async;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+*
+* This macro returns the channel of the service to connect to the interrupt
+* of its ZDMA channel with XZDma_AsyncIntrHandler().
+*
+* @param	AsyncPtr is a pointer to the XZDma_Async instance.
+* @param	Index is the index of the channel, in the order of
+*		XZDma_AsyncAddChannel() calls.
+*
+* @return	Pointer to the channel.
+*
+* @note		C-style signature:
+*		XZDma_AsyncChan *XZDma_AsyncGetChan(XZDma_Async *AsyncPtr,
+*							u32 Index)
+*
+******************************************************************************/
+#define XZDma_AsyncGetChan(AsyncPtr, Index) \
+	(&(AsyncPtr)->Chan[(Index)])
+
+/************************** Function Prototypes ******************************/
+
+s32 XZDma_AsyncInitialize(XZDma_Async *AsyncPtr, u32 UseIntr);
+s32 XZDma_AsyncAddChannel(XZDma_Async *AsyncPtr, XZDma *InstancePtr,
+			  UINTPTR DscrMemPtr, u32 NoOfBytes);
+s32 XZDma_AsyncCopy(XZDma_Async *AsyncPtr, UINTPTR DstAddr, UINTPTR SrcAddr,
+		    u32 Size, XZDma_Fence *FencePtr);
+s32 XZDma_AsyncFill(XZDma_Async *AsyncPtr, UINTPTR DstAddr, u32 Value,
+		    u32 Size, XZDma_Fence *FencePtr);
+s32 XZDma_AsyncSg(XZDma_Async *AsyncPtr, XZDma_Transfer *List, u32 Num,
+		  XZDma_Fence *FencePtr);
+s32 XZDma_FencePoll(XZDma_Async *AsyncPtr, XZDma_Fence Fence);
+s32 XZDma_FenceWait(XZDma_Async *AsyncPtr, XZDma_Fence Fence, u32 TimeoutUs);
+s32 XZDma_FenceSetCallback(XZDma_Async *AsyncPtr, XZDma_Fence Fence,
+			   XZDma_FenceHandler Handler, void *CallBackRef);
+u32 XZDma_AsyncPoll(XZDma_Async *AsyncPtr);
+void XZDma_AsyncIntrHandler(void *Instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XZDMA_ASYNC_H_ */
+/** @} */
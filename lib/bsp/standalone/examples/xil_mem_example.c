@@ -0,0 +1,214 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/**
+*
+* @file xil_mem_example.c
+*
+* Implements example that checks Xil_MemCpy, Xil_MemSet and Xil_MemCmpFast
+* against byte by byte reference loops for all source/destination alignment
+* combinations up to 16 bytes and for sizes around every block boundary. On
+* ARM based platforms the copy and set throughput is measured afterwards for
+* aligned and misaligned buffers, together with memcpy/memset for reference.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 8.0   kc   10/18/26 First release
+* </pre>
+******************************************************************************/
+#include <string.h>
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xil_mem.h"
+#include "xstatus.h"
+#if !defined (__MICROBLAZE__)
+#include "xtime_l.h"
+#endif
+
+/* Alignment offsets checked for source and destination */
+#define MEM_TEST_MAX_OFFSET	16U
+/* Sizes 0 to MEM_TEST_MAX_SMALL are all checked */
+#define MEM_TEST_MAX_SMALL	200U
+/* Guard bytes around the destination to catch overruns */
+#define MEM_TEST_GUARD		32U
+#define MEM_TEST_GUARD_VAL	0xA5U
+#define MEM_TEST_BUF_SIZE	(4096U + (2U * MEM_TEST_GUARD) + MEM_TEST_MAX_OFFSET)
+
+/* Throughput test */
+#define MEM_PERF_SIZE		(64U * 1024U)
+#define MEM_PERF_ITER		64U
+
+static u8 SrcBuf[MEM_TEST_BUF_SIZE] __attribute__ ((aligned(64)));
+static u8 DstBuf[MEM_TEST_BUF_SIZE] __attribute__ ((aligned(64)));
+static u8 RefBuf[MEM_TEST_BUF_SIZE] __attribute__ ((aligned(64)));
+
+#if !defined (__MICROBLAZE__)
+static u8 PerfSrc[MEM_PERF_SIZE + 64U] __attribute__ ((aligned(64)));
+static u8 PerfDst[MEM_PERF_SIZE + 64U] __attribute__ ((aligned(64)));
+#endif
+
+/* Larger sizes checked for every alignment combination */
+static const u32 LargeSizes[] = {255U, 256U, 257U, 511U, 1000U, 1023U, 1024U,
+	1025U, 4095U, 4096U};
+
+static int MemCheckOne(u32 SrcOff, u32 DstOff, u32 Len)
+{
+	u8 *Dst = &DstBuf[MEM_TEST_GUARD + DstOff];
+	const u8 *Src = &SrcBuf[SrcOff];
+	u8 Val = (u8)(Len + SrcOff);
+	s32 Ret;
+	u32 Idx;
+
+	/* Copy */
+	(void)memset(DstBuf, MEM_TEST_GUARD_VAL, sizeof(DstBuf));
+	(void)memset(RefBuf, MEM_TEST_GUARD_VAL, sizeof(RefBuf));
+	for (Idx = 0U; Idx < Len; Idx++) {
+		RefBuf[MEM_TEST_GUARD + DstOff + Idx] = Src[Idx];
+	}
+	Xil_MemCpy(Dst, Src, Len);
+	if (memcmp(DstBuf, RefBuf, sizeof(DstBuf)) != 0) {
+		xil_printf("Xil_MemCpy failed src %d dst %d len %d\r\n",
+			SrcOff, DstOff, Len);
+		return XST_FAILURE;
+	}
+
+	/* Set */
+	for (Idx = 0U; Idx < Len; Idx++) {
+		RefBuf[MEM_TEST_GUARD + DstOff + Idx] = Val;
+	}
+	Xil_MemSet(Dst, Val, Len);
+	if (memcmp(DstBuf, RefBuf, sizeof(DstBuf)) != 0) {
+		xil_printf("Xil_MemSet failed dst %d len %d\r\n", DstOff, Len);
+		return XST_FAILURE;
+	}
+
+	/* Compare, equal and with the last byte differing */
+	Xil_MemCpy(Dst, Src, Len);
+	if (Xil_MemCmpFast(Dst, Src, Len) != 0) {
+		xil_printf("Xil_MemCmpFast failed src %d dst %d len %d\r\n",
+			SrcOff, DstOff, Len);
+		return XST_FAILURE;
+	}
+	if (Len > 0U) {
+		Dst[Len - 1U] = (u8)(Src[Len - 1U] + 1U);
+		Ret = Xil_MemCmpFast(Dst, Src, Len);
+		if ((Ret <= 0) != (Dst[Len - 1U] < Src[Len - 1U])) {
+			xil_printf("Xil_MemCmpFast sign failed src %d dst %d "
+				"len %d\r\n", SrcOff, DstOff, Len);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+static int MemCheck(void)
+{
+	u32 SrcOff;
+	u32 DstOff;
+	u32 Len;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < sizeof(SrcBuf); Idx++) {
+		SrcBuf[Idx] = (u8)((Idx * 7U) + (Idx >> 8U));
+	}
+
+	for (SrcOff = 0U; SrcOff < MEM_TEST_MAX_OFFSET; SrcOff++) {
+		for (DstOff = 0U; DstOff < MEM_TEST_MAX_OFFSET; DstOff++) {
+			for (Len = 0U; Len <= MEM_TEST_MAX_SMALL; Len++) {
+				if (MemCheckOne(SrcOff, DstOff, Len) !=
+					XST_SUCCESS) {
+					return XST_FAILURE;
+				}
+			}
+			for (Idx = 0U; Idx < (sizeof(LargeSizes) /
+				sizeof(LargeSizes[0U])); Idx++) {
+				if (MemCheckOne(SrcOff, DstOff, LargeSizes[Idx]) !=
+					XST_SUCCESS) {
+					return XST_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+#if !defined (__MICROBLAZE__)
+static void MemPerfPrint(const char *Name, u32 Off, XTime Start, XTime End)
+{
+	u64 Us = ((u64)(End - Start) * 1000000U) / COUNTS_PER_SECOND;
+	u64 Bytes = (u64)MEM_PERF_SIZE * MEM_PERF_ITER;
+
+	if (Us == 0U) {
+		Us = 1U;
+	}
+	xil_printf("%s offset %d: %d MB/s\r\n", Name, Off,
+		(u32)(Bytes / Us));
+}
+
+static void MemPerf(void)
+{
+	static const u32 Offsets[] = {0U, 1U, 4U, 8U};
+	XTime Start;
+	XTime End;
+	u32 Iter;
+	u32 Idx;
+	u32 Off;
+
+	for (Idx = 0U; Idx < (sizeof(Offsets) / sizeof(Offsets[0U])); Idx++) {
+		Off = Offsets[Idx];
+
+		XTime_GetTime(&Start);
+		for (Iter = 0U; Iter < MEM_PERF_ITER; Iter++) {
+			Xil_MemCpy(&PerfDst[Off], PerfSrc, MEM_PERF_SIZE);
+		}
+		XTime_GetTime(&End);
+		MemPerfPrint("Xil_MemCpy", Off, Start, End);
+
+		XTime_GetTime(&Start);
+		for (Iter = 0U; Iter < MEM_PERF_ITER; Iter++) {
+			(void)memcpy(&PerfDst[Off], PerfSrc, MEM_PERF_SIZE);
+		}
+		XTime_GetTime(&End);
+		MemPerfPrint("memcpy    ", Off, Start, End);
+
+		XTime_GetTime(&Start);
+		for (Iter = 0U; Iter < MEM_PERF_ITER; Iter++) {
+			Xil_MemSet(&PerfDst[Off], (u8)Iter, MEM_PERF_SIZE);
+		}
+		XTime_GetTime(&End);
+		MemPerfPrint("Xil_MemSet", Off, Start, End);
+
+		XTime_GetTime(&Start);
+		for (Iter = 0U; Iter < MEM_PERF_ITER; Iter++) {
+			(void)memset(&PerfDst[Off], (s32)Iter, MEM_PERF_SIZE);
+		}
+		XTime_GetTime(&End);
+		MemPerfPrint("memset    ", Off, Start, End);
+	}
+}
+#endif
+
+int main()
+{
+	xil_printf("Start of Xil_Mem Example\n\r");
+
+	if (MemCheck() != XST_SUCCESS) {
+		xil_printf("Xil_Mem example has FAILED\r\n");
+		return XST_FAILURE;
+	}
+
+#if !defined (__MICROBLAZE__)
+	MemPerf();
+#endif
+
+	xil_printf("Xil_Mem example has PASSED\r\n");
+
+	return XST_SUCCESS;
+}
@@ -0,0 +1,290 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_mem_bench.c
+*
+* Host benchmark for the Xil_MemCpy, Xil_MemSet and Xil_MemCmpFast kernels of
+* xil_mem.c, which is compiled into this tool. The kernel of the host
+* architecture is used, so build it natively or with a cross compiler to
+* check the AArch64 or ARM kernel, for example under qemu-user.
+*
+* The functions are first checked against byte by byte reference loops for
+* all source/destination alignment combinations up to 16 bytes, every size up
+* to 200 bytes and sizes around the block boundaries up to 4 KiB, with guard
+* bytes around the destination. The throughput of the functions is then
+* measured for aligned and misaligned buffers, together with the word loop
+* Xil_MemCpy used before the block kernels and with memcpy/memset.
+*
+* Usage: xil_mem_bench [-s <size>] [-i <iterations>] [-c]
+*	-s	Buffer size of the throughput test, 64 KiB by default
+*	-i	Iterations of the throughput test, 4096 by default
+*	-c	Only run the checks
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xil_mem.h"
+
+/* Alignment offsets checked for source and destination */
+#define MEM_TEST_MAX_OFFSET	16U
+/* Sizes 0 to MEM_TEST_MAX_SMALL are all checked */
+#define MEM_TEST_MAX_SMALL	200U
+/* Guard bytes around the destination to catch overruns */
+#define MEM_TEST_GUARD		32U
+#define MEM_TEST_GUARD_VAL	0xA5U
+#define MEM_TEST_BUF_SIZE	(4096U + (2U * MEM_TEST_GUARD) + MEM_TEST_MAX_OFFSET)
+
+static u8 SrcBuf[MEM_TEST_BUF_SIZE] __attribute__ ((aligned(64)));
+static u8 DstBuf[MEM_TEST_BUF_SIZE] __attribute__ ((aligned(64)));
+static u8 RefBuf[MEM_TEST_BUF_SIZE] __attribute__ ((aligned(64)));
+
+/* Larger sizes checked for every alignment combination */
+static const u32 LargeSizes[] = {255U, 256U, 257U, 511U, 1000U, 1023U, 1024U,
+	1025U, 4095U, 4096U};
+
+/* Xil_MemCpy before the block kernels, for reference */
+static void WordMemCpy(void *dst, const void *src, u32 cnt)
+{
+	char *d = (char *)dst;
+	const char *s = (const char *)src;
+
+	while (cnt >= sizeof(u32)) {
+		*(u32 *)(void *)d = *(const u32 *)(const void *)s;
+		d += sizeof(u32);
+		s += sizeof(u32);
+		cnt -= sizeof(u32);
+	}
+	while (cnt > 0U) {
+		*d = *s;
+		d += 1U;
+		s += 1U;
+		cnt -= 1U;
+	}
+}
+
+static int MemCheckOne(u32 SrcOff, u32 DstOff, u32 Len)
+{
+	u8 *Dst = &DstBuf[MEM_TEST_GUARD + DstOff];
+	const u8 *Src = &SrcBuf[SrcOff];
+	u8 Val = (u8)(Len + SrcOff);
+	s32 Ret;
+	u32 Idx;
+
+	/* Copy */
+	memset(DstBuf, MEM_TEST_GUARD_VAL, sizeof(DstBuf));
+	memset(RefBuf, MEM_TEST_GUARD_VAL, sizeof(RefBuf));
+	for (Idx = 0U; Idx < Len; Idx++) {
+		RefBuf[MEM_TEST_GUARD + DstOff + Idx] = Src[Idx];
+	}
+	Xil_MemCpy(Dst, Src, Len);
+	if (memcmp(DstBuf, RefBuf, sizeof(DstBuf)) != 0) {
+		printf("Xil_MemCpy failed src %u dst %u len %u\n",
+			SrcOff, DstOff, Len);
+		return -1;
+	}
+
+	/* Set */
+	for (Idx = 0U; Idx < Len; Idx++) {
+		RefBuf[MEM_TEST_GUARD + DstOff + Idx] = Val;
+	}
+	Xil_MemSet(Dst, Val, Len);
+	if (memcmp(DstBuf, RefBuf, sizeof(DstBuf)) != 0) {
+		printf("Xil_MemSet failed dst %u len %u\n", DstOff, Len);
+		return -1;
+	}
+
+	/* Compare, equal and with the last byte differing */
+	Xil_MemCpy(Dst, Src, Len);
+	if (Xil_MemCmpFast(Dst, Src, Len) != 0) {
+		printf("Xil_MemCmpFast failed src %u dst %u len %u\n",
+			SrcOff, DstOff, Len);
+		return -1;
+	}
+	if (Len > 0U) {
+		Dst[Len - 1U] = (u8)(Src[Len - 1U] + 1U);
+		Ret = Xil_MemCmpFast(Dst, Src, Len);
+		if ((Ret <= 0) != (Dst[Len - 1U] < Src[Len - 1U])) {
+			printf("Xil_MemCmpFast sign failed src %u dst %u "
+				"len %u\n", SrcOff, DstOff, Len);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int MemCheck(void)
+{
+	u32 SrcOff;
+	u32 DstOff;
+	u32 Len;
+	u32 Idx;
+	u32 Num = 0U;
+
+	for (Idx = 0U; Idx < sizeof(SrcBuf); Idx++) {
+		SrcBuf[Idx] = (u8)((Idx * 7U) + (Idx >> 8U));
+	}
+
+	for (SrcOff = 0U; SrcOff < MEM_TEST_MAX_OFFSET; SrcOff++) {
+		for (DstOff = 0U; DstOff < MEM_TEST_MAX_OFFSET; DstOff++) {
+			for (Len = 0U; Len <= MEM_TEST_MAX_SMALL; Len++) {
+				if (MemCheckOne(SrcOff, DstOff, Len) != 0) {
+					return -1;
+				}
+				Num++;
+			}
+			for (Idx = 0U; Idx < (sizeof(LargeSizes) /
+				sizeof(LargeSizes[0U])); Idx++) {
+				if (MemCheckOne(SrcOff, DstOff,
+					LargeSizes[Idx]) != 0) {
+					return -1;
+				}
+				Num++;
+			}
+		}
+	}
+	printf("%u cases checked\n", Num);
+
+	return 0;
+}
+
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((double)Ts.tv_sec * 1e6) + ((double)Ts.tv_nsec / 1e3);
+}
+
+static void MemPerfPrint(const char *Name, u32 Off, double Us, u32 Size,
+		u32 Iter)
+{
+	printf("%-14s offset %u: %8.0f MB/s\n", Name, Off,
+		((double)Size * Iter) / Us);
+}
+
+static void MemPerf(u8 *Src, u8 *Dst, u32 Size, u32 Iter)
+{
+	static const u32 Offsets[] = {0U, 1U, 4U, 8U};
+	double Start;
+	u32 Idx;
+	u32 Cnt;
+	u32 Off;
+
+	memset(Src, 0x5A, Size + 64U);
+	for (Idx = 0U; Idx < (sizeof(Offsets) / sizeof(Offsets[0U])); Idx++) {
+		Off = Offsets[Idx];
+
+		Start = NowUs();
+		for (Cnt = 0U; Cnt < Iter; Cnt++) {
+			Xil_MemCpy(&Dst[Off], Src, Size);
+		}
+		MemPerfPrint("Xil_MemCpy", Off, NowUs() - Start, Size, Iter);
+
+		Start = NowUs();
+		for (Cnt = 0U; Cnt < Iter; Cnt++) {
+			WordMemCpy(&Dst[Off], Src, Size);
+		}
+		MemPerfPrint("word loop", Off, NowUs() - Start, Size, Iter);
+
+		Start = NowUs();
+		for (Cnt = 0U; Cnt < Iter; Cnt++) {
+			memcpy(&Dst[Off], Src, Size);
+			__asm__ __volatile__("" : : "r" (Dst) : "memory");
+		}
+		MemPerfPrint("memcpy", Off, NowUs() - Start, Size, Iter);
+
+		Start = NowUs();
+		for (Cnt = 0U; Cnt < Iter; Cnt++) {
+			Xil_MemSet(&Dst[Off], (u8)Cnt, Size);
+		}
+		MemPerfPrint("Xil_MemSet", Off, NowUs() - Start, Size, Iter);
+
+		Start = NowUs();
+		for (Cnt = 0U; Cnt < Iter; Cnt++) {
+			memset(&Dst[Off], (int)Cnt, Size);
+			__asm__ __volatile__("" : : "r" (Dst) : "memory");
+		}
+		MemPerfPrint("memset", Off, NowUs() - Start, Size, Iter);
+
+		Start = NowUs();
+		for (Cnt = 0U; Cnt < Iter; Cnt++) {
+			Xil_MemCpy(&Dst[Off], &Src[Off], Size);
+			if (Xil_MemCmpFast(&Dst[Off], &Src[Off], Size) != 0) {
+				printf("Xil_MemCmpFast mismatch\n");
+				return;
+			}
+		}
+		MemPerfPrint("Cpy+CmpFast", Off, NowUs() - Start, Size, Iter);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	u32 Size = 64U * 1024U;
+	u32 Iter = 4096U;
+	int CheckOnly = 0;
+	u8 *Src;
+	u8 *Dst;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "s:i:c")) != -1) {
+		switch (Opt) {
+		case 's':
+			Size = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			Iter = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			CheckOnly = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-s <size>] [-i <iterations>]"
+				" [-c]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if (MemCheck() != 0) {
+		printf("FAILED\n");
+		return 1;
+	}
+	if (CheckOnly != 0) {
+		printf("PASSED\n");
+		return 0;
+	}
+
+	/* Room for the offsets, rounded up to the alignment */
+	Src = aligned_alloc(64U, (Size + 127U) & ~63U);
+	Dst = aligned_alloc(64U, (Size + 127U) & ~63U);
+	if ((Src == NULL) || (Dst == NULL)) {
+		printf("Out of memory\n");
+		return 1;
+	}
+	MemPerf(Src, Dst, Size, Iter);
+	free(Src);
+	free(Dst);
+	printf("PASSED\n");
+
+	return 0;
+}
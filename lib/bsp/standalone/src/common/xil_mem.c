@@ -8,8 +8,17 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy, set and compare functions. Buffers which
+* are mutually aligned are processed in blocks by a kernel selected at build
+* time for the target architecture:
+*	- AArch64: 64 byte blocks with LDP/STP of X registers
+*	- Cortex-R5/A9: 32 byte blocks of eight words, LDM/STM friendly
+*	- MicroBlaze: 16 byte word bursts
+* The kernels only use general purpose registers, as the FP/SIMD registers
+* are not saved by FreeRTOS tasks or nested interrupt handlers which may call
+* them. Head and tail bytes use the word/byte loops. Buffers which cannot be
+* aligned with each other are copied byte by byte, except on AArch64 which
+* supports unaligned accesses.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +31,10 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 8.0   kc       10/18/26 Alignment aware Xil_MemCpy with per architecture
+*                         block kernels, added Xil_MemSet and Xil_MemCmpFast
+*       kc       10/18/26 Use LDP/STP of X registers instead of NEON on
+*                         AArch64, byte copy for misaligned buffers on ARM
 *
 * </pre>
 *
@@ -32,10 +45,185 @@
 #include "xil_types.h"
 #include "xil_mem.h"
 
+/************************** Constant Definitions ****************************/
+
+#if defined (__aarch64__)
+#define XIL_MEM_BLOCK_SIZE	64U
+#define XIL_MEM_ALIGN		8U
+#elif defined (__arm__)
+#define XIL_MEM_BLOCK_SIZE	32U
+#define XIL_MEM_ALIGN		4U
+#else
+#define XIL_MEM_BLOCK_SIZE	16U
+#define XIL_MEM_ALIGN		4U
+#endif
+
+#define XIL_MEM_ALIGN_MASK	(XIL_MEM_ALIGN - 1U)
+
+/**************************** Type Definitions *******************************/
+
+/* Word used by the compare loop, XIL_MEM_ALIGN bytes wide */
+#if defined (__aarch64__)
+typedef u64 XilMemWord;
+#else
+typedef u32 XilMemWord;
+#endif
+
 /***************** Inline Functions Definitions ********************/
+/*****************************************************************************/
+/**
+* @brief       This function copies Blocks blocks of XIL_MEM_BLOCK_SIZE bytes.
+*              Both pointers must be XIL_MEM_ALIGN aligned.
+*
+* @param       d: pointer pointing to destination memory
+*
+* @param       s: pointer pointing to source memory
+*
+* @param       Blocks: number of blocks to be copied
+*
+*****************************************************************************/
+static inline void Xil_MemCpyBlocks(u8 *d, const u8 *s, u32 Blocks)
+{
+	u32 Cnt = Blocks;
+
+#if defined (__aarch64__)
+	u64 W0, W1, W2, W3;
+
+	while (Cnt > 0U) {
+		__asm__ __volatile__(
+			"ldp	%0, %1, [%5]\n\t"
+			"ldp	%2, %3, [%5, #16]\n\t"
+			"stp	%0, %1, [%4]\n\t"
+			"stp	%2, %3, [%4, #16]\n\t"
+			"ldp	%0, %1, [%5, #32]\n\t"
+			"ldp	%2, %3, [%5, #48]\n\t"
+			"stp	%0, %1, [%4, #32]\n\t"
+			"stp	%2, %3, [%4, #48]\n\t"
+			: "=&r" (W0), "=&r" (W1), "=&r" (W2), "=&r" (W3)
+			: "r" (d), "r" (s)
+			: "memory");
+		d += XIL_MEM_BLOCK_SIZE;
+		s += XIL_MEM_BLOCK_SIZE;
+		Cnt--;
+	}
+#elif defined (__arm__)
+	u32 *d32 = (u32 *)(void *)d;
+	const u32 *s32 = (const u32 *)(const void *)s;
+	u32 W0, W1, W2, W3, W4, W5, W6, W7;
+
+	while (Cnt > 0U) {
+		W0 = s32[0U];
+		W1 = s32[1U];
+		W2 = s32[2U];
+		W3 = s32[3U];
+		W4 = s32[4U];
+		W5 = s32[5U];
+		W6 = s32[6U];
+		W7 = s32[7U];
+		d32[0U] = W0;
+		d32[1U] = W1;
+		d32[2U] = W2;
+		d32[3U] = W3;
+		d32[4U] = W4;
+		d32[5U] = W5;
+		d32[6U] = W6;
+		d32[7U] = W7;
+		d32 += 8U;
+		s32 += 8U;
+		Cnt--;
+	}
+#else
+	u32 *d32 = (u32 *)(void *)d;
+	const u32 *s32 = (const u32 *)(const void *)s;
+	u32 W0, W1, W2, W3;
+
+	while (Cnt > 0U) {
+		W0 = s32[0U];
+		W1 = s32[1U];
+		W2 = s32[2U];
+		W3 = s32[3U];
+		d32[0U] = W0;
+		d32[1U] = W1;
+		d32[2U] = W2;
+		d32[3U] = W3;
+		d32 += 4U;
+		s32 += 4U;
+		Cnt--;
+	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills Blocks blocks of XIL_MEM_BLOCK_SIZE bytes.
+*              The pointer must be XIL_MEM_ALIGN aligned.
+*
+* @param       d: pointer pointing to destination memory
+*
+* @param       Val: byte value to be written
+*
+* @param       Blocks: number of blocks to be written
+*
+*****************************************************************************/
+static inline void Xil_MemSetBlocks(u8 *d, u8 Val, u32 Blocks)
+{
+	u32 Cnt = Blocks;
+
+#if defined (__aarch64__)
+	const u64 W = (u64)Val * 0x0101010101010101U;
+
+	while (Cnt > 0U) {
+		__asm__ __volatile__(
+			"stp	%1, %1, [%0]\n\t"
+			"stp	%1, %1, [%0, #16]\n\t"
+			"stp	%1, %1, [%0, #32]\n\t"
+			"stp	%1, %1, [%0, #48]\n\t"
+			:
+			: "r" (d), "r" (W)
+			: "memory");
+		d += XIL_MEM_BLOCK_SIZE;
+		Cnt--;
+	}
+#else
+	u32 *d32 = (u32 *)(void *)d;
+	const u32 W = (u32)Val * 0x01010101U;
+	u32 Idx;
+
+	while (Cnt > 0U) {
+		for (Idx = 0U; Idx < (XIL_MEM_BLOCK_SIZE / sizeof(u32)); Idx++) {
+			d32[Idx] = W;
+		}
+		d32 += XIL_MEM_BLOCK_SIZE / sizeof(u32);
+		Cnt--;
+	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the number of leading bytes to be
+*              processed one by one so that Ptr becomes XIL_MEM_ALIGN aligned.
+*
+* @param       Ptr: pointer to be aligned
+*
+* @param       cnt: number of bytes available
+*
+* @return      Number of head bytes
+*
+*****************************************************************************/
+static inline u32 Xil_MemHeadLen(const void *Ptr, u32 cnt)
+{
+	u32 Head = (u32)((XIL_MEM_ALIGN - ((UINTPTR)Ptr & XIL_MEM_ALIGN_MASK)) &
+			XIL_MEM_ALIGN_MASK);
+
+	return (Head < cnt) ? Head : cnt;
+}
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
+*              When the source and destination can be aligned with each other
+*              the bulk of the data is copied in blocks.
 *
 * @param       dst: pointer pointing to destination memory
 *
@@ -48,6 +236,33 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
 	char *d = (char*)(void *)dst;
 	const char *s = src;
+	u32 Head;
+
+	if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_ALIGN_MASK) == 0U) {
+		Head = Xil_MemHeadLen(d, cnt);
+		cnt -= Head;
+		while (Head > 0U) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			Head -= 1U;
+		}
+		Xil_MemCpyBlocks((u8 *)d, (const u8 *)s, cnt / XIL_MEM_BLOCK_SIZE);
+		d += cnt & ~(XIL_MEM_BLOCK_SIZE - 1U);
+		s += cnt & ~(XIL_MEM_BLOCK_SIZE - 1U);
+		cnt &= (XIL_MEM_BLOCK_SIZE - 1U);
+	}
+#if !defined (__aarch64__)
+	else {
+		/* No unaligned word accesses, copy byte by byte */
+		while (cnt > 0U) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			cnt -= 1U;
+		}
+	}
+#endif
 
 	while (cnt >= sizeof (s32)) {
 		*(s32*)d = *(s32*)s;
@@ -68,3 +283,89 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a byte value.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value to be written
+*
+* @param       cnt: 32 bit length of bytes to be written
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, u8 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	u32 Head = Xil_MemHeadLen(d, cnt);
+
+	cnt -= Head;
+	while (Head > 0U) {
+		*d = val;
+		d += 1U;
+		Head -= 1U;
+	}
+
+	Xil_MemSetBlocks(d, val, cnt / XIL_MEM_BLOCK_SIZE);
+	d += cnt & ~(XIL_MEM_BLOCK_SIZE - 1U);
+	cnt &= (XIL_MEM_BLOCK_SIZE - 1U);
+
+	while (cnt > 0U) {
+		*d = val;
+		d += 1U;
+		cnt -= 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function compares two memory regions. Mutually aligned
+*              regions are compared a word at a time until a difference is
+*              found. The result is not constant time, use Xil_SMemCmp_CT
+*              for secure data.
+*
+* @param       src1: pointer pointing to first memory region
+*
+* @param       src2: pointer pointing to second memory region
+*
+* @param       cnt: 32 bit length of bytes to be compared
+*
+* @return      0 if both regions match, a negative value if the first
+*              mismatching byte is lower in src1, a positive value otherwise
+*
+*****************************************************************************/
+s32 Xil_MemCmpFast(const void* src1, const void* src2, u32 cnt)
+{
+	const u8 *s1 = (const u8 *)src1;
+	const u8 *s2 = (const u8 *)src2;
+	u32 Head;
+
+	if ((((UINTPTR)s1 ^ (UINTPTR)s2) & XIL_MEM_ALIGN_MASK) == 0U) {
+		Head = Xil_MemHeadLen(s1, cnt);
+		while ((Head > 0U) && (*s1 == *s2)) {
+			s1 += 1U;
+			s2 += 1U;
+			Head -= 1U;
+			cnt -= 1U;
+		}
+		if (Head == 0U) {
+			while ((cnt >= sizeof(XilMemWord)) &&
+				(*(const XilMemWord *)(const void *)s1 ==
+				 *(const XilMemWord *)(const void *)s2)) {
+				s1 += sizeof(XilMemWord);
+				s2 += sizeof(XilMemWord);
+				cnt -= sizeof(XilMemWord);
+			}
+		}
+	}
+
+	/* Locate the first mismatching byte, if any */
+	while ((cnt > 0U) && (*s1 == *s2)) {
+		s1 += 1U;
+		s2 += 1U;
+		cnt -= 1U;
+	}
+
+	return (cnt == 0U) ? 0 : ((s32)*s1 - (s32)*s2);
+}
@@ -22,6 +22,7 @@
 * ----- -------- -------- -----------------------------------------------
 * 6.1   nsk      11/07/16 First release.
 * 7.0   mus      01/07/19 Add cpp extern macro
+* 8.0   kc       10/18/26 Added Xil_MemSet and Xil_MemCmpFast
 *
 * </pre>
 *
@@ -36,6 +37,8 @@ extern "C" {
 /************************** Function Prototypes *****************************/
 
 void Xil_MemCpy(void* dst, const void* src, u32 cnt);
+void Xil_MemSet(void* dst, u8 val, u32 cnt);
+s32 Xil_MemCmpFast(const void* src1, const void* src2, u32 cnt);
 
 #ifdef __cplusplus
 }
@@ -79,6 +79,8 @@
 *       adk	 07/15/22 Updated the Xil_WaitForEventSet() API to
 *			  support variable number of events.
 *	ssc	 08/25/22 Added Xil_SecureRMW32 API
+* 8.0   kc       10/18/26 Xil_SMemCpy, Xil_SMemSet and Xil_SMemCmp use the
+*                         block kernels of xil_mem.c
 *
 * </pre>
 *
@@ -86,6 +88,7 @@
 
 /****************************** Include Files *********************************/
 #include "xil_util.h"
+#include "xil_mem.h"
 #include "sleep.h"
 
 /************************** Constant Definitions ****************************/
@@ -865,7 +868,7 @@ int Xil_SMemCmp(const void *Src1, const u32 Src1Size,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		Status = memcmp (Src1, Src2, CmpLen);
+		Status = Xil_MemCmpFast(Src1, Src2, CmpLen);
 		if (Status != 0) {
 			Status = XST_FAILURE;
 		}
@@ -941,7 +944,7 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 
 /*****************************************************************************/
 /**
- * @brief	This is wrapper function to memcpy function. This function
+ * @brief	This is wrapper function to Xil_MemCpy function. This function
  *		takes size of two memory regions to make sure not read from
  *		or write to out of bound memory region.
  *
@@ -979,7 +982,7 @@ int Xil_SMemCpy(void *Dest, const u32 DestSize,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		(void)memcpy(DestTemp, SrcTemp, CopyLen);
+		Xil_MemCpy(DestTemp, SrcTemp, CopyLen);
 		Status = XST_SUCCESS;
 	}
 
@@ -988,7 +991,7 @@ int Xil_SMemCpy(void *Dest, const u32 DestSize,
 
 /*****************************************************************************/
 /**
- * @brief	This is wrapper function to memset function. This function
+ * @brief	This is wrapper function to Xil_MemSet function. This function
  *		writes specified byte to destination specified number of times.
  *		This function also takes maximum string size that destination
  *		holds to make sure not to write out of bound area.
@@ -1012,7 +1015,7 @@ int Xil_SMemSet(void *Dest, const u32 DestSize,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		(void)memset(Dest, (s32)Data, Len);
+		Xil_MemSet(Dest, Data, Len);
 		Status = XST_SUCCESS;
 	}
 
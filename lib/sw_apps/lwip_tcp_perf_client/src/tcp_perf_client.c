@@ -162,10 +162,23 @@ static void tcp_client_err(void *arg, err_t err)
 	xil_printf("TCP connection aborted\n\r");
 }
 
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+/* The tx batch calls of xemacpsif only apply to a GEM netif */
+static int netif_is_gem(struct netif *netif)
+{
+	return (netif != NULL) && (netif->state != NULL) &&
+		(((struct xemac_s *)netif->state)->type == xemac_type_emacps);
+}
+#endif
+
 static err_t tcp_send_perf_traffic(void)
 {
-	err_t err;
+	err_t err = ERR_OK;
 	u8_t apiflags = TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE;
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+	struct netif *batch_netif = netif_is_gem(netif_default) ?
+			netif_default : NULL;
+#endif
 
 	if (c_pcb == NULL) {
 		return ERR_CONN;
@@ -178,23 +191,37 @@ static err_t tcp_send_perf_traffic(void)
 	apiflags = 0;
 #endif
 
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+	/* Start the transmitter once for all the segments queued below */
+	if (batch_netif != NULL) {
+		xemacpsif_tx_batch_begin(batch_netif);
+	}
+#endif
 	while (tcp_sndbuf(c_pcb) > TCP_SEND_BUFSIZE) {
 		err = tcp_write(c_pcb, send_buf, TCP_SEND_BUFSIZE, apiflags);
 		if (err != ERR_OK) {
 			xil_printf("TCP client: Error on tcp_write: %d\r\n",
 					err);
-			return err;
+			break;
 		}
 
 		err = tcp_output(c_pcb);
 		if (err != ERR_OK) {
 			xil_printf("TCP client: Error on tcp_output: %d\r\n",
 					err);
-			return err;
+			break;
 		}
 		client.total_bytes += TCP_SEND_BUFSIZE;
 		client.i_report.total_bytes += TCP_SEND_BUFSIZE;
 	}
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+	if (batch_netif != NULL) {
+		xemacpsif_tx_batch_end(batch_netif);
+	}
+#endif
+	if (err != ERR_OK) {
+		return err;
+	}
 
 	if (client.end_time || client.i_report.report_interval_time) {
 		u64_t now = get_time_ms();
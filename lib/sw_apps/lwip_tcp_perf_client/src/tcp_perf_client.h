@@ -30,10 +30,12 @@
 #define __TCP_PERF_CLIENT_H_
 
 #include "lwipopts.h"
+#include "xlwipconfig.h"
 #include "lwip/ip_addr.h"
 #include "lwip/err.h"
 #include "lwip/tcp.h"
 #include "lwip/inet.h"
+#include "netif/xadapter.h"
 #include "xil_printf.h"
 #include "platform.h"
 
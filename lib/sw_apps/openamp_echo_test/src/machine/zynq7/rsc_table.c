@@ -18,7 +18,12 @@
 #define __section_t(S)          __attribute__((__section__(#S)))
 #define __resource              __section_t(.resource_table)
 
+#ifdef ECHO_THROUGHPUT
+/* Name Service and notification suppression with event indexes */
+#define RPMSG_IPU_C0_FEATURES        (1 | VIRTIO_RING_F_EVENT_IDX)
+#else
 #define RPMSG_IPU_C0_FEATURES        1
+#endif /* ECHO_THROUGHPUT */
 
 /* VirtIO rpmsg device id */
 #define VIRTIO_ID_RPMSG_             7
@@ -36,6 +36,16 @@ The 2 channel names are:
 
 Note that in the case of multiple endpoints, the 0th endpoint has the
 original name of "rpmsg-openamp-demo-channel".
+
+Throughput variant:
+If the macro ECHO_THROUGHPUT is defined (-DECHO_THROUGHPUT in the
+application compiler flags), replies are written straight into TX payload
+buffers and sent back as chains of up to ECHO_TX_CHAIN buffers with a single
+notification once the receive virtqueue has been drained. The resource table
+then also advertises VIRTIO_RING_F_EVENT_IDX so that both sides suppress
+notifications. Every ECHO_REPORT_MSGS echoed messages the message count, byte
+count and elapsed time are printed, which gives the echo throughput when the
+host streams messages with echo_test.
 */
 
 #include "xil_printf.h"
@@ -46,6 +56,10 @@ original name of "rpmsg-openamp-demo-channel".
 #include "platform_info.h"
 #include "rpmsg-echo.h"
 #include <stdio.h>
+#ifdef ECHO_THROUGHPUT
+#include <string.h>
+#include "xtime_l.h"
+#endif /* ECHO_THROUGHPUT */
 
 #define SHUTDOWN_MSG	0xEF56A55A
 
@@ -65,6 +79,92 @@ original name of "rpmsg-openamp-demo-channel".
 static struct rpmsg_endpoint lept[ECHO_NUM_EPTS];
 static int shutdown_req = 0;
 
+#ifdef ECHO_THROUGHPUT
+#ifndef ECHO_TX_CHAIN
+#define ECHO_TX_CHAIN RPMSG_TX_CHAIN_MAX
+#endif /* !ECHO_TX_CHAIN */
+
+#if ECHO_TX_CHAIN < 1 || ECHO_TX_CHAIN > RPMSG_TX_CHAIN_MAX
+#error "ECHO_TX_CHAIN should be from 1 to RPMSG_TX_CHAIN_MAX"
+#endif
+
+#ifndef ECHO_REPORT_MSGS
+#define ECHO_REPORT_MSGS 10000
+#endif /* !ECHO_REPORT_MSGS */
+
+/* Replies waiting to be sent, they all belong to the same endpoint */
+static struct rpmsg_endpoint *tx_ept;
+static void *tx_buf[ECHO_TX_CHAIN];
+static int tx_len[ECHO_TX_CHAIN];
+static int tx_cnt;
+
+static unsigned int echo_msgs;
+static unsigned long long echo_bytes;
+static XTime echo_start;
+
+/*-----------------------------------------------------------------------------*
+ *  Send the pending replies with one notification
+ *-----------------------------------------------------------------------------*/
+static void echo_flush(void)
+{
+	int ret;
+
+	if (!tx_cnt)
+		return;
+
+	ret = rpmsg_send_nocopy_chain(tx_ept, tx_buf, tx_len, tx_cnt);
+	if (ret < 0)
+		ML_ERR("rpmsg_send_nocopy_chain failed %d\r\n", ret);
+	tx_cnt = 0;
+}
+
+/*-----------------------------------------------------------------------------*
+ *  Queue a reply, flushing the chain when it is full
+ *-----------------------------------------------------------------------------*/
+static void echo_queue(struct rpmsg_endpoint *ept, void *data, size_t len)
+{
+	uint32_t buf_len;
+	void *buf;
+	XTime now;
+
+	if (tx_cnt && tx_ept != ept)
+		echo_flush();
+
+	buf = rpmsg_get_tx_payload_buffer(ept, &buf_len, 0);
+	if (!buf) {
+		/* Out of TX buffers, hand over what we have and retry */
+		echo_flush();
+		buf = rpmsg_get_tx_payload_buffer(ept, &buf_len, 1);
+		if (!buf) {
+			ML_ERR("no TX buffer\r\n");
+			return;
+		}
+	}
+	if (len > buf_len)
+		len = buf_len;
+	memcpy(buf, data, len);
+
+	tx_ept = ept;
+	tx_buf[tx_cnt] = buf;
+	tx_len[tx_cnt] = len;
+	if (++tx_cnt == ECHO_TX_CHAIN)
+		echo_flush();
+
+	if (!echo_msgs)
+		XTime_GetTime(&echo_start);
+	echo_msgs++;
+	echo_bytes += len;
+	if (echo_msgs == ECHO_REPORT_MSGS) {
+		XTime_GetTime(&now);
+		LPRINTF("echoed %u msgs %llu bytes in %llu us\r\n",
+			echo_msgs, echo_bytes,
+			(now - echo_start) / (COUNTS_PER_SECOND / 1000000));
+		echo_msgs = 0;
+		echo_bytes = 0;
+	}
+}
+#endif /* ECHO_THROUGHPUT */
+
 /*-----------------------------------------------------------------------------*
  *  RPMSG endpoint callbacks
  *-----------------------------------------------------------------------------*/
@@ -80,10 +180,14 @@ static int rpmsg_endpoint_cb(struct rpmsg_endpoint *ept, void *data, size_t len,
 		return RPMSG_SUCCESS;
 	}
 
+#ifdef ECHO_THROUGHPUT
+	echo_queue(ept, data, len);
+#else
 	/* Send data back to master */
 	if (rpmsg_send(ept, data, len) < 0) {
 		ML_ERR("rpmsg_send failed\r\n");
 	}
+#endif /* ECHO_THROUGHPUT */
 	return RPMSG_SUCCESS;
 }
 
@@ -125,6 +229,10 @@ int app(struct rpmsg_device *rdev, void *priv)
 	ML_INFO("Successfully created rpmsg endpoint.\r\n");
 	while(1) {
 		platform_poll(priv);
+#ifdef ECHO_THROUGHPUT
+		/* The receive virtqueue is drained, send the replies */
+		echo_flush();
+#endif /* ECHO_THROUGHPUT */
 		/* we got a shutdown request, exit */
 		if (shutdown_req) {
 			break;
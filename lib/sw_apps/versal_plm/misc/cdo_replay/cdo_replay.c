@@ -0,0 +1,611 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file cdo_replay.c
+*
+* Host replay of a CDO file, to check and estimate the CDO pipeline of the
+* PLM (PLM_CDO_PIPELINE).
+*
+* The CDO is replayed twice against a sparse model of the memory and register
+* space: once serially, as the PLM does without the pipeline, and once with
+* the DMA_XFER commands left in flight, guarded unless they set
+* XPLMI_DMA_XFER_PIPELINE. The pipeline rules of xplmi_cdo_pipe.c are
+* compiled into this tool, hence the same commands wait for the transfer as
+* on the target. A transfer in flight
+* only reads its source and writes its destination when the next barrier is
+* reached, so a command wrongly issued alongside it changes the final state,
+* which is compared with the one of the serial replay.
+*
+* The memory model can not tell a core enable or start write from any other
+* register write. Use -v to list the writes issued alongside each transfer
+* and check that none of them depends on it, in particular before setting
+* XPLMI_DMA_XFER_PIPELINE in a CDO.
+*
+* The time of both replays is estimated with a cost per register write, per
+* other command and per transfer setup and word, which can be changed to
+* match the boot device and the target of the transfers.
+*
+* Usage: cdo_replay [-a] [-v] [-w <ns>] [-c <ns>] [-s <ns>] [-d <ns>] <cdo>
+*	cdo_replay -g <cdo>
+*	-a	Take every DMA_XFER as setting XPLMI_DMA_XFER_PIPELINE, to
+*		estimate the gain of setting the flag
+*	-v	List the writes issued while a transfer was in flight
+*	-w	Cost of a register write, 100 ns by default
+*	-c	Cost of any other command, 1000 ns by default
+*	-s	Setup cost of a transfer, 500 ns by default
+*	-d	Cost of a transferred word, 2.5 ns by default
+*	-g	Generate a sample CDO loading 32 AIE like tiles
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*       kc   10/18/2026 Pipeline the DMA_XFER commands not setting the flag
+*                       with guarded rules
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "xplmi_cdo_pipe.h"
+
+/* CDO layout, see xplmi_cdo.h and xplmi_cmd.h */
+#define CDO_HDR_IDN_WRD		0x004F4443U
+#define CDO_HDR_LEN		5U
+#define CDO_CMD_END		0x01FFU
+#define CDO_LONG_CMD_LEN	255U
+#define CDO_CMD_API_ID(CmdId)	((CmdId) & 0xFFU)
+#define CDO_CMD_MODULE_ID(CmdId)	(((CmdId) >> 8U) & 0xFFU)
+#define CDO_CMD_LEN(CmdId)	(((CmdId) >> 16U) & 0xFFU)
+#define CDO_CMD(Api, Len)	(((u32)(Len) << 16U) | \
+	(XPLMI_CDO_PIPE_GENERIC_ID << 8U) | (u32)(Api))
+
+/* Generic commands, see xplmi_modules.h */
+#define CDO_DMA_WRITE_ID	5U
+#define CDO_MASK_POLL64_ID	6U
+#define CDO_DMA_XFER_ID		9U
+
+/* Sparse memory model, an unwritten word reads as a pattern of its address */
+typedef struct {
+	u64 Addr;
+	u32 Val;
+	u32 Used;
+} MemEntry;
+
+typedef struct {
+	MemEntry *Table;
+	u64 Size;
+	u64 Count;
+} MemModel;
+
+typedef struct {
+	double WriteNs;
+	double CmdNs;
+	double XferSetupNs;
+	double XferWordNs;
+	int PipelineAll;
+	int Verbose;
+} ReplayCfg;
+
+typedef struct {
+	double Ns;
+	u32 Cmds;
+	u32 Xfers;
+	u32 PipelinedXfers;
+	u32 GuardedXfers;
+	u32 Overlapped;
+} ReplayStats;
+
+static u64 MemHash(u64 Addr, u64 Size)
+{
+	return ((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> (64U - __builtin_ctzll(Size));
+}
+
+static u32 MemDefault(u64 Addr)
+{
+	return (u32)((Addr >> 2U) * 2654435761U) ^ (u32)(Addr >> 32U);
+}
+
+static MemEntry *MemFind(const MemModel *Mem, u64 Addr)
+{
+	u64 Idx = MemHash(Addr, Mem->Size);
+
+	while ((Mem->Table[Idx].Used != 0U) && (Mem->Table[Idx].Addr != Addr)) {
+		Idx = (Idx + 1U) & (Mem->Size - 1U);
+	}
+
+	return &Mem->Table[Idx];
+}
+
+static int MemInit(MemModel *Mem, u64 Size)
+{
+	Mem->Size = Size;
+	Mem->Count = 0U;
+	Mem->Table = calloc(Size, sizeof(MemEntry));
+
+	return (Mem->Table == NULL) ? -1 : 0;
+}
+
+static u32 MemRead(const MemModel *Mem, u64 Addr)
+{
+	const MemEntry *Entry = MemFind(Mem, Addr);
+
+	return (Entry->Used != 0U) ? Entry->Val : MemDefault(Addr);
+}
+
+static void MemWrite(MemModel *Mem, u64 Addr, u32 Val)
+{
+	MemEntry *Entry;
+	MemModel New;
+	u64 Idx;
+
+	Addr &= ~3ULL;
+	if ((Mem->Count * 2U) >= Mem->Size) {
+		if (MemInit(&New, Mem->Size * 2U) != 0) {
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		}
+		for (Idx = 0U; Idx < Mem->Size; Idx++) {
+			if (Mem->Table[Idx].Used != 0U) {
+				*MemFind(&New, Mem->Table[Idx].Addr) =
+					Mem->Table[Idx];
+				New.Count++;
+			}
+		}
+		free(Mem->Table);
+		*Mem = New;
+	}
+	Entry = MemFind(Mem, Addr);
+	if (Entry->Used == 0U) {
+		Entry->Used = 1U;
+		Entry->Addr = Addr;
+		Mem->Count++;
+	}
+	Entry->Val = Val;
+}
+
+static int MemCompare(const MemModel *A, const MemModel *B)
+{
+	u64 Idx;
+	int Diff = 0;
+
+	for (Idx = 0U; Idx < A->Size; Idx++) {
+		if ((A->Table[Idx].Used != 0U) && (MemRead(B,
+			A->Table[Idx].Addr) != A->Table[Idx].Val)) {
+			if (Diff < 16) {
+				printf("mismatch at 0x%llx: serial 0x%08x "
+					"pipelined 0x%08x\n",
+					(unsigned long long)A->Table[Idx].Addr,
+					A->Table[Idx].Val,
+					MemRead(B, A->Table[Idx].Addr));
+			}
+			Diff++;
+		}
+	}
+
+	return Diff;
+}
+
+static void MemCopy(MemModel *Mem, u64 Src, u64 Dest, u32 Words)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Words; Idx++) {
+		MemWrite(Mem, Dest + ((u64)Idx * 4U),
+			MemRead(Mem, Src + ((u64)Idx * 4U)));
+	}
+}
+
+/*
+ * Replays the commands following the CDO header. If Pipeline is set, the
+ * transfers allowed to are left in flight and only copied at the next
+ * barrier.
+ */
+static int Replay(const u32 *Cdo, u32 CdoLen, const ReplayCfg *Cfg,
+	int Pipeline, MemModel *Mem, ReplayStats *Stats)
+{
+	XPlmi_CdoPipeXfer Xfer = {0U};
+	u32 XferWords = 0U;
+	double XferEnd = 0.0;
+	int InFlight = 0;
+	u32 Off = 0U;
+	u32 CmdId;
+	u32 Len;
+	u32 Hdr;
+	const u32 *Payload;
+	u64 Addr;
+	u64 Dest;
+	u32 Idx;
+	double Cost;
+
+	memset(Stats, 0, sizeof(*Stats));
+	while (Off < CdoLen) {
+		CmdId = Cdo[Off];
+		if (CmdId == CDO_CMD_END) {
+			break;
+		}
+		Len = CDO_CMD_LEN(CmdId);
+		Hdr = 1U;
+		if (Len == CDO_LONG_CMD_LEN) {
+			if ((Off + 1U) >= CdoLen) {
+				break;
+			}
+			Len = Cdo[Off + 1U];
+			Hdr = 2U;
+		}
+		if (((u64)Off + Hdr + Len) > CdoLen) {
+			fprintf(stderr, "Command 0x%08x at word %u exceeds the "
+				"CDO\n", CmdId, Off + CDO_HDR_LEN);
+			return -1;
+		}
+		Payload = &Cdo[Off + Hdr];
+
+		if ((Pipeline != 0) && (InFlight != 0)) {
+			if (XPlmi_CdoPipeCanIssue(&Xfer, &Cdo[Off],
+				CdoLen - Off) == (u8)FALSE) {
+				/* Barrier, the transfer lands now */
+				MemCopy(Mem, Xfer.SrcAddr, Xfer.DestAddr,
+					XferWords);
+				if (XferEnd > Stats->Ns) {
+					Stats->Ns = XferEnd;
+				}
+				InFlight = 0;
+			} else {
+				Stats->Overlapped++;
+				if ((Cfg->Verbose != 0) && (Len >= 2U)) {
+					printf("  word %u: 0x%08x 0x%08x 0x%08x "
+						"alongside 0x%llx -> 0x%llx\n",
+						Off + CDO_HDR_LEN, CmdId, Payload[0U],
+						Payload[1U],
+						(unsigned long long)Xfer.SrcAddr,
+						(unsigned long long)Xfer.DestAddr);
+				}
+			}
+		}
+
+		Cost = Cfg->CmdNs;
+		if (CDO_CMD_MODULE_ID(CmdId) == XPLMI_CDO_PIPE_GENERIC_ID) {
+			switch (CDO_CMD_API_ID(CmdId)) {
+			case XPLMI_CDO_PIPE_WRITE_ID:
+				if (Len >= 2U) {
+					MemWrite(Mem, Payload[0U], Payload[1U]);
+				}
+				Cost = Cfg->WriteNs;
+				break;
+			case XPLMI_CDO_PIPE_MASK_WRITE_ID:
+				if (Len >= 3U) {
+					Addr = Payload[0U];
+					MemWrite(Mem, Addr, (MemRead(Mem, Addr) &
+						~Payload[1U]) | (Payload[2U] &
+						Payload[1U]));
+				}
+				Cost = Cfg->WriteNs;
+				break;
+			case XPLMI_CDO_PIPE_WRITE64_ID:
+				if (Len >= 3U) {
+					Addr = ((u64)Payload[0U] << 32U) |
+						Payload[1U];
+					MemWrite(Mem, Addr, Payload[2U]);
+				}
+				Cost = Cfg->WriteNs;
+				break;
+			case XPLMI_CDO_PIPE_MASK_WRITE64_ID:
+				if (Len >= 4U) {
+					Addr = ((u64)Payload[0U] << 32U) |
+						Payload[1U];
+					MemWrite(Mem, Addr, (MemRead(Mem, Addr) &
+						~Payload[2U]) | (Payload[3U] &
+						Payload[2U]));
+				}
+				Cost = Cfg->WriteNs;
+				break;
+			case XPLMI_CDO_PIPE_NOP_ID:
+				Cost = 0.0;
+				break;
+			case CDO_DMA_WRITE_ID:
+				if (Len >= 2U) {
+					Dest = ((u64)Payload[0U] << 32U) |
+						Payload[1U];
+					for (Idx = 2U; Idx < Len; Idx++) {
+						MemWrite(Mem, Dest, Payload[Idx]);
+						Dest += 4U;
+					}
+					Cost = Cfg->XferSetupNs +
+						(Cfg->XferWordNs * (Len - 2U));
+				}
+				break;
+			case CDO_DMA_XFER_ID:
+				if (Len < 6U) {
+					break;
+				}
+				Stats->Xfers++;
+				Xfer.SrcAddr = ((u64)Payload[0U] << 32U) |
+					Payload[1U];
+				Xfer.DestAddr = ((u64)Payload[2U] << 32U) |
+					Payload[3U];
+				XferWords = Payload[4U];
+				Xfer.Len = (u64)XferWords * 4U;
+				Cost = Cfg->XferSetupNs +
+					(Cfg->XferWordNs * XferWords);
+				Xfer.Guarded = (u8)((Cfg->PipelineAll == 0) &&
+					((Payload[5U] & XPLMI_DMA_XFER_PIPELINE) == 0U));
+				if ((Pipeline != 0) && (XferWords != 0U)) {
+					Stats->PipelinedXfers++;
+					Stats->GuardedXfers += Xfer.Guarded;
+					XferEnd = Stats->Ns + Cost;
+					Cost = Cfg->XferSetupNs;
+					InFlight = 1;
+				} else {
+					MemCopy(Mem, Xfer.SrcAddr, Xfer.DestAddr,
+						XferWords);
+				}
+				break;
+			default:
+				/* Polls, markers and the like only cost time */
+				break;
+			}
+		}
+		Stats->Ns += Cost;
+		Stats->Cmds++;
+		Off += Hdr + Len;
+	}
+
+	/* End of the CDO is a barrier */
+	if (InFlight != 0) {
+		MemCopy(Mem, Xfer.SrcAddr, Xfer.DestAddr, XferWords);
+		if (XferEnd > Stats->Ns) {
+			Stats->Ns = XferEnd;
+		}
+	}
+
+	return 0;
+}
+
+static void Put(u32 *Cdo, u32 *Off, u32 Word)
+{
+	Cdo[*Off] = Word;
+	(*Off)++;
+}
+
+/*
+ * Writes a CDO loading 32 tiles: per tile a DMA_XFER of the program setting
+ * XPLMI_DMA_XFER_PIPELINE, the configuration writes of the tile, a mask poll
+ * on the lock of the tile and its core enable. It then loads DDR with an
+ * unflagged transfer followed by PL writes, which run alongside it, and an
+ * APU reset release, which waits for it. A last unflagged transfer is
+ * followed by a write into its destination.
+ */
+static int Generate(const char *Path)
+{
+	static u32 Cdo[64U * 1024U];
+	u32 Off = CDO_HDR_LEN;
+	u64 Tile;
+	u32 Tidx;
+	u32 Idx;
+	u32 Sum = 0U;
+	FILE *Fp;
+
+	for (Tidx = 0U; Tidx < 32U; Tidx++) {
+		Tile = 0x20000000000ULL | ((u64)(Tidx / 4U) << 23U) |
+			((u64)(Tidx % 4U + 1U) << 18U);
+		Put(Cdo, &Off, CDO_CMD(CDO_DMA_XFER_ID, 6U));
+		Put(Cdo, &Off, 0U);
+		Put(Cdo, &Off, 0x10000000U + (Tidx * 0x4000U));
+		Put(Cdo, &Off, (u32)(Tile >> 32U));
+		Put(Cdo, &Off, (u32)(Tile + 0x20000U));
+		Put(Cdo, &Off, 0x1000U);
+		Put(Cdo, &Off, XPLMI_DMA_XFER_PIPELINE);
+		for (Idx = 0U; Idx < 48U; Idx++) {
+			Put(Cdo, &Off, CDO_CMD(XPLMI_CDO_PIPE_WRITE64_ID, 3U));
+			Put(Cdo, &Off, (u32)(Tile >> 32U));
+			Put(Cdo, &Off, (u32)(Tile + 0x3F000U + (Idx * 4U)));
+			Put(Cdo, &Off, (Tidx << 8U) | Idx);
+		}
+		Put(Cdo, &Off, CDO_CMD(CDO_MASK_POLL64_ID, 5U));
+		Put(Cdo, &Off, (u32)(Tile >> 32U));
+		Put(Cdo, &Off, (u32)(Tile + 0x1F000U));
+		Put(Cdo, &Off, 0x1U);
+		Put(Cdo, &Off, 0x1U);
+		Put(Cdo, &Off, 0x1000U);
+		Put(Cdo, &Off, CDO_CMD(XPLMI_CDO_PIPE_WRITE64_ID, 3U));
+		Put(Cdo, &Off, (u32)(Tile >> 32U));
+		Put(Cdo, &Off, (u32)(Tile + 0x32000U));
+		Put(Cdo, &Off, 0x1U);
+	}
+	Put(Cdo, &Off, CDO_CMD(CDO_DMA_XFER_ID, 6U));
+	Put(Cdo, &Off, 0U);
+	Put(Cdo, &Off, 0x10000000U);
+	Put(Cdo, &Off, 0U);
+	Put(Cdo, &Off, 0x40000000U);
+	Put(Cdo, &Off, 0x8000U);
+	Put(Cdo, &Off, 0U);
+	for (Idx = 0U; Idx < 64U; Idx++) {
+		Put(Cdo, &Off, CDO_CMD(XPLMI_CDO_PIPE_WRITE_ID, 2U));
+		Put(Cdo, &Off, 0xA4000000U + (Idx * 4U));
+		Put(Cdo, &Off, Idx);
+	}
+	Put(Cdo, &Off, CDO_CMD(XPLMI_CDO_PIPE_WRITE_ID, 2U));
+	Put(Cdo, &Off, 0xFD1A0300U);
+	Put(Cdo, &Off, 0U);
+	Put(Cdo, &Off, CDO_CMD(CDO_DMA_XFER_ID, 6U));
+	Put(Cdo, &Off, 0U);
+	Put(Cdo, &Off, 0x18000000U);
+	Put(Cdo, &Off, 0U);
+	Put(Cdo, &Off, 0x20000000U);
+	Put(Cdo, &Off, 0x100U);
+	Put(Cdo, &Off, 0U);
+	Put(Cdo, &Off, CDO_CMD(XPLMI_CDO_PIPE_WRITE_ID, 2U));
+	Put(Cdo, &Off, 0x20000010U);
+	Put(Cdo, &Off, 0xDEADBEEFU);
+	Put(Cdo, &Off, CDO_CMD_END);
+
+	Cdo[0U] = CDO_HDR_LEN - 1U;
+	Cdo[1U] = CDO_HDR_IDN_WRD;
+	Cdo[2U] = 0x200U;
+	Cdo[3U] = Off - CDO_HDR_LEN;
+	for (Idx = 0U; Idx < (CDO_HDR_LEN - 1U); Idx++) {
+		Sum += Cdo[Idx];
+	}
+	Cdo[CDO_HDR_LEN - 1U] = Sum ^ 0xFFFFFFFFU;
+
+	Fp = fopen(Path, "wb");
+	if (Fp == NULL) {
+		perror(Path);
+		return 1;
+	}
+	if (fwrite(Cdo, sizeof(u32), Off, Fp) != Off) {
+		perror(Path);
+		fclose(Fp);
+		return 1;
+	}
+	fclose(Fp);
+
+	return 0;
+}
+
+static u32 *ReadCdo(const char *Path, u32 *Words)
+{
+	FILE *Fp = fopen(Path, "rb");
+	u32 *Buf;
+	long Size;
+
+	if (Fp == NULL) {
+		perror(Path);
+		return NULL;
+	}
+	fseek(Fp, 0L, SEEK_END);
+	Size = ftell(Fp);
+	fseek(Fp, 0L, SEEK_SET);
+	if (Size < (long)(CDO_HDR_LEN * sizeof(u32))) {
+		fprintf(stderr, "%s: too short for a CDO\n", Path);
+		fclose(Fp);
+		return NULL;
+	}
+	Buf = malloc((size_t)Size);
+	if ((Buf == NULL) || (fread(Buf, 1U, (size_t)Size, Fp) != (size_t)Size)) {
+		fprintf(stderr, "%s: read failed\n", Path);
+		free(Buf);
+		fclose(Fp);
+		return NULL;
+	}
+	fclose(Fp);
+	*Words = (u32)((u64)Size / sizeof(u32));
+
+	return Buf;
+}
+
+static void Usage(const char *Name)
+{
+	fprintf(stderr, "Usage: %s [-a] [-v] [-w <ns>] [-c <ns>] [-s <ns>] "
+		"[-d <ns>] <cdo>\n       %s -g <cdo>\n", Name, Name);
+}
+
+int main(int argc, char **argv)
+{
+	ReplayCfg Cfg = {100.0, 1000.0, 500.0, 2.5, 0, 0};
+	ReplayStats Serial;
+	ReplayStats Piped;
+	MemModel SerialMem;
+	MemModel PipedMem;
+	const char *GenPath = NULL;
+	u32 *Cdo;
+	u32 Words;
+	u32 Sum = 0U;
+	u32 Idx;
+	int Diff;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "avw:c:s:d:g:")) != -1) {
+		switch (Opt) {
+		case 'a':
+			Cfg.PipelineAll = 1;
+			break;
+		case 'v':
+			Cfg.Verbose = 1;
+			break;
+		case 'w':
+			Cfg.WriteNs = strtod(optarg, NULL);
+			break;
+		case 'c':
+			Cfg.CmdNs = strtod(optarg, NULL);
+			break;
+		case 's':
+			Cfg.XferSetupNs = strtod(optarg, NULL);
+			break;
+		case 'd':
+			Cfg.XferWordNs = strtod(optarg, NULL);
+			break;
+		case 'g':
+			GenPath = optarg;
+			break;
+		default:
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+	if (GenPath != NULL) {
+		return Generate(GenPath);
+	}
+	if (optind >= argc) {
+		Usage(argv[0]);
+		return 1;
+	}
+
+	Cdo = ReadCdo(argv[optind], &Words);
+	if (Cdo == NULL) {
+		return 1;
+	}
+	for (Idx = 0U; Idx < (CDO_HDR_LEN - 1U); Idx++) {
+		Sum += Cdo[Idx];
+	}
+	if ((Cdo[1U] != CDO_HDR_IDN_WRD) ||
+		((Sum ^ 0xFFFFFFFFU) != Cdo[CDO_HDR_LEN - 1U])) {
+		fprintf(stderr, "%s: invalid CDO header\n", argv[optind]);
+		return 1;
+	}
+	if (Cdo[3U] < (Words - CDO_HDR_LEN)) {
+		Words = Cdo[3U] + CDO_HDR_LEN;
+	}
+
+	if ((MemInit(&SerialMem, 1024U) != 0) ||
+		(MemInit(&PipedMem, 1024U) != 0)) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	if ((Replay(&Cdo[CDO_HDR_LEN], Words - CDO_HDR_LEN, &Cfg, 0,
+		&SerialMem, &Serial) != 0) ||
+		(Replay(&Cdo[CDO_HDR_LEN], Words - CDO_HDR_LEN, &Cfg, 1,
+		&PipedMem, &Piped) != 0)) {
+		return 1;
+	}
+
+	Diff = MemCompare(&SerialMem, &PipedMem) +
+		MemCompare(&PipedMem, &SerialMem);
+	printf("%u commands, %u DMA_XFER, %u pipelined (%u guarded), %u "
+		"commands alongside a transfer\n", Serial.Cmds, Serial.Xfers,
+		Piped.PipelinedXfers, Piped.GuardedXfers, Piped.Overlapped);
+	printf("serial    %10.1f us\npipelined %10.1f us (%.1f%%)\n",
+		Serial.Ns / 1000.0, Piped.Ns / 1000.0,
+		(Serial.Ns > 0.0) ? (100.0 * (Serial.Ns - Piped.Ns) /
+		Serial.Ns) : 0.0);
+	printf("%llu words written, state %s\n",
+		(unsigned long long)SerialMem.Count,
+		(Diff == 0) ? "identical" : "DIFFERS");
+
+	free(SerialMem.Table);
+	free(PipedMem.Table);
+	free(Cdo);
+
+	return (Diff == 0) ? 0 : 1;
+}
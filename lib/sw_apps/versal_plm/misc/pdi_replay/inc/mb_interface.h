@@ -0,0 +1,24 @@
+/*
+ * Host build of the PLM, the 64-bit accesses of the PLM go to the memory and
+ * register model of pdi_replay
+ */
+#ifndef _MICROBLAZE_INTERFACE_H_
+#define _MICROBLAZE_INTERFACE_H_
+
+#include "xil_types.h"
+
+u32 Replay_In32(u64 Addr);
+u8 Replay_In8(u64 Addr);
+void Replay_Out32(u64 Addr, u32 Value);
+void Replay_Out8(u64 Addr, u8 Value);
+
+#define lwea(Addr)		Replay_In32((u64)(Addr))
+#define lbuea(Addr)		Replay_In8((u64)(Addr))
+#define swea(Addr, Data)	Replay_Out32((u64)(Addr), (u32)(Data))
+#define sbea(Addr, Data)	Replay_Out8((u64)(Addr), (u8)(Data))
+#define mbar(Mode)
+
+void microblaze_enable_interrupts(void);
+void microblaze_disable_interrupts(void);
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Host build of the PLM, the register accesses of the PLM go to the memory and
+ * register model of pdi_replay
+ */
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "mb_interface.h"
+
+#define INLINE inline
+#define INST_SYNC
+#define DATA_SYNC
+
+u8 Xil_In8(UINTPTR Addr);
+u16 Xil_In16(UINTPTR Addr);
+u32 Xil_In32(UINTPTR Addr);
+u64 Xil_In64(UINTPTR Addr);
+void Xil_Out8(UINTPTR Addr, u8 Value);
+void Xil_Out16(UINTPTR Addr, u16 Value);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+void Xil_Out64(UINTPTR Addr, u64 Value);
+
+static INLINE int Xil_SecureOut32(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Value);
+
+	return (Xil_In32(Addr) == Value) ? XST_SUCCESS : XST_FAILURE;
+}
+
+static INLINE u16 Xil_EndianSwap16(u16 Data)
+{
+	return (u16)(((Data & 0xFF00U) >> 8U) | ((Data & 0x00FFU) << 8U));
+}
+
+static INLINE u32 Xil_EndianSwap32(u32 Data)
+{
+	return ((Data & 0xFF000000U) >> 24U) | ((Data & 0x00FF0000U) >> 8U) |
+		((Data & 0x0000FF00U) << 8U) | ((Data & 0x000000FFU) << 24U);
+}
+
+/* The host is little endian, as the PMC */
+#define Xil_In16LE	Xil_In16
+#define Xil_In32LE	Xil_In32
+#define Xil_Out16LE	Xil_Out16
+#define Xil_Out32LE	Xil_Out32
+#define Xil_Htons	Xil_EndianSwap16
+#define Xil_Htonl	Xil_EndianSwap32
+#define Xil_Ntohs	Xil_EndianSwap16
+#define Xil_Ntohl	Xil_EndianSwap32
+
+static INLINE u16 Xil_In16BE(UINTPTR Addr)
+{
+	return Xil_EndianSwap16(Xil_In16(Addr));
+}
+
+static INLINE u32 Xil_In32BE(UINTPTR Addr)
+{
+	return Xil_EndianSwap32(Xil_In32(Addr));
+}
+
+static INLINE void Xil_Out16BE(UINTPTR Addr, u16 Value)
+{
+	Xil_Out16(Addr, Xil_EndianSwap16(Value));
+}
+
+static INLINE void Xil_Out32BE(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Xil_EndianSwap32(Value));
+}
+
+#endif
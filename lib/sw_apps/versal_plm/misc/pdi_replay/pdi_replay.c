@@ -0,0 +1,1720 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file pdi_replay.c
+*
+* Host replay of a PDI through the loader of the PLM, to profile the CDO
+* commands of its partitions and time the load.
+*
+* The PDI is loaded by XLoader_LoadPdi() from the DDR boot source, with the
+* header parsing of xilpdi.c, the partition loading of xloader_prtn_load.c
+* and the CDO processing and generic command handlers of xilplmi compiled
+* into this tool. PMC RAM and the PDI are mapped at their addresses on the
+* target and all other register and memory accesses of the PLM go to a
+* sparse model, in which an unwritten word reads as 0. A poll which does
+* not match the model sets the polled bits, as the device would, and is
+* counted as a wait. DMA transfers complete when they are started.
+*
+* The modules other than the generic and the loader ones are registered
+* with handlers which succeed without any access, so the PM, security and
+* other commands of a CDO are counted but their register accesses are not.
+* Secure (authenticated or encrypted) partitions are not supported and the
+* boot devices other than DDR are not modeled.
+*
+* The log of the PLM is printed with PLM_PRINT_PERF and
+* PLM_PRINT_PERF_CDO_PROFILE, hence the "time;" and "count;" lines of
+* XPlmi_CdoProfileDump() after each partition, which give the host time
+* spent in each command. They are followed by the register writes, reads,
+* polls, poll waits and DMA words of each command in the same folded stack
+* format, "writes;<image>;prtn_<n>;mod_<m>;cmd_<c> <count>", the accesses
+* outside the commands going to "<image>;prtn_<n>;loader". The counts are
+* exact, the times are those of the host. The GetBoard and LogString
+* commands DMA from a 32-bit address of a PLM variable and do not work on
+* the host.
+*
+* Usage: pdi_replay [-v] <pdi>
+*	pdi_replay -g <pdi>
+*	-v	Also print the DEBUG_INFO messages of the PLM
+*	-g	Generate a sample PDI of the PLM and four images of CDO and ELF
+*		partitions
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "xloader.h"
+#include "xloader_ddr.h"
+#include "xloader_plat.h"
+#include "xloader_qspi.h"
+#include "xloader_sbi.h"
+#include "xloader_sd.h"
+#include "xloader_secure.h"
+#include "xplmi.h"
+#include "xplmi_cdo.h"
+#include "xplmi_cmd.h"
+#include "xplmi_dma.h"
+#include "xplmi_err_common.h"
+#include "xplmi_generic.h"
+#include "xplmi_modules.h"
+#include "xplmi_proc.h"
+#include "xplmi_ssit.h"
+#include "xplmi_sysmon.h"
+#include "xplmi_task.h"
+#include "xplmi_util.h"
+#include "xplmi_wdt.h"
+#include "xplmi_event_logging.h"
+#include "xpm_api.h"
+#include "xpm_device.h"
+#include "xpm_subsystem.h"
+#include "xsecure_init.h"
+#include "xsecure_sha.h"
+#include "sleep.h"
+
+/* The PDI is mapped in DDR, where a boot PDI would be copied */
+#define REPLAY_PDI_ADDR		0x800000000ULL
+#define REPLAY_PDI_MAX_LEN	0x40000000U
+/* Host memory of this tool, such as its buffers and the stack */
+#define REPLAY_HOST_ADDR	0x400000000000ULL
+#define REPLAY_CMD_IDS		0x10000U
+#define REPLAY_CMD_ID(CmdId)	((CmdId) & 0xFFFFU)
+#define REPLAY_MEM_SIZE		0x10000U
+#define REPLAY_STUB_CMDS	256U
+#define REPLAY_TRACE_LEN	0x1000U
+#define REPLAY_TIMER_HZ		1000000000U
+#define REPLAY_NS_PER_MS	1000000U
+#define REPLAY_NS_PER_US	1000U
+#define REPLAY_MSG_LEN		512U
+
+/* Sample PDI layout */
+#define SAMPLE_META_HDR_OFST	0x2000U
+#define SAMPLE_IMG_HDR_OFST	(SAMPLE_META_HDR_OFST + XIH_IHT_LEN)
+#define SAMPLE_PRTN_HDR_OFST	(SAMPLE_META_HDR_OFST + 0x400U)
+#define SAMPLE_DATA_OFST	0x3000U
+#define SAMPLE_PLM_OFST		0x1000U
+#define SAMPLE_MAX_WORDS	0x20000U
+#define SAMPLE_IDCODE		0x14CA8093U
+#define SAMPLE_EXT_IDCODE	0x01U
+#define SAMPLE_IMGS		5U
+#define SAMPLE_PRTNS		6U
+#define SAMPLE_CDO_HDR_LEN	5U
+#define SAMPLE_CDO_IDN_WRD	0x004F4443U
+#define SAMPLE_CDO_VERSION	0x200U
+#define SAMPLE_LONG_CMD_LEN	255U
+#define SAMPLE_KEYHOLE_WORDS	0x6000U
+#define SAMPLE_KEYHOLE_SIZE	0x10000U
+#define SAMPLE_ELF_WORDS	0x1000U
+
+/* Generic commands, see xplmi_generic.c */
+#define SAMPLE_MASK_POLL	1U
+#define SAMPLE_MASK_WRITE	2U
+#define SAMPLE_WRITE		3U
+#define SAMPLE_DELAY		4U
+#define SAMPLE_DMA_WRITE	5U
+#define SAMPLE_DMA_WRITE_KEYHOLE	13U
+#define SAMPLE_PM_MODULE_ID	2U
+#define SAMPLE_PM_REQUEST_DEVICE	13U
+
+/* Register writes, reads, polls and DMA words of a command */
+typedef struct {
+	u64 Writes;
+	u64 Reads;
+	u64 Polls;
+	u64 PollWaits;
+	u64 DmaWords;
+} Replay_Count;
+
+/* Sparse model of the registers and memory not mapped on the host */
+typedef struct {
+	u64 Addr;
+	u32 Val;
+	u32 Used;
+} Replay_Reg;
+
+typedef struct {
+	Replay_Reg *Table;
+	u64 Size;
+	u64 Count;
+} Replay_RegModel;
+
+/* Sample PDI being generated */
+typedef struct {
+	u32 *Words;
+	u32 Len;
+} Sample_Pdi;
+
+/* PLM functions wrapped at link time, see the Makefile */
+int __real_XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr);
+int __real_XPlmi_CmdResume(XPlmi_Cmd *CmdPtr);
+void __real_XPlmi_CdoProfileDump(const char *Frame, u32 PrtnNum);
+int __wrap_XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr);
+int __wrap_XPlmi_CmdResume(XPlmi_Cmd *CmdPtr);
+void __wrap_XPlmi_CdoProfileDump(const char *Frame, u32 PrtnNum);
+int __wrap_XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue,
+	u32 TimeOutInUs);
+int __wrap_XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue,
+	u32 TimeOutInUs);
+int __wrap_XPlmi_UtilPollForMask(u32 RegAddr, u32 Mask, u32 TimeOutInUs);
+int __wrap_XPlmi_UtilPollForMask64(u32 HighAddr, u32 LowAddr, u32 Mask,
+	u32 TimeOutInUs);
+
+static Replay_RegModel RegModel;
+static Replay_Count CmdCount[REPLAY_CMD_IDS];
+/* Command IDs run since the last dump, in the order of their first run */
+static u16 UsedIds[REPLAY_CMD_IDS];
+static u8 IdUsed[REPLAY_CMD_IDS];
+static u32 UsedIdCnt;
+static Replay_Count LoaderCount;
+static Replay_Count TotalCount;
+static Replay_Count *CurCount = &LoaderCount;
+static u8 *PdiMem;
+static u64 PdiLen;
+static u32 TraceMem[REPLAY_TRACE_LEN / XPLMI_WORD_LEN];
+static XPlmi_CircularBuffer TraceLog = {
+	.StartAddr = 0U,
+	.Len = REPLAY_TRACE_LEN,
+};
+static u32 PmcIroFreq = REPLAY_TIMER_HZ;
+static XPlmi_BoardParams BoardParams;
+static XPlmi_ModuleCmd StubCmds[REPLAY_STUB_CMDS];
+static XPlmi_Module StubModules[XPLMI_MAX_MODULES];
+static u32 Prtns;
+
+/*****************************************************************************/
+/* Memory and register model */
+
+static u64 Replay_Hash(u64 Addr, u64 Size)
+{
+	return ((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >>
+		(64U - __builtin_ctzll(Size));
+}
+
+static Replay_Reg *Replay_RegFind(const Replay_RegModel *Model, u64 Addr)
+{
+	u64 Idx = Replay_Hash(Addr, Model->Size);
+
+	while ((Model->Table[Idx].Used != 0U) &&
+		(Model->Table[Idx].Addr != Addr)) {
+		Idx = (Idx + 1U) & (Model->Size - 1U);
+	}
+
+	return &Model->Table[Idx];
+}
+
+static int Replay_RegInit(Replay_RegModel *Model, u64 Size)
+{
+	Model->Size = Size;
+	Model->Count = 0U;
+	Model->Table = calloc(Size, sizeof(Replay_Reg));
+
+	return (Model->Table == NULL) ? XST_FAILURE : XST_SUCCESS;
+}
+
+static u32 Replay_RegRead(u64 Addr)
+{
+	const Replay_Reg *Reg = Replay_RegFind(&RegModel, Addr & ~3ULL);
+
+	return (Reg->Used != 0U) ? Reg->Val : 0U;
+}
+
+static void Replay_RegWrite(u64 Addr, u32 Val)
+{
+	Replay_RegModel New;
+	Replay_Reg *Reg;
+	u64 Idx;
+
+	Addr &= ~3ULL;
+	if ((RegModel.Count * 2U) >= RegModel.Size) {
+		if (Replay_RegInit(&New, RegModel.Size * 2U) != XST_SUCCESS) {
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		}
+		for (Idx = 0U; Idx < RegModel.Size; Idx++) {
+			if (RegModel.Table[Idx].Used != 0U) {
+				*Replay_RegFind(&New, RegModel.Table[Idx].Addr) =
+					RegModel.Table[Idx];
+				New.Count++;
+			}
+		}
+		free(RegModel.Table);
+		RegModel = New;
+	}
+	Reg = Replay_RegFind(&RegModel, Addr);
+	if (Reg->Used == 0U) {
+		Reg->Used = 1U;
+		Reg->Addr = Addr;
+		RegModel.Count++;
+	}
+	Reg->Val = Val;
+}
+
+/* Host address of the mapped PMC RAM, PDI and host memory, NULL otherwise */
+static u8 *Replay_HostPtr(u64 Addr, u64 Len)
+{
+	u8 *Ptr = NULL;
+
+	if ((Addr >= XPLMI_PMCRAM_BASEADDR) &&
+		((Addr + Len) <= (XPLMI_PMCRAM_BASEADDR + XPLMI_PMCRAM_LEN))) {
+		Ptr = (u8 *)(UINTPTR)Addr;
+	}
+	else if ((Addr >= REPLAY_PDI_ADDR) &&
+		((Addr + Len) <= (REPLAY_PDI_ADDR + PdiLen))) {
+		Ptr = (u8 *)(UINTPTR)Addr;
+	}
+	else if (Addr >= REPLAY_HOST_ADDR) {
+		Ptr = (u8 *)(UINTPTR)Addr;
+	}
+
+	return Ptr;
+}
+
+static u32 Replay_Load(u64 Addr)
+{
+	const u8 *Ptr = Replay_HostPtr(Addr, XPLMI_WORD_LEN);
+	u32 Val;
+
+	if (Ptr != NULL) {
+		memcpy(&Val, Ptr, sizeof(Val));
+	}
+	else {
+		Val = Replay_RegRead(Addr);
+	}
+
+	return Val;
+}
+
+static void Replay_Store(u64 Addr, u32 Val)
+{
+	u8 *Ptr = Replay_HostPtr(Addr, XPLMI_WORD_LEN);
+
+	if (Ptr != NULL) {
+		memcpy(Ptr, &Val, sizeof(Val));
+	}
+	else {
+		Replay_RegWrite(Addr, Val);
+	}
+}
+
+static u32 Replay_Read(u64 Addr, u32 Size)
+{
+	u32 Shift = (u32)(Addr & 3U) * 8U;
+	u32 Val;
+
+	if (Replay_HostPtr(Addr, Size) == NULL) {
+		CurCount->Reads++;
+	}
+	Val = Replay_Load(Addr & ~3ULL) >> Shift;
+	if (Size < XPLMI_WORD_LEN) {
+		Val &= (1U << (Size * 8U)) - 1U;
+	}
+
+	return Val;
+}
+
+static void Replay_Write(u64 Addr, u32 Size, u32 Val)
+{
+	u32 Shift = (u32)(Addr & 3U) * 8U;
+	u32 Mask = 0xFFFFFFFFU;
+	u32 Old;
+
+	if (Replay_HostPtr(Addr, Size) == NULL) {
+		CurCount->Writes++;
+	}
+	if (Size < XPLMI_WORD_LEN) {
+		Mask = ((1U << (Size * 8U)) - 1U) << Shift;
+		Old = Replay_Load(Addr & ~3ULL);
+		Val = (Old & ~Mask) | ((Val << Shift) & Mask);
+	}
+	Replay_Store(Addr & ~3ULL, Val);
+}
+
+/* Copies words, keeping only the last one for a fixed destination */
+static void Replay_Copy(u64 Src, u64 Dest, u32 Words, u8 FixedDest)
+{
+	u8 *SrcPtr = Replay_HostPtr(Src, (u64)Words * XPLMI_WORD_LEN);
+	u8 *DestPtr = Replay_HostPtr(Dest, (u64)Words * XPLMI_WORD_LEN);
+	u32 Idx;
+
+	if ((SrcPtr != NULL) && (DestPtr != NULL) && (FixedDest == (u8)FALSE)) {
+		memmove(DestPtr, SrcPtr, (size_t)Words * XPLMI_WORD_LEN);
+		goto END;
+	}
+	for (Idx = 0U; Idx < Words; Idx++) {
+		if ((FixedDest == (u8)FALSE) || ((Idx + 1U) == Words)) {
+			Replay_Store(Dest, Replay_Load(Src));
+		}
+		Src += XPLMI_WORD_LEN;
+		if (FixedDest == (u8)FALSE) {
+			Dest += XPLMI_WORD_LEN;
+		}
+	}
+
+END:
+	return;
+}
+
+/* The device completes any poll not matching the model */
+static void Replay_Poll(u64 Addr, u32 Mask, u32 ExpectedValue)
+{
+	u32 Val = Replay_Load(Addr);
+
+	CurCount->Polls++;
+	if ((Val & Mask) != (ExpectedValue & Mask)) {
+		CurCount->PollWaits++;
+		Replay_Store(Addr, (Val & ~Mask) | (ExpectedValue & Mask));
+	}
+}
+
+static u64 Replay_Ns(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * REPLAY_TIMER_HZ) + (u64)Ts.tv_nsec;
+}
+
+static void Replay_AddCount(Replay_Count *Dest, const Replay_Count *Src)
+{
+	Dest->Writes += Src->Writes;
+	Dest->Reads += Src->Reads;
+	Dest->Polls += Src->Polls;
+	Dest->PollWaits += Src->PollWaits;
+	Dest->DmaWords += Src->DmaWords;
+}
+
+static void Replay_PrintCount(const char *Frame, u32 PrtnNum,
+	const char *Leaf, const Replay_Count *Count)
+{
+	if (Count->Writes != 0U) {
+		printf("writes;%s;prtn_%u;%s %llu\n", Frame, PrtnNum, Leaf,
+			(unsigned long long)Count->Writes);
+	}
+	if (Count->Reads != 0U) {
+		printf("reads;%s;prtn_%u;%s %llu\n", Frame, PrtnNum, Leaf,
+			(unsigned long long)Count->Reads);
+	}
+	if (Count->Polls != 0U) {
+		printf("polls;%s;prtn_%u;%s %llu\n", Frame, PrtnNum, Leaf,
+			(unsigned long long)Count->Polls);
+	}
+	if (Count->PollWaits != 0U) {
+		printf("poll_waits;%s;prtn_%u;%s %llu\n", Frame, PrtnNum, Leaf,
+			(unsigned long long)Count->PollWaits);
+	}
+	if (Count->DmaWords != 0U) {
+		printf("dma_words;%s;prtn_%u;%s %llu\n", Frame, PrtnNum, Leaf,
+			(unsigned long long)Count->DmaWords);
+	}
+}
+
+static Replay_Count *Replay_CmdCount(u32 CmdId)
+{
+	u32 Id = REPLAY_CMD_ID(CmdId);
+
+	if (IdUsed[Id] == 0U) {
+		IdUsed[Id] = 1U;
+		UsedIds[UsedIdCnt] = (u16)Id;
+		UsedIdCnt++;
+	}
+
+	return &CmdCount[Id];
+}
+
+/*****************************************************************************/
+/* Register accesses of the PLM and of the BSP */
+
+u8 Xil_In8(UINTPTR Addr)
+{
+	return (u8)Replay_Read(Addr, 1U);
+}
+
+u16 Xil_In16(UINTPTR Addr)
+{
+	return (u16)Replay_Read(Addr, 2U);
+}
+
+u32 Xil_In32(UINTPTR Addr)
+{
+	return Replay_Read(Addr, XPLMI_WORD_LEN);
+}
+
+u64 Xil_In64(UINTPTR Addr)
+{
+	return (u64)Replay_Read(Addr, XPLMI_WORD_LEN) |
+		((u64)Replay_Read(Addr + XPLMI_WORD_LEN, XPLMI_WORD_LEN) << 32U);
+}
+
+void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	Replay_Write(Addr, 1U, Value);
+}
+
+void Xil_Out16(UINTPTR Addr, u16 Value)
+{
+	Replay_Write(Addr, 2U, Value);
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	Replay_Write(Addr, XPLMI_WORD_LEN, Value);
+}
+
+void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	Replay_Write(Addr, XPLMI_WORD_LEN, (u32)Value);
+	Replay_Write(Addr + XPLMI_WORD_LEN, XPLMI_WORD_LEN, (u32)(Value >> 32U));
+}
+
+u32 Replay_In32(u64 Addr)
+{
+	return Replay_Read(Addr, XPLMI_WORD_LEN);
+}
+
+u8 Replay_In8(u64 Addr)
+{
+	return (u8)Replay_Read(Addr, 1U);
+}
+
+void Replay_Out32(u64 Addr, u32 Value)
+{
+	Replay_Write(Addr, XPLMI_WORD_LEN, Value);
+}
+
+void Replay_Out8(u64 Addr, u8 Value)
+{
+	Replay_Write(Addr, 1U, Value);
+}
+
+void microblaze_enable_interrupts(void)
+{
+}
+
+void microblaze_disable_interrupts(void)
+{
+}
+
+/*****************************************************************************/
+/* Wrapped PLM functions, counting the accesses of each command */
+
+int __wrap_XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
+{
+	Replay_Count *Prev = CurCount;
+	int Status;
+
+	CurCount = Replay_CmdCount(CmdPtr->CmdId);
+	Status = __real_XPlmi_CmdExecute(CmdPtr);
+	CurCount = Prev;
+
+	return Status;
+}
+
+int __wrap_XPlmi_CmdResume(XPlmi_Cmd *CmdPtr)
+{
+	Replay_Count *Prev = CurCount;
+	int Status;
+
+	CurCount = Replay_CmdCount(CmdPtr->CmdId);
+	Status = __real_XPlmi_CmdResume(CmdPtr);
+	CurCount = Prev;
+
+	return Status;
+}
+
+void __wrap_XPlmi_CdoProfileDump(const char *Frame, u32 PrtnNum)
+{
+	char Leaf[32U];
+	u32 Idx;
+	u32 Id;
+
+	__real_XPlmi_CdoProfileDump(Frame, PrtnNum);
+	for (Idx = 0U; Idx < UsedIdCnt; Idx++) {
+		Id = UsedIds[Idx];
+		(void)snprintf(Leaf, sizeof(Leaf), "mod_%u;cmd_%u",
+			Id >> 8U, Id & 0xFFU);
+		Replay_PrintCount(Frame, PrtnNum, Leaf, &CmdCount[Id]);
+		Replay_AddCount(&TotalCount, &CmdCount[Id]);
+		memset(&CmdCount[Id], 0, sizeof(CmdCount[Id]));
+		IdUsed[Id] = 0U;
+	}
+	UsedIdCnt = 0U;
+	Replay_PrintCount(Frame, PrtnNum, "loader", &LoaderCount);
+	Replay_AddCount(&TotalCount, &LoaderCount);
+	memset(&LoaderCount, 0, sizeof(LoaderCount));
+	Prtns++;
+}
+
+int __wrap_XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue,
+	u32 TimeOutInUs)
+{
+	(void)TimeOutInUs;
+	Replay_Poll(RegAddr, Mask, ExpectedValue);
+
+	return XST_SUCCESS;
+}
+
+int __wrap_XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue,
+	u32 TimeOutInUs)
+{
+	(void)TimeOutInUs;
+	Replay_Poll(RegAddr, Mask, ExpectedValue);
+
+	return XST_SUCCESS;
+}
+
+int __wrap_XPlmi_UtilPollForMask(u32 RegAddr, u32 Mask, u32 TimeOutInUs)
+{
+	(void)TimeOutInUs;
+	Replay_Poll(RegAddr, Mask, Mask);
+
+	return XST_SUCCESS;
+}
+
+int __wrap_XPlmi_UtilPollForMask64(u32 HighAddr, u32 LowAddr, u32 Mask,
+	u32 TimeOutInUs)
+{
+	(void)TimeOutInUs;
+	Replay_Poll(((u64)HighAddr << 32U) | LowAddr, Mask, Mask);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/* PLM functions not compiled into this tool */
+
+int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	Replay_Copy(SrcAddr, DestAddr, Len,
+		(u8)((Flags & XPLMI_DST_CH_AXI_FIXED) != 0U));
+	CurCount->DmaWords += Len;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_DmaSbiXfer(u64 SrcAddr, u32 Len, u32 Flags)
+{
+	(void)SrcAddr;
+	(void)Len;
+	(void)Flags;
+
+	/* The SBI is a boot device, which is not modeled */
+	return XST_FAILURE;
+}
+
+int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+/* The instance is only checked by the loader, the transfers are above */
+XPmcDma *XPlmi_GetDmaInstance(u32 DeviceId)
+{
+	static XPmcDma PmcDma;
+
+	(void)DeviceId;
+
+	return &PmcDma;
+}
+
+int XPlmi_MemCpy64(u64 DestAddr, u64 SrcAddr, u32 Len)
+{
+	Replay_Copy(SrcAddr, DestAddr, Len / XPLMI_WORD_LEN, (u8)FALSE);
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSet(u64 DestAddr, u32 Val, u32 Len)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		Replay_Store(DestAddr + ((u64)Idx * XPLMI_WORD_LEN), Val);
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSetBytes(void *const DestPtr, u32 DestLen, u8 Val, u32 Len)
+{
+	int Status = XST_FAILURE;
+
+	if ((DestPtr != NULL) && (Len <= DestLen)) {
+		memset(DestPtr, Val, Len);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+int XPlmi_InitNVerifyMem(u64 Addr, u32 Len)
+{
+	(void)Addr;
+	(void)Len;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_VerifyAddrRange(u64 StartAddr, u64 EndAddr)
+{
+	(void)StartAddr;
+	(void)EndAddr;
+
+	return XST_SUCCESS;
+}
+
+u64 XPlmi_GetTimerValue(void)
+{
+	/* The PMC timer counts down */
+	return ~Replay_Ns();
+}
+
+void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime)
+{
+	u64 Ns = TCur - XPlmi_GetTimerValue();
+
+	PerfTime->TPerfMs = Ns / REPLAY_NS_PER_MS;
+	PerfTime->TPerfMsFrac = (Ns % REPLAY_NS_PER_MS) / REPLAY_NS_PER_US;
+}
+
+/* Busy wait on the timer as usleep_MB(), a host sleep would overshoot */
+void usleep(ULONG useconds)
+{
+	u64 End = Replay_Ns() + ((u64)useconds * REPLAY_NS_PER_US);
+
+	while (Replay_Ns() < End) {
+		;
+	}
+}
+
+u32 *XPlmi_GetPmcIroFreq(void)
+{
+	return &PmcIroFreq;
+}
+
+XPlmi_CircularBuffer *XPlmi_GetTraceLogInst(void)
+{
+	return &TraceLog;
+}
+
+XPlmi_BoardParams *XPlmi_GetBoardParams(void)
+{
+	return &BoardParams;
+}
+
+void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...)
+{
+	char Msg[REPLAY_MSG_LEN];
+	va_list Args;
+	u32 Idx;
+
+	if ((DebugType & DebugLog->LogLevel) == 0U) {
+		goto END;
+	}
+	va_start(Args, Ctrl1);
+	(void)vsnprintf(Msg, sizeof(Msg), Ctrl1, Args);
+	va_end(Args);
+	/* The messages of the PLM end with "\n\r" */
+	for (Idx = 0U; Msg[Idx] != '\0'; Idx++) {
+		if (Msg[Idx] != '\r') {
+			(void)putchar(Msg[Idx]);
+		}
+	}
+
+END:
+	return;
+}
+
+int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable)
+{
+	(void)UartSelect;
+	(void)UartEnable;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_ErrMgr(int ErrStatus)
+{
+	printf("PLM error 0x%08x\n", (u32)ErrStatus);
+}
+
+int XPlmi_CheckIpiAccess(u32 CmdId, u32 IpiReqType)
+{
+	(void)CmdId;
+	(void)IpiReqType;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_CheckNpiErrors(void)
+{
+	return XST_SUCCESS;
+}
+
+int XPlmi_ClearNpiErrors(void)
+{
+	return XST_SUCCESS;
+}
+
+int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity)
+{
+	(void)NodeId;
+	(void)Periodicity;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_ErrorTaskHandler(void *Data)
+{
+	(void)Data;
+
+	return XST_SUCCESS;
+}
+
+u32 *XPlmi_GetLpdInitialized(void)
+{
+	static u32 LpdInitialized = LPD_INITIALIZED;
+
+	return &LpdInitialized;
+}
+
+u32 XPlmi_GetReadbackLen(u32 Len)
+{
+	return Len;
+}
+
+void XPlmi_GetReadbackSrcDest(u32 SlrType, u64 *SrcAddr, u64 *DestAddrRead)
+{
+	(void)SlrType;
+	(void)SrcAddr;
+	(void)DestAddrRead;
+}
+
+XPlmi_TaskNode *XPlmi_GetTaskByIndex(u32 Index)
+{
+	(void)Index;
+
+	return NULL;
+}
+
+u32 XPlmi_IsSldInitiated(void)
+{
+	return (u32)FALSE;
+}
+
+void XPlmi_PORHandler(void)
+{
+}
+
+void XPlmi_ProcessTamperResponse(u32 TamperResp)
+{
+	(void)TamperResp;
+}
+
+void XPlmi_SetEmSubsystemId(const u32 *Id)
+{
+	(void)Id;
+}
+
+void XPlmi_SetMaxOutCmds(u8 Val)
+{
+	(void)Val;
+}
+
+void XPlmi_SetPlmLiveStatus(void)
+{
+}
+
+void XPlmi_SetPlmMode(u8 Mode)
+{
+	(void)Mode;
+}
+
+int XPlmi_SsitSyncMaster(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitSyncSlaves(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitWaitSlaves(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_SysMonOTDetect(u32 WaitInMSec)
+{
+	(void)WaitInMSec;
+}
+
+/* Boot devices other than DDR */
+int XLoader_SbiInit(u32 DeviceFlags)
+{
+	(void)DeviceFlags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_SbiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
+{
+	(void)SrcAddr;
+	(void)DestAddr;
+	(void)Length;
+	(void)Flags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_SbiRecovery(void)
+{
+	return XST_FAILURE;
+}
+
+int XLoader_QspiInit(u32 DeviceFlags)
+{
+	(void)DeviceFlags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
+{
+	(void)SrcAddr;
+	(void)DestAddr;
+	(void)Length;
+	(void)Flags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_QspiGetBusWidth(u64 ImageOffsetAddress)
+{
+	(void)ImageOffsetAddress;
+
+	return XST_FAILURE;
+}
+
+int XLoader_QspiRelease(void)
+{
+	return XST_FAILURE;
+}
+
+int XLoader_SdInit(u32 DeviceFlags)
+{
+	(void)DeviceFlags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
+{
+	(void)SrcAddr;
+	(void)DestAddr;
+	(void)Length;
+	(void)Flags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_SdRelease(void)
+{
+	return XST_FAILURE;
+}
+
+int XLoader_RawInit(u32 DeviceFlags)
+{
+	(void)DeviceFlags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_RawCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
+{
+	(void)SrcAddr;
+	(void)DestAddr;
+	(void)Length;
+	(void)Flags;
+
+	return XST_FAILURE;
+}
+
+int XLoader_RawRelease(void)
+{
+	return XST_FAILURE;
+}
+
+/* Loader functions of the interrupts, CFrame and JTAG authentication */
+int XLoader_AddAuthJtagToScheduler(void)
+{
+	return XST_SUCCESS;
+}
+
+int XLoader_AuthEncClear(void)
+{
+	return XST_SUCCESS;
+}
+
+int XLoader_CframeDataClearCheck(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+void XLoader_CframeErrorHandler(u32 ImageId)
+{
+	(void)ImageId;
+}
+
+int XLoader_CframeInit(void)
+{
+	return XST_SUCCESS;
+}
+
+int XLoader_IntrInit(void)
+{
+	return XST_SUCCESS;
+}
+
+/* Secure partitions are not supported */
+int XLoader_ImgHdrTblAuth(XLoader_SecureParams *SecurePtr)
+{
+	(void)SecurePtr;
+
+	return XST_FAILURE;
+}
+
+int XLoader_ReadAndVerifySecureHdrs(XLoader_SecureParams *SecurePtr,
+	XilPdi_MetaHdr *MetaHdr)
+{
+	(void)SecurePtr;
+	(void)MetaHdr;
+
+	return XST_FAILURE;
+}
+
+int XLoader_SecureAuthInit(XLoader_SecureParams *SecurePtr,
+	const XilPdi_PrtnHdr *PrtnHdr)
+{
+	(void)SecurePtr;
+
+	return (PrtnHdr->AuthCertificateOfst == 0U) ? XST_SUCCESS : XST_FAILURE;
+}
+
+int XLoader_SecureEncInit(XLoader_SecureParams *SecurePtr,
+	const XilPdi_PrtnHdr *PrtnHdr)
+{
+	(void)SecurePtr;
+
+	return (PrtnHdr->EncStatus == 0U) ? XST_SUCCESS : XST_FAILURE;
+}
+
+int XLoader_SecureValidations(const XLoader_SecureParams *SecurePtr)
+{
+	return (SecurePtr->SecureEn == (u8)FALSE) ? XST_SUCCESS : XST_FAILURE;
+}
+
+void XLoader_UpdateKatStatus(XLoader_SecureParams *SecurePtr, u32 PlmKatMask)
+{
+	(void)SecurePtr;
+	(void)PlmKatMask;
+}
+
+void XLoader_UpdateKekSrc(XilPdi *PdiPtr)
+{
+	(void)PdiPtr;
+}
+
+XSecure_Sha3 *XSecure_GetSha3Instance(void)
+{
+	return NULL;
+}
+
+int XSecure_Sha3Initialize(XSecure_Sha3 *InstancePtr, XPmcDma *DmaPtr)
+{
+	(void)InstancePtr;
+	(void)DmaPtr;
+
+	return XST_FAILURE;
+}
+
+int XSecure_Sha3Start(XSecure_Sha3 *InstancePtr)
+{
+	(void)InstancePtr;
+
+	return XST_FAILURE;
+}
+
+int XSecure_Sha3Update64Bit(XSecure_Sha3 *InstancePtr, u64 InDataAddr,
+	const u32 Size)
+{
+	(void)InstancePtr;
+	(void)InDataAddr;
+	(void)Size;
+
+	return XST_FAILURE;
+}
+
+int XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, XSecure_Sha3Hash *Sha3Hash)
+{
+	(void)InstancePtr;
+	(void)Sha3Hash;
+
+	return XST_FAILURE;
+}
+
+/* PM functions called by the loader, the PM commands are not modeled */
+XStatus XPm_RequestDevice(const u32 SubsystemId, const u32 DeviceId,
+	const u32 Capabilities, const u32 QoS, const u32 Ack,
+	const u32 CmdType)
+{
+	(void)SubsystemId;
+	(void)DeviceId;
+	(void)Capabilities;
+	(void)QoS;
+	(void)Ack;
+	(void)CmdType;
+
+	return XST_SUCCESS;
+}
+
+XStatus XPm_ReleaseDevice(const u32 SubsystemId, const u32 DeviceId,
+	const u32 CmdType)
+{
+	(void)SubsystemId;
+	(void)DeviceId;
+	(void)CmdType;
+
+	return XST_SUCCESS;
+}
+
+XStatus XPm_RequestWakeUp(u32 SubsystemId, const u32 DeviceId,
+	const u32 SetAddress, const u64 Address, const u32 Ack,
+	const u32 CmdType)
+{
+	(void)SubsystemId;
+	(void)DeviceId;
+	(void)SetAddress;
+	(void)Address;
+	(void)Ack;
+	(void)CmdType;
+
+	return XST_SUCCESS;
+}
+
+XStatus XPm_DevIoctl(const u32 SubsystemId, const u32 DeviceId,
+	const pm_ioctl_id IoctlId, const u32 Arg1, const u32 Arg2,
+	const u32 Arg3, u32 *const Response, const u32 CmdType)
+{
+	(void)SubsystemId;
+	(void)DeviceId;
+	(void)IoctlId;
+	(void)Arg1;
+	(void)Arg2;
+	(void)Arg3;
+	(void)CmdType;
+	*Response = 0U;
+
+	return XST_SUCCESS;
+}
+
+XStatus XPm_Query(const u32 Qid, const u32 Arg1, const u32 Arg2,
+	const u32 Arg3, u32 *const Output)
+{
+	(void)Qid;
+	(void)Arg1;
+	(void)Arg2;
+	(void)Arg3;
+	*Output = 0U;
+
+	return XST_SUCCESS;
+}
+
+XStatus XPm_GetDeviceBaseAddr(u32 DeviceId, u32 *BaseAddr)
+{
+	(void)DeviceId;
+	*BaseAddr = 0U;
+
+	return XST_FAILURE;
+}
+
+XStatus XPm_GetDeviceStatus(const u32 SubsystemId, const u32 DeviceId,
+	XPm_DeviceStatus *const DeviceStatus)
+{
+	(void)SubsystemId;
+	(void)DeviceId;
+	memset(DeviceStatus, 0, sizeof(*DeviceStatus));
+
+	return XST_SUCCESS;
+}
+
+XStatus XPmDevice_GetStatus(const u32 SubsystemId, const u32 DeviceId,
+	XPm_DeviceStatus *const DeviceStatus)
+{
+	return XPm_GetDeviceStatus(SubsystemId, DeviceId, DeviceStatus);
+}
+
+u32 XPm_GetSubsystemId(u32 ImageId)
+{
+	(void)ImageId;
+
+	return PM_SUBSYS_PMC;
+}
+
+XStatus XPmSubsystem_Configure(u32 SubsystemId)
+{
+	(void)SubsystemId;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/* Modules of the PLM */
+
+static int Replay_StubHandler(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+/* The modules not compiled into this tool accept any command */
+static void Replay_RegisterStubModules(void)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < REPLAY_STUB_CMDS; Idx++) {
+		StubCmds[Idx].Handler = Replay_StubHandler;
+	}
+	for (Idx = 0U; Idx < XPLMI_MAX_MODULES; Idx++) {
+		if (Modules[Idx] != NULL) {
+			continue;
+		}
+		StubModules[Idx].Id = Idx;
+		StubModules[Idx].CmdAry = StubCmds;
+		StubModules[Idx].CmdCnt = REPLAY_STUB_CMDS;
+		StubModules[Idx].CheckIpiAccess = NULL;
+		XPlmi_ModuleRegister(&StubModules[Idx]);
+	}
+}
+
+/*****************************************************************************/
+/* Sample PDI */
+
+static u32 Sample_Checksum(const u32 *Words, u32 Len)
+{
+	u32 Sum = 0U;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		Sum += Words[Idx];
+	}
+
+	return ~Sum;
+}
+
+static void Sample_Add(Sample_Pdi *Pdi, u32 Word)
+{
+	if (Pdi->Len < SAMPLE_MAX_WORDS) {
+		Pdi->Words[Pdi->Len] = Word;
+	}
+	Pdi->Len++;
+}
+
+static void Sample_Cmd(Sample_Pdi *Pdi, u32 ModuleId, u32 ApiId, u32 Len)
+{
+	Sample_Add(Pdi, (Len << 16U) | (ModuleId << 8U) | ApiId);
+}
+
+static void Sample_Write(Sample_Pdi *Pdi, u32 Addr, u32 Val)
+{
+	Sample_Cmd(Pdi, XPLMI_MODULE_GENERIC_ID, SAMPLE_WRITE, 2U);
+	Sample_Add(Pdi, Addr);
+	Sample_Add(Pdi, Val);
+}
+
+static void Sample_MaskWrite(Sample_Pdi *Pdi, u32 Addr, u32 Mask, u32 Val)
+{
+	Sample_Cmd(Pdi, XPLMI_MODULE_GENERIC_ID, SAMPLE_MASK_WRITE, 3U);
+	Sample_Add(Pdi, Addr);
+	Sample_Add(Pdi, Mask);
+	Sample_Add(Pdi, Val);
+}
+
+static void Sample_MaskPoll(Sample_Pdi *Pdi, u32 Addr, u32 Mask, u32 Val)
+{
+	Sample_Cmd(Pdi, XPLMI_MODULE_GENERIC_ID, SAMPLE_MASK_POLL, 4U);
+	Sample_Add(Pdi, Addr);
+	Sample_Add(Pdi, Mask);
+	Sample_Add(Pdi, Val);
+	Sample_Add(Pdi, 1000U);
+}
+
+/* Starts a CDO, whose length is set by Sample_EndCdo() */
+static u32 Sample_StartCdo(Sample_Pdi *Pdi)
+{
+	u32 Start = Pdi->Len;
+
+	Sample_Add(Pdi, SAMPLE_CDO_HDR_LEN - 1U);
+	Sample_Add(Pdi, SAMPLE_CDO_IDN_WRD);
+	Sample_Add(Pdi, SAMPLE_CDO_VERSION);
+	Sample_Add(Pdi, 0U);
+	Sample_Add(Pdi, 0U);
+
+	return Start;
+}
+
+static void Sample_EndCdo(Sample_Pdi *Pdi, u32 Start)
+{
+	Pdi->Words[Start + 3U] = Pdi->Len - Start - SAMPLE_CDO_HDR_LEN;
+	Pdi->Words[Start + 4U] = Sample_Checksum(&Pdi->Words[Start],
+		SAMPLE_CDO_HDR_LEN - 1U);
+}
+
+/* LPD like CDO: PM requests, register writes, a poll and a DMA write */
+static void Sample_LpdCdo(Sample_Pdi *Pdi)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < 4U; Idx++) {
+		Sample_Cmd(Pdi, SAMPLE_PM_MODULE_ID, SAMPLE_PM_REQUEST_DEVICE, 4U);
+		Sample_Add(Pdi, 0x18224018U + Idx);
+		Sample_Add(Pdi, 0x7U);
+		Sample_Add(Pdi, 0x64U);
+		Sample_Add(Pdi, 0x1U);
+	}
+	for (Idx = 0U; Idx < 16U; Idx++) {
+		Sample_MaskWrite(Pdi, 0xFF5E0000U + (Idx * 4U), 0xFFU, Idx);
+		Sample_Write(Pdi, 0xFF0A0000U + (Idx * 4U), 0x1000U + Idx);
+	}
+	Sample_MaskPoll(Pdi, 0xFF5E0100U, 0x1U, 0x1U);
+	Sample_Cmd(Pdi, XPLMI_MODULE_GENERIC_ID, SAMPLE_DMA_WRITE, 2U + 64U);
+	Sample_Add(Pdi, 0U);
+	Sample_Add(Pdi, 0xFFFC0000U);
+	for (Idx = 0U; Idx < 64U; Idx++) {
+		Sample_Add(Pdi, Idx * 0x01010101U);
+	}
+}
+
+/* PL configuration like CDO: a keyhole write larger than a chunk */
+static void Sample_PlCdo(Sample_Pdi *Pdi)
+{
+	u32 Idx;
+
+	Sample_MaskWrite(Pdi, 0xF12B0000U, 0x3U, 0x3U);
+	Sample_MaskPoll(Pdi, 0xF12B0004U, 0x1U, 0x1U);
+	Sample_Cmd(Pdi, XPLMI_MODULE_GENERIC_ID, SAMPLE_DMA_WRITE_KEYHOLE,
+		SAMPLE_LONG_CMD_LEN);
+	Sample_Add(Pdi, 3U + SAMPLE_KEYHOLE_WORDS);
+	Sample_Add(Pdi, 0U);
+	Sample_Add(Pdi, 0xF6000000U);
+	Sample_Add(Pdi, SAMPLE_KEYHOLE_SIZE / XPLMI_WORD_LEN);
+	for (Idx = 0U; Idx < SAMPLE_KEYHOLE_WORDS; Idx++) {
+		Sample_Add(Pdi, Idx ^ 0xA5A5A5A5U);
+	}
+	Sample_MaskPoll(Pdi, 0xF12B0008U, 0x100U, 0x100U);
+	for (Idx = 0U; Idx < 8U; Idx++) {
+		Sample_Write(Pdi, 0xF12B0100U + (Idx * 4U), Idx);
+	}
+}
+
+/* FPD like CDO: writes and a delay */
+static void Sample_FpdCdo(Sample_Pdi *Pdi)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < 8U; Idx++) {
+		Sample_MaskWrite(Pdi, 0xFD1A0000U + (Idx * 4U), 0x1U, 0x0U);
+	}
+	Sample_Cmd(Pdi, XPLMI_MODULE_GENERIC_ID, SAMPLE_DELAY, 1U);
+	Sample_Add(Pdi, 10U);
+	Sample_MaskPoll(Pdi, 0xFD1A0100U, 0x3U, 0x3U);
+}
+
+/* APU subsystem like CDO: PM requests */
+static void Sample_ApuCdo(Sample_Pdi *Pdi)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < 2U; Idx++) {
+		Sample_Cmd(Pdi, SAMPLE_PM_MODULE_ID, SAMPLE_PM_REQUEST_DEVICE, 4U);
+		Sample_Add(Pdi, 0x1810C003U + Idx);
+		Sample_Add(Pdi, 0x7U);
+		Sample_Add(Pdi, 0x64U);
+		Sample_Add(Pdi, 0x1U);
+	}
+}
+
+static void Sample_Elf(Sample_Pdi *Pdi)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < SAMPLE_ELF_WORDS; Idx++) {
+		Sample_Add(Pdi, 0xD503201FU);
+	}
+}
+
+/* Adds the data of a partition and fills its header */
+static void Sample_Prtn(Sample_Pdi *Pdi, XilPdi_PrtnHdr *PrtnHdr,
+	void (*Data)(Sample_Pdi *Pdi), u32 Attrb, u64 DstnAddr)
+{
+	u32 Start;
+	u32 Cdo = 0U;
+
+	while ((Pdi->Len % 4U) != 0U) {
+		Sample_Add(Pdi, 0U);
+	}
+	Start = Pdi->Len;
+	if ((Attrb & XIH_PH_ATTRB_PRTN_TYPE_MASK) == XIH_PH_ATTRB_PRTN_TYPE_CDO) {
+		Cdo = Sample_StartCdo(Pdi);
+	}
+	Data(Pdi);
+	if ((Attrb & XIH_PH_ATTRB_PRTN_TYPE_MASK) == XIH_PH_ATTRB_PRTN_TYPE_CDO) {
+		Sample_EndCdo(Pdi, Cdo);
+	}
+	memset(PrtnHdr, 0, sizeof(*PrtnHdr));
+	PrtnHdr->EncDataWordLen = Pdi->Len - Start;
+	PrtnHdr->UnEncDataWordLen = Pdi->Len - Start;
+	PrtnHdr->TotalDataWordLen = Pdi->Len - Start;
+	PrtnHdr->DstnLoadAddr = DstnAddr;
+	PrtnHdr->DstnExecutionAddr = DstnAddr;
+	PrtnHdr->DataWordOfst = Start;
+	PrtnHdr->PrtnAttrb = Attrb;
+}
+
+/*
+ * Generates a full PDI of the PLM image and four images: LPD, PL, FPD and
+ * APU subsystem, the last one of a CDO and an ELF partition.
+ */
+static int Sample_Generate(const char *Path)
+{
+	int Status = XST_FAILURE;
+	static const struct {
+		const char *Name;
+		u32 ImgID;
+		u32 NoOfPrtns;
+	} Imgs[SAMPLE_IMGS] = {
+		{"plm", 0x18700000U, 1U},
+		{"lpd", 0x1C000000U, 1U},
+		{"pl_cfi", 0x18700001U, 1U},
+		{"fpd", 0x420C003U, 1U},
+		{"apu_subsystem", 0x1C000003U, 2U},
+	};
+	static void (*const Data[SAMPLE_PRTNS])(Sample_Pdi *Pdi) = {
+		Sample_Elf, Sample_LpdCdo, Sample_PlCdo, Sample_FpdCdo,
+		Sample_ApuCdo, Sample_Elf,
+	};
+	static const u32 Attrb[SAMPLE_PRTNS] = {
+		XIH_PH_ATTRB_PRTN_TYPE_ELF, XIH_PH_ATTRB_PRTN_TYPE_CDO,
+		XIH_PH_ATTRB_PRTN_TYPE_CDO, XIH_PH_ATTRB_PRTN_TYPE_CDO,
+		XIH_PH_ATTRB_PRTN_TYPE_CDO,
+		XIH_PH_ATTRB_PRTN_TYPE_ELF | XIH_PH_ATTRB_DSTN_CPU_A72_0,
+	};
+	Sample_Pdi Pdi;
+	XilPdi_BootHdr *BootHdr;
+	XilPdi_ImgHdrTbl *ImgHdrTbl;
+	XilPdi_ImgHdr *ImgHdr;
+	XilPdi_PrtnHdr *PrtnHdr;
+	u32 Prtn = 0U;
+	u32 Img;
+	u32 Idx;
+	FILE *Fp;
+
+	Pdi.Words = calloc(SAMPLE_MAX_WORDS, sizeof(u32));
+	if (Pdi.Words == NULL) {
+		goto END;
+	}
+	Pdi.Words[0U] = SMAP_BUS_WIDTH_8_WORD1;
+	Pdi.Words[1U] = 0x44332211U;
+	Pdi.Words[2U] = 0x88776655U;
+	Pdi.Words[3U] = 0xCCBBAA99U;
+	BootHdr = (XilPdi_BootHdr *)&Pdi.Words[SMAP_BUS_WIDTH_LENGTH /
+		XPLMI_WORD_LEN];
+	BootHdr->WidthDetection = 0xAA995566U;
+	BootHdr->ImgIden = XIH_BH_IMAGE_IDENT;
+	BootHdr->BootHdrFwRsvd.MetaHdrOfst = SAMPLE_META_HDR_OFST;
+
+	/* The partitions, after the headers */
+	Pdi.Len = SAMPLE_DATA_OFST / XPLMI_WORD_LEN;
+	PrtnHdr = (XilPdi_PrtnHdr *)&Pdi.Words[SAMPLE_PRTN_HDR_OFST /
+		XPLMI_WORD_LEN];
+	for (Img = 0U; Img < SAMPLE_IMGS; Img++) {
+		ImgHdr = (XilPdi_ImgHdr *)&Pdi.Words[(SAMPLE_IMG_HDR_OFST /
+			XPLMI_WORD_LEN) + (Img * XIH_IH_LEN / XPLMI_WORD_LEN)];
+		ImgHdr->FirstPrtnHdr = (SAMPLE_PRTN_HDR_OFST + (Prtn *
+			XIH_PH_LEN)) / XPLMI_WORD_LEN;
+		ImgHdr->NoOfPrtns = Imgs[Img].NoOfPrtns;
+		(void)strncpy((char *)ImgHdr->ImgName, Imgs[Img].Name,
+			sizeof(ImgHdr->ImgName) - 1U);
+		ImgHdr->ImgID = Imgs[Img].ImgID;
+		for (Idx = 0U; Idx < Imgs[Img].NoOfPrtns; Idx++) {
+			Sample_Prtn(&Pdi, &PrtnHdr[Prtn], Data[Prtn], Attrb[Prtn],
+				(Prtn == 0U) ? 0xF0200000U : 0U);
+			if (Pdi.Len > SAMPLE_MAX_WORDS) {
+				goto END;
+			}
+			if ((Prtn + 1U) < SAMPLE_PRTNS) {
+				PrtnHdr[Prtn].NextPrtnOfst = (SAMPLE_PRTN_HDR_OFST +
+					((Prtn + 1U) * XIH_PH_LEN)) / XPLMI_WORD_LEN;
+			}
+			PrtnHdr[Prtn].Checksum = Sample_Checksum(
+				(const u32 *)&PrtnHdr[Prtn],
+				(XIH_PH_LEN / XPLMI_WORD_LEN) - 1U);
+			Prtn++;
+		}
+		ImgHdr->Checksum = Sample_Checksum((const u32 *)ImgHdr,
+			(XIH_IH_LEN / XPLMI_WORD_LEN) - 1U);
+	}
+
+	/* The PLM image is skipped by the loader, only its length matters */
+	BootHdr->DpiSrcOfst = PrtnHdr[0U].DataWordOfst * XPLMI_WORD_LEN;
+	BootHdr->PlmLen = PrtnHdr[0U].TotalDataWordLen * XPLMI_WORD_LEN;
+	BootHdr->TotalPlmLen = BootHdr->PlmLen;
+
+	ImgHdrTbl = (XilPdi_ImgHdrTbl *)&Pdi.Words[SAMPLE_META_HDR_OFST /
+		XPLMI_WORD_LEN];
+	ImgHdrTbl->Version = XLOADER_PDI_VERSION_4;
+	ImgHdrTbl->NoOfImgs = SAMPLE_IMGS;
+	ImgHdrTbl->ImgHdrAddr = SAMPLE_IMG_HDR_OFST / XPLMI_WORD_LEN;
+	ImgHdrTbl->NoOfPrtns = SAMPLE_PRTNS;
+	ImgHdrTbl->PrtnHdrAddr = SAMPLE_PRTN_HDR_OFST / XPLMI_WORD_LEN;
+	ImgHdrTbl->Idcode = SAMPLE_IDCODE;
+	ImgHdrTbl->Rsrvd[1U] = XIH_IHT_FPDI_IDENT_VAL;
+	ImgHdrTbl->ExtIdCode = SAMPLE_EXT_IDCODE;
+	ImgHdrTbl->Checksum = Sample_Checksum((const u32 *)ImgHdrTbl,
+		(XIH_IHT_LEN / XPLMI_WORD_LEN) - 1U);
+
+	Fp = fopen(Path, "wb");
+	if ((Fp == NULL) || (fwrite(Pdi.Words, sizeof(u32), Pdi.Len, Fp) !=
+		Pdi.Len)) {
+		perror(Path);
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+	if (Fp != NULL) {
+		fclose(Fp);
+	}
+
+END:
+	free(Pdi.Words);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/* Replay of a PDI */
+
+static int Replay_Map(u64 Addr, u64 Len)
+{
+	void *Ptr = mmap((void *)(UINTPTR)Addr, Len, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if (Ptr != (void *)(UINTPTR)Addr) {
+		fprintf(stderr, "Can not map 0x%llx\n", (unsigned long long)Addr);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+static int Replay_LoadFile(const char *Path)
+{
+	int Status = XST_FAILURE;
+	FILE *Fp = fopen(Path, "rb");
+	long Len;
+
+	if (Fp == NULL) {
+		perror(Path);
+		goto END;
+	}
+	if ((fseek(Fp, 0L, SEEK_END) != 0) || ((Len = ftell(Fp)) <= 0L) ||
+		((u64)Len > REPLAY_PDI_MAX_LEN) || (fseek(Fp, 0L, SEEK_SET) != 0)) {
+		fprintf(stderr, "%s: invalid PDI length\n", Path);
+		goto END;
+	}
+	/* The loader copies 16 byte aligned lengths */
+	PdiLen = ((u64)Len + XPLMI_PMCRAM_LEN) & ~(XPLMI_PMCRAM_LEN - 1ULL);
+	Status = Replay_Map(REPLAY_PDI_ADDR, PdiLen);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	PdiMem = (u8 *)(UINTPTR)REPLAY_PDI_ADDR;
+	if (fread(PdiMem, 1U, (size_t)Len, Fp) != (size_t)Len) {
+		perror(Path);
+		Status = XST_FAILURE;
+	}
+
+END:
+	if (Fp != NULL) {
+		fclose(Fp);
+	}
+
+	return Status;
+}
+
+static u32 Replay_PdiWord(u64 Ofst)
+{
+	u32 Val = 0U;
+
+	if ((Ofst + XPLMI_WORD_LEN) <= PdiLen) {
+		memcpy(&Val, &PdiMem[Ofst], sizeof(Val));
+	}
+
+	return Val;
+}
+
+/*
+ * Sets the registers read by the loader before the PDI: a monolithic device
+ * with the IDCODE and extended IDCODE of the image header table, and the
+ * boot header of a full PDI copied to PMC RAM as by the ROM.
+ */
+static u8 Replay_SetupDevice(void)
+{
+	u8 PdiType = XLOADER_PDI_TYPE_PARTIAL;
+	u64 IhtOfst = 0U;
+
+	if (Replay_PdiWord(XIH_BH_IMAGE_IDENT_OFFSET) == XIH_BH_IMAGE_IDENT) {
+		PdiType = XLOADER_PDI_TYPE_FULL;
+		memcpy((void *)(UINTPTR)XIH_BH_PRAM_ADDR,
+			&PdiMem[SMAP_BUS_WIDTH_LENGTH], sizeof(XilPdi_BootHdr));
+		IhtOfst = Replay_PdiWord(XIH_BH_META_HDR_OFFSET);
+	}
+	else if (Replay_PdiWord(0U) == SMAP_BUS_WIDTH_8_WORD1) {
+		IhtOfst = SMAP_BUS_WIDTH_LENGTH;
+	}
+	Replay_RegWrite(PMC_TAP_SLR_TYPE, XLOADER_SSIT_MONOLITIC);
+	Replay_RegWrite(PMC_TAP_IDCODE, Replay_PdiWord(IhtOfst +
+		offsetof(XilPdi_ImgHdrTbl, Idcode)));
+	Replay_RegWrite(EFUSE_CACHE_IP_DISABLE_0, ((Replay_PdiWord(IhtOfst +
+		offsetof(XilPdi_ImgHdrTbl, ExtIdCode)) & XIH_IHT_EXT_IDCODE_MASK)
+		<< EFUSE_CACHE_IP_DISABLE_0_EID1_SHIFT) &
+		EFUSE_CACHE_IP_DISABLE_0_EID1_MASK);
+
+	return PdiType;
+}
+
+static int Replay_Pdi(const char *Path, u8 LogLevel)
+{
+	int Status = XST_FAILURE;
+	XilPdi *PdiPtr;
+	u64 Start;
+	u64 Ns;
+
+	Status = Replay_RegInit(&RegModel, REPLAY_MEM_SIZE);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = Replay_Map(XPLMI_PMCRAM_BASEADDR, XPLMI_PMCRAM_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = Replay_LoadFile(Path);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	DebugLog->LogLevel = LogLevel;
+	TraceLog.StartAddr = (u64)(UINTPTR)TraceMem;
+
+	XPlmi_GenericInit();
+	Status = XLoader_Init();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Replay_RegisterStubModules();
+
+	PdiPtr = XLoader_GetPdiInstance();
+	PdiPtr->PdiType = Replay_SetupDevice();
+	PdiPtr->IpiMask = 0U;
+	PdiPtr->ValidHeader = (u8)TRUE;
+	SubsystemPdiIns.ValidHeader = (u8)TRUE;
+	memset(&LoaderCount, 0, sizeof(LoaderCount));
+
+	Start = Replay_Ns();
+	Status = XLoader_LoadPdi(PdiPtr, XLOADER_PDI_SRC_DDR, REPLAY_PDI_ADDR);
+	Ns = Replay_Ns() - Start;
+	if (Status != XST_SUCCESS) {
+		printf("PDI load failed: 0x%08x\n", (u32)Status);
+		goto END;
+	}
+
+	printf("%u partitions: %llu writes, %llu reads, %llu polls, "
+		"%llu poll waits, %llu DMA words\n", Prtns,
+		(unsigned long long)TotalCount.Writes,
+		(unsigned long long)TotalCount.Reads,
+		(unsigned long long)TotalCount.Polls,
+		(unsigned long long)TotalCount.PollWaits,
+		(unsigned long long)TotalCount.DmaWords);
+	printf("PDI load time: %llu.%03llu ms\n",
+		(unsigned long long)(Ns / REPLAY_NS_PER_MS),
+		(unsigned long long)((Ns % REPLAY_NS_PER_MS) / REPLAY_NS_PER_US));
+
+END:
+	return Status;
+}
+
+int main(int argc, char *argv[])
+{
+	int Status = XST_FAILURE;
+	u8 LogLevel = DEBUG_PRINT_ALWAYS | DEBUG_GENERAL;
+
+	if ((argc == 3) && (strcmp(argv[1], "-g") == 0)) {
+		Status = Sample_Generate(argv[2]);
+		goto END;
+	}
+	if ((argc == 3) && (strcmp(argv[1], "-v") == 0)) {
+		LogLevel |= DEBUG_INFO;
+		argv++;
+		argc--;
+	}
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s [-v] <pdi>\n"
+			"       %s -g <pdi>\n", argv[0], argv[0]);
+		return 1;
+	}
+	Status = Replay_Pdi(argv[1], LogLevel);
+
+END:
+	if (Status == XST_SUCCESS) {
+		printf("pdi_replay PASSED\n");
+	} else {
+		printf("pdi_replay FAILED\n");
+	}
+
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1 @@
+/* Host build of xplmi_event_logging.c, no BSP configuration */
@@ -0,0 +1,15 @@
+/* Host build, the 64-bit accesses of the PLM are host pointer accesses */
+#ifndef _MICROBLAZE_INTERFACE_H_
+#define _MICROBLAZE_INTERFACE_H_
+
+#include "xil_types.h"
+
+#define lwea(Addr)		(*(volatile u32 *)(UINTPTR)(Addr))
+#define lbuea(Addr)		(*(volatile u8 *)(UINTPTR)(Addr))
+#define swea(Addr, Data)	(*(volatile u32 *)(UINTPTR)(Addr) = (Data))
+#define sbea(Addr, Data)	(*(volatile u8 *)(UINTPTR)(Addr) = (Data))
+
+void microblaze_enable_interrupts(void);
+void microblaze_disable_interrupts(void);
+
+#endif
@@ -0,0 +1,413 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file plm_trace.c
+*
+* Host decoder for the PLM trace log.
+*
+* The input is a binary dump of the trace log buffer, as copied by the
+* event logging command with sub command 9 (retrieve trace ring) or 6
+* (retrieve trace data), for example saved with "mrd -bin -file" from xsdb.
+* Every record is printed with its time stamp and the message from the event
+* dictionary in xplmi_trace_events.h, which is compiled into this tool. For
+* the events that end a boot phase, the phase duration is printed after the
+* message and a summary of all phases is printed at the end. The events that
+* carry their duration, written with the boot trace option in place of the
+* boot time prints, are printed and summed up the same way.
+*
+* Only trace format 2 is decoded, see xplmi_event_logging.h.
+*
+* Usage: plm_trace [-f <timer Hz>] [-s] <trace dump>
+*	-f	PMC timer frequency, by default the one of the trace start record
+*	-s	Only print the phase summary
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*       kc   10/18/2026 Decode the events carrying their duration
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+/* The PLM headers use the Xilinx integer types */
+typedef uint32_t u32;
+
+typedef struct {
+	u32 Id;
+	u32 StartId;
+	const char *Name;
+	const char *Format;
+} TraceEvent;
+
+#define XPLMI_TRACE_DICTIONARY
+#define XPLMI_TRACE_EVENT(Id, StartId, Format)	{ Id, StartId, #Id, Format },
+static const TraceEvent Dictionary[] = {
+#include "xplmi_trace_events.h"
+};
+#define DICTIONARY_SIZE		(sizeof(Dictionary) / sizeof(Dictionary[0]))
+
+/* Record layout, see xplmi_event_logging.h */
+#define TRACE_MAGIC_MASK	0xFF000000U
+#define TRACE_MAGIC		0xA5000000U
+#define TRACE_LEN(Hdr)		(((Hdr) >> 16) & 0xFFU)
+#define TRACE_ID(Hdr)		((Hdr) & 0xFFFFU)
+#define TRACE_HDR_WORDS		3U
+#define TRACE_MAX_ARGS		8U
+
+#define DEFAULT_TIMER_HZ	400000000U
+#define MAX_OPEN_PHASES		64U
+
+typedef struct {
+	u32 Id;
+	u32 HasArg;
+	u32 Arg;
+	uint64_t Ticks;
+} OpenPhase;
+
+typedef struct {
+	u32 Count;
+	double TotalMs;
+	double MaxMs;
+} PhaseStats;
+
+static OpenPhase Open[MAX_OPEN_PHASES];
+static u32 OpenCnt;
+static PhaseStats Stats[DICTIONARY_SIZE];
+static double TimerHz;
+static int TimerHzFixed;
+static int SummaryOnly;
+
+static const TraceEvent *FindEvent(u32 Id, u32 *Index)
+{
+	u32 i;
+
+	for (i = 0U; i < DICTIONARY_SIZE; i++) {
+		if (Dictionary[i].Id == Id) {
+			if (Index != NULL) {
+				*Index = i;
+			}
+			return &Dictionary[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int IsPhaseStart(u32 Id)
+{
+	u32 i;
+
+	for (i = 0U; i < DICTIONARY_SIZE; i++) {
+		if (Dictionary[i].StartId == Id) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static double TicksToMs(uint64_t Ticks)
+{
+	return ((double)Ticks * 1000.0) / TimerHz;
+}
+
+/*
+ * Checks that the records starting at word Start cover the dump up to its
+ * end. Zero words are the padding the PLM writes before wrapping.
+ */
+static int IsValidChain(const u32 *Words, size_t Count, size_t Start)
+{
+	size_t i = Start;
+	u32 Len;
+
+	while (i < Count) {
+		if (Words[i] == 0U) {
+			i++;
+			continue;
+		}
+		Len = TRACE_LEN(Words[i]);
+		if (((Words[i] & TRACE_MAGIC_MASK) != TRACE_MAGIC) ||
+		    (Len < TRACE_HDR_WORDS) || ((i + Len) > Count)) {
+			return 0;
+		}
+		i += Len;
+	}
+
+	return 1;
+}
+
+/*
+ * Once the ring has wrapped, the oldest record of the dump may have been
+ * partly overwritten. Skip words until the rest of the dump decodes.
+ */
+static size_t FindFirstRecord(const u32 *Words, size_t Count)
+{
+	size_t Start;
+
+	for (Start = 0U; Start < Count; Start++) {
+		if (IsValidChain(Words, Count, Start) != 0) {
+			return Start;
+		}
+	}
+
+	fprintf(stderr, "warning: no valid record chain, decoding from start\n");
+	return 0U;
+}
+
+static void AddPhase(u32 EvIndex, double Ms)
+{
+	Stats[EvIndex].Count++;
+	Stats[EvIndex].TotalMs += Ms;
+	if (Ms > Stats[EvIndex].MaxMs) {
+		Stats[EvIndex].MaxMs = Ms;
+	}
+	if (SummaryOnly == 0) {
+		printf("  (%.3f ms)\n", Ms);
+	}
+}
+
+/* The duration is in the last two argument words, upper word first */
+static void DurationPhase(u32 EvIndex, const u32 *Rec, u32 NumArgs)
+{
+	const u32 *Dur;
+
+	if (NumArgs < 2U) {
+		if (SummaryOnly == 0) {
+			printf("  (no duration)\n");
+		}
+		return;
+	}
+
+	Dur = &Rec[TRACE_HDR_WORDS + NumArgs - 2U];
+	AddPhase(EvIndex, TicksToMs(((uint64_t)Dur[0] << 32) | Dur[1]));
+}
+
+static void EndPhase(const TraceEvent *Ev, u32 EvIndex, const u32 *Args,
+		     u32 NumArgs, uint64_t Ticks)
+{
+	u32 i;
+
+	for (i = OpenCnt; i > 0U; i--) {
+		if ((Open[i - 1U].Id == Ev->StartId) &&
+		    ((Open[i - 1U].HasArg == 0U) ||
+		     ((NumArgs > 0U) && (Open[i - 1U].Arg == Args[0])))) {
+			break;
+		}
+	}
+	if (i == 0U) {
+		if (SummaryOnly == 0) {
+			printf("  (start not in trace)\n");
+		}
+		return;
+	}
+
+	AddPhase(EvIndex, TicksToMs(Ticks - Open[i - 1U].Ticks));
+
+	/* Drop the phase, keeping the order of the others */
+	memmove(&Open[i - 1U], &Open[i], (OpenCnt - i) * sizeof(Open[0]));
+	OpenCnt--;
+}
+
+static void DecodeRecord(const u32 *Rec)
+{
+	u32 Id = TRACE_ID(Rec[0]);
+	u32 NumArgs = TRACE_LEN(Rec[0]) - TRACE_HDR_WORDS;
+	uint64_t Ticks = ((uint64_t)Rec[1] << 32) | Rec[2];
+	u32 Args[TRACE_MAX_ARGS] = {0U};
+	const TraceEvent *Ev;
+	u32 EvIndex = 0U;
+	u32 i;
+
+	for (i = 0U; (i < NumArgs) && (i < TRACE_MAX_ARGS); i++) {
+		Args[i] = Rec[TRACE_HDR_WORDS + i];
+	}
+
+	Ev = FindEvent(Id, &EvIndex);
+	if ((Ev != NULL) && (Ev->Id == XPLMI_TRACE_LOG_START)) {
+		if (Args[0] != XPLMI_TRACE_LOG_VERSION_2) {
+			fprintf(stderr, "warning: trace format %u, expected %u\n",
+				Args[0], XPLMI_TRACE_LOG_VERSION_2);
+		}
+		if ((TimerHzFixed == 0) && (Args[1] != 0U)) {
+			TimerHz = (double)Args[1];
+		}
+		/* Time stamps restart with the timer */
+		OpenCnt = 0U;
+	}
+
+	if (SummaryOnly == 0) {
+		printf("[%12.3f ms] ", TicksToMs(Ticks));
+		if (Ev != NULL) {
+			printf(Ev->Format, Args[0], Args[1], Args[2], Args[3],
+			       Args[4], Args[5], Args[6], Args[7]);
+		} else {
+			printf("event 0x%x", Id);
+			for (i = 0U; i < NumArgs; i++) {
+				printf(" 0x%x", Rec[TRACE_HDR_WORDS + i]);
+			}
+		}
+		if ((Ev == NULL) || (Ev->StartId == 0U)) {
+			printf("\n");
+		}
+	}
+
+	if (Ev == NULL) {
+		return;
+	}
+	if (Ev->StartId == XPLMI_TRACE_LOG_DURATION) {
+		DurationPhase(EvIndex, Rec, NumArgs);
+	} else if (Ev->StartId != 0U) {
+		EndPhase(Ev, EvIndex, Args, NumArgs, Ticks);
+	}
+	if (IsPhaseStart(Id) != 0) {
+		if (OpenCnt == MAX_OPEN_PHASES) {
+			memmove(&Open[0], &Open[1],
+				(MAX_OPEN_PHASES - 1U) * sizeof(Open[0]));
+			OpenCnt--;
+		}
+		Open[OpenCnt].Id = Id;
+		Open[OpenCnt].HasArg = (NumArgs > 0U) ? 1U : 0U;
+		Open[OpenCnt].Arg = Args[0];
+		Open[OpenCnt].Ticks = Ticks;
+		OpenCnt++;
+	}
+}
+
+static void PrintSummary(void)
+{
+	u32 i;
+
+	printf("\n%-36s %6s %12s %12s\n", "Phase", "Count", "Total ms",
+	       "Max ms");
+	for (i = 0U; i < DICTIONARY_SIZE; i++) {
+		if (Stats[i].Count == 0U) {
+			continue;
+		}
+		printf("%-36s %6u %12.3f %12.3f\n", Dictionary[i].Name,
+		       Stats[i].Count, Stats[i].TotalMs, Stats[i].MaxMs);
+	}
+}
+
+static u32 *ReadDump(const char *Path, size_t *Count)
+{
+	FILE *Fp;
+	uint8_t *Bytes;
+	u32 *Words;
+	long Size;
+	size_t i;
+
+	Fp = fopen(Path, "rb");
+	if (Fp == NULL) {
+		perror(Path);
+		return NULL;
+	}
+	fseek(Fp, 0L, SEEK_END);
+	Size = ftell(Fp);
+	fseek(Fp, 0L, SEEK_SET);
+	if (Size <= 0) {
+		fprintf(stderr, "%s: empty trace dump\n", Path);
+		fclose(Fp);
+		return NULL;
+	}
+
+	Bytes = malloc((size_t)Size);
+	Words = malloc(((size_t)Size / 4U + 1U) * sizeof(u32));
+	if ((Bytes == NULL) || (Words == NULL) ||
+	    (fread(Bytes, 1U, (size_t)Size, Fp) != (size_t)Size)) {
+		fprintf(stderr, "%s: read failed\n", Path);
+		free(Bytes);
+		free(Words);
+		fclose(Fp);
+		return NULL;
+	}
+	fclose(Fp);
+
+	/* The dump is in the little endian byte order of the PMC */
+	*Count = (size_t)Size / 4U;
+	for (i = 0U; i < *Count; i++) {
+		Words[i] = (u32)Bytes[4U * i] |
+			((u32)Bytes[(4U * i) + 1U] << 8) |
+			((u32)Bytes[(4U * i) + 2U] << 16) |
+			((u32)Bytes[(4U * i) + 3U] << 24);
+	}
+	free(Bytes);
+
+	return Words;
+}
+
+int main(int argc, char *argv[])
+{
+	u32 *Words;
+	size_t Count;
+	size_t i;
+	u32 Len;
+	int Opt;
+
+	TimerHz = (double)DEFAULT_TIMER_HZ;
+	while ((Opt = getopt(argc, argv, "f:sh")) != -1) {
+		switch (Opt) {
+		case 'f':
+			TimerHz = strtod(optarg, NULL);
+			TimerHzFixed = 1;
+			if (TimerHz <= 0.0) {
+				fprintf(stderr, "invalid timer frequency\n");
+				return 1;
+			}
+			break;
+		case 's':
+			SummaryOnly = 1;
+			break;
+		default:
+			fprintf(stderr,
+				"Usage: %s [-f <timer Hz>] [-s] <trace dump>\n",
+				argv[0]);
+			return (Opt == 'h') ? 0 : 1;
+		}
+	}
+	if (optind >= argc) {
+		fprintf(stderr, "Usage: %s [-f <timer Hz>] [-s] <trace dump>\n",
+			argv[0]);
+		return 1;
+	}
+
+	Words = ReadDump(argv[optind], &Count);
+	if (Words == NULL) {
+		return 1;
+	}
+
+	i = FindFirstRecord(Words, Count);
+	while (i < Count) {
+		if (Words[i] == 0U) {
+			i++;
+			continue;
+		}
+		Len = TRACE_LEN(Words[i]);
+		if (((Words[i] & TRACE_MAGIC_MASK) != TRACE_MAGIC) ||
+		    (Len < TRACE_HDR_WORDS) || ((i + Len) > Count)) {
+			fprintf(stderr, "invalid record at word %zu\n", i);
+			break;
+		}
+		DecodeRecord(&Words[i]);
+		i += Len;
+	}
+
+	PrintSummary();
+	free(Words);
+
+	return 0;
+}
@@ -0,0 +1,241 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file trace_gen.c
+*
+* Host generator of a wrapped PLM trace log dump, with xplmi_event_logging.c
+* compiled into this tool. The PMC timer is replaced by a counter advanced
+* by fixed steps and the trace log buffer by a 256 byte host buffer.
+*
+* The records of a boot with the boot trace option, three images of three
+* partitions each, are written through the trace log functions of the PLM,
+* so that the buffer wraps several times. The buffer is then read with the
+* event logging sub commands 6 (retrieve trace data) and 9 (retrieve trace
+* ring), which must give the same bytes, and saved to the given file.
+* "make check" compares that file with the committed sample_wrapped.bin and
+* the output of plm_trace for it with sample_wrapped.txt.
+*
+* Usage: trace_gen <trace dump>
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "xplmi_event_logging.h"
+#include "xplmi_debug.h"
+#include "xplmi_proc.h"
+#include "xplmi_plat.h"
+#include "xplmi_dma.h"
+
+#define TEST_TRACE_WORDS	64U
+#define TEST_TIMER_HZ		XPLMI_PMC_IRO_FREQ_320_MHZ
+/* Timer ticks in 1 us */
+#define TEST_US			(TEST_TIMER_HZ / 1000000U)
+#define TEST_IMAGES		3U
+#define TEST_PRTNS		3U
+#define TEST_BOOT_MODE		0x2U
+#define TEST_PRTN_BYTES		0x1000U
+
+static u32 TraceMem[TEST_TRACE_WORDS];
+static u32 DataDump[TEST_TRACE_WORDS];
+static u32 RingDump[TEST_TRACE_WORDS];
+static XPlmi_CircularBuffer TraceLog;
+static XPlmi_LogInfo HostDebugLog;
+static u64 TimerValue = (XPLMI_PIT1_CYCLE_VALUE << 32U) |
+	XPLMI_PIT2_CYCLE_VALUE;
+static u32 PmcIroFreq = TEST_TIMER_HZ;
+
+/* PLM functions used by xplmi_event_logging.c */
+XPlmi_CircularBuffer *XPlmi_GetTraceLogInst(void)
+{
+	return &TraceLog;
+}
+
+u64 XPlmi_GetTimerValue(void)
+{
+	return TimerValue;
+}
+
+u32 *XPlmi_GetPmcIroFreq(void)
+{
+	return &PmcIroFreq;
+}
+
+int XPlmi_MemCpy64(u64 DestAddr, u64 SrcAddr, u32 Len)
+{
+	memcpy((void *)(UINTPTR)DestAddr, (const void *)(UINTPTR)SrcAddr, Len);
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_VerifyAddrRange(u64 StartAddr, u64 EndAddr)
+{
+	(void)StartAddr;
+	(void)EndAddr;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable)
+{
+	(void)UartSelect;
+	(void)UartEnable;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...)
+{
+	(void)DebugType;
+	(void)Ctrl1;
+}
+
+static void Test_Elapse(u32 Us)
+{
+	TimerValue -= (u64)Us * TEST_US;
+}
+
+static int Test_EventLogging(u32 SubCmd, u64 Addr, u32 Len, u32 *Resp)
+{
+	int Status;
+	u32 Payload[4U];
+	XPlmi_Cmd Cmd;
+
+	memset(&Cmd, 0, sizeof(Cmd));
+	Payload[0U] = SubCmd;
+	Payload[1U] = (u32)(Addr >> 32U);
+	Payload[2U] = (u32)(Addr & 0xFFFFFFFFU);
+	Payload[3U] = Len;
+	Cmd.Payload = Payload;
+	Cmd.PayloadLen = 4U;
+	Status = XPlmi_EventLogging(&Cmd);
+	if (Resp != NULL) {
+		*Resp = Cmd.Response[1U];
+	}
+
+	return Status;
+}
+
+/* The records written by the PLM for a boot with PLM_BOOT_TRACE */
+static void Test_Boot(void)
+{
+	u64 TStart;
+	u32 Image;
+	u32 Prtn;
+	u32 PrtnNum = 0U;
+	u64 RomTicks = 25000U * TEST_US;
+
+	Test_Elapse(1200U);
+	XPlmi_TraceLog2(XPLMI_TRACE_LOG_PLM_INIT);
+	XPlmi_TraceLog3(XPLMI_TRACE_LOG_BOOT_PDI_START, TEST_BOOT_MODE);
+	TStart = XPlmi_GetTimerValue();
+	Test_Elapse(350U);
+	XPlmi_TraceLogDuration(XPLMI_TRACE_LOG_PDI_INIT, TStart,
+		TEST_BOOT_MODE);
+
+	for (Image = 0U; Image < TEST_IMAGES; Image++) {
+		XPlmi_TraceLog3(XPLMI_TRACE_LOG_LOAD_IMAGE_START,
+			0x18700000U + Image);
+		for (Prtn = 0U; Prtn < TEST_PRTNS; Prtn++) {
+			XPlmi_TraceLog4(XPLMI_TRACE_LOG_LOAD_PRTN_START,
+				PrtnNum, 0x1C000000U + PrtnNum);
+			TStart = XPlmi_GetTimerValue();
+			Test_Elapse(100U * (PrtnNum + 1U));
+			XPlmi_TraceLogDuration(XPLMI_TRACE_LOG_CDO_PROCESS,
+				TStart, PrtnNum);
+			Test_Elapse(20U);
+			XPlmi_TraceLog4(XPLMI_TRACE_LOG_LOAD_PRTN, PrtnNum,
+				TEST_PRTN_BYTES * (PrtnNum + 1U));
+			PrtnNum++;
+		}
+		Test_Elapse(5U);
+		XPlmi_TraceLog3(XPLMI_TRACE_LOG_LOAD_IMAGE,
+			0x18700000U + Image);
+	}
+
+	Test_Elapse(10U);
+	XPlmi_TraceLog4(XPLMI_TRACE_LOG_BOOT_PDI, TEST_BOOT_MODE, XST_SUCCESS);
+	XPlmi_TraceLog5(XPLMI_TRACE_LOG_ROM_TIME, 0U, (u32)(RomTicks >> 32U),
+		(u32)(RomTicks & 0xFFFFFFFFU));
+}
+
+int main(int argc, char *argv[])
+{
+	int Status = XST_FAILURE;
+	FILE *Fp;
+	u32 Len = 0U;
+	u8 Bytes[sizeof(DataDump)];
+
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s <trace dump>\n", argv[0]);
+		return 1;
+	}
+
+	DebugLog = &HostDebugLog;
+	Status = Test_EventLogging(XPLMI_LOGGING_CMD_CONFIG_TRACE_MEM,
+		(u64)(UINTPTR)TraceMem, sizeof(TraceMem), NULL);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Test_Boot();
+	Status = XST_FAILURE;
+
+	/* The boot records are more than the buffer holds */
+	if (TraceLog.IsBufferFull != (u32)TRUE) {
+		printf("trace log did not wrap\n");
+		goto END;
+	}
+	Status = Test_EventLogging(XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA,
+		(u64)(UINTPTR)DataDump, 0U, NULL);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = Test_EventLogging(XPLMI_LOGGING_CMD_RETRIEVE_TRACE_RING,
+		(u64)(UINTPTR)RingDump, sizeof(RingDump), &Len);
+	if ((Status != XST_SUCCESS) || (Len != sizeof(RingDump)) ||
+	    (memcmp(DataDump, RingDump, sizeof(DataDump)) != 0)) {
+		printf("trace data and trace ring differ\n");
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	/* The dump is in the little endian byte order of the PMC */
+	for (Len = 0U; Len < TEST_TRACE_WORDS; Len++) {
+		Bytes[4U * Len] = (u8)DataDump[Len];
+		Bytes[(4U * Len) + 1U] = (u8)(DataDump[Len] >> 8U);
+		Bytes[(4U * Len) + 2U] = (u8)(DataDump[Len] >> 16U);
+		Bytes[(4U * Len) + 3U] = (u8)(DataDump[Len] >> 24U);
+	}
+	Fp = fopen(argv[1], "wb");
+	if ((Fp == NULL) ||
+	    (fwrite(Bytes, 1U, sizeof(Bytes), Fp) != sizeof(Bytes))) {
+		perror(argv[1]);
+		Status = XST_FAILURE;
+	}
+	if (Fp != NULL) {
+		fclose(Fp);
+	}
+
+END:
+	if (Status == XST_SUCCESS) {
+		printf("trace_gen PASSED\n");
+	} else {
+		printf("trace_gen FAILED\n");
+	}
+
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
@@ -39,6 +39,9 @@
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       kpt  07/21/2022 Added XPlmi_GetBootKatStatus
 *       bm   07/22/2022 Shutdown modules gracefully during update
+* 1.09  kc   10/18/2026 Trace boot PDI load start and end
+*       kc   10/18/2026 Trace PLM initialization end and skip the boot time
+*                       prints with PLM_BOOT_TRACE
 *
 * </pre>
 *
@@ -92,6 +95,9 @@ int XPlm_LoadBootPdi(void *Arg)
 		Status = XST_SUCCESS;
 		goto ERR_END;
 	}
+#ifdef PLM_BOOT_TRACE
+	XPlmi_TraceLog2(XPLMI_TRACE_LOG_PLM_INIT);
+#endif
 	XPlmi_Printf(DEBUG_PRINT_PERF, "PLM Initialization Time \n\r");
 
 	/**
@@ -121,13 +127,15 @@ int XPlm_LoadBootPdi(void *Arg)
 	XPlmi_GetBootKatStatus((volatile u32*)&PdiInstPtr->PlmKatStatus);
 #endif
 
-	XPlmi_Printf(DEBUG_GENERAL, "***********Boot PDI Load: Started***********\n\r");
+	XPlmi_Printf(DEBUG_BOOT, "***********Boot PDI Load: Started***********\n\r");
 
 	PdiInstPtr->PdiType = XLOADER_PDI_TYPE_FULL;
 	PdiInstPtr->IpiMask = 0U;
 	PdiInstPtr->ValidHeader = (u8)TRUE;
 	SubsystemPdiIns.ValidHeader = (u8)TRUE;
+	XPlmi_TraceLog3(XPLMI_TRACE_LOG_BOOT_PDI_START, (u32)BootMode);
 	Status = XLoader_LoadPdi(PdiInstPtr, BootMode, 0U);
+	XPlmi_TraceLog4(XPLMI_TRACE_LOG_BOOT_PDI, (u32)BootMode, (u32)Status);
 	if (Status != XST_SUCCESS) {
 		goto ERR_END;
 	}
@@ -139,11 +147,13 @@ int XPlm_LoadBootPdi(void *Arg)
 	}
 #endif
 
-	XPlmi_Printf(DEBUG_GENERAL, "***********Boot PDI Load: Done***********\n\r");
+	XPlmi_Printf(DEBUG_BOOT, "***********Boot PDI Load: Done***********\n\r");
 
 	/** Print ROM time and PLM time stamp */
 	XPlmi_PrintRomTime();
+#ifndef PLM_BOOT_TRACE
 	XPlmi_Printf(DEBUG_PRINT_ALWAYS, "Total PLM Boot Time \n\r");
+#endif
 
 END:
 	/**
@@ -42,6 +42,8 @@
 * 1.08  bm   07/06/2022 Refactor versal and versal_net code
 *       ma   07/29/2022 Replaced XPAR_XIPIPSU_0_DEVICE_ID macro with
 *                       XPLMI_IPI_DEVICE_ID
+* 1.09  kc   10/18/2026 Trace PMC CDO processing start and end
+*       kc   10/18/2026 Skip the PMC CDO time print with PLM_BOOT_TRACE
 *
 * </pre>
 *
@@ -163,7 +165,7 @@ int XPlm_ProcessPmcCdo(void *Arg)
 	int SStatus = XST_FAILURE;
 	XPlmiCdo Cdo;
 	u32 SlrType = XLOADER_SSIT_INVALID_SLR;
-#ifdef PLM_PRINT_PERF_CDO_PROCESS
+#if defined (PLM_PRINT_PERF_CDO_PROCESS) && !defined (PLM_BOOT_TRACE)
 	u64 TaskStartTime;
 	XPlmi_PerfTime PerfTime;
 #endif
@@ -171,7 +173,7 @@ int XPlm_ProcessPmcCdo(void *Arg)
 	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
 	(void )Arg;
 
-#ifdef PLM_PRINT_PERF_CDO_PROCESS
+#if defined (PLM_PRINT_PERF_CDO_PROCESS) && !defined (PLM_BOOT_TRACE)
 	TaskStartTime = XPlmi_GetTimerValue();
 #endif
 
@@ -202,13 +204,15 @@ int XPlm_ProcessPmcCdo(void *Arg)
 	Cdo.BufPtr = (u32 *)XPLMI_PMCRAM_BASEADDR;
 	Cdo.BufLen = XPLMI_PMCRAM_LEN;
 	Cdo.SubsystemId = PM_SUBSYS_PMC;
+	XPlmi_TraceLog2(XPLMI_TRACE_LOG_PMC_CDO_START);
 	Status = XPlmi_ProcessCdo(&Cdo);
+	XPlmi_TraceLog3(XPLMI_TRACE_LOG_PMC_CDO, (u32)Status);
 	if (Status != XST_SUCCESS) {
 		(void)XLoader_SecureClear();
 		goto END;
 	}
 
-#ifdef PLM_PRINT_PERF_CDO_PROCESS
+#if defined (PLM_PRINT_PERF_CDO_PROCESS) && !defined (PLM_BOOT_TRACE)
 	XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
 	XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: PMC CDO processing time\n\r",
 			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
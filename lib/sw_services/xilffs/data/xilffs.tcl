@@ -88,12 +88,14 @@ proc xgen_opts_file {libhandle} {
 	set use_lfn [common::get_property CONFIG.use_lfn $libhandle]
 	set use_mkfs [common::get_property CONFIG.use_mkfs $libhandle]
 	set use_trim [common::get_property CONFIG.use_trim $libhandle]
+	set use_fastseek [common::get_property CONFIG.use_fastseek $libhandle]
 	set enable_multi_partition [common::get_property CONFIG.enable_multi_partition $libhandle]
 	set num_logical_vol [common::get_property CONFIG.num_logical_vol $libhandle]
 	set use_strfunc [common::get_property CONFIG.use_strfunc $libhandle]
 	set set_fs_rpath [common::get_property CONFIG.set_fs_rpath $libhandle]
 	set word_access [common::get_property CONFIG.word_access $libhandle]
 	set use_chmod [common::get_property CONFIG.use_chmod $libhandle]
+	set enable_cache [common::get_property CONFIG.enable_cache $libhandle]
 
 	# do processor specific checks
 	set proc  [hsi::get_sw_processor];
@@ -164,6 +166,31 @@ proc xgen_opts_file {libhandle} {
 		if {$use_trim == true} {
 			puts $file_handle "\#define FILE_SYSTEM_USE_TRIM"
 		}
+		if {$use_fastseek == true} {
+			puts $file_handle "\#define FILE_SYSTEM_USE_FASTSEEK"
+		}
+		if {$enable_cache == true} {
+			set cache_sets [common::get_property CONFIG.cache_sets $libhandle]
+			set cache_ways [common::get_property CONFIG.cache_ways $libhandle]
+			set cache_read_ahead [common::get_property CONFIG.cache_read_ahead $libhandle]
+			if {$cache_sets < 1 || ($cache_sets & ($cache_sets - 1)) != 0} {
+				puts "WARNING : Number of cache sets must be a power of 2\
+						Setting back the number of cache sets to 8\n"
+				set cache_sets 8
+			}
+			if {$cache_ways < 1} {
+				puts "WARNING : Invalid number of cache ways, setting\
+						back to 4\n"
+				set cache_ways 4
+			}
+			if {$cache_read_ahead < 0} {
+				set cache_read_ahead 0
+			}
+			puts $file_handle "\#define FILE_SYSTEM_CACHE"
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_SETS ${cache_sets}U"
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_WAYS ${cache_ways}U"
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_READ_AHEAD ${cache_read_ahead}U"
+		}
 		if {$num_logical_vol > 10} {
 			puts "WARNING : File System supports only up to 10 logical drives\
 					Setting back the num of vol to 10\n"
@@ -0,0 +1,241 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file diskcache_test.c
+*		Host test of the diskio sector cache, with ff.c, ffsystem.c,
+*		diskio.c on the RAM interface and diskcache.c compiled into
+*		this tool.
+*
+*		When built with the cache, the staging buffers are checked
+*		first. Two drives are set up on a media model, the read of drive
+*		0 that fills the read-ahead writes back the dirty sectors of
+*		drive 1, as a task accessing the other drive would. Both drives
+*		must keep their data.
+*
+*		Then a log file is appended to a FAT volume on the RAM disk
+*		with many small writes, some large writes and an f_close after
+*		each record, as data loggers do. The volume is remounted and the
+*		file read back. The RAM disk image is written to the given file,
+*		the images of the cached and uncached builds must be identical.
+*
+*		Usage: diskcache_test <image file>
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.0   kc   10/18/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "ff.h"
+#include "diskio.h"
+#include "diskcache.h"
+
+#define TEST_RECORDS		3000U
+#define TEST_BIG_LEN		9000U
+#define TEST_MEDIA_SECTORS	64U
+
+char RamDisk[RAMFS_SIZE];
+static BYTE Work[FF_MAX_SS];
+static char Big[TEST_BIG_LEN];
+static char ReadBack[TEST_RECORDS * 64U];
+
+#ifdef FILE_SYSTEM_CACHE
+static BYTE Media[DISKCACHE_NUM_DRV][TEST_MEDIA_SECTORS][FF_MAX_SS];
+static u32 SyncOnReadAhead;
+
+static BYTE Pattern(BYTE pdrv, DWORD sector, UINT offset, BYTE gen)
+{
+	return (BYTE)((pdrv * 0x53U) ^ (sector * 7U) ^ offset ^ gen);
+}
+
+static DRESULT MediaRead(BYTE pdrv, BYTE *buff, DWORD sector, UINT count)
+{
+	(void)memcpy(buff, Media[pdrv][sector], count * FF_MAX_SS);
+
+	/* Another task syncs drive 1 while the read-ahead of drive 0 runs */
+	if ((pdrv == 0U) && (count > 1U) && (SyncOnReadAhead != 0U)) {
+		SyncOnReadAhead = 0U;
+		if (disk_cache_sync(1U) != RES_OK) {
+			return RES_ERROR;
+		}
+	}
+
+	return RES_OK;
+}
+
+static DRESULT MediaWrite(BYTE pdrv, const BYTE *buff, DWORD sector,
+		UINT count)
+{
+	(void)memcpy(Media[pdrv][sector], buff, count * FF_MAX_SS);
+	return RES_OK;
+}
+
+static int StageTest(void)
+{
+	BYTE Buff[FF_MAX_SS];
+	BYTE pdrv;
+	DWORD sector;
+	UINT Index;
+
+	for (pdrv = 0U; pdrv < 2U; pdrv++) {
+		for (sector = 0U; sector < TEST_MEDIA_SECTORS; sector++) {
+			for (Index = 0U; Index < FF_MAX_SS; Index++) {
+				Media[pdrv][sector][Index] =
+					Pattern(pdrv, sector, Index, 0U);
+			}
+		}
+		disk_cache_init(pdrv, TEST_MEDIA_SECTORS, MediaRead, MediaWrite);
+	}
+
+	/* A dirty run on drive 1 */
+	for (sector = 10U; sector < 18U; sector++) {
+		for (Index = 0U; Index < FF_MAX_SS; Index++) {
+			Buff[Index] = Pattern(1U, sector, Index, 0xA5U);
+		}
+		if (disk_cache_write(1U, Buff, sector, 1U) != RES_OK) {
+			return -1;
+		}
+	}
+
+	/* Sequential reads of drive 0, the second one reads ahead */
+	SyncOnReadAhead = 1U;
+	for (sector = 0U; sector < 16U; sector++) {
+		if (disk_cache_read(0U, Buff, sector, 1U) != RES_OK) {
+			return -1;
+		}
+		for (Index = 0U; Index < FF_MAX_SS; Index++) {
+			if (Buff[Index] != Pattern(0U, sector, Index, 0U)) {
+				printf("drive 0 sector %u corrupted\n",
+					(unsigned)sector);
+				return -1;
+			}
+		}
+	}
+	if (SyncOnReadAhead != 0U) {
+		printf("no read-ahead\n");
+		return -1;
+	}
+
+	for (sector = 10U; sector < 18U; sector++) {
+		for (Index = 0U; Index < FF_MAX_SS; Index++) {
+			if (Media[1][sector][Index] !=
+				Pattern(1U, sector, Index, 0xA5U)) {
+				printf("drive 1 sector %u corrupted\n",
+					(unsigned)sector);
+				return -1;
+			}
+		}
+	}
+	printf("staging buffers: PASSED\n");
+
+	return 0;
+}
+#endif
+
+static int LogTest(void)
+{
+	FATFS fs;
+	FIL fil;
+	UINT bw;
+	UINT Len;
+	char Line[64];
+	u32 Index;
+	FRESULT rc;
+
+	rc = f_mount(&fs, "0:/", 0U);
+	if (rc == FR_OK) {
+		rc = f_mkfs("0:/", FM_FAT, 0U, Work, sizeof(Work));
+	}
+	for (Index = 0U; (rc == FR_OK) && (Index < TEST_RECORDS); Index++) {
+		rc = f_open(&fil, "0:/log.txt", FA_OPEN_APPEND | FA_WRITE);
+		if (rc != FR_OK) {
+			break;
+		}
+		Len = (UINT)sprintf(Line, "record %06u abcdefghijklmnopqrstuvwxyz\n",
+			Index);
+		rc = f_write(&fil, Line, Len, &bw);
+		if ((rc == FR_OK) && ((Index % 7U) == 0U)) {
+			(void)memset(Big, 'A' + (Index % 26U), sizeof(Big));
+			rc = f_write(&fil, Big, sizeof(Big), &bw);
+		}
+		if (rc == FR_OK) {
+			rc = f_close(&fil);
+		}
+	}
+	if (rc != FR_OK) {
+		printf("log write failed, %d\n", rc);
+		return -1;
+	}
+
+	(void)f_mount(NULL, "0:/", 0U);
+	rc = f_mount(&fs, "0:/", 1U);
+	if (rc == FR_OK) {
+		rc = f_open(&fil, "0:/log.txt", FA_READ);
+	}
+	if (rc == FR_OK) {
+		rc = f_read(&fil, ReadBack, sizeof(ReadBack), &bw);
+		(void)f_close(&fil);
+	}
+	if ((rc != FR_OK) || (memcmp(ReadBack, "record 000000", 13U) != 0)) {
+		printf("log read back failed, %d\n", rc);
+		return -1;
+	}
+	printf("log: %u bytes read back\n", bw);
+
+#ifdef FILE_SYSTEM_CACHE
+	{
+		DISKCACHE_STATS s;
+
+		disk_cache_get_stats(0U, &s);
+		printf("cache: read hits %u misses %u, write hits %u misses %u, "
+			"read-ahead %u, bypass %u, write-backs %u, media "
+			"reads %u writes %u\n", s.ReadHits, s.ReadMisses,
+			s.WriteHits, s.WriteMisses, s.ReadAhead, s.Bypass,
+			s.WriteBacks, s.MediaReads, s.MediaWrites);
+	}
+#endif
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	FILE *fp;
+
+	if (argc < 2) {
+		printf("Usage: %s <image file>\n", argv[0]);
+		return 1;
+	}
+
+#ifdef FILE_SYSTEM_CACHE
+	if (StageTest() != 0) {
+		printf("FAILED\n");
+		return 1;
+	}
+#endif
+	if (LogTest() != 0) {
+		printf("FAILED\n");
+		return 1;
+	}
+
+	fp = fopen(argv[1], "wb");
+	if ((fp == NULL) || (fwrite(RamDisk, RAMFS_SIZE, 1U, fp) != 1U)) {
+		printf("Failed to write %s\n", argv[1]);
+		return 1;
+	}
+	(void)fclose(fp);
+	printf("PASSED\n");
+
+	return 0;
+}
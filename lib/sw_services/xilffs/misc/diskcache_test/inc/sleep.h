@@ -0,0 +1 @@
+/* Host build, not used on the RAM interface */
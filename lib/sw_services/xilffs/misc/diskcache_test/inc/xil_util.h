@@ -0,0 +1,28 @@
+/* Host build, only the secure memory functions used by xilffs */
+#ifndef XIL_UTIL_H
+#define XIL_UTIL_H
+
+#include <string.h>
+#include "xil_types.h"
+#include "xstatus.h"
+
+static inline int Xil_SMemCpy(void *Dest, u32 DestSize, const void *Src,
+		u32 SrcSize, u32 CopyLen)
+{
+	if ((CopyLen > DestSize) || (CopyLen > SrcSize)) {
+		return XST_FAILURE;
+	}
+	(void)memcpy(Dest, Src, CopyLen);
+	return XST_SUCCESS;
+}
+
+static inline int Xil_SMemSet(void *Dest, u32 DestSize, u8 Data, u32 Len)
+{
+	if (Len > DestSize) {
+		return XST_FAILURE;
+	}
+	(void)memset(Dest, Data, Len);
+	return XST_SUCCESS;
+}
+
+#endif
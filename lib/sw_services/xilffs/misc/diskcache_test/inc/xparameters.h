@@ -0,0 +1,21 @@
+/* Host build of xilffs on the RAM interface, see ../diskcache_test.c */
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define FILE_SYSTEM_INTERFACE_RAM
+#define RAMFS_SIZE			(4U * 1024U * 1024U)
+extern char RamDisk[];
+#define RAMFS_START_ADDR		RamDisk
+#define FILE_SYSTEM_USE_MKFS
+#define FILE_SYSTEM_NUM_LOGIC_VOL	2
+#define FILE_SYSTEM_USE_STRFUNC		0
+#define FILE_SYSTEM_SET_FS_RPATH	0
+
+#ifdef DISKCACHE_TEST_CACHE
+#define FILE_SYSTEM_CACHE
+#define FILE_SYSTEM_CACHE_SETS		8U
+#define FILE_SYSTEM_CACHE_WAYS		4U
+#define FILE_SYSTEM_CACHE_READ_AHEAD	8U
+#endif
+
+#endif
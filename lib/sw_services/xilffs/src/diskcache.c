@@ -0,0 +1,656 @@
+/******************************************************************************
+* Copyright (c) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file diskcache.c
+*		This file implements the sector cache of the diskio layer.
+*
+*		The cache is N-way set associative with LRU replacement.
+*		Sector n maps to set (n % FILE_SYSTEM_CACHE_SETS), so that
+*		consecutive sectors spread over all sets. Writes are cached
+*		(write-back) and reach the media when a dirty line is evicted
+*		or on disk_cache_sync, which is called for CTRL_SYNC. Runs of
+*		consecutive dirty sectors are written with a single request.
+*		A read which continues the previous read prefetches the next
+*		FILE_SYSTEM_CACHE_READ_AHEAD sectors.
+*		Requests larger than half of the cache bypass it, cached
+*		copies of the sectors involved are kept coherent.
+*
+*		The cache only talks to the media through the functions given
+*		to disk_cache_init, so it runs unchanged on top of the SD and
+*		the RAM interfaces.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.9   kc   10/18/26 First release
+*       kc   10/18/26 Use a staging buffer per drive
+*
+* </pre>
+*
+* @note		Each drive has its own lines and staging buffer, so different
+*		drives can be accessed from different tasks. Accesses to one
+*		drive, including its partitions, must not run concurrently.
+*
+*		Dirty sectors are lost if the media is removed or the system
+*		is reset before CTRL_SYNC, that is before f_sync or f_close.
+*
+******************************************************************************/
+#include "diskcache.h"
+
+#ifdef FILE_SYSTEM_CACHE
+#include "xil_util.h"
+
+#define DISKCACHE_LINES		(FILE_SYSTEM_CACHE_SETS * FILE_SYSTEM_CACHE_WAYS)
+
+/* Requests with more sectors than this bypass the cache */
+#define DISKCACHE_BYPASS	(((DISKCACHE_LINES / 2U) > 0U) ? \
+					(DISKCACHE_LINES / 2U) : 1U)
+
+/* Staging buffer used for read-ahead and for write-back of dirty runs */
+#define DISKCACHE_STAGE_SECTORS	((FILE_SYSTEM_CACHE_READ_AHEAD > 8U) ? \
+					FILE_SYSTEM_CACHE_READ_AHEAD : 8U)
+
+#define DISKCACHE_SET(sector)	((u32)(sector) & (FILE_SYSTEM_CACHE_SETS - 1U))
+#define DISKCACHE_NO_WAY	(-1)
+
+typedef struct {
+	DWORD Sector;	/* Sector held by the line */
+	u32 Age;		/* Tick of the last access */
+	u8 Valid;
+	u8 Dirty;
+} DISKCACHE_LINE;
+
+typedef struct {
+	DISKCACHE_LINE Line[FILE_SYSTEM_CACHE_SETS][FILE_SYSTEM_CACHE_WAYS];
+	DISKCACHE_READ Read;	/* Media read function */
+	DISKCACHE_WRITE Write;	/* Media write function */
+	DWORD SectorCount;		/* Number of sectors of the media */
+	DWORD NextSector;		/* Sector following the last read */
+	u32 Tick;
+	DISKCACHE_STATS Stats;
+} DISKCACHE;
+
+static DISKCACHE Cache[DISKCACHE_NUM_DRV];
+
+/*
+ * Line data and the staging buffers are DMA targets, keep them cache line
+ * aligned. The staging buffer holds read-ahead and write-back data while the
+ * media request of a drive is in progress, it is not shared across drives.
+ */
+#ifdef __ICCARM__
+#pragma data_alignment = 64
+static BYTE CacheData[DISKCACHE_NUM_DRV][FILE_SYSTEM_CACHE_SETS]
+		[FILE_SYSTEM_CACHE_WAYS][FF_MAX_SS];
+#pragma data_alignment = 64
+static BYTE StageBuff[DISKCACHE_NUM_DRV][DISKCACHE_STAGE_SECTORS * FF_MAX_SS];
+#else
+static BYTE CacheData[DISKCACHE_NUM_DRV][FILE_SYSTEM_CACHE_SETS]
+		[FILE_SYSTEM_CACHE_WAYS][FF_MAX_SS] __attribute__ ((aligned(64)));
+static BYTE StageBuff[DISKCACHE_NUM_DRV][DISKCACHE_STAGE_SECTORS * FF_MAX_SS]
+		__attribute__ ((aligned(64)));
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Looks up a sector in the cache.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+*
+* @return	Way of the set holding the sector or DISKCACHE_NO_WAY
+*
+******************************************************************************/
+static s32 disk_cache_find (BYTE pdrv, DWORD sector)
+{
+	const DISKCACHE_LINE *Line = Cache[pdrv].Line[DISKCACHE_SET(sector)];
+	s32 Way;
+
+	for (Way = 0; Way < (s32)FILE_SYSTEM_CACHE_WAYS; Way++) {
+		if ((Line[Way].Valid != 0U) && (Line[Way].Sector == sector)) {
+			return Way;
+		}
+	}
+
+	return DISKCACHE_NO_WAY;
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks whether a sector is cached and dirty.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+*
+* @return	1 if the sector is dirty, else 0
+*
+******************************************************************************/
+static u8 disk_cache_is_dirty (BYTE pdrv, DWORD sector)
+{
+	s32 Way = disk_cache_find(pdrv, sector);
+
+	if (Way == DISKCACHE_NO_WAY) {
+		return 0U;
+	}
+
+	return Cache[pdrv].Line[DISKCACHE_SET(sector)][Way].Dirty;
+}
+
+/*****************************************************************************/
+/**
+*
+* Allocates a line for a sector which is not cached. The least recently used
+* line of the set is replaced, it is written back first if it is dirty.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+* @param	*way - Returns the way of the allocated line
+*
+* @return
+*		RES_OK		Line allocated, it is not valid yet
+*		RES_ERROR	Write-back of the replaced line failed
+*
+******************************************************************************/
+static DRESULT disk_cache_alloc (BYTE pdrv, DWORD sector, u32 *way)
+{
+	DISKCACHE *Dc = &Cache[pdrv];
+	u32 Set = DISKCACHE_SET(sector);
+	DISKCACHE_LINE *Line = Dc->Line[Set];
+	u32 Victim = 0U;
+	u32 Way;
+	DRESULT res;
+
+	for (Way = 0U; Way < FILE_SYSTEM_CACHE_WAYS; Way++) {
+		if (Line[Way].Valid == 0U) {
+			Victim = Way;
+			break;
+		}
+		if ((Dc->Tick - Line[Way].Age) > (Dc->Tick - Line[Victim].Age)) {
+			Victim = Way;
+		}
+	}
+
+	if (Line[Victim].Valid != 0U) {
+		if (Line[Victim].Dirty != 0U) {
+			Dc->Stats.MediaWrites++;
+			res = Dc->Write(pdrv, CacheData[pdrv][Set][Victim],
+					Line[Victim].Sector, 1U);
+			if (res != RES_OK) {
+				return res;
+			}
+			Dc->Stats.WriteBacks++;
+		}
+		Dc->Stats.Evictions++;
+	}
+
+	Line[Victim].Valid = 0U;
+	Line[Victim].Dirty = 0U;
+	Line[Victim].Sector = sector;
+	*way = Victim;
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Stores a sector read from the media in the cache. Sectors which are already
+* cached are left untouched, the cached copy may be newer than the media.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Sector data
+* @param	sector - Sector number
+*
+* @return
+*		RES_OK		Sector cached
+*		RES_ERROR	Write-back of the replaced line failed
+*
+******************************************************************************/
+static DRESULT disk_cache_fill (BYTE pdrv, const BYTE *buff, DWORD sector)
+{
+	DISKCACHE *Dc = &Cache[pdrv];
+	u32 Set = DISKCACHE_SET(sector);
+	u32 Way;
+	DRESULT res;
+
+	if (disk_cache_find(pdrv, sector) != DISKCACHE_NO_WAY) {
+		return RES_OK;
+	}
+
+	res = disk_cache_alloc(pdrv, sector, &Way);
+	if (res != RES_OK) {
+		return res;
+	}
+
+	(void)Xil_SMemCpy(CacheData[pdrv][Set][Way], FF_MAX_SS, buff, FF_MAX_SS,
+			FF_MAX_SS);
+	Dc->Line[Set][Way].Valid = 1U;
+	Dc->Line[Set][Way].Age = ++Dc->Tick;
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prefetches the sectors following a read if the read continues the previous
+* one. Errors are not reported, the data is read again on demand.
+*
+* @param	pdrv - Drive number
+* @param	sector - Start sector of the read
+* @param	count - Sector count of the read
+*
+******************************************************************************/
+static void disk_cache_read_ahead (BYTE pdrv, DWORD sector, UINT count)
+{
+	DISKCACHE *Dc = &Cache[pdrv];
+	DWORD Next = sector + count;
+	u8 Sequential = (sector == Dc->NextSector) ? 1U : 0U;
+	UINT Cnt = FILE_SYSTEM_CACHE_READ_AHEAD;
+	UINT Index;
+
+	Dc->NextSector = Next;
+
+	if ((Cnt == 0U) || (Sequential == 0U) || (Next >= Dc->SectorCount) ||
+		(disk_cache_find(pdrv, Next) != DISKCACHE_NO_WAY)) {
+		return;
+	}
+
+	if (Cnt > (Dc->SectorCount - Next)) {
+		Cnt = (UINT)(Dc->SectorCount - Next);
+	}
+
+	Dc->Stats.MediaReads++;
+	if (Dc->Read(pdrv, StageBuff[pdrv], Next, Cnt) != RES_OK) {
+		return;
+	}
+
+	for (Index = 0U; Index < Cnt; Index++) {
+		if (disk_cache_find(pdrv, Next + Index) != DISKCACHE_NO_WAY) {
+			continue;
+		}
+		if (disk_cache_fill(pdrv, &StageBuff[pdrv][Index * FF_MAX_SS],
+				Next + Index) != RES_OK) {
+			break;
+		}
+		Dc->Stats.ReadAhead++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Initializes the cache of a drive. Cached data of a previous initialization
+* is dropped without being written, the media may have been replaced.
+*
+* @param	pdrv - Drive number
+* @param	sector_count - Number of sectors of the media
+* @param	read - Media read function
+* @param	write - Media write function
+*
+******************************************************************************/
+void disk_cache_init (
+		BYTE pdrv,
+		DWORD sector_count,
+		DISKCACHE_READ read,
+		DISKCACHE_WRITE write
+)
+{
+	DISKCACHE *Dc;
+
+	if (pdrv >= DISKCACHE_NUM_DRV) {
+		return;
+	}
+
+	Dc = &Cache[pdrv];
+	(void)Xil_SMemSet(Dc, sizeof(*Dc), 0, sizeof(*Dc));
+	Dc->Read = read;
+	Dc->Write = write;
+	Dc->SectorCount = sector_count;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads sectors through the cache.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Read successful
+*		RES_NOTRDY	Cache not initialized
+*		RES_ERROR	Read not successful
+*
+******************************************************************************/
+DRESULT disk_cache_read (
+		BYTE pdrv,
+		BYTE *buff,
+		DWORD sector,
+		UINT count
+)
+{
+	DISKCACHE *Dc;
+	DRESULT res = RES_OK;
+	UINT Index = 0U;
+	UINT Cnt;
+	s32 Way;
+
+	if ((pdrv >= DISKCACHE_NUM_DRV) || (Cache[pdrv].Read == NULL)) {
+		return RES_NOTRDY;
+	}
+	Dc = &Cache[pdrv];
+
+	if (count > DISKCACHE_BYPASS) {
+		Dc->Stats.Bypass += count;
+		Dc->Stats.MediaReads++;
+		res = Dc->Read(pdrv, buff, sector, count);
+		if (res != RES_OK) {
+			return res;
+		}
+		/* Dirty sectors are newer than the media */
+		for (Index = 0U; Index < count; Index++) {
+			Way = disk_cache_find(pdrv, sector + Index);
+			if ((Way != DISKCACHE_NO_WAY) && (Dc->Line[DISKCACHE_SET(
+				sector + Index)][Way].Dirty != 0U)) {
+				(void)Xil_SMemCpy(&buff[Index * FF_MAX_SS], FF_MAX_SS,
+					CacheData[pdrv][DISKCACHE_SET(sector + Index)][Way],
+					FF_MAX_SS, FF_MAX_SS);
+			}
+		}
+	} else {
+		while (Index < count) {
+			Way = disk_cache_find(pdrv, sector + Index);
+			if (Way != DISKCACHE_NO_WAY) {
+				(void)Xil_SMemCpy(&buff[Index * FF_MAX_SS], FF_MAX_SS,
+					CacheData[pdrv][DISKCACHE_SET(sector + Index)][Way],
+					FF_MAX_SS, FF_MAX_SS);
+				Dc->Line[DISKCACHE_SET(sector + Index)][Way].Age =
+						++Dc->Tick;
+				Dc->Stats.ReadHits++;
+				Index++;
+				continue;
+			}
+
+			/* Read the run of missing sectors with one request */
+			Cnt = 1U;
+			while (((Index + Cnt) < count) && (disk_cache_find(pdrv,
+				sector + Index + Cnt) == DISKCACHE_NO_WAY)) {
+				Cnt++;
+			}
+			Dc->Stats.MediaReads++;
+			res = Dc->Read(pdrv, &buff[Index * FF_MAX_SS],
+					sector + Index, Cnt);
+			if (res != RES_OK) {
+				return res;
+			}
+			Dc->Stats.ReadMisses += Cnt;
+
+			while (Cnt > 0U) {
+				res = disk_cache_fill(pdrv, &buff[Index * FF_MAX_SS],
+						sector + Index);
+				if (res != RES_OK) {
+					return res;
+				}
+				Index++;
+				Cnt--;
+			}
+		}
+	}
+
+	disk_cache_read_ahead(pdrv, sector, count);
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes sectors through the cache.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data to be written
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Write successful
+*		RES_NOTRDY	Cache not initialized
+*		RES_ERROR	Write not successful
+*
+******************************************************************************/
+DRESULT disk_cache_write (
+		BYTE pdrv,
+		const BYTE *buff,
+		DWORD sector,
+		UINT count
+)
+{
+	DISKCACHE *Dc;
+	DISKCACHE_LINE *Line;
+	DRESULT res;
+	UINT Index;
+	u32 Set;
+	u32 Way;
+	s32 Found;
+
+	if ((pdrv >= DISKCACHE_NUM_DRV) || (Cache[pdrv].Write == NULL)) {
+		return RES_NOTRDY;
+	}
+	Dc = &Cache[pdrv];
+
+	if (count > DISKCACHE_BYPASS) {
+		Dc->Stats.Bypass += count;
+		Dc->Stats.MediaWrites++;
+		res = Dc->Write(pdrv, buff, sector, count);
+		if (res != RES_OK) {
+			return res;
+		}
+		/* Cached copies now match the media */
+		for (Index = 0U; Index < count; Index++) {
+			Found = disk_cache_find(pdrv, sector + Index);
+			if (Found != DISKCACHE_NO_WAY) {
+				Set = DISKCACHE_SET(sector + Index);
+				(void)Xil_SMemCpy(CacheData[pdrv][Set][Found], FF_MAX_SS,
+					&buff[Index * FF_MAX_SS], FF_MAX_SS, FF_MAX_SS);
+				Dc->Line[Set][Found].Dirty = 0U;
+			}
+		}
+		return RES_OK;
+	}
+
+	for (Index = 0U; Index < count; Index++) {
+		Set = DISKCACHE_SET(sector + Index);
+		Found = disk_cache_find(pdrv, sector + Index);
+		if (Found != DISKCACHE_NO_WAY) {
+			Way = (u32)Found;
+			Dc->Stats.WriteHits++;
+		} else {
+			res = disk_cache_alloc(pdrv, sector + Index, &Way);
+			if (res != RES_OK) {
+				return res;
+			}
+			Dc->Stats.WriteMisses++;
+		}
+
+		Line = &Dc->Line[Set][Way];
+		(void)Xil_SMemCpy(CacheData[pdrv][Set][Way], FF_MAX_SS,
+				&buff[Index * FF_MAX_SS], FF_MAX_SS, FF_MAX_SS);
+		Line->Valid = 1U;
+		Line->Dirty = 1U;
+		Line->Age = ++Dc->Tick;
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes all dirty sectors of a drive to the media. Consecutive dirty sectors
+* are written with a single request.
+*
+* @param	pdrv - Drive number
+*
+* @return
+*		RES_OK		All dirty sectors written
+*		RES_NOTRDY	Cache not initialized
+*		RES_ERROR	Write not successful
+*
+******************************************************************************/
+DRESULT disk_cache_sync (
+		BYTE pdrv
+)
+{
+	DISKCACHE *Dc;
+	const DISKCACHE_LINE *Line;
+	DRESULT res;
+	DWORD First;
+	UINT Cnt;
+	UINT Index;
+	u32 Set;
+	u32 Way;
+	u32 Written;
+	s32 Found;
+
+	if ((pdrv >= DISKCACHE_NUM_DRV) || (Cache[pdrv].Write == NULL)) {
+		return RES_NOTRDY;
+	}
+	Dc = &Cache[pdrv];
+	Dc->Stats.Syncs++;
+
+	/*
+	 * A run is started at a dirty sector whose predecessor is not dirty.
+	 * Runs longer than the staging buffer are completed by the next pass.
+	 */
+	do {
+		Written = 0U;
+		for (Set = 0U; Set < FILE_SYSTEM_CACHE_SETS; Set++) {
+			for (Way = 0U; Way < FILE_SYSTEM_CACHE_WAYS; Way++) {
+				Line = &Dc->Line[Set][Way];
+				if ((Line->Valid == 0U) || (Line->Dirty == 0U)) {
+					continue;
+				}
+				First = Line->Sector;
+				if ((First > 0U) &&
+					(disk_cache_is_dirty(pdrv, First - 1U) != 0U)) {
+					continue;
+				}
+
+				Cnt = 0U;
+				while ((Cnt < DISKCACHE_STAGE_SECTORS) &&
+					(disk_cache_is_dirty(pdrv, First + Cnt) != 0U)) {
+					Found = disk_cache_find(pdrv, First + Cnt);
+					(void)Xil_SMemCpy(&StageBuff[pdrv][Cnt * FF_MAX_SS],
+						FF_MAX_SS, CacheData[pdrv][DISKCACHE_SET(
+						First + Cnt)][Found], FF_MAX_SS, FF_MAX_SS);
+					Cnt++;
+				}
+
+				Dc->Stats.MediaWrites++;
+				res = Dc->Write(pdrv, StageBuff[pdrv], First, Cnt);
+				if (res != RES_OK) {
+					return res;
+				}
+
+				for (Index = 0U; Index < Cnt; Index++) {
+					Found = disk_cache_find(pdrv, First + Index);
+					Dc->Line[DISKCACHE_SET(First + Index)][Found].Dirty = 0U;
+				}
+				Dc->Stats.WriteBacks += Cnt;
+				Written += Cnt;
+			}
+		}
+	} while (Written != 0U);
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops cached sectors without writing them, used when sectors are trimmed.
+*
+* @param	pdrv - Drive number
+* @param	start - First sector
+* @param	end - Last sector
+*
+******************************************************************************/
+void disk_cache_discard (
+		BYTE pdrv,
+		DWORD start,
+		DWORD end
+)
+{
+	DISKCACHE_LINE *Line;
+	u32 Set;
+	u32 Way;
+
+	if (pdrv >= DISKCACHE_NUM_DRV) {
+		return;
+	}
+
+	for (Set = 0U; Set < FILE_SYSTEM_CACHE_SETS; Set++) {
+		for (Way = 0U; Way < FILE_SYSTEM_CACHE_WAYS; Way++) {
+			Line = &Cache[pdrv].Line[Set][Way];
+			if ((Line->Valid != 0U) && (Line->Sector >= start) &&
+				(Line->Sector <= end)) {
+				Line->Valid = 0U;
+				Line->Dirty = 0U;
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the cache statistics of a drive.
+*
+* @param	pdrv - Drive number
+* @param	*stats - Pointer to the statistics to be filled
+*
+******************************************************************************/
+void disk_cache_get_stats (
+		BYTE pdrv,
+		DISKCACHE_STATS *stats
+)
+{
+	if (pdrv >= DISKCACHE_NUM_DRV) {
+		(void)Xil_SMemSet(stats, sizeof(*stats), 0, sizeof(*stats));
+		return;
+	}
+
+	*stats = Cache[pdrv].Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* Clears the cache statistics of a drive.
+*
+* @param	pdrv - Drive number
+*
+******************************************************************************/
+void disk_cache_reset_stats (
+		BYTE pdrv
+)
+{
+	if (pdrv >= DISKCACHE_NUM_DRV) {
+		return;
+	}
+
+	(void)Xil_SMemSet(&Cache[pdrv].Stats, sizeof(Cache[pdrv].Stats), 0,
+			sizeof(Cache[pdrv].Stats));
+}
+#endif /* FILE_SYSTEM_CACHE */
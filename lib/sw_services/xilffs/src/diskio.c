@@ -29,6 +29,9 @@
 *		write files using ADMA2 in polled mode.
 *		The file system can be used to read from and write to an
 *		SD card that is already formatted as FATFS.
+*		If FILE_SYSTEM_CACHE is defined, disk_read and disk_write
+*		go through the sector cache in diskcache.c, for both the SD
+*		and the RAM interface.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -66,6 +69,9 @@
 * 4.5   sk   03/31/21 Maintain discrete global variables for each controller.
 * 4.6   sk   07/20/21 Fixed compilation warning in RAM interface.
 * 4.8   sk   05/05/22 Replace standard lib functions with Xilinx functions.
+* 4.9   kc   10/18/26 Added disk_read_start and disk_read_wait for reads that
+*                     overlap with processing.
+*       kc   10/18/26 Added the optional write-back sector cache.
 *
 * </pre>
 *
@@ -73,6 +79,7 @@
 *
 ******************************************************************************/
 #include "diskio.h"
+#include "diskcache.h"
 #include "ff.h"
 #include "xil_types.h"
 
@@ -82,6 +89,9 @@
 #include "sleep.h"
 #include "xil_printf.h"
 #include "xil_util.h"
+#ifdef FILE_SYSTEM_INTERFACE_SD
+#include "xil_cache.h"
+#endif
 
 #define SD_CD_DELAY		10000U
 #define XSDPS_NUM_INSTANCES	2
@@ -114,8 +124,15 @@ static u32 CardDetect[XSDPS_NUM_INSTANCES];
 static u32 WriteProtect[XSDPS_NUM_INSTANCES];
 static u32 SlotType[XSDPS_NUM_INSTANCES];
 static u8 HostCntrlrVer[XSDPS_NUM_INSTANCES];
+static BYTE *PendBuff[XSDPS_NUM_INSTANCES];	/* Buffer of a started read */
+static u32 PendLen[XSDPS_NUM_INSTANCES];
 #endif
 
+static DRESULT disk_media_read (BYTE pdrv, BYTE *buff, DWORD sector,
+		UINT count);
+static DRESULT disk_media_write (BYTE pdrv, const BYTE *buff, DWORD sector,
+		UINT count);
+
 /*-----------------------------------------------------------------------*/
 /* Get Disk Status							*/
 /*-----------------------------------------------------------------------*/
@@ -300,6 +317,10 @@ DSTATUS disk_initialize (
 	s &= (~STA_NOINIT);
 
 	Stat[pdrv] = s;
+#ifdef FILE_SYSTEM_CACHE
+	disk_cache_init(pdrv, (DWORD)SdInstance[pdrv].SectorCount,
+			disk_media_read, disk_media_write);
+#endif
 #endif
 
 #ifdef FILE_SYSTEM_INTERFACE_RAM
@@ -309,6 +330,9 @@ DSTATUS disk_initialize (
 	/* Clearing No init Status for RAM */
 	s &= (~STA_NOINIT);
 	Stat[pdrv] = s;
+#ifdef FILE_SYSTEM_CACHE
+	disk_cache_init(pdrv, SECTORCNT, disk_media_read, disk_media_write);
+#endif
 #endif
 
 	return s;
@@ -318,11 +342,73 @@ DSTATUS disk_initialize (
 /*-----------------------------------------------------------------------*/
 /* Read Sector(s)							 */
 /*-----------------------------------------------------------------------*/
+/*****************************************************************************/
+/**
+*
+* Reads the media.
+* In case of SD, it reads the SD card using ADMA2 in polled mode.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Read successful
+*		RES_ERROR	Read not successful
+*
+* @note		The drive status is checked by the caller.
+*
+******************************************************************************/
+static DRESULT disk_media_read (
+		BYTE pdrv,	/* Physical drive number (0) */
+		BYTE *buff,	/* Pointer to the data buffer to store read data */
+		DWORD sector,	/* Start sector number (LBA) */
+		UINT count	/* Sector count (1..128) */
+)
+{
+#ifdef FILE_SYSTEM_INTERFACE_SD
+	s32 Status = XST_FAILURE;
+	DWORD LocSector = sector;
+
+	/* Complete a read started by disk_read_start */
+	if (disk_read_wait(pdrv) != RES_OK) {
+		return RES_ERROR;
+	}
+
+	/* Convert LBA to byte address if needed */
+	if ((SdInstance[pdrv].HCS) == 0U) {
+		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+	}
+
+	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
+	if (Status != XST_SUCCESS) {
+		return RES_ERROR;
+	}
+#endif
+
+#ifdef FILE_SYSTEM_INTERFACE_RAM
+	Xil_SMemCpy(buff, count * SECTORSIZE, dataramfs + (sector * SECTORSIZE),
+			count * SECTORSIZE, count * SECTORSIZE);
+	(void)pdrv;
+#endif
+
+#if !defined(FILE_SYSTEM_INTERFACE_SD) && !defined(FILE_SYSTEM_INTERFACE_RAM)
+	(void)pdrv;
+	(void)buff;
+	(void)sector;
+	(void)count;
+#endif
+
+	return RES_OK;
+}
+
 /*****************************************************************************/
 /**
 *
 * Reads the drive
 * In case of SD, it reads the SD card using ADMA2 in polled mode.
+* If the sector cache is enabled, the read is served by the cache.
 *
 * @param	pdrv - Drive number
 * @param	*buff - Pointer to the data buffer to store read data
@@ -345,10 +431,6 @@ DRESULT disk_read (
 )
 {
 	DSTATUS s;
-#ifdef FILE_SYSTEM_INTERFACE_SD
-	s32 Status = XST_FAILURE;
-	DWORD LocSector = sector;
-#endif
 
 	s = disk_status(pdrv);
 
@@ -359,29 +441,132 @@ DRESULT disk_read (
 		return RES_PARERR;
 	}
 
+#ifdef FILE_SYSTEM_CACHE
+	return disk_cache_read(pdrv, buff, sector, count);
+#else
+	return disk_media_read(pdrv, buff, sector, count);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts reading the drive without waiting for the data.
+* In case of SD, the ADMA2 transfer is started and the function returns
+* while the transfer is in progress. disk_read_wait has to be called before
+* the data in buff is used or before the drive is accessed again.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Read started
+*		RES_NOTRDY	Drive not initialized
+*		RES_ERROR	Read could not be started
+*
+* @note		For the RAM interface the data is copied before returning.
+*
+******************************************************************************/
+DRESULT disk_read_start (
+		BYTE pdrv,	/* Physical drive number (0) */
+		BYTE *buff,	/* Pointer to the data buffer to store read data */
+		DWORD sector,	/* Start sector number (LBA) */
+		UINT count	/* Sector count */
+)
+{
 #ifdef FILE_SYSTEM_INTERFACE_SD
+	s32 Status = XST_FAILURE;
+	DWORD LocSector = sector;
+
+	if ((Stat[pdrv] & STA_NOINIT) != 0U) {
+		return RES_NOTRDY;
+	}
+	if (count == 0U) {
+		return RES_PARERR;
+	}
+
+	/* Only one transfer can be in flight per controller */
+	if (disk_read_wait(pdrv) != RES_OK) {
+		return RES_ERROR;
+	}
+
+#ifdef FILE_SYSTEM_CACHE
+	/* The transfer bypasses the cache, the media has to be up to date */
+	if (disk_cache_sync(pdrv) != RES_OK) {
+		return RES_ERROR;
+	}
+#endif
+
 	/* Convert LBA to byte address if needed */
 	if ((SdInstance[pdrv].HCS) == 0U) {
 		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 	}
 
-	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
+	Status = XSdPs_StartReadTransfer(&SdInstance[pdrv], (u32)LocSector,
+			count, buff);
 	if (Status != XST_SUCCESS) {
+		SdInstance[pdrv].IsBusy = FALSE;
 		return RES_ERROR;
 	}
-#endif
 
-#ifdef FILE_SYSTEM_INTERFACE_RAM
-	Xil_SMemCpy(buff, count * SECTORSIZE, dataramfs + (sector * SECTORSIZE),
-			count * SECTORSIZE, count * SECTORSIZE);
+	PendBuff[pdrv] = buff;
+	PendLen[pdrv] = count * SdInstance[pdrv].BlkSize;
+
+	return RES_OK;
+#else
+	return disk_read(pdrv, buff, sector, count);
 #endif
+}
 
-#if !defined(FILE_SYSTEM_INTERFACE_SD) && !defined(FILE_SYSTEM_INTERFACE_RAM)
-	(void)buff;
-	(void)sector;
+/*****************************************************************************/
+/**
+*
+* Waits for the completion of a read started by disk_read_start.
+*
+* @param	pdrv - Drive number
+*
+* @return
+*		RES_OK		Read completed or no read pending
+*		RES_ERROR	Read not successful
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_read_wait (
+		BYTE pdrv	/* Physical drive number (0) */
+)
+{
+#ifdef FILE_SYSTEM_INTERFACE_SD
+	s32 Status;
+
+	if (SdInstance[pdrv].IsBusy == FALSE) {
+		return RES_OK;
+	}
+
+	do {
+		Status = XSdPs_CheckReadTransfer(&SdInstance[pdrv]);
+	} while (Status == XST_DEVICE_BUSY);
+
+	if ((Status == XST_SUCCESS) &&
+		(SdInstance[pdrv].Config.IsCacheCoherent == 0U)) {
+		Xil_DCacheInvalidateRange((INTPTR)PendBuff[pdrv],
+				(INTPTR)PendLen[pdrv]);
+	}
+	PendBuff[pdrv] = NULL;
+	PendLen[pdrv] = 0U;
+
+	if (Status != XST_SUCCESS) {
+		/* Drop the busy state so that the drive can be used again */
+		SdInstance[pdrv].IsBusy = FALSE;
+		return RES_ERROR;
+	}
+#else
+	(void)pdrv;
 #endif
 
-    return RES_OK;
+	return RES_OK;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -405,7 +590,11 @@ DRESULT disk_ioctl (
 
 	switch (cmd) {
 		case (BYTE)CTRL_SYNC :	/* Make sure that no pending write process */
+#ifdef FILE_SYSTEM_CACHE
+			res = disk_cache_sync(pdrv);
+#else
 			res = RES_OK;
+#endif
 			break;
 
 		case (BYTE)GET_SECTOR_COUNT : /* Get number of sectors on the disk (DWORD) */
@@ -419,6 +608,9 @@ DRESULT disk_ioctl (
 			break;
 
 		case (BYTE)CTRL_TRIM :	/* Erase the data */
+#ifdef FILE_SYSTEM_CACHE
+			disk_cache_discard(pdrv, SendBuff[0], SendBuff[1]);
+#endif
 			if ((SdInstance[pdrv].HCS) == 0U) {
 				SendBuff[0] *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 				SendBuff[1] *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
@@ -436,7 +628,11 @@ DRESULT disk_ioctl (
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 	switch (cmd) {
 	case (BYTE)CTRL_SYNC:
+#ifdef FILE_SYSTEM_CACHE
+		res = disk_cache_sync(pdrv);
+#else
 		res = RES_OK;
+#endif
 		break;
 	case (BYTE)GET_BLOCK_SIZE:
 		*(WORD *)buff = BLOCKSIZE;
@@ -491,8 +687,8 @@ DWORD get_fattime (void)
 /*****************************************************************************/
 /**
 *
-* Reads the drive
-* In case of SD, it reads the SD card using ADMA2 in polled mode.
+* Writes the media.
+* In case of SD, it writes the SD card using ADMA2 in polled mode.
 *
 * @param	pdrv - Drive number
 * @param	*buff - Pointer to the data to be written
@@ -500,35 +696,28 @@ DWORD get_fattime (void)
 * @param	count - Sector count
 *
 * @return
-*		RES_OK		Read successful
-*		STA_NOINIT	Drive not initialized
-*		RES_ERROR	Read not successful
+*		RES_OK		Write successful
+*		RES_ERROR	Write not successful
 *
-* @note
+* @note		The drive status is checked by the caller.
 *
 ******************************************************************************/
-DRESULT disk_write (
+static DRESULT disk_media_write (
 	BYTE pdrv,			/* Physical drive nmuber (0..) */
 	const BYTE *buff,	/* Data to be written */
 	DWORD sector,		/* Sector address (LBA) */
 	UINT count			/* Number of sectors to write (1..128) */
 )
 {
-	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
 	DWORD LocSector = sector;
-#endif
 
-	s = disk_status(pdrv);
-	if ((s & STA_NOINIT) != 0U) {
-		return RES_NOTRDY;
-	}
-	if (count == 0U) {
-		return RES_PARERR;
+	/* Complete a read started by disk_read_start */
+	if (disk_read_wait(pdrv) != RES_OK) {
+		return RES_ERROR;
 	}
 
-#ifdef FILE_SYSTEM_INTERFACE_SD
 	/* Convert LBA to byte address if needed */
 	if ((SdInstance[pdrv].HCS) == 0U) {
 		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
@@ -544,12 +733,60 @@ DRESULT disk_write (
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 	Xil_SMemCpy(dataramfs + (sector * SECTORSIZE), count * SECTORSIZE, buff,
 				count * SECTORSIZE, count * SECTORSIZE);
+	(void)pdrv;
 #endif
 
 #if !defined(FILE_SYSTEM_INTERFACE_SD) && !defined(FILE_SYSTEM_INTERFACE_RAM)
+	(void)pdrv;
 	(void)buff;
 	(void)sector;
+	(void)count;
 #endif
 
 	return RES_OK;
 }
+
+/*****************************************************************************/
+/**
+*
+* Writes the drive
+* In case of SD, it writes the SD card using ADMA2 in polled mode.
+* If the sector cache is enabled, the data is written to the cache and
+* reaches the media on eviction or on CTRL_SYNC.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data to be written
+* @param	sector - Sector address
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Write successful
+*		STA_NOINIT	Drive not initialized
+*		RES_ERROR	Write not successful
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_write (
+	BYTE pdrv,			/* Physical drive nmuber (0..) */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address (LBA) */
+	UINT count			/* Number of sectors to write (1..128) */
+)
+{
+	DSTATUS s;
+
+	s = disk_status(pdrv);
+	if ((s & STA_NOINIT) != 0U) {
+		return RES_NOTRDY;
+	}
+	if (count == 0U) {
+		return RES_PARERR;
+	}
+
+#ifdef FILE_SYSTEM_CACHE
+	return disk_cache_write(pdrv, buff, sector, count);
+#else
+	return disk_media_write(pdrv, buff, sector, count);
+#endif
+}
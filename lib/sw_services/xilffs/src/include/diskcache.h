@@ -0,0 +1,94 @@
+/******************************************************************************
+* Copyright (c) 2022 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file diskcache.h
+*		This file contains the interface of the sector cache used by
+*		the diskio layer.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date		Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.9   kc   10/18/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef DISKCACHE_H
+#define DISKCACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "diskio.h"
+#include "ff.h"
+
+#ifdef FILE_SYSTEM_CACHE
+
+/* Number of sets, must be a power of 2 */
+#ifndef FILE_SYSTEM_CACHE_SETS
+#define FILE_SYSTEM_CACHE_SETS		8U
+#endif
+
+/* Number of sectors (ways) per set */
+#ifndef FILE_SYSTEM_CACHE_WAYS
+#define FILE_SYSTEM_CACHE_WAYS		4U
+#endif
+
+/* Sectors read ahead on sequential reads, 0 disables read-ahead */
+#ifndef FILE_SYSTEM_CACHE_READ_AHEAD
+#define FILE_SYSTEM_CACHE_READ_AHEAD	8U
+#endif
+
+/* Number of physical drives with a cache */
+#define DISKCACHE_NUM_DRV		2U
+
+#if ((FILE_SYSTEM_CACHE_SETS & (FILE_SYSTEM_CACHE_SETS - 1U)) != 0U)
+#error "FILE_SYSTEM_CACHE_SETS must be a power of 2"
+#endif
+
+/* Media access functions the cache sits on top of */
+typedef DRESULT (*DISKCACHE_READ)(BYTE pdrv, BYTE *buff, DWORD sector,
+		UINT count);
+typedef DRESULT (*DISKCACHE_WRITE)(BYTE pdrv, const BYTE *buff,
+		DWORD sector, UINT count);
+
+/* Per drive cache statistics, in sectors unless stated otherwise */
+typedef struct {
+	u32 ReadHits;		/* Sectors read from the cache */
+	u32 ReadMisses;		/* Sectors read from the media */
+	u32 WriteHits;		/* Sectors written to a cached sector */
+	u32 WriteMisses;	/* Sectors written to a newly allocated line */
+	u32 ReadAhead;		/* Sectors prefetched on sequential reads */
+	u32 Bypass;			/* Sectors of requests that bypassed the cache */
+	u32 Evictions;		/* Lines replaced */
+	u32 WriteBacks;		/* Dirty sectors written to the media */
+	u32 Syncs;			/* Number of CTRL_SYNC requests */
+	u32 MediaReads;		/* Number of read requests sent to the media */
+	u32 MediaWrites;	/* Number of write requests sent to the media */
+} DISKCACHE_STATS;
+
+void disk_cache_init (BYTE pdrv, DWORD sector_count, DISKCACHE_READ read,
+		DISKCACHE_WRITE write);
+DRESULT disk_cache_read (BYTE pdrv, BYTE *buff, DWORD sector, UINT count);
+DRESULT disk_cache_write (BYTE pdrv, const BYTE *buff, DWORD sector,
+		UINT count);
+DRESULT disk_cache_sync (BYTE pdrv);
+void disk_cache_discard (BYTE pdrv, DWORD start, DWORD end);
+void disk_cache_get_stats (BYTE pdrv, DISKCACHE_STATS *stats);
+void disk_cache_reset_stats (BYTE pdrv);
+
+#endif /* FILE_SYSTEM_CACHE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISKCACHE_H */
@@ -139,6 +139,8 @@
 *       dc   07/27/2022 Added goto END in error case for header failures
 *       ma   08/08/2022 Check EAM errors between each image load
 *       ng   18/08/2022 Modified DelayedHandoffCpus condition to handle all possible values
+*       kc   10/18/2026 Trace image load start
+*       kc   10/18/2026 Trace PDI initialization with PLM_BOOT_TRACE
 *
 * </pre>
 *
@@ -307,7 +309,9 @@ int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSrc, u64 PdiAddr)
 	volatile int Status = XST_FAILURE;
 	u32 RegVal = XPlmi_In32(PMC_GLOBAL_PMC_MULTI_BOOT);
 	u64 PdiInitTime = XPlmi_GetTimerValue();
+#ifndef PLM_BOOT_TRACE
 	XPlmi_PerfTime PerfTime;
+#endif
 	u8 DeviceFlags = (u8)(PdiSrc & XLOADER_PDISRC_FLAGS_MASK);
 	u32 SdRawBootVal = RegVal & XLOADER_SD_RAWBOOT_MASK;
 	const char *RawString = "";
@@ -361,7 +365,7 @@ int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSrc, u64 PdiAddr)
 		(DeviceOps[PdiPtr->PdiIndex].Init == NULL)) {
 		goto END1;
 	}
-	XPlmi_Printf(DEBUG_GENERAL, "Loading PDI from %s%s\n\r",
+	XPlmi_Printf(DEBUG_BOOT, "Loading PDI from %s%s\n\r",
 		PdiSourceMap[DeviceFlags].Name, RawString);
 	/*
 	 * Update PDI Ptr with source and address
@@ -371,7 +375,7 @@ int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSrc, u64 PdiAddr)
 		PMC_TAP_SLR_TYPE_VAL_MASK);
 	if ((PdiPtr->SlrType == XLOADER_SSIT_MASTER_SLR) ||
 		(PdiPtr->SlrType == XLOADER_SSIT_MONOLITIC)) {
-		XPlmi_Printf(DEBUG_GENERAL, "Monolithic/Master Device\n\r");
+		XPlmi_Printf(DEBUG_BOOT, "Monolithic/Master Device\n\r");
 
 		Status = DeviceOps[PdiPtr->PdiIndex].Init(PdiSrc);
 		if (Status != XST_SUCCESS) {
@@ -400,10 +404,15 @@ END1:
 		PdiPtr->PdiSrc);
 	Status = XPlmi_UpdateStatus(XLOADER_UNSUPPORTED_BOOT_MODE, 0);
 END:
+#ifdef PLM_BOOT_TRACE
+	XPlmi_TraceLogDuration(XPLMI_TRACE_LOG_PDI_INIT, PdiInitTime,
+		(u32)PdiSrc);
+#else
 	XPlmi_MeasurePerfTime(PdiInitTime, &PerfTime);
 	XPlmi_Printf(DEBUG_PRINT_PERF,
 		"%u.%03u ms: PDI initialization time\n\r",
 		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
 	return Status;
 }
 
@@ -1216,6 +1225,9 @@ static int XLoader_LoadImage(XilPdi *PdiPtr)
 	volatile int Status = XST_FAILURE;
 	u32 NodeId = NODESUBCLASS(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 
+	XPlmi_TraceLog3(XPLMI_TRACE_LOG_LOAD_IMAGE_START,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
+
 #ifdef XPLM_SEM
 	/* Stop the SEM scan before PL load */
 	if ((PdiPtr->PdiType != XLOADER_PDI_TYPE_FULL) &&
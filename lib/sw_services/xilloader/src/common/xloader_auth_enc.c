@@ -88,6 +88,8 @@
 *       bsv  07/08/22 Changes related to Optional data in Image header table
 *       kpt  07/24/22 Added support to go into secure lockdown when KAT fails
 *       kpt  08/03/22 Added volatile keyword to avoid compiler optimization of loop redundancy checks
+* 1.05  kc   10/18/26 Start the second chunk copy as soon as the first block
+*                     no longer needs chunk memory 1
 *
 * </pre>
 *
@@ -2019,6 +2021,14 @@ static int XLoader_AesDecryption(XLoader_SecureParams *SecurePtr,
 		if ((Status != XST_SUCCESS) || (StatusTmp != XST_SUCCESS)) {
 			goto END;
 		}
+		/*
+		 * Key is loaded, so the AC and PUF data in chunk memory 1 are not
+		 * needed anymore. Overlap the next chunk copy with decryption.
+		 */
+		Status = XLoader_StartDeferredChunkCopy(SecurePtr);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
 		SrcOffset += XLOADER_SECURE_HDR_TOTAL_SIZE;
 		ChunkSize = ChunkSize - XLOADER_SECURE_HDR_TOTAL_SIZE;
 	}
@@ -3383,6 +3393,15 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 					XLoader_VerifyAuthHashNUpdateNext,
 					SecurePtr, TotalSize, Last);
 
+		if ((SecurePtr->IsEncrypted != (u8)TRUE) &&
+			(SecureTempParams->IsEncrypted != (u8)TRUE)) {
+			/* Authentication certificate is not needed anymore */
+			Status = XLoader_StartDeferredChunkCopy(SecurePtr);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
 		if (((SecurePtr->IsEncrypted != (u8)TRUE) &&
 			(SecureTempParams->IsEncrypted != (u8)TRUE)) &&
 			(SecurePtr->IsCdo != (u8)TRUE)) {
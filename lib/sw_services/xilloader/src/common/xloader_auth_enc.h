@@ -48,6 +48,7 @@
 *       kpt  07/05/2022 Added support to update KAT status
 *       ma   07/08/22 Removed EFUSE_CACHE_MISC_CTRL as it is defined in xplmi_hw.h
 *       kpt  07/24/22 Added XLoader_RsaPssSignVerify to support KAT for versal net
+* 1.04  kc   10/18/26 Added deferred next chunk copy parameters
 *
 * </pre>
 *
@@ -454,6 +455,9 @@ typedef struct XLoader_SecureParams {
 	u32 RemainingDataLen;	/**< Remaining data length */
 	u32 RemainingEncLen;	/**< Remaining encrypted data length */
 	u32 BlockNum;		/**< Block number */
+	u64 DeferredCopyAddr;	/**< Source of the next chunk copy deferred
+				  * while processing the first block */
+	u32 DeferredCopyLen;	/**< Length of the deferred copy, 0 if none */
 	u32 Sha3Hash[XLOADER_SHA3_LEN / 4U];	/**< SHA3 hash */
 	u32 SecureHdrLen;	/**< Secure header length */
 	XPmcDma *PmcDmaInstPtr;	/**< PMC DMA instance pointer */
@@ -90,6 +90,10 @@
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       dc   07/19/2022 Added support for data measurement in VersalNet
 *       bm   07/24/2022 Set PlmLiveStatus during boot time
+* 1.10  kc   10/18/2026 Use the ping-pong chunk copy for SD/eMMC boot modes
+*       kc   10/18/2026 Print the CDO profile of each partition
+*       kc   10/18/2026 Trace partition load start and end
+*       kc   10/18/2026 Trace the boot messages with PLM_BOOT_TRACE
 *
 * </pre>
 *
@@ -144,11 +148,13 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 {
 	int Status = XST_FAILURE;
 	u32 PrtnIndex;
+#ifndef PLM_BOOT_TRACE
 	u64 PrtnLoadTime;
 	XPlmi_PerfTime PerfTime;
+#endif
 
 	if ((PdiPtr->CopyToMem == (u8)FALSE) && (PdiPtr->DelayLoad == (u8)FALSE)) {
-		XPlmi_Printf(DEBUG_GENERAL,
+		XPlmi_Printf(DEBUG_BOOT,
 			"+++Loading Image#: 0x%0x, Name: %s, Id: 0x%08x\n\r",
 			PdiPtr->ImageNum,
 			(char *)PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgName,
@@ -156,14 +162,14 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 	}
 	else {
 		if (PdiPtr->DelayLoad == (u8)TRUE) {
-			XPlmi_Printf(DEBUG_GENERAL,
+			XPlmi_Printf(DEBUG_BOOT,
 				"+++Skipping Image#: 0x%0x, Name: %s, Id: 0x%08x\n\r",
 				PdiPtr->ImageNum,
 				(char *)PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgName,
 				PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 		}
 		if (PdiPtr->CopyToMem == (u8)TRUE) {
-			XPlmi_Printf(DEBUG_GENERAL,
+			XPlmi_Printf(DEBUG_BOOT,
 				"+++Copying Image#: 0x%0x, Name: %s, Id: 0x%08x\n\r",
 				PdiPtr->ImageNum,
 				(char *)PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgName,
@@ -185,24 +191,28 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 		}
 
 		if ((PdiPtr->CopyToMem == (u8)FALSE) && (PdiPtr->DelayLoad == (u8)FALSE)) {
-			XPlmi_Printf(DEBUG_GENERAL, "---Loading Partition#: 0x%0x, "
+			XPlmi_Printf(DEBUG_BOOT, "---Loading Partition#: 0x%0x, "
 					"Id: 0x%0x\r\n", PdiPtr->PrtnNum,
 					PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId);
 		}
 		else {
 			if (PdiPtr->DelayLoad == (u8)TRUE) {
-				XPlmi_Printf(DEBUG_GENERAL, "---Skipping Partition#: 0x%0x, "
+				XPlmi_Printf(DEBUG_BOOT, "---Skipping Partition#: 0x%0x, "
 						"Id: 0x%0x\r\n", PdiPtr->PrtnNum,
 						PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId);
 			}
 			if (PdiPtr->CopyToMem == (u8)TRUE) {
-				XPlmi_Printf(DEBUG_GENERAL, "---Copying Partition#: 0x%0x, "
+				XPlmi_Printf(DEBUG_BOOT, "---Copying Partition#: 0x%0x, "
 						"Id: 0x%0x\r\n", PdiPtr->PrtnNum,
 						PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId);
 			}
 		}
 
+#ifndef PLM_BOOT_TRACE
 		PrtnLoadTime = XPlmi_GetTimerValue();
+#endif
+		XPlmi_TraceLog4(XPLMI_TRACE_LOG_LOAD_PRTN_START, PdiPtr->PrtnNum,
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId);
 		/* Prtn Hdr Validation */
 		Status = XLoader_PrtnHdrValidation(
 				&(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]), PdiPtr->PrtnNum);
@@ -222,12 +232,22 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
+		XPlmi_TraceLog4(XPLMI_TRACE_LOG_LOAD_PRTN, PdiPtr->PrtnNum,
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen *
+			XPLMI_WORD_LEN);
+#ifndef PLM_BOOT_TRACE
 		XPlmi_MeasurePerfTime(PrtnLoadTime, &PerfTime);
 		XPlmi_Printf(DEBUG_PRINT_PERF,
 			" %u.%03u ms for Partition#: 0x%0x, Size: %u Bytes\n\r",
 			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, PdiPtr->PrtnNum,
 			(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen) *
 			XPLMI_WORD_LEN);
+#endif
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+		XPlmi_CdoProfileDump(
+			(const char *)PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgName,
+			PdiPtr->PrtnNum);
+#endif
 
 		++PdiPtr->PrtnNum;
 		if (XPlmi_NpiOutOfReset() == (u8)TRUE) {
@@ -377,7 +397,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	u64 CdoProcessTimeStart;
 	u64 CdoProcessTimeEnd;
 	u64 CdoProcessTime = 0U;
+#ifndef PLM_BOOT_TRACE
 	XPlmi_PerfTime PerfTime;
+#endif
 #endif
 
 	XPlmi_Printf(DEBUG_INFO, "Processing CDO partition \n\r");
@@ -397,11 +419,12 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	if ((SecureParams->SecureEn == (u8)FALSE) &&
 		(SecureTempParams->SecureEn == (u8)FALSE) &&
 		(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
-		if ((PdiPtr->PdiIndex == XLOADER_SD_INDEX) ||
-			(PdiPtr->PdiIndex == XLOADER_SD_RAW_INDEX)) {
-			ChunkLen = XLOADER_CHUNK_SIZE;
-		}
-		else {
+		/*
+		 * SD/eMMC copies are overlapped with CDO processing through the
+		 * ping-pong chunks, keyhole data is staged in PMC RAM for them
+		 */
+		if ((PdiPtr->PdiIndex != XLOADER_SD_INDEX) &&
+			(PdiPtr->PdiIndex != XLOADER_SD_RAW_INDEX)) {
 			Cdo.Cmd.KeyHoleParams.Func = PdiPtr->MetaHdr.DeviceCopy;
 		}
 	}
@@ -548,11 +571,16 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 
 END:
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
+#ifdef PLM_BOOT_TRACE
+	XPlmi_TraceLogDuration(XPLMI_TRACE_LOG_CDO_PROCESS,
+		(XPlmi_GetTimerValue() + CdoProcessTime), PdiPtr->PrtnNum);
+#else
 	XPlmi_MeasurePerfTime((XPlmi_GetTimerValue() + CdoProcessTime),
 				&PerfTime);
 	XPlmi_Printf(DEBUG_PRINT_PERF,
 			"%u.%03u ms Cdo Processing time\n\r",
 			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
 #endif
 	return Status;
 }
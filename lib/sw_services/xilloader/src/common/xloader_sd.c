@@ -41,6 +41,8 @@
 * 1.07  skg  06/20/2022 Fixed MISRA C Rule 10.3 violation
 *       skg  06/20/2022 Fixed MISRA C Rule 7.4 violation
 *       bm   07/06/2022 Refactor versal and versal_net code
+* 1.08  kc   10/18/2026 Overlap SD/eMMC reads of the next chunk with the
+*                       processing of the current chunk
 *
 * </pre>
 *
@@ -54,8 +56,10 @@
 #if defined(XLOADER_SD_0) || defined(XLOADER_SD_1)
 #include "xparameters.h"
 #include "ff.h"
+#include "diskio.h"
 #include "xplmi_generic.h"
 #include "xil_util.h"
+#include "xil_cache.h"
 #include "xpm_api.h"
 #include "xpm_nodeid.h"
 #include "xplmi.h"
@@ -64,6 +68,19 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/*
+ * State of a copy started with XPLMI_DEVICE_COPY_STATE_INITIATE. The block
+ * aligned part of the copy is in flight, the trailing bytes are read when
+ * the copy is completed with XPLMI_DEVICE_COPY_STATE_WAIT_DONE.
+ */
+typedef struct {
+	u64 SrcAddr;	/**< Source address of the trailing bytes */
+	u64 DestAddr;	/**< Destination address of the trailing bytes */
+	u32 Length;	/**< Number of trailing bytes */
+	u64 XfrAddr;	/**< Destination address of the transfer in flight */
+	u32 XfrLen;	/**< Length of the transfer in flight */
+	u8 IsStarted;	/**< TRUE if a transfer is in flight */
+} XLoader_SdAsyncCopy;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SD_SRC_FILENAME_SIZE1		(9U)
@@ -72,6 +89,14 @@
 /************************** Function Prototypes ******************************/
 static int XLoader_MakeSdFileName(u32 MultiBootOffset);
 static u8 XLoader_GetDrvNumSD(u8 DeviceFlags);
+static int XLoader_SdReadFile(u64 SrcAddr, u64 DestAddr, u32 Length);
+static int XLoader_SdStartCopy(u64 SrcAddr, u64 DestAddr, u32 Length);
+static int XLoader_SdWaitCopy(void);
+#if (FF_USE_FASTSEEK == 1)
+static u8 XLoader_SdGetSector(u64 Offset, u32 Length, DWORD *Sector);
+#endif
+static int XLoader_RawStartCopy(u64 SrcAddr, u64 DestAddr, u32 Length);
+static int XLoader_RawWaitCopy(void);
 
 /************************** Variable Definitions *****************************/
 static FIL FFil;		/* File object */
@@ -80,6 +105,10 @@ static char BootFile[XLOADER_BASE_FILE_NAME_LEN_SD + 1U] = {'\0'};
 static u32 SdCdnVal = 0U;
 static u32 SdCdnReg = 0U;
 static u32 SdDeviceNode;
+static XLoader_SdAsyncCopy SdAsyncCopy;
+#if (FF_USE_FASTSEEK == 1)
+static DWORD SdClmt[XLOADER_SD_CLMT_SIZE];	/* Cluster link map table */
+#endif
 
 /*****************************************************************************/
 /**
@@ -267,12 +296,226 @@ int XLoader_SdInit(u32 DeviceFlags)
 		(void)f_unmount(BootFile);
 		goto END;
 	}
+	SdAsyncCopy.IsStarted = (u8)FALSE;
+
+#if (FF_USE_FASTSEEK == 1)
+	/*
+	 * Map the clusters of the boot file so that file offsets can be
+	 * translated to sectors without walking the FAT. Reads which are not
+	 * covered by the map fall back to f_read.
+	 */
+	SdClmt[0U] = XLOADER_SD_CLMT_SIZE;
+	FFil.cltbl = SdClmt;
+	Rc = f_lseek(&FFil, CREATE_LINKMAP);
+	if (Rc != FR_OK) {
+		XLoader_Printf(DEBUG_INFO, "SD: Link map not created: %d\n\r", Rc);
+		FFil.cltbl = NULL;
+	}
+#endif
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads data from the boot file to a 32-bit
+ * destination address.
+ *
+ * @param	SrcAddr is the offset in the boot file
+ * @param	DestAddr is the destination address
+ * @param	Length is the number of bytes to be read
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_SdReadFile(u64 SrcAddr, u64 DestAddr, u32 Length)
+{
+	int Status = XST_FAILURE;
+	FRESULT Rc;
+	UINT Br = 0U;
+
+	Rc = f_lseek(&FFil, (FSIZE_t)SrcAddr);
+	if (Rc != FR_OK) {
+		XLoader_Printf(DEBUG_INFO, "SD: Unable to seek to 0x%0x%08x\n",
+				(SrcAddr >> 32U), (u32)SrcAddr);
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_LSEEK, (int)Rc);
+		XLoader_Printf(DEBUG_GENERAL,"XLOADER_ERR_SD_F_LSEEK\n\r");
+		goto END;
+	}
+
+	Rc = f_read(&FFil, (void*)(UINTPTR)DestAddr, Length, &Br);
+	if (Rc != FR_OK) {
+		XLoader_Printf(DEBUG_GENERAL, "SD: f_read returned %d\r\n", Rc);
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_READ, (int)Rc);
+		XLoader_Printf(DEBUG_GENERAL, "XLOADER_ERR_SD_F_READ\n\r");
+		goto END;
+	}
 	Status = XST_SUCCESS;
 
 END:
 	return Status;
 }
 
+#if (FF_USE_FASTSEEK == 1)
+/*****************************************************************************/
+/**
+ * @brief	This function translates an offset in the boot file to a
+ * sector of the drive using the cluster link map table.
+ *
+ * @param	Offset is the sector aligned offset in the boot file
+ * @param	Length is the number of bytes starting at Offset
+ * @param	Sector is used to return the sector number
+ *
+ * @return	TRUE if the range is contiguous on the drive, else FALSE
+ *
+ *****************************************************************************/
+static u8 XLoader_SdGetSector(u64 Offset, u32 Length, DWORD *Sector)
+{
+	u8 IsContiguous = (u8)FALSE;
+	const FATFS *Fs = FFil.obj.fs;
+	const DWORD *Tbl = &FFil.cltbl[1U];
+	u32 ClstSize = (u32)Fs->csize * XLOADER_SD_RAW_BLK_SIZE;
+	DWORD Clst = (DWORD)(Offset / ClstSize);
+	DWORD LastClst = (DWORD)((Offset + Length - 1U) / ClstSize);
+
+	/* Each fragment is a cluster count followed by its first cluster */
+	while (Tbl[0U] != 0U) {
+		if (Clst < Tbl[0U]) {
+			if (LastClst < Tbl[0U]) {
+				*Sector = Fs->database +
+					((Tbl[1U] + Clst - 2U) * Fs->csize) +
+					(DWORD)((Offset % ClstSize) /
+					XLOADER_SD_RAW_BLK_SIZE);
+				IsContiguous = (u8)TRUE;
+			}
+			break;
+		}
+		Clst -= Tbl[0U];
+		LastClst -= Tbl[0U];
+		Tbl = &Tbl[2U];
+	}
+
+	return IsContiguous;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the copy of data from the boot file. If
+ * the sector aligned part of the data is contiguous on the drive, its
+ * transfer is started and left in flight. Otherwise nothing is done here and
+ * the data is read by XLoader_SdCopy when the copy is completed.
+ *
+ * @param	SrcAddr is the offset in the boot file
+ * @param	DestAddr is the destination address
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_SdStartCopy(u64 SrcAddr, u64 DestAddr, u32 Length)
+{
+	int Status = XST_FAILURE;
+#if (FF_USE_FASTSEEK == 1)
+	DRESULT Res;
+	DWORD Sector = 0U;
+	u32 HeadLen = (u32)(SrcAddr % XLOADER_SD_RAW_BLK_SIZE);
+	u32 NumBlocks;
+	u32 TrfLen;
+
+	if (HeadLen != 0U) {
+		HeadLen = XLOADER_SD_RAW_BLK_SIZE - HeadLen;
+	}
+
+	if ((FFil.cltbl == NULL) || ((DestAddr >> 32U) != 0U) ||
+		(Length <= HeadLen) || (Length > XLOADER_SD_CHUNK_SIZE) ||
+		((SrcAddr + Length) > f_size(&FFil)) ||
+		(((DestAddr + HeadLen) % XPLMI_WORD_LEN) != 0U)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	NumBlocks = (Length - HeadLen) / XLOADER_SD_RAW_BLK_SIZE;
+	if ((NumBlocks == 0U) || (XLoader_SdGetSector(SrcAddr + HeadLen,
+		NumBlocks * XLOADER_SD_RAW_BLK_SIZE, &Sector) != (u8)TRUE)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/* Unaligned head is read right away */
+	if (HeadLen != 0U) {
+		Status = XLoader_SdReadFile(SrcAddr, DestAddr, HeadLen);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		SrcAddr += HeadLen;
+		DestAddr += HeadLen;
+		Length -= HeadLen;
+	}
+
+	Res = disk_read_start(FFil.obj.fs->pdrv, (BYTE *)(UINTPTR)DestAddr,
+		Sector, NumBlocks);
+	if (Res != RES_OK) {
+		XLoader_Printf(DEBUG_GENERAL, "SD: disk_read_start returned %d\r\n",
+				Res);
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_READ, (int)FR_DISK_ERR);
+		goto END;
+	}
+
+	/* Trailing bytes are read once the transfer is done */
+	TrfLen = NumBlocks * XLOADER_SD_RAW_BLK_SIZE;
+	SdAsyncCopy.SrcAddr = SrcAddr + TrfLen;
+	SdAsyncCopy.DestAddr = DestAddr + TrfLen;
+	SdAsyncCopy.Length = Length - TrfLen;
+	SdAsyncCopy.IsStarted = (u8)TRUE;
+	Status = XST_SUCCESS;
+#else
+	(void)SrcAddr;
+	(void)DestAddr;
+	(void)Length;
+	Status = XST_SUCCESS;
+#endif
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function completes the copy started by
+ * XLoader_SdStartCopy. It waits for the transfer in flight and reads the
+ * trailing bytes which are not a multiple of the sector size.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_SdWaitCopy(void)
+{
+	int Status = XST_FAILURE;
+	DRESULT Res;
+
+	SdAsyncCopy.IsStarted = (u8)FALSE;
+	Res = disk_read_wait(FFil.obj.fs->pdrv);
+	if (Res != RES_OK) {
+		XLoader_Printf(DEBUG_GENERAL, "SD: disk_read_wait returned %d\r\n",
+				Res);
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_READ, (int)FR_DISK_ERR);
+		goto END;
+	}
+
+	if (SdAsyncCopy.Length == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+	Status = XLoader_SdReadFile(SdAsyncCopy.SrcAddr, SdAsyncCopy.DestAddr,
+		SdAsyncCopy.Length);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to copy the data from SD/eMMC to
@@ -283,8 +526,10 @@ END:
  * @param 	DestAddr is the address of the destination where it
  * 		should copy to
  * @param	Length of the bytes to be copied
- * @param	Flags are unused and only passed to maintain compatibility without
- *		the copy functions of other boot modes
+ * @param	Flags carry the device copy state. With
+ *		XPLMI_DEVICE_COPY_STATE_INITIATE the copy is started and the
+ *		function returns while it is in progress, it is completed by
+ *		the next call with XPLMI_DEVICE_COPY_STATE_WAIT_DONE
  *
  * @return	XST_SUCCESS on success and error code on failure
  *
@@ -296,9 +541,18 @@ int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	UINT Br = 0U;
 	u32 TrfLen;
 	u64 DestOffset = 0U;
+	u32 CopyState = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
 
-	if (Flags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
-		Status = XST_SUCCESS;
+	if (SdAsyncCopy.IsStarted == (u8)TRUE) {
+		Status = XLoader_SdWaitCopy();
+		if ((Status != XST_SUCCESS) ||
+			(CopyState == XPLMI_DEVICE_COPY_STATE_WAIT_DONE)) {
+			goto END;
+		}
+	}
+
+	if (CopyState == XPLMI_DEVICE_COPY_STATE_INITIATE) {
+		Status = XLoader_SdStartCopy(SrcAddr, DestAddr, Length);
 		goto END;
 	}
 
@@ -370,6 +624,10 @@ END:
 	int Status = XST_FAILURE;
 	FRESULT Rc;
 
+	if (SdAsyncCopy.IsStarted == (u8)TRUE) {
+		(void)XLoader_SdWaitCopy();
+	}
+
 	Rc = f_close(&FFil);
 	if (Rc != FR_OK) {
 		XLoader_Printf(DEBUG_INFO, "SD: Unable to close file\n\r");
@@ -421,6 +679,7 @@ int XLoader_RawInit(u32 DeviceFlags)
 			(int)XLOADER_ERR_MEMSET_SD_INSTANCE);
 		goto END;
 	}
+	SdAsyncCopy.IsStarted = (u8)FALSE;
 	if ((XLoader_IsPdiSrcSD0(PdiSrc) == (u8)TRUE) ||
 		(PdiSrc == XLOADER_PDI_SRC_EMMC0)) {
 		SdDeviceNode = PM_DEV_SDIO_0;
@@ -506,6 +765,140 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function starts the copy of data in raw boot mode. The
+ * unaligned head of the data is read right away, the transfer of the block
+ * aligned part is started and left in flight.
+ *
+ * @param	SrcAddr is the address of the SD flash where copy should
+ * 		start from
+ * @param	DestAddr is the address of the destination where it
+ * 		should copy to
+ * @param	Length of the bytes to be copied
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_RawStartCopy(u64 SrcAddr, u64 DestAddr, u32 Length)
+{
+	int Status = XST_FAILURE;
+	u8 ReadBuffer[XLOADER_SD_RAW_BLK_SIZE];
+	u8* ReadBuffPtr;
+	u32 HeadLen = (u32)(SrcAddr % XLOADER_SD_RAW_BLK_SIZE);
+	u32 NumBlocks;
+	u32 TrfLen;
+
+	if (HeadLen != 0U) {
+		HeadLen = XLOADER_SD_RAW_BLK_SIZE - HeadLen;
+	}
+
+	/* Copies which can not be overlapped are done by XLoader_RawCopy */
+	if ((Length <= HeadLen) || (Length > XLOADER_SD_CHUNK_SIZE) ||
+		(((DestAddr + HeadLen) % XPLMI_WORD_LEN) != 0U)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+	NumBlocks = (Length - HeadLen) / XLOADER_SD_RAW_BLK_SIZE;
+	if (NumBlocks == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	if (HeadLen != 0U) {
+		SdInstance.Dma64BitAddr = 0U;
+		Status = XSdPs_ReadPolled(&SdInstance,
+			(u32)(SrcAddr / XLOADER_SD_RAW_BLK_SIZE), 1U, ReadBuffer);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XPlmi_DmaXfr(
+			(u64)(UINTPTR)&ReadBuffer[XLOADER_SD_RAW_BLK_SIZE - HeadLen],
+			DestAddr, (HeadLen >> XPLMI_WORD_LEN_SHIFT), XPLMI_PMCDMA_0);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		SrcAddr += HeadLen;
+		DestAddr += HeadLen;
+		Length -= HeadLen;
+	}
+
+	if ((DestAddr >> 32U) == 0U) {
+		SdInstance.Dma64BitAddr = 0U;
+		ReadBuffPtr = (u8 *)(UINTPTR)(DestAddr);
+	}
+	else {
+		SdInstance.Dma64BitAddr = DestAddr;
+		ReadBuffPtr = NULL;
+	}
+	Status = XSdPs_StartReadTransfer(&SdInstance,
+		(u32)(SrcAddr / XLOADER_SD_RAW_BLK_SIZE), NumBlocks, ReadBuffPtr);
+	if (Status != XST_SUCCESS) {
+		/* Busy state is set even if the transfer could not be started */
+		SdInstance.IsBusy = FALSE;
+		goto END;
+	}
+
+	/* Trailing bytes are read once the transfer is done */
+	TrfLen = NumBlocks * XLOADER_SD_RAW_BLK_SIZE;
+	SdAsyncCopy.XfrAddr = DestAddr;
+	SdAsyncCopy.XfrLen = TrfLen;
+	SdAsyncCopy.SrcAddr = SrcAddr + TrfLen;
+	SdAsyncCopy.DestAddr = DestAddr + TrfLen;
+	SdAsyncCopy.Length = Length - TrfLen;
+	SdAsyncCopy.IsStarted = (u8)TRUE;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function completes the copy started by
+ * XLoader_RawStartCopy. It waits for the transfer in flight and reads the
+ * trailing bytes which are not a multiple of the block size.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_RawWaitCopy(void)
+{
+	int Status = XST_FAILURE;
+	u8 ReadBuffer[XLOADER_SD_RAW_BLK_SIZE];
+
+	SdAsyncCopy.IsStarted = (u8)FALSE;
+	do {
+		Status = XSdPs_CheckReadTransfer(&SdInstance);
+	} while (Status == XST_DEVICE_BUSY);
+	if (Status != XST_SUCCESS) {
+		SdInstance.IsBusy = FALSE;
+		goto END;
+	}
+
+	if ((SdInstance.Config.IsCacheCoherent == 0U) &&
+		((SdAsyncCopy.XfrAddr >> 32U) == 0U)) {
+		Xil_DCacheInvalidateRange((INTPTR)SdAsyncCopy.XfrAddr,
+			(INTPTR)SdAsyncCopy.XfrLen);
+	}
+
+	if (SdAsyncCopy.Length == 0U) {
+		goto END;
+	}
+	SdInstance.Dma64BitAddr = 0U;
+	Status = XSdPs_ReadPolled(&SdInstance,
+		(u32)(SdAsyncCopy.SrcAddr / XLOADER_SD_RAW_BLK_SIZE), 1U,
+		ReadBuffer);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XPlmi_DmaXfr((u64)(UINTPTR)&ReadBuffer[0U],
+		SdAsyncCopy.DestAddr,
+		(SdAsyncCopy.Length >> XPLMI_WORD_LEN_SHIFT), XPLMI_PMCDMA_0);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to copy the data from SD/eMMC to
@@ -516,8 +909,10 @@ END:
  * @param	DestAddr is the address of the destination where it
  * 		should copy to
  * @param	Length of the bytes to be copied
- * @param	Flags param is unused and is only included for compliance with
- * 		other device boot modes
+ * @param	Flags carry the device copy state. With
+ *		XPLMI_DEVICE_COPY_STATE_INITIATE the copy is started and the
+ *		function returns while it is in progress, it is completed by
+ *		the next call with XPLMI_DEVICE_COPY_STATE_WAIT_DONE
  *
  * @return	XST_SUCCESS on success and error code on failure
  *
@@ -531,9 +926,18 @@ int XLoader_RawCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u64 StartBlock = SrcAddr / XLOADER_SD_RAW_BLK_SIZE;
 	u32 TrfLen;
 	u32 NumBlocks;
+	u32 CopyState = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
 
-	if (Flags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
-		Status = XST_SUCCESS;
+	if (SdAsyncCopy.IsStarted == (u8)TRUE) {
+		Status = XLoader_RawWaitCopy();
+		if ((Status != XST_SUCCESS) ||
+			(CopyState == XPLMI_DEVICE_COPY_STATE_WAIT_DONE)) {
+			goto END;
+		}
+	}
+
+	if (CopyState == XPLMI_DEVICE_COPY_STATE_INITIATE) {
+		Status = XLoader_RawStartCopy(SrcAddr, DestAddr, Length);
 		goto END;
 	}
 
@@ -630,6 +1034,10 @@ int XLoader_RawRelease(void)
 {
 	int Status = XST_FAILURE;
 
+	if (SdAsyncCopy.IsStarted == (u8)TRUE) {
+		(void)XLoader_RawWaitCopy();
+	}
+
 	XPlmi_Out32(SdCdnReg, SdCdnVal);
 	Status = XPm_ReleaseDevice(PM_SUBSYS_PMC, SdDeviceNode,
 		XPLMI_CMD_SECURE);
@@ -34,6 +34,7 @@
 *       bsv  10/13/2020 Code clean up
 * 1.04  bm   12/15/2020 Removed XLOADER_SD_MAX_BOOT_FILES_LIMIT macro
 * 1.05  bsv  08/31/2021 Code clean up
+* 1.06  kc   10/18/2026 Added XLOADER_SD_CLMT_SIZE macro
 *
 * </pre>
 *
@@ -69,6 +70,8 @@ extern "C" {
 #define XLOADER_SD_RAW_BLK_SIZE			(512U)
 #define XLOADER_SD_CHUNK_SIZE		(0x200000U)
 #define XLOADER_NUM_SECTORS		(0x1000U)
+#define XLOADER_SD_CLMT_SIZE		(32U) /**< Cluster link map table size
+						in DWORDs, maps up to 15 fragments */
 
 /************************** Function Prototypes ******************************/
 int XLoader_SdInit(u32 DeviceFlags);
@@ -113,6 +113,8 @@
 *       bsv  02/14/22 Added comments for better readability
 *       kpt  02/18/22 Fixed copy to memory issue
 * 1.09  bm   07/06/22 Refactor versal and versal_net code
+* 1.10  kc   10/18/26 Start the second chunk copy during the first block
+*                     once chunk memory 1 is free
 *
 * </pre>
 *
@@ -204,12 +206,12 @@ int XLoader_SecureInit(XLoader_SecureParams *SecurePtr, XilPdi *PdiPtr,
 	 * instead of PPU1 RAM. What this means is that while processing
 	 * first chunk of any partition, the second 32K chunk of PMC RAM
 	 * starting from 0xf2008120 contains authentication certificate and
-	 * PufData as applicable. This means second chunk of partition
-	 * must get loaded at 0xf2000020 and not at 0xf2008120. This means
-	 * double buffering would be disabled when first chunk is processed
-	 * and only enabled from second chunk onwards. Third chunk gets loaded
-	 * at 0xf2008120 and from then on chunks get loaded alternatively to
-	 * the two 32KB chunks of PMC RAM. */
+	 * PufData as applicable. So the second chunk copy to 0xf2008120 is
+	 * only started once they are not needed anymore, see
+	 * XLoader_SecureChunkCopy. If it is not started while the first chunk
+	 * is processed, second chunk gets loaded at 0xf2000020 and third chunk
+	 * at 0xf2008120. From then on chunks get loaded alternatively to the
+	 * two 32KB chunks of PMC RAM. */
 	SecurePtr->NextChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
 	SecurePtr->BlockNum = 0x00U;
 	SecurePtr->ProcessedLen = 0x00U;
@@ -666,6 +668,8 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 {
 	int Status = XST_FAILURE;
 	u8 Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+	const XLoader_SecureTempParams *SecureTempParams = XLoader_GetTempParams();
+	u32 NextLen;
 
 	if (SecurePtr->IsNextChunkCopyStarted == (u8)TRUE) {
 		SecurePtr->IsNextChunkCopyStarted = (u8)FALSE;
@@ -683,25 +687,64 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 	/* The below if condition is important, it has been added since
          * authentication certificate and Puf data are now stored in PMC RAM
          * instead of PPU1 RAM. What this means is that while processing
-         * first chunk of any partition, the second 32K chunk of PMC RAM
-         * starting from 0xf2008120 contains authentication certificate and
-         * PufData as applicable. This means second chunk of partition
-         * must get loaded at 0xf2000020 and not at 0xf2008120. This means
-         * double buffering should be disabled when first chunk is processed
-         * and only enabled from second chunk onwards. Third chunk gets loaded
-         * at 0xf2008120 and from then on chunks alternatively get loaded to
-	 * the two 32KB chunks of PMC RAM. */
-
-	if ((Last != (u8)TRUE) && (SecurePtr->BlockNum != 0U) &&
+         * first chunk of an authenticated or encrypted partition, the second
+         * 32K chunk of PMC RAM starting from 0xf2008120 contains
+         * authentication certificate and PufData as applicable. So the copy
+         * of the second chunk to 0xf2008120 is only recorded here and started
+         * by XLoader_StartDeferredChunkCopy once the first block is
+         * authenticated and the AES key is loaded, which overlaps it with the
+         * decryption of the first block. From then on chunks alternatively
+         * get loaded to the two 32KB chunks of PMC RAM. */
+	SecurePtr->DeferredCopyLen = 0U;
+	if ((Last != (u8)TRUE) &&
 	((SecurePtr->DmaFlags & XPLMI_PMCDMA_0) != XPLMI_PMCDMA_0)) {
-		Status = XLoader_StartNextChunkCopy(SecurePtr,
-					(SecurePtr->RemainingDataLen - TotalSize),
+		NextLen = SecurePtr->RemainingDataLen - TotalSize;
+		if ((SecurePtr->BlockNum != 0U) ||
+			((SecurePtr->SecureEn != (u8)TRUE) &&
+			(SecureTempParams->SecureEn != (u8)TRUE))) {
+			Status = XLoader_StartNextChunkCopy(SecurePtr, NextLen,
 					SrcAddr + TotalSize, BlockSize);
+		}
+		else {
+			SecurePtr->DeferredCopyAddr = SrcAddr + TotalSize;
+			if (NextLen <= BlockSize) {
+				SecurePtr->DeferredCopyLen = NextLen;
+			}
+			else {
+				SecurePtr->DeferredCopyLen = BlockSize;
+			}
+		}
 	}
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief	This function starts the second chunk copy recorded by
+* XLoader_SecureChunkCopy while processing the first block. It must only be
+* called once the authentication certificate and PUF data in
+* XPLMI_PMCRAM_CHUNK_MEMORY_1 are not needed anymore.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+*
+* @return	XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+int XLoader_StartDeferredChunkCopy(XLoader_SecureParams *SecurePtr)
+{
+	int Status = XST_SUCCESS;
+	u32 CopyLen = SecurePtr->DeferredCopyLen;
+
+	if (CopyLen != 0U) {
+		SecurePtr->DeferredCopyLen = 0U;
+		Status = XLoader_StartNextChunkCopy(SecurePtr, CopyLen,
+				SecurePtr->DeferredCopyAddr, CopyLen);
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * @brief	This function checks if PPK is programmed.
@@ -58,6 +58,7 @@
 *       bsv  02/11/22 Code optimization to reduce text size
 *       kpt  02/18/22 Removed Flags param from XLoader_SecureInit function prototype
 * 1.08  dc   07/12/22 Moved error codes related to buffer clear to xplmi_status.h
+* 1.09  kc   10/18/26 Added XLoader_StartDeferredChunkCopy
 *
 * </pre>
 *
@@ -112,6 +113,7 @@ int XLoader_SecureCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr, u32 Size);
 int XLoader_SecureClear(void);
 int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 			u8 Last, u32 BlockSize, u32 TotalSize);
+int XLoader_StartDeferredChunkCopy(XLoader_SecureParams *SecurePtr);
 u32 XLoader_GetAHWRoT(const u32* AHWRoTPtr);
 u32 XLoader_GetSHWRoT(const u32* SHWRoTPtr);
 int XLoader_SetSecureState(void);
@@ -14,6 +14,8 @@
 #                     communication feature
 #       ma   08/10/22 Enable SSIT PLM to PLM communication feature based on
 #                     user option and Number of SLRs from the design
+# 1.3   kc   10/18/26 Added configurable option for CDO pipeline
+#       kc   10/18/26 Added configurable option for boot trace
 ##############################################################################
 
 #---------------------------------------------
@@ -130,6 +132,13 @@ proc xgen_opts_file {libhandle} {
 		puts $file_handle "#define PLM_PRINT_PERF"
 	}
 
+	# Get plm_boot_trace_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_boot_trace_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Boot trace enable */"
+		puts $file_handle "#define PLM_BOOT_TRACE"
+	}
+
 	# Get plm_qspi_en value set by user, by default it is TRUE
 	set value [common::get_property CONFIG.plm_qspi_en $libhandle]
 	if {$value == false} {
@@ -200,6 +209,13 @@ proc xgen_opts_file {libhandle} {
 		puts $file_handle "#define PLM_OCP_EXCLUDE"
 	}
 
+	# Get plm_cdo_pipeline_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_cdo_pipeline_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* CDO pipeline enable */"
+		puts $file_handle "#define PLM_CDO_PIPELINE"
+	}
+
 	# Get ssit_plm_to_plm_comm_en value set by user, by default it is TRUE(Valid only for Versal)
 	set value [common::get_property CONFIG.ssit_plm_to_plm_comm_en $libhandle]
 	# Check if hsi::get_current_part is available before reading NUM_OF_SLRS property
@@ -50,6 +50,12 @@
 *       ma   07/25/2022 Enhancements to secure lockdown code
 *       bm   08/24/2022 Support Begin, Break and End commands across chunk
 *                       boundaries
+* 1.07  kc   10/18/2026 Added CDO pipeline to overlap DMA_XFER commands with
+*                       the register writes following them
+*       kc   10/18/2026 Added per command CDO profile
+*       kc   10/18/2026 Pipeline only the DMA_XFER commands requesting it
+*       kc   10/18/2026 Pipeline the DMA_XFER commands not setting
+*                       XPLMI_DMA_XFER_PIPELINE with guarded rules
 *
 * </pre>
 *
@@ -66,12 +72,60 @@
 #include "xplmi_generic.h"
 #include "xplmi_wdt.h"
 #include "xplmi_tamper.h"
+#include "xplmi_modules.h"
+#include "xplmi_plat.h"
 
 /************************** Constant Definitions *****************************/
 #define XPLMI_CMD_LEN_TEMPBUF		(0x8U) /**< This buffer is used to
 			store commands which extend across 32K boundaries */
 
+#ifdef PLM_CDO_PIPELINE
+/* The rules of xplmi_cdo_pipe.c must match the command IDs of the PLM */
+#if (XPLMI_CDO_PIPE_GENERIC_ID != XPLMI_MODULE_GENERIC_ID) || \
+	(XPLMI_CDO_PIPE_MASK_WRITE_ID != XPLMI_MASK_WRITE_CMD_ID) || \
+	(XPLMI_CDO_PIPE_WRITE_ID != XPLMI_WRITE_CMD_ID) || \
+	(XPLMI_CDO_PIPE_DELAY_ID != XPLMI_DELAY_CMD_ID) || \
+	(XPLMI_CDO_PIPE_MASK_WRITE64_ID != XPLMI_MASK_WRITE64_CMD_ID) || \
+	(XPLMI_CDO_PIPE_WRITE64_ID != XPLMI_WRITE64_CMD_ID) || \
+	(XPLMI_CDO_PIPE_NOP_ID != XPLMI_NOP_CMD_ID)
+#error "CDO pipeline command IDs do not match xplmi_modules.h"
+#endif
+#endif
+
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+#define XPLMI_CDO_PROF_MAX_ENTRIES	(64U) /**< Must be a power of 2 */
+#define XPLMI_CDO_PROF_CMD_MASK		(XPLMI_CMD_MODULE_ID_MASK | \
+					XPLMI_CMD_API_ID_MASK)
+#define XPLMI_CDO_PROF_OVERFLOW_ID	(0xFFFFFFFFU) /**< Commands not fitting
+							in the table */
+#define XPLMI_CDO_PROF_USEC_PER_SEC	(1000000U)
+#endif
+
 /**************************** Type Definitions *******************************/
+#ifdef PLM_CDO_PIPELINE
+/**
+ * The DMA_XFER command left in flight while the following commands of the
+ * CDO are executed
+ */
+typedef struct {
+	XPlmi_CdoPipeXfer Xfer;	/**< Transfer in flight */
+	u32 XferCnt;	/**< Number of transfers left in flight */
+	u32 OverlapCnt;	/**< Commands executed while a transfer was in flight */
+	u8 InFlight;	/**< A transfer is in flight */
+	u8 Active;	/**< A CDO is being processed */
+} XPlmi_CdoPipeline;
+#endif
+
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+/**
+ * Time spent in and number of executions of a CDO command
+ */
+typedef struct {
+	u32 CmdId;	/**< Module ID and API ID of the command */
+	u32 Count;	/**< Number of executions */
+	u64 Ticks;	/**< Timer ticks spent including the resumes */
+} XPlmi_CdoProfEntry;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -81,6 +135,230 @@
 
 /*****************************************************************************/
 
+#ifdef PLM_CDO_PIPELINE
+/*****************************************************************************/
+/**
+ * @brief	This function returns the CDO pipeline instance.
+ *
+ * @return	Pointer to the CDO pipeline instance
+ *
+ *****************************************************************************/
+static XPlmi_CdoPipeline *XPlmi_GetCdoPipeline(void)
+{
+	static XPlmi_CdoPipeline CdoPipeline = {0U};
+
+	return &CdoPipeline;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the DMA_XFER command in flight, if any,
+ * to complete.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_CdoPipelineBarrier(void)
+{
+	int Status = XST_SUCCESS;
+	XPlmi_CdoPipeline *Pipeline = XPlmi_GetCdoPipeline();
+
+	if (Pipeline->InFlight == (u8)TRUE) {
+		Pipeline->InFlight = (u8)FALSE;
+		Status = XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_0);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the command can be executed while the
+ * DMA_XFER command in flight, if any, has not completed.
+ *
+ * @param	BufPtr is pointer to the command
+ * @param	BufLen is length of the command available in the buffer
+ *
+ * @return	TRUE if the command can be executed, FALSE otherwise
+ *
+ *****************************************************************************/
+static u8 XPlmi_CdoPipelineCanIssue(const u32 *BufPtr, u32 BufLen)
+{
+	const XPlmi_CdoPipeline *Pipeline = XPlmi_GetCdoPipeline();
+	u8 CanIssue = (u8)TRUE;
+
+	if (Pipeline->InFlight == (u8)TRUE) {
+		CanIssue = XPlmi_CdoPipeCanIssue(&Pipeline->Xfer, BufPtr, BufLen);
+	}
+
+	return CanIssue;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the transfer of a DMA_XFER command. If a
+ * CDO is processed, the transfer is left in flight and the next command that
+ * can not run alongside it waits for its completion. Otherwise the transfer
+ * is blocking. If the command does not set XPLMI_DMA_XFER_PIPELINE, the
+ * transfer is guarded, see xplmi_cdo_pipe.h.
+ *
+ * @param	SrcAddr for SRC channel to fetch data from
+ * @param	DestAddr for DST channel to store the data
+ * @param	Len of the data in words
+ * @param	Flags to select PMC DMA, DMA Burst type and pipelining
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XPlmi_CdoPipelineDmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	int Status = XST_FAILURE;
+	XPlmi_CdoPipeline *Pipeline = XPlmi_GetCdoPipeline();
+	u32 DmaFlags = Flags & ~XPLMI_DMA_XFER_PIPELINE;
+
+	/*
+	 * Transfers to SSIT slave SLRs are completed with their own wait
+	 * function, hence are kept blocking
+	 */
+	if ((Pipeline->Active == (u8)FALSE) || (Len == 0U) ||
+		((DmaFlags & (XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK)) != 0U) ||
+		(XPlmi_GetPlmiWaitForDone(DestAddr) != XPmcDma_WaitForDone)) {
+		Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len, DmaFlags);
+		goto END;
+	}
+
+	Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len,
+		DmaFlags | XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Pipeline->Xfer.SrcAddr = SrcAddr;
+	Pipeline->Xfer.DestAddr = DestAddr;
+	Pipeline->Xfer.Len = (u64)Len * XPLMI_WORD_LEN;
+	Pipeline->Xfer.Guarded = (u8)((Flags & XPLMI_DMA_XFER_PIPELINE) == 0U);
+	Pipeline->InFlight = (u8)TRUE;
+	Pipeline->XferCnt++;
+
+END:
+	return Status;
+}
+#endif
+
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+/*****************************************************************************/
+/**
+ * @brief	This function returns the CDO profile table.
+ *
+ * @return	Pointer to the first entry of the CDO profile table
+ *
+ *****************************************************************************/
+static XPlmi_CdoProfEntry *XPlmi_GetCdoProfile(void)
+{
+	static XPlmi_CdoProfEntry CdoProfile[XPLMI_CDO_PROF_MAX_ENTRIES + 1U];
+
+	return CdoProfile;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the time taken by a command to the CDO
+ * profile. The entries are looked up by open addressing on the command ID.
+ * The last entry collects the commands that do not fit in the table.
+ *
+ * @param	CmdId is the command header
+ * @param	TStart is the timer value when the command was started
+ * @param	IsResume is TRUE if the command was resumed
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_CdoProfileRecord(u32 CmdId, u64 TStart, u8 IsResume)
+{
+	XPlmi_CdoProfEntry *Profile = XPlmi_GetCdoProfile();
+	XPlmi_CdoProfEntry *Entry = &Profile[XPLMI_CDO_PROF_MAX_ENTRIES];
+	u32 Id = CmdId & XPLMI_CDO_PROF_CMD_MASK;
+	u32 Index = (Id ^ (Id >> XPLMI_CMD_MODULE_ID_SHIFT)) &
+		(XPLMI_CDO_PROF_MAX_ENTRIES - 1U);
+	u32 Probe;
+
+	for (Probe = 0U; Probe < XPLMI_CDO_PROF_MAX_ENTRIES; Probe++) {
+		if ((Profile[Index].Count == 0U) &&
+			(Profile[Index].Ticks == 0U)) {
+			Profile[Index].CmdId = Id;
+			Entry = &Profile[Index];
+			break;
+		}
+		if (Profile[Index].CmdId == Id) {
+			Entry = &Profile[Index];
+			break;
+		}
+		Index = (Index + 1U) & (XPLMI_CDO_PROF_MAX_ENTRIES - 1U);
+	}
+	if (Probe == XPLMI_CDO_PROF_MAX_ENTRIES) {
+		Entry->CmdId = XPLMI_CDO_PROF_OVERFLOW_ID;
+	}
+
+	/* PMC timer counts down */
+	Entry->Ticks += TStart - XPlmi_GetTimerValue();
+	if (IsResume == (u8)FALSE) {
+		Entry->Count++;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the CDO profile collected since the last
+ * call and clears it. Each command is printed as two lines in folded stack
+ * format, "time;<Frame>;prtn_<PrtnNum>;mod_<ModuleId>;cmd_<ApiId> <usec>"
+ * and "count;<Frame>;prtn_<PrtnNum>;mod_<ModuleId>;cmd_<ApiId> <count>",
+ * so that the log can be fed to flame graph tools after filtering on the
+ * first frame. Time of a DMA_XFER left in flight by the CDO pipeline is
+ * accounted to the command waiting for it.
+ *
+ * @param	Frame is the name of the parent frame, usually the image name
+ * @param	PrtnNum is the partition number
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_CdoProfileDump(const char *Frame, u32 PrtnNum)
+{
+	XPlmi_CdoProfEntry *Profile = XPlmi_GetCdoProfile();
+	const u32 *PmcIroFreq = XPlmi_GetPmcIroFreq();
+	u32 Index;
+	u32 Usec;
+	u32 ModuleId;
+	u32 ApiId;
+
+	for (Index = 0U; Index <= XPLMI_CDO_PROF_MAX_ENTRIES; Index++) {
+		/* A command only resumed since the last dump has no count */
+		if (Profile[Index].Ticks == 0U) {
+			continue;
+		}
+		if (Profile[Index].CmdId == XPLMI_CDO_PROF_OVERFLOW_ID) {
+			ModuleId = XPLMI_CDO_PROF_OVERFLOW_ID;
+			ApiId = XPLMI_CDO_PROF_OVERFLOW_ID;
+		} else {
+			ModuleId = (Profile[Index].CmdId & XPLMI_CMD_MODULE_ID_MASK) >>
+				XPLMI_CMD_MODULE_ID_SHIFT;
+			ApiId = Profile[Index].CmdId & XPLMI_CMD_API_ID_MASK;
+		}
+		Usec = (u32)((Profile[Index].Ticks *
+			(u64)XPLMI_CDO_PROF_USEC_PER_SEC) / (u64)(*PmcIroFreq));
+		XPlmi_Printf(DEBUG_PRINT_PERF,
+			"time;%s;prtn_%u;mod_%u;cmd_%u %u\n\r",
+			Frame, PrtnNum, ModuleId, ApiId, Usec);
+		XPlmi_Printf(DEBUG_PRINT_PERF,
+			"count;%s;prtn_%u;mod_%u;cmd_%u %u\n\r",
+			Frame, PrtnNum, ModuleId, ApiId, Profile[Index].Count);
+	}
+
+	(void)XPlmi_MemSetBytes(Profile, sizeof(XPlmi_CdoProfEntry) *
+		(XPLMI_CDO_PROF_MAX_ENTRIES + 1U), 0U,
+		sizeof(XPlmi_CdoProfEntry) * (XPLMI_CDO_PROF_MAX_ENTRIES + 1U));
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function will calculate the size of the command. Bits 16 to 23
@@ -237,6 +515,9 @@ static int XPlmi_CdoCmdResume(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *Si
 	int Status = XST_FAILURE;
 	XPlmi_Cmd *CmdPtr = &CdoPtr->Cmd;
 	u32 PrintLen;
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+	u64 TStart;
+#endif
 
 	/* Update the Payload buffer and length */
 	if (CmdPtr->Len > (CmdPtr->ProcessedLen + BufLen)) {
@@ -252,7 +533,13 @@ static int XPlmi_CdoCmdResume(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *Si
 	CmdPtr->Payload = BufPtr;
 	CmdPtr->ProcessedCdoLen = CdoPtr->ProcessedCdoLen;
 	*Size = CmdPtr->PayloadLen;
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+	TStart = XPlmi_GetTimerValue();
+#endif
 	Status = XPlmi_CmdResume(CmdPtr);
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+	XPlmi_CdoProfileRecord(CmdPtr->CmdId, TStart, (u8)TRUE);
+#endif
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL,
 			"CMD: 0x%08x Resume failed, Processed Cdo Length 0x%0x\n\r",
@@ -288,6 +575,9 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 	int Status = XST_FAILURE;
 	XPlmi_Cmd *CmdPtr = &CdoPtr->Cmd;
 	u32 PrintLen;
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+	u64 TStart;
+#endif
 	u32 BufSize;
 
 	/*
@@ -333,6 +623,18 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 		*Size = BufLen;
 		CdoPtr->CmdState = XPLMI_CMD_STATE_RESUME;
 	}
+#ifdef PLM_CDO_PIPELINE
+	if (XPlmi_CdoPipelineCanIssue(BufPtr, *Size) == (u8)FALSE) {
+		Status = XPlmi_CdoPipelineBarrier();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	} else if (XPlmi_GetCdoPipeline()->InFlight == (u8)TRUE) {
+		XPlmi_GetCdoPipeline()->OverlapCnt++;
+	} else {
+		/* No transfer in flight */
+	}
+#endif
 	/* Copy the image id to cmd subsystem ID */
 	CmdPtr->SubsystemId = CdoPtr->SubsystemId;
 	CmdPtr->IpiMask = 0U;
@@ -342,7 +644,13 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 	XPlmi_SetupCmd(CmdPtr, BufPtr, *Size);
 	CmdPtr->DeferredError = (u8)FALSE;
 	CmdPtr->ProcessedCdoLen = CdoPtr->ProcessedCdoLen;
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+	TStart = XPlmi_GetTimerValue();
+#endif
 	Status = XPlmi_CmdExecute(CmdPtr);
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+	XPlmi_CdoProfileRecord(CmdPtr->CmdId, TStart, (u8)FALSE);
+#endif
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL,
 			"CMD: 0x%08x execute failed, Processed Cdo Length 0x%0x\n\r",
@@ -385,7 +693,18 @@ int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr)
 	u32 BufLen = CdoPtr->BufLen;
 	u32 RemainingLen;
 	u32 SldInitiated = XPlmi_IsSldInitiated();
-
+#ifdef PLM_CDO_PIPELINE
+	int SStatus = XST_FAILURE;
+	XPlmi_CdoPipeline *Pipeline = XPlmi_GetCdoPipeline();
+	u8 WasActive = Pipeline->Active;
+#endif
+#if defined(PLM_CDO_PIPELINE) && defined(PLM_PRINT_PERF_CDO_PROCESS)
+	u8 CmdEndDetected = CdoPtr->CmdEndDetected;
+#endif
+
+#ifdef PLM_CDO_PIPELINE
+	Pipeline->Active = (u8)TRUE;
+#endif
 	/* Verify the header for the first chunk of CDO */
 	if (CdoPtr->Cdo1stChunk == (u8)TRUE) {
 		Status = XPlmi_CdoVerifyHeader(CdoPtr);
@@ -505,6 +824,27 @@ int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr)
 	Status = XST_SUCCESS;
 
 END:
+#ifdef PLM_CDO_PIPELINE
+	/*
+	 * The transfer in flight may read from the chunk, hence it is completed
+	 * before the chunk is given back to the loader
+	 */
+	SStatus = XPlmi_CdoPipelineBarrier();
+	if (Status == XST_SUCCESS) {
+		Status = SStatus;
+	}
+	Pipeline->Active = WasActive;
+#endif
+#if defined(PLM_CDO_PIPELINE) && defined(PLM_PRINT_PERF_CDO_PROCESS)
+	if ((CmdEndDetected == (u8)FALSE) &&
+		(CdoPtr->CmdEndDetected == (u8)TRUE)) {
+		XPlmi_Printf(DEBUG_PRINT_PERF,
+			" CDO pipeline: %u DMA xfers in flight, %u commands"
+			" overlapped\n\r", Pipeline->XferCnt, Pipeline->OverlapCnt);
+		Pipeline->XferCnt = 0U;
+		Pipeline->OverlapCnt = 0U;
+	}
+#endif
 	XPlmi_SetPlmLiveStatus();
 	return Status;
 }
@@ -34,6 +34,10 @@
 *       bsv  08/02/2021 Code clean up to reduce size
 * 1.05  ma   01/31/2022 Fix DMA Keyhole command issue where the command
 *                       starts at the 32K boundary
+* 1.06  kc   10/18/2026 Added CDO pipeline to overlap DMA_XFER commands with
+*                       the register writes following them
+*       kc   10/18/2026 Added per command CDO profile
+*       kc   10/18/2026 Pipeline only the DMA_XFER commands requesting it
 *
 * </pre>
 *
@@ -51,6 +55,7 @@ extern "C" {
 #include "xplmi_cmd.h"
 #include "xplmi_debug.h"
 #include "xplmi_status.h"
+#include "xplmi_cdo_pipe.h"
 
 /**@cond xplmi_internal
  * @{
@@ -108,6 +113,12 @@ typedef struct {
 /************************** Function Prototypes ******************************/
 int XPlmi_InitCdo(XPlmiCdo *CdoPtr);
 int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr);
+#ifdef PLM_CDO_PIPELINE
+int XPlmi_CdoPipelineDmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
+#endif
+#ifdef PLM_PRINT_PERF_CDO_PROFILE
+void XPlmi_CdoProfileDump(const char *Frame, u32 PrtnNum);
+#endif
 
 /**
  * @}
@@ -0,0 +1,156 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xplmi_cdo_pipe.c
+ *
+ * This file contains the rules of the CDO pipeline. See xplmi_cdo_pipe.h.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- ---------- -------------------------------------------------------
+ * 1.0   kc   10/18/2026 Initial release
+ *       kc   10/18/2026 Infer the writes depending on transfers not setting
+ *                       XPLMI_DMA_XFER_PIPELINE
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xplmi_cdo_pipe.h"
+
+/************************** Constant Definitions *****************************/
+#define XPLMI_CDO_PIPE_API_ID_MASK	(0xFFU)
+#define XPLMI_CDO_PIPE_MODULE_ID_MASK	(0xFF00U)
+#define XPLMI_CDO_PIPE_MODULE_ID_SHIFT	(8U)
+#define XPLMI_CDO_PIPE_LEN_MASK		(0xFF0000U)
+#define XPLMI_CDO_PIPE_LEN_SHIFT	(16U)
+#define XPLMI_CDO_PIPE_LONG_CMD_LEN	(255U)
+#define XPLMI_CDO_PIPE_WORD_LEN		(4U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if a register write to the address has to
+ * wait for the DMA_XFER command in flight. For a guarded transfer, the
+ * writes to the control space and near the destination also have to wait.
+ *
+ * @param	Xfer is pointer to the transfer in flight
+ * @param	Addr is the address written by the command
+ *
+ * @return	TRUE if the write has to wait, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_CdoPipeIsHazard(const XPlmi_CdoPipeXfer *Xfer, u64 Addr)
+{
+	u8 IsHazard = (u8)FALSE;
+	u64 GuardLow = 0U;
+
+	if (Xfer->DestAddr > XPLMI_CDO_PIPE_GUARD_LEN) {
+		GuardLow = Xfer->DestAddr - XPLMI_CDO_PIPE_GUARD_LEN;
+	}
+
+	/* The last word of the write may still reach into the transfer */
+	if ((Addr >= XPLMI_CDO_PIPE_PMC_LOW_ADDR) &&
+		(Addr < XPLMI_CDO_PIPE_PMC_HIGH_ADDR)) {
+		IsHazard = (u8)TRUE;
+	} else if (((Addr + XPLMI_CDO_PIPE_WORD_LEN) > Xfer->SrcAddr) &&
+		(Addr < (Xfer->SrcAddr + Xfer->Len))) {
+		IsHazard = (u8)TRUE;
+	} else if (((Addr + XPLMI_CDO_PIPE_WORD_LEN) > Xfer->DestAddr) &&
+		(Addr < (Xfer->DestAddr + Xfer->Len))) {
+		IsHazard = (u8)TRUE;
+	} else if (Xfer->Guarded == (u8)FALSE) {
+		/* The CDO states that the write does not depend on the transfer */
+	} else if ((Addr >= XPLMI_CDO_PIPE_CTRL_LOW_ADDR) &&
+		(Addr < XPLMI_CDO_PIPE_CTRL_HIGH_ADDR)) {
+		/* May release a processor running from the destination */
+		IsHazard = (u8)TRUE;
+	} else if ((Addr >= GuardLow) && (Addr < (Xfer->DestAddr +
+		Xfer->Len + XPLMI_CDO_PIPE_GUARD_LEN))) {
+		/* May enable a core or DMA using the destination */
+		IsHazard = (u8)TRUE;
+	} else {
+		/* Independent register space */
+	}
+
+	return IsHazard;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the command can be executed while the
+ * DMA_XFER command in flight has not completed. Only the register writes
+ * that do not touch the PMC address space or the memory of the transfer and
+ * the NOP and delay commands qualify. Any other command, like mask poll,
+ * marker, set or end, is a barrier.
+ *
+ * @param	Xfer is pointer to the transfer in flight
+ * @param	BufPtr is pointer to the command
+ * @param	BufLen is length of the command available in the buffer
+ *
+ * @return	TRUE if the command can be executed, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_CdoPipeCanIssue(const XPlmi_CdoPipeXfer *Xfer, const u32 *BufPtr,
+	u32 BufLen)
+{
+	u8 CanIssue = (u8)FALSE;
+	u32 CmdId = BufPtr[0U];
+	u32 ModuleId = (CmdId & XPLMI_CDO_PIPE_MODULE_ID_MASK) >>
+		XPLMI_CDO_PIPE_MODULE_ID_SHIFT;
+	u32 Len = (CmdId & XPLMI_CDO_PIPE_LEN_MASK) >> XPLMI_CDO_PIPE_LEN_SHIFT;
+	u64 Addr;
+
+	/* Long commands and commands split across chunks are barriers */
+	if ((ModuleId != XPLMI_CDO_PIPE_GENERIC_ID) ||
+		(Len == XPLMI_CDO_PIPE_LONG_CMD_LEN) || ((Len + 1U) > BufLen)) {
+		goto END;
+	}
+
+	switch (CmdId & XPLMI_CDO_PIPE_API_ID_MASK) {
+	case XPLMI_CDO_PIPE_NOP_ID:
+	case XPLMI_CDO_PIPE_DELAY_ID:
+		CanIssue = (u8)TRUE;
+		break;
+	case XPLMI_CDO_PIPE_WRITE_ID:
+	case XPLMI_CDO_PIPE_MASK_WRITE_ID:
+		if (Len >= 1U) {
+			Addr = (u64)BufPtr[1U];
+			if (XPlmi_CdoPipeIsHazard(Xfer, Addr) == (u8)FALSE) {
+				CanIssue = (u8)TRUE;
+			}
+		}
+		break;
+	case XPLMI_CDO_PIPE_WRITE64_ID:
+	case XPLMI_CDO_PIPE_MASK_WRITE64_ID:
+		if (Len >= 2U) {
+			Addr = ((u64)BufPtr[1U] << 32U) | (u64)BufPtr[2U];
+			if (XPlmi_CdoPipeIsHazard(Xfer, Addr) == (u8)FALSE) {
+				CanIssue = (u8)TRUE;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+
+END:
+	return CanIssue;
+}
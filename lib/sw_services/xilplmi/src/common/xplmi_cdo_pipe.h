@@ -0,0 +1,112 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xplmi_cdo_pipe.h
+ *
+ * This file contains the rules of the CDO pipeline, which decide whether a
+ * command may run while a DMA_XFER command is in flight.
+ *
+ * A DMA_XFER command is left in flight while the register writes following
+ * it, up to the next command that is not a write, NOP or delay, are
+ * executed. Writes to the PMC address space or to the source or destination
+ * of the transfer always wait for it.
+ *
+ * As CDO generators do not tell which writes depend on a transfer, the
+ * rules infer it for a transfer not setting XPLMI_DMA_XFER_PIPELINE: the
+ * writes to the 32-bit control space, which holds the reset and clock
+ * controllers of the processors, and the writes within
+ * XPLMI_CDO_PIPE_GUARD_LEN of the destination, which covers the core and DMA
+ * controls of the AIE tiles loaded and of their neighbours, also wait for
+ * it. A CDO setting XPLMI_DMA_XFER_PIPELINE states that the writes
+ * following the transfer do not depend on it, so only the PMC address space
+ * and the transfer's own ranges wait.
+ *
+ * The rules are used by the PLM and by the cdo_replay host tool, hence this
+ * file must only include xil_types.h.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- ---------- -------------------------------------------------------
+ * 1.0   kc   10/18/2026 Initial release
+ *       kc   10/18/2026 Infer the writes depending on transfers not setting
+ *                       XPLMI_DMA_XFER_PIPELINE
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XPLMI_CDO_PIPE_H
+#define XPLMI_CDO_PIPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+/*
+ * DMA_XFER flag stating that the writes following the transfer do not
+ * depend on it
+ */
+#define XPLMI_DMA_XFER_PIPELINE		((u32)0x1U << 31U)
+
+/*
+ * Writes to the PMC address space, which holds the DMA, SSS, SBI and CFU
+ * registers, always wait for the transfer in flight
+ */
+#define XPLMI_CDO_PIPE_PMC_LOW_ADDR	(0xF0000000U)
+#define XPLMI_CDO_PIPE_PMC_HIGH_ADDR	(0xF2000000U)
+
+/*
+ * Writes to the 32-bit control space, with the PMC, LPD and FPD registers,
+ * and within 64 MB of the destination wait for a transfer not setting
+ * XPLMI_DMA_XFER_PIPELINE. 64 MB spans at least two AIE tile columns on
+ * each side.
+ */
+#define XPLMI_CDO_PIPE_CTRL_LOW_ADDR	(0xF0000000U)
+#define XPLMI_CDO_PIPE_CTRL_HIGH_ADDR	(0x100000000U)
+#define XPLMI_CDO_PIPE_GUARD_LEN	(0x4000000U)
+
+/*
+ * Generic module commands looked at by the rules, checked against
+ * xplmi_modules.h in xplmi_cdo.c
+ */
+#define XPLMI_CDO_PIPE_GENERIC_ID	(1U)
+#define XPLMI_CDO_PIPE_MASK_WRITE_ID	(2U)
+#define XPLMI_CDO_PIPE_WRITE_ID		(3U)
+#define XPLMI_CDO_PIPE_DELAY_ID		(4U)
+#define XPLMI_CDO_PIPE_MASK_WRITE64_ID	(7U)
+#define XPLMI_CDO_PIPE_WRITE64_ID	(8U)
+#define XPLMI_CDO_PIPE_NOP_ID		(17U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * The DMA_XFER command in flight
+ */
+typedef struct {
+	u64 SrcAddr;	/**< Source address of the transfer */
+	u64 DestAddr;	/**< Destination address of the transfer */
+	u64 Len;	/**< Length of the transfer in bytes */
+	u8 Guarded;	/**< The CDO did not set XPLMI_DMA_XFER_PIPELINE */
+} XPlmi_CdoPipeXfer;
+
+/************************** Function Prototypes ******************************/
+u8 XPlmi_CdoPipeIsHazard(const XPlmi_CdoPipeXfer *Xfer, u64 Addr);
+u8 XPlmi_CdoPipeCanIssue(const XPlmi_CdoPipeXfer *Xfer, const u32 *BufPtr,
+	u32 BufLen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPLMI_CDO_PIPE_H */
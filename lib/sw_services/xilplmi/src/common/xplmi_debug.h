@@ -32,6 +32,7 @@
 *       bm   08/12/2021 Added support to configure uart during run-time
 *       bsv  09/05/2021 Disable prints in slave boot modes in case of error
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
+* 1.07  kc   10/18/2026 Added DEBUG_BOOT and boot trace option
 *
 * </pre>
 *
@@ -76,12 +77,22 @@ void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...);
 int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable);
 
 /***************** Macros (Inline Functions) Definitions *********************/
-#ifdef PLM_PRINT_PERF
+#if defined (PLM_PRINT_PERF) && !defined (PLM_BOOT_TRACE)
 #define DEBUG_PRINT_PERF	DEBUG_PRINT_ALWAYS
 #else
 #define DEBUG_PRINT_PERF	(0U)
 #endif
 
+/*
+ * Boot progress messages. With PLM_BOOT_TRACE, they and the boot time
+ * messages are stored as records in the trace log instead of being printed.
+ */
+#ifdef PLM_BOOT_TRACE
+#define DEBUG_BOOT		(0U)
+#else
+#define DEBUG_BOOT		DEBUG_GENERAL
+#endif
+
 #if defined (PLM_DEBUG_DETAILED)
 #define XPlmiDbgCurrentTypes ((DEBUG_DETAILED) | (DEBUG_INFO) | \
 				(DEBUG_GENERAL) | (DEBUG_PRINT_ALWAYS))
@@ -47,6 +47,10 @@
 *                       XPlmi_InitDebugLogBuffer function
 * 1.06  bsv  06/03/2022 Add CommandInfo to a separate section in elf
 *       bm   07/06/2022 Refactor versal and versal_net code
+* 1.07  kc   10/18/2026 Store raw timer ticks in trace records, keep records
+*                       whole across buffer wrap and added trace ring
+*                       retrieval command
+*       kc   10/18/2026 Added XPlmi_TraceLogDuration for boot trace
 *
 * </pre>
 *
@@ -65,6 +69,7 @@
 #include "xil_util.h"
 #include "xplmi_modules.h"
 #include "xplmi_plat.h"
+#include "xplmi_proc.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -84,6 +89,10 @@
 #define XPLMI_TRACE_LOG_BUFFER	(0U)
 #define XPLMI_DEBUG_LOG_BUFFER	(1U)
 
+/* Timer value at PLM timer start, the timer counts down from it */
+#define XPLMI_TRACE_LOG_TIMER_START	((XPLMI_PIT1_CYCLE_VALUE << 32U) | \
+					XPLMI_PIT2_CYCLE_VALUE)
+
 /**
  * @}
  * @endcond
@@ -142,6 +151,49 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function copies the valid part of the trace ring, oldest
+ * data first, to the destination and returns the number of bytes copied in
+ * the command response.
+ *
+ * @param 	Cmd is the pointer to command structure
+ * @param 	DestAddr to which the trace data is to be copied
+ * @param 	MaxLen is the size of the destination in bytes
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_RetrieveTraceRing(XPlmi_Cmd *Cmd, u64 DestAddr, u32 MaxLen)
+{
+	int Status = XST_FAILURE;
+	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
+	XPlmi_CircularBuffer Valid = *TraceLog;
+	u32 Len = TraceLog->Len;
+
+	if (TraceLog->IsBufferFull == (u32)FALSE) {
+		/* Only the data up to the current offset is valid */
+		Valid.Len = TraceLog->Offset;
+		Len = TraceLog->Offset;
+	}
+	if (Len > MaxLen) {
+		Status = (int)XPLMI_ERR_INVALID_LOG_BUF_LEN;
+		goto END;
+	}
+
+	if (Len != 0U) {
+		Status = XPlmi_RetrieveBufferData(&Valid, DestAddr);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Cmd->Response[1U] = Len;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function configures Log Buffer with the given memory address
@@ -241,13 +293,20 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
  *			Arg1 - High Address
  *			Arg2 - Low Address
  *			Arg3 - Length
- *		6 - Retrieve Trace Log buffer
+ *		6 - Retrieve Trace Log buffer. The records are in format 2,
+ *		    see xplmi_event_logging.h, and a record may be partly
+ *		    overwritten at the start of a wrapped buffer.
  *			Arg1 - High Address
  *			Arg2 - Low Address
  *		7 - Retrieve Trace Log buffer information
  *		8 - Configure Uart
  *			Arg1 - Uart Select
  *			Arg2 - Uart Enable
+ *		9 - Retrieve Trace Log ring, oldest record first. The number
+ *		    of bytes copied is returned in the response.
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *			Arg3 - Length of the destination in bytes
  *
  * @param	Cmd is pointer to the command structure
 
@@ -293,6 +352,9 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 			StartAddr = (Arg1 << 32U) | Arg2;
 			Status = XPlmi_ConfigureLogMem(TraceLog, StartAddr,
 					Arg3, XPLMI_TRACE_LOG_BUFFER);
+			if (Status == XST_SUCCESS) {
+				XPlmi_TraceLogStart();
+			}
 			break;
 		case XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA:
 			Status = XPlmi_RetrieveBufferData(TraceLog,
@@ -305,6 +367,10 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 		case XPLMI_LOGGING_CMD_CONFIG_UART:
 			Status = XPlmi_ConfigUart((u8)Arg1, (u8)Arg2);
 			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_TRACE_RING:
+			Status = XPlmi_RetrieveTraceRing(Cmd, (Arg1 << 32U) | Arg2,
+					Arg3);
+			break;
 		default:
 			XPlmi_Printf(DEBUG_GENERAL,
 				"Received invalid event logging command\n\r");
@@ -332,26 +398,74 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 {
 	u32 Index;
-	XPlmi_PerfTime PerfTime;
+	/* Time stamp of PLM in timer ticks, converted by the trace decoder */
+	u64 Ticks = XPLMI_TRACE_LOG_TIMER_START - XPlmi_GetTimerValue();
 	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
 
-	/* Get time stamp of PLM */
-	XPlmi_MeasurePerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
-		XPLMI_PIT2_CYCLE_VALUE, &PerfTime);
+	if ((Len * XPLMI_WORD_LEN) > TraceLog->Len) {
+		goto END;
+	}
 
-	TraceData[0U] = TraceData[0U] | (Len << XPLMI_TRACE_LOG_LEN_SHIFT);
-	TraceData[1U] = (u32)PerfTime.TPerfMs;
-	TraceData[2U] = (u32)PerfTime.TPerfMsFrac;
+	TraceData[0U] = XPLMI_TRACE_LOG_MAGIC | (Len << XPLMI_TRACE_LOG_LEN_SHIFT) |
+		(TraceData[0U] & XPLMI_TRACE_LOG_ID_MASK);
+	TraceData[1U] = (u32)(Ticks >> 32U);
+	TraceData[2U] = (u32)(Ticks & 0xFFFFFFFFU);
 
-	for (Index = 0U; Index < Len; Index++) {
-		if (TraceLog->Offset >= TraceLog->Len) {
-			TraceLog->Offset = 0x0U;
-			TraceLog->IsBufferFull = (u32)TRUE;
+	/* Fill the end of the buffer with zeroes if the record does not fit */
+	if (((u32)TraceLog->Offset + (Len * XPLMI_WORD_LEN)) > TraceLog->Len) {
+		while (TraceLog->Offset < TraceLog->Len) {
+			XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), 0U);
+			TraceLog->Offset += XPLMI_WORD_LEN;
 		}
+		TraceLog->Offset = 0x0U;
+		TraceLog->IsBufferFull = (u32)TRUE;
+	}
 
+	for (Index = 0U; Index < Len; Index++) {
 		XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), TraceData[Index]);
 		TraceLog->Offset += XPLMI_WORD_LEN;
 	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function writes the trace start record, which gives the
+ * trace format version and the frequency of the PMC timer used for the time
+ * stamps to the trace decoder.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TraceLogStart(void)
+{
+	const u32 *PmcIroFreq = XPlmi_GetPmcIroFreq();
+
+	XPlmi_TraceLog4(XPLMI_TRACE_LOG_START, XPLMI_TRACE_LOG_VERSION_2,
+		*PmcIroFreq);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function writes a trace record with the time taken by a boot
+ * phase, in PMC timer ticks, in place of the boot time print of the phase.
+ *
+ * @param	Header is the trace event ID
+ * @param	TStart is the timer value at the start of the phase
+ * @param	Arg1 is the first argument of the record
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TraceLogDuration(u32 Header, u64 TStart, u32 Arg1)
+{
+	/* The timer counts down */
+	u64 Ticks = TStart - XPlmi_GetTimerValue();
+
+	XPlmi_TraceLog5(Header, Arg1, (u32)(Ticks >> 32U),
+		(u32)(Ticks & 0xFFFFFFFFU));
 }
 
 /*****************************************************************************/
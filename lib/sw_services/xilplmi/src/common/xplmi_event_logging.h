@@ -29,7 +29,8 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
-*
+* 1.05  kc   10/18/2026 Binary trace records with raw timer time stamps and
+*                       trace ring retrieval command
 *
 * </pre>
 *
@@ -47,6 +48,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xplmi_cmd.h"
 #include "xplmi_util.h"
+#include "xplmi_trace_events.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -74,6 +76,8 @@ typedef struct {
 /************************** Function Prototypes ******************************/
 int XPlmi_EventLogging(XPlmi_Cmd * Cmd);
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len);
+void XPlmi_TraceLogStart(void);
+void XPlmi_TraceLogDuration(u32 Header, u64 TStart, u32 Arg1);
 void XPlmi_InitDebugLogBuffer(void);
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -86,22 +90,30 @@ void XPlmi_InitDebugLogBuffer(void);
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA	(0x6U)
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_BUFFER_INFO	(0x7U)
 #define XPLMI_LOGGING_CMD_CONFIG_UART			(0x8U)
+#define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_RING		(0x9U)
 #define XPLMI_LOG_LEVEL_SHIFT		(0x4U)
 
-/* Trace log buffer length shift */
+/* Trace log record header */
 #define XPLMI_TRACE_LOG_LEN_SHIFT		(16U)
-
-/* Trace event IDs */
-#define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_ID_MASK			(0xFFFFU)
+#define XPLMI_TRACE_LOG_MAGIC			(0xA5000000U)
 
 /*
  * Trace log functions
  * TraceBuffer structure
- * 		0U - Header
- * 		1U - Time stamp in ms
- * 		2U - Time stamp fraction
+ * 		0U - Header, Magic[31:24] Length in words[23:16] Event ID[15:0]
+ * 		1U - Time stamp in PMC timer ticks, upper word
+ * 		2U - Time stamp in PMC timer ticks, lower word
  * 		3U - Payload
  * 		...
+ * Records are not split at the end of the buffer, the space left is
+ * filled with zero words. Event IDs and their format strings are in
+ * xplmi_trace_events.h.
+ *
+ * This is format 2, given by the XPLMI_TRACE_LOG_START record. Format 1 had
+ * no magic byte in the header, the time stamp in ms with its fraction in
+ * words 1 and 2, and split the records at the end of the buffer, so readers
+ * of sub command 6 written for format 1 have to be updated.
  */
 /*****************************************************************************/
 /**
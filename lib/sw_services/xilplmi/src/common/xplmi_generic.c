@@ -79,6 +79,11 @@
 *       bm   08/30/2022 Ignore strings in begin command beyond 24 characters
 *                       instead of erroring out
 *       bm   09/14/2022 Move ScatterWrite commands from common to versal_net
+* 1.09  kc   10/18/2026 Leave DMA_XFER in flight when CDO pipeline is enabled
+*       kc   10/18/2026 Added GetTaskStats command
+*       kc   10/18/2026 Leave DMA_XFER in flight only if its flags request it
+*       kc   10/18/2026 Leave every DMA_XFER in flight, guarded unless its
+*                       flags set XPLMI_DMA_XFER_PIPELINE
 *
 * </pre>
 *
@@ -107,6 +112,7 @@
 #endif
 #include "xplmi_plat.h"
 #include "xplmi_tamper.h"
+#include "xplmi_task.h"
 
 /**@cond xplmi_internal
  * @{
@@ -149,6 +155,7 @@ static int XPlmi_KeyHoleXfr(XPlmi_KeyHoleXfrParams* KeyHoleXfrParams);
 static int XPlmi_StackPush(u32 *Data);
 static int XPlmi_StackPop(u32 PopLevel, u32 *Data);
 static int XPlmi_TamperTrigger(XPlmi_Cmd *Cmd);
+static int XPlmi_GetTaskStats(XPlmi_Cmd *Cmd);
 
 /************************** Variable Definitions *****************************/
 static u32 OffsetList[XPLMI_BEGIN_OFFSET_STACK_SIZE] = {0U};
@@ -824,7 +831,9 @@ END:
  *		- Low Src Addr
  *		- High Dest Addr
  *		- Low Dest Addr
- *		- Params - AXI burst type (Fixed/INCR)
+ *		- Params - AXI burst type (Fixed/INCR) and
+ *		  XPLMI_DMA_XFER_PIPELINE if the following writes do not
+ *		  depend on the transfer
  *
  * @param	Cmd is pointer to the command structure
  *
@@ -860,8 +869,9 @@ static int XPlmi_DmaXfer(XPlmi_Cmd *Cmd)
 	DestAddr += ((u64)Cmd->ProcessedLen * XPLMI_WORD_LEN);
 	Len = Cmd->ResumeData[4U];
 
-	/* Set DMA flags to DMA0 */
-	Flags = Cmd->ResumeData[5U] | XPLMI_PMCDMA_0;
+	/* Set DMA flags to DMA0, the pipeline request is not a DMA flag */
+	Flags = (Cmd->ResumeData[5U] & ~XPLMI_DMA_XFER_PIPELINE) |
+		XPLMI_PMCDMA_0;
 
 	if (DestAddr == XPLMI_SBI_DEST_ADDR) {
 		XPlmi_UtilRMW(SLAVE_BOOT_SBI_MODE,
@@ -871,7 +881,8 @@ static int XPlmi_DmaXfer(XPlmi_Cmd *Cmd)
 			Status = XPlmi_NpiRead(SrcAddr, DestAddr, Len);
 		} else {
 			Status = XPlmi_DmaSbiXfer(SrcAddr, Len,
-					Cmd->ResumeData[5U] | XPLMI_PMCDMA_1);
+					(Cmd->ResumeData[5U] &
+					~XPLMI_DMA_XFER_PIPELINE) | XPLMI_PMCDMA_1);
 		}
 		if (Status != XST_SUCCESS) {
 			XPlmi_UtilRMW(SLAVE_BOOT_SBI_MODE,
@@ -899,7 +910,17 @@ static int XPlmi_DmaXfer(XPlmi_Cmd *Cmd)
 		if ((Flags & XPLMI_DMA_SRC_NPI) == XPLMI_DMA_SRC_NPI) {
 			Status = XPlmi_NpiRead(SrcAddr, DestAddr, Len);
 		} else {
+#ifdef PLM_CDO_PIPELINE
+			/*
+			 * Left in flight while the following writes that
+			 * can not depend on it are executed
+			 */
+			Status = XPlmi_CdoPipelineDmaXfr(SrcAddr, DestAddr, Len,
+				Flags | (Cmd->ResumeData[5U] &
+				XPLMI_DMA_XFER_PIPELINE));
+#else
 			Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len, Flags);
+#endif
 		}
 	}
 	if (Status != XST_SUCCESS) {
@@ -1965,6 +1986,78 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function reads the accounting of a PLM task and fills in the
+ *		response buffer.
+ *		Command: GetTaskStats
+ *		Reserved[31:24]=0 Length[23:16]=1..2 PLM=1 CMD_TASK_STATS=36
+ *		Payload = Task Index, Flags (optional)
+ *		Response is
+ *		- Task handler address, 0 if the task index is free
+ *		- Run count
+ *		- Cumulative run time in us
+ *		- Maximum run time in us
+ *		- Cumulative queueing delay in us
+ *		- Maximum queueing delay in us
+ *		- Task priority
+ *		Cumulative times wrap at 32 bits. If XPLMI_TASK_STATS_CLEAR is
+ *		set in Flags, the accounting of the task is cleared after it is
+ *		read, so that it can be sampled over intervals.
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return	XST_SUCCESS on success and XST_INVALID_PARAM if the task index
+ *		is out of range
+ *
+ *****************************************************************************/
+static int XPlmi_GetTaskStats(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	XPlmi_TaskNode *Task = XPlmi_GetTaskByIndex(Cmd->Payload[0U]);
+	const u32 *PmcIroFreq = XPlmi_GetPmcIroFreq();
+	XPlmi_TaskStats Stats;
+	u32 Flags = 0U;
+	XPLMI_EXPORT_CMD(XPLMI_TASK_STATS_CMD_ID, XPLMI_MODULE_GENERIC_ID,
+		XPLMI_CMD_ARG_CNT_ONE, XPLMI_CMD_ARG_CNT_TWO);
+
+	if (Task == NULL) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+	if (Cmd->PayloadLen > 1U) {
+		Flags = Cmd->Payload[1U];
+	}
+
+	/* Copy with interrupts disabled as task handlers update the stats */
+	microblaze_disable_interrupts();
+	Stats = Task->Stats;
+	if ((Flags & XPLMI_TASK_STATS_CLEAR) != 0U) {
+		Task->Stats.RunTime = 0U;
+		Task->Stats.WaitTime = 0U;
+		Task->Stats.MaxRunTime = 0U;
+		Task->Stats.MaxWaitTime = 0U;
+		Task->Stats.RunCnt = 0U;
+	}
+	microblaze_enable_interrupts();
+
+	Cmd->Response[1U] = (u32)(UINTPTR)Task->Handler;
+	Cmd->Response[2U] = Stats.RunCnt;
+	Cmd->Response[3U] = (u32)((Stats.RunTime *
+		(u64)XPLMI_TASK_USEC_PER_SEC) / (u64)(*PmcIroFreq));
+	Cmd->Response[4U] = (u32)(((u64)Stats.MaxRunTime *
+		(u64)XPLMI_TASK_USEC_PER_SEC) / (u64)(*PmcIroFreq));
+	Cmd->Response[5U] = (u32)((Stats.WaitTime *
+		(u64)XPLMI_TASK_USEC_PER_SEC) / (u64)(*PmcIroFreq));
+	Cmd->Response[6U] = (u32)(((u64)Stats.MaxWaitTime *
+		(u64)XPLMI_TASK_USEC_PER_SEC) / (u64)(*PmcIroFreq));
+	Cmd->Response[7U] = Task->Priority;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
 /**
  * @{
  * @cond xplmi_internal
@@ -2020,6 +2113,7 @@ void XPlmi_GenericInit(void)
 		XPLMI_MODULE_COMMAND(XPlmi_ScatterWrite),
 		XPLMI_MODULE_COMMAND(XPlmi_ScatterWrite2),
 		XPLMI_MODULE_COMMAND(XPlmi_TamperTrigger),
+		XPLMI_MODULE_COMMAND(XPlmi_GetTaskStats),
 	};
 	/* This is to store CMD_END in xplm_modules section */
 	XPLMI_EXPORT_CMD(XPLMI_END_CMD_ID, XPLMI_MODULE_GENERIC_ID,
@@ -45,6 +45,7 @@
 *       ma   07/08/2022 Add support for storing procs to PMC RAM based on ID
 *       ma   07/08/2022 Add support for Tamper Trigger over IPI
 *       bm   07/13/2022 Retain critical data structures after In-Place PLM Update
+*       kc   10/18/2026 Added define for Get Task Stats command
 *
 * </pre>
 *
@@ -150,6 +151,7 @@ typedef struct {
 #define XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL	(0x13U)
 #define XPLMI_PLM_MODULES_GET_BOARD_VAL		(0x15U)
 #define XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL	(0x23U)
+#define XPLMI_PLM_GENERIC_TASK_STATS_VAL	(0x24U)
 #define XPLMI_PLM_LOADER_SET_IMG_INFO_VAL	(0x4U)
 
 /* Define related to break */
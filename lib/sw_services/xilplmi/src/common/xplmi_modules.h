@@ -35,6 +35,7 @@
 *       ma   07/08/2022 Move ScatterWrite and ScatterWrite2 APIs to common code
 *       jd   08/11/2022 Increase command argument count macros from 6 to 12
 *       jd   08/31/2022 Typecasting CmdIdVal to u8 in XPLMI_EXPORT_CMD
+*       kc   10/18/2026 Added Get Task Stats command ID
 * </pre>
 *
 * @note
@@ -155,6 +156,7 @@ typedef struct {
 #define XPLMI_OT_CHECK_CMD_ID		(30U)
 #define XPLMI_SCATTER_WRITE_CMD_ID	(33U)
 #define XPLMI_SCATTER_WRITE2_CMD_ID	(34U)
+#define XPLMI_TASK_STATS_CMD_ID		(36U)
 #define XPLMI_END_CMD_ID		(0xFFU)
 
 /************************** Function Prototypes ******************************/
@@ -44,6 +44,8 @@
 *       bm   03/16/2022 Fix ROM time calculation
 * 1.07  skd  04/21/2022 Misra-C violation Rule 18.1 fixed
 * 1.08  bm   07/06/2022 Refactor versal and versal_net code
+* 1.09  kc   10/18/2026 Write trace start record once the timer is running
+*       kc   10/18/2026 Trace ROM time with PLM_BOOT_TRACE
 *
 * </pre>
 *
@@ -58,6 +60,7 @@
 #include "xplmi_debug.h"
 #include "xplmi_err_common.h"
 #include "xplmi_plat.h"
+#include "xplmi_event_logging.h"
 
 /**@cond xplmi_internal
  * @{
@@ -231,18 +234,32 @@ void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime)
 void XPlmi_PrintRomTime(void)
 {
 	u64 PmcRomTime;
+#ifdef PLM_BOOT_TRACE
+	const u32 *PmcIroFreq = XPlmi_GetPmcIroFreq();
+	u64 RomTicks;
+#else
 	XPlmi_PerfTime PerfTime;
+#endif
 
 	/* Get PMC ROM time */
 	PmcRomTime = (u64)XPlmi_In32(PMC_GLOBAL_GLOBAL_GEN_STORAGE0);
 	PmcRomTime |= (u64)XPlmi_In32(PMC_GLOBAL_GLOBAL_GEN_STORAGE1) << 32U;
 
+#ifdef PLM_BOOT_TRACE
+	/* ROM counts at 320 MHz, the trace is in PLM timer ticks */
+	RomTicks = ((XPLMI_PIT1_CYCLE_VALUE << 32U) | XPLMI_PIT2_CYCLE_VALUE) -
+		PmcRomTime;
+	RomTicks = (RomTicks * (u64)(*PmcIroFreq)) / XPLMI_PMC_IRO_FREQ_320_MHZ;
+	XPlmi_TraceLog5(XPLMI_TRACE_LOG_ROM_TIME, 0U, (u32)(RomTicks >> 32U),
+		(u32)(RomTicks & 0xFFFFFFFFU));
+#else
 	/* Print time stamp of PLM */
 	XPlmi_GetPerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
 		XPLMI_PIT2_CYCLE_VALUE, PmcRomTime,
 		XPLMI_PMC_IRO_FREQ_320_MHZ, &PerfTime);
 	XPlmi_Printf(DEBUG_PRINT_ALWAYS, "%u.%03u ms: ROM Time\r\n",
 		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
 }
 
 /*****************************************************************************/
@@ -326,6 +343,9 @@ int XPlmi_StartTimer(void)
 	XPlmi_InitPitTimer((u8)XPLMI_PIT1, Pit1ResetValue);
 	XPlmi_InitPitTimer((u8)XPLMI_PIT3, Pit3ResetValue);
 
+	/* Trace time stamps start with the timer */
+	XPlmi_TraceLogStart();
+
 END:
 	return Status;
 }
@@ -43,6 +43,7 @@
 * 1.06  skg  06/20/2022 Misra-C violation Rule 10.4 fixed
 *       sk   06/27/2022 Updated logic in XPlmi_SchedulerAddTask to fix task
 *                       creation error
+* 1.07  kc   10/18/2026 Remove queued task with XPlmi_TaskRemove
 *
 * </pre>
 *
@@ -352,10 +353,7 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			Sched.TaskList[Idx].CustomerFunc = NULL;
 			Sched.TaskList[Idx].Data = NULL;
 			microblaze_disable_interrupts();
-			if (metal_list_is_empty(&Sched.TaskList[Idx].Task->TaskNode) ==
-				(int)FALSE) {
-				metal_list_del(&Sched.TaskList[Idx].Task->TaskNode);
-			}
+			XPlmi_TaskRemove(Sched.TaskList[Idx].Task);
 			microblaze_enable_interrupts();
 			TaskCount++;
 		}
@@ -41,6 +41,9 @@
 *                       same priority
 *       bsv  03/11/2022 Restore race condition fix that got disturbed by
 *                       previous patch
+* 1.08  kc   10/18/2026 Select the ready queue from a priority bitmap and
+*                       account run count, run time and queueing delay of
+*                       every task
 *
 * </pre>
 *
@@ -60,11 +63,24 @@
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
+/*
+ * Bit of a priority in the ready bitmap. Priority 0 is the MSB, so that count
+ * leading zeros of the bitmap gives the highest ready priority.
+ */
+#define XPLMI_TASK_READY_BIT(Priority)	((u32)1U << (31U - (u32)(Priority)))
+
+#if (XPLMI_TASK_PRIORITIES > 32U)
+#error "Ready bitmap supports at most 32 task priorities"
+#endif
 
 /************************** Function Prototypes ******************************/
+static void XPlmi_TaskAccount(XPlmi_TaskNode *Task, u64 QueueTime,
+	u64 StartTime, u64 EndTime);
 
 /************************** Variable Definitions *****************************/
 static struct metal_list TaskQueue[XPLMI_TASK_PRIORITIES];
+static u32 TaskReadyMask; /* Bit set for every non empty TaskQueue */
+static XPlmi_TaskNode Tasks[XPLMI_TASK_MAX];
 
 /*****************************************************************************/
 
@@ -122,7 +138,6 @@ XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 		const void *PrivData, const u32 IntrId)
 {
 	XPlmi_TaskNode *Task = NULL;
-	static XPlmi_TaskNode Tasks[XPLMI_TASK_MAX];
 	u8 Index;
 
 	for (Index = 0U; Index < XPLMI_TASK_MAX; Index++) {
@@ -147,6 +162,27 @@ XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 	return Task;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function returns the task node at the given index of the
+ * task pool.
+ *
+ * @param	Index is the index of the task node
+ *
+ * @return	Task node, NULL if Index is out of range
+ *
+ *****************************************************************************/
+XPlmi_TaskNode *XPlmi_GetTaskByIndex(u32 Index)
+{
+	XPlmi_TaskNode *Task = NULL;
+
+	if (Index < XPLMI_TASK_MAX) {
+		Task = &Tasks[Index];
+	}
+
+	return Task;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function adds the task to the task queue so that it can be
@@ -161,8 +197,30 @@ void XPlmi_TaskTriggerNow(XPlmi_TaskNode *Task)
 {
 	Xil_AssertVoid(Task->Handler != NULL);
 	if (metal_list_is_empty(&Task->TaskNode) != (int)FALSE) {
+		Task->Stats.QueueTime = XPlmi_GetTimerValue();
 		metal_list_add_tail(&TaskQueue[Task->Priority],
 			&Task->TaskNode);
+		TaskReadyMask |= XPLMI_TASK_READY_BIT(Task->Priority);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function removes the task from the task queue if it is
+ * queued. It must be called with interrupts disabled.
+ *
+ * @param	Task Pointer to the task node
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskRemove(XPlmi_TaskNode *Task)
+{
+	if (metal_list_is_empty(&Task->TaskNode) == (int)FALSE) {
+		metal_list_del(&Task->TaskNode);
+		if (metal_list_is_empty(&TaskQueue[Task->Priority]) != (int)FALSE) {
+			TaskReadyMask &= ~XPLMI_TASK_READY_BIT(Task->Priority);
+		}
 	}
 }
 
@@ -182,6 +240,38 @@ void XPlmi_TaskInit(void)
 	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
 		metal_list_init(&TaskQueue[Index]);
 	}
+	TaskReadyMask = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function updates the accounting of a task after its handler
+ * has run. The PMC timer counts down.
+ *
+ * @param	Task Pointer to the task node
+ * @param	QueueTime is the timer value when the task was queued
+ * @param	StartTime is the timer value when the handler was called
+ * @param	EndTime is the timer value when the handler returned
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_TaskAccount(XPlmi_TaskNode *Task, u64 QueueTime,
+	u64 StartTime, u64 EndTime)
+{
+	XPlmi_TaskStats *Stats = &Task->Stats;
+	u64 WaitTime = QueueTime - StartTime;
+	u64 RunTime = StartTime - EndTime;
+
+	Stats->RunCnt++;
+	Stats->WaitTime += WaitTime;
+	if (WaitTime > (u64)Stats->MaxWaitTime) {
+		Stats->MaxWaitTime = (u32)WaitTime;
+	}
+	Stats->RunTime += RunTime;
+	if (RunTime > (u64)Stats->MaxRunTime) {
+		Stats->MaxRunTime = (u32)RunTime;
+	}
 }
 
 /*****************************************************************************/
@@ -196,73 +286,56 @@ void XPlmi_TaskInit(void)
 void XPlmi_TaskDispatchLoop(void)
 {
 	int Status = XST_FAILURE;
-	struct metal_list *Node[XPLMI_TASK_PRIORITIES];
 	XPlmi_TaskNode *Task;
 	u32 Index;
+	u64 QueueTime;
+	u64 StartTime;
 #ifdef PLM_DEBUG_DETAILED
-	u64 TaskStartTime;
 	XPlmi_PerfTime PerfTime = {0U};
 #endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
-	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-		Node[Index] = &TaskQueue[Index];
-	}
 
 	while (TRUE) {
-		Task = NULL;
 		XPlmi_SetPlmLiveStatus();
 
 		microblaze_disable_interrupts();
-		/* Priority based task handling */
-		for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-			/* If no pending tasks are present, go to sleep */
-			if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
-				XPlmi_Printf(DEBUG_DETAILED,
-				 "No pending tasks in Priority%d Queue\n\r",
-				 Index);
-				continue;
-			} else {
-				/* Skip the first element as it
-				 * is not proper task
-				 */
-				if ((metal_list_is_empty(Node[Index]) != (int)FALSE) ||
-					(Node[Index] == &TaskQueue[Index])) {
-					Node[Index] = TaskQueue[Index].next;
-				}
-				/* Get the next task in round robin */
-				Task = metal_container_of(Node[Index],
-					XPlmi_TaskNode, TaskNode);
-				Node[Index] = Node[Index]->next;
-				break;
-			}
-		}
-		if (Task != NULL) {
-#ifdef PLM_DEBUG_DETAILED
-			/* Call the task handler */
-			TaskStartTime = XPlmi_GetTimerValue();
-#endif
-			Xil_AssertVoid(Task->Handler != NULL);
-			metal_list_del(&Task->TaskNode);
+		if (TaskReadyMask == 0U) {
+			/*
+			 * Goto sleep when all queues are empty
+			 */
+			XPlmi_Printf(DEBUG_DETAILED,
+				"No pending tasks..Going to sleep\n\r");
+			mb_sleep();
 			microblaze_enable_interrupts();
-			Status = Task->Handler(Task->PrivData);
-#ifdef PLM_DEBUG_DETAILED
-			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
-			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
-				(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
-#endif
-			if (Status != XST_SUCCESS) {
-				XPlmi_ErrMgr(Status);
-			}
 			continue;
 		}
 
 		/*
-		 * Goto sleep when all queues are empty
+		 * Highest priority non empty queue, the tasks of a priority
+		 * are handled in the order they were queued
 		 */
-		XPlmi_Printf(DEBUG_DETAILED,
-			"No pending tasks..Going to sleep\n\r");
-		mb_sleep();
+		Index = (u32)__builtin_clz(TaskReadyMask);
+		Task = metal_container_of(TaskQueue[Index].next,
+			XPlmi_TaskNode, TaskNode);
+		Xil_AssertVoid(Task->Handler != NULL);
+		XPlmi_TaskRemove(Task);
+		/* Task may be queued again as soon as interrupts are enabled */
+		QueueTime = Task->Stats.QueueTime;
 		microblaze_enable_interrupts();
+
+		/* Call the task handler */
+		StartTime = XPlmi_GetTimerValue();
+		Status = Task->Handler(Task->PrivData);
+		XPlmi_TaskAccount(Task, QueueTime, StartTime,
+			XPlmi_GetTimerValue());
+#ifdef PLM_DEBUG_DETAILED
+		XPlmi_MeasurePerfTime(StartTime, &PerfTime);
+		XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
+			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
+		if (Status != XST_SUCCESS) {
+			XPlmi_ErrMgr(Status);
+		}
 	}
 }
@@ -30,6 +30,7 @@
 *       bsv  08/15/2021 Replaced enums with macros
 * 1.05  bsv  03/05/2022 Fix exception while deleting two consecutive tasks of
 *                       same priority
+* 1.06  kc   10/18/2026 Added ready queue bitmap and per task accounting
 *
 * </pre>
 *
@@ -58,6 +59,10 @@ extern "C" {
 #define XPLMI_TASK_MAX			(72U)
 #define XPLMI_TASK_PRIORITIES		(2U)
 #define XPLMI_INVALID_INTR_ID		(0xFFFFFFFFU)
+#define XPLMI_TASK_USEC_PER_SEC		(1000000U)
+
+/* Flags of the task statistics command */
+#define XPLMI_TASK_STATS_CLEAR		(0x1U)
 
 
 #define XPLMI_SCHED_TASK_MISSED				(0x1U)
@@ -69,6 +74,18 @@ extern "C" {
 /**************************** Type Definitions *******************************/
 typedef struct XPlmi_TaskNode XPlmi_TaskNode;
 
+/*
+ * Task accounting, times are in PMC timer ticks
+ */
+typedef struct {
+    u64 QueueTime; /**< Timer value when the task was queued */
+    u64 RunTime; /**< Cumulative handler run time */
+    u64 WaitTime; /**< Cumulative time spent in the ready queue */
+    u32 MaxRunTime; /**< Longest handler run time */
+    u32 MaxWaitTime; /**< Longest time spent in the ready queue */
+    u32 RunCnt; /**< Number of times the handler was called */
+} XPlmi_TaskStats;
+
 struct XPlmi_TaskNode {
     u8 Priority;
     u8 State;
@@ -77,6 +94,7 @@ struct XPlmi_TaskNode {
     struct metal_list TaskNode;
     int (*Handler)(void * PrivData);
     void * PrivData;
+    XPlmi_TaskStats Stats;
 };
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -92,10 +110,12 @@ struct XPlmi_TaskNode {
 XPlmi_TaskNode * XPlmi_TaskCreate(TaskPriority_t Priority,
 	int (*Handler)(void *Arg), void * PrivData);
 void XPlmi_TaskTriggerNow(XPlmi_TaskNode * Task);
+void XPlmi_TaskRemove(XPlmi_TaskNode *Task);
 void XPlmi_TaskInit(void);
 void XPlmi_TaskDispatchLoop(void);
 XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 	const void *PrivData, const u32 IntrId);
+XPlmi_TaskNode *XPlmi_GetTaskByIndex(u32 Index);
 
 /************************** Variable Definitions *****************************/
 
@@ -0,0 +1,95 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xplmi_trace_events.h
+ *
+ * This file contains the IDs of the trace log events and their dictionary.
+ *
+ * A trace record only carries the event ID, a time stamp and the argument
+ * words. The format strings are kept in the dictionary below, which is only
+ * compiled when XPLMI_TRACE_DICTIONARY is defined, so that they never end up
+ * in the PLM elf. The host trace decoder defines XPLMI_TRACE_DICTIONARY and
+ * XPLMI_TRACE_EVENT(Id, StartId, Format) and includes this file to build its
+ * table at compile time. StartId is the event that starts the boot phase
+ * ended by Id, 0 if Id does not end a phase. If the start event has
+ * arguments, start and end of a phase are matched on their first argument.
+ * StartId is XPLMI_TRACE_LOG_DURATION for the events that carry the duration
+ * of a phase in PMC timer ticks in their last two argument words, upper word
+ * first, see XPlmi_TraceLogDuration.
+ *
+ * This file must not include other headers.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- ---------- -------------------------------------------------------
+ * 1.0   kc   10/18/2026 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XPLMI_TRACE_EVENTS_H
+#define XPLMI_TRACE_EVENTS_H
+
+/************************** Constant Definitions *****************************/
+/* Trace log format version, see XPLMI_TRACE_LOG_START */
+#define XPLMI_TRACE_LOG_VERSION_2		(2U)
+
+/* Trace event IDs */
+#define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_LOAD_IMAGE_START	(0x2U)
+#define XPLMI_TRACE_LOG_LOAD_PRTN_START		(0x3U)
+#define XPLMI_TRACE_LOG_LOAD_PRTN		(0x4U)
+#define XPLMI_TRACE_LOG_PMC_CDO_START		(0x5U)
+#define XPLMI_TRACE_LOG_PMC_CDO			(0x6U)
+#define XPLMI_TRACE_LOG_BOOT_PDI_START		(0x7U)
+#define XPLMI_TRACE_LOG_BOOT_PDI		(0x8U)
+#define XPLMI_TRACE_LOG_START			(0x9U)
+#define XPLMI_TRACE_LOG_PLM_INIT		(0xAU)
+#define XPLMI_TRACE_LOG_PDI_INIT		(0xBU)
+#define XPLMI_TRACE_LOG_CDO_PROCESS		(0xCU)
+#define XPLMI_TRACE_LOG_ROM_TIME		(0xDU)
+
+/* StartId of the events carrying their own duration */
+#define XPLMI_TRACE_LOG_DURATION		(0xFFFFU)
+
+#endif /* XPLMI_TRACE_EVENTS_H */
+
+/*****************************************************************************/
+/* Dictionary, outside of the include guard so that it can be expanded again */
+#ifdef XPLMI_TRACE_DICTIONARY
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_START, 0U,
+	"Trace started, format %u, timer %u Hz")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_PMC_CDO_START, 0U,
+	"PMC CDO processing started")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_PMC_CDO, XPLMI_TRACE_LOG_PMC_CDO_START,
+	"PMC CDO processing done, status 0x%x")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_BOOT_PDI_START, 0U,
+	"Boot PDI load started, boot mode 0x%x")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_BOOT_PDI, XPLMI_TRACE_LOG_BOOT_PDI_START,
+	"Boot PDI load done, boot mode 0x%x status 0x%x")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_LOAD_IMAGE_START, 0U,
+	"Image 0x%08x load started")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_LOAD_IMAGE, XPLMI_TRACE_LOG_LOAD_IMAGE_START,
+	"Image 0x%08x loaded")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_LOAD_PRTN_START, 0U,
+	"Partition %u load started, id 0x%x")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_LOAD_PRTN, XPLMI_TRACE_LOG_LOAD_PRTN_START,
+	"Partition %u loaded, %u bytes")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_PLM_INIT, 0U,
+	"PLM initialization done")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_PDI_INIT, XPLMI_TRACE_LOG_DURATION,
+	"PDI initialization, source 0x%x")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_CDO_PROCESS, XPLMI_TRACE_LOG_DURATION,
+	"Partition %u CDO processing")
+XPLMI_TRACE_EVENT(XPLMI_TRACE_LOG_ROM_TIME, XPLMI_TRACE_LOG_DURATION,
+	"PMC ROM")
+#endif
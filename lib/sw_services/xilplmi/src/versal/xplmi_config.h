@@ -44,6 +44,8 @@
 *       ssc  03/05/2022 Moved default config definitions to xparameters.h
 *       ma   05/24/2022 Added PLM_ENABLE_PLM_TO_PLM_COMM macro for SSIT
 *                       PLM to PLM communication
+* 1.09  kc   10/18/2026 Added PLM_CDO_PIPELINE macro
+*       kc   10/18/2026 Added PLM_PRINT_PERF_CDO_PROFILE macro
 *
 * </pre>
 *
@@ -160,6 +162,23 @@ extern "C" {
  * This definition is disabled by default (i.e. not defined).
  */
 //#define PLM_DEBUG_MODE
+
+/**
+ * @name PLM CDO pipeline option
+ *
+ * By default, PLM executes the CDO commands strictly one after the other.
+ * Enabling the below macro lets a DMA_XFER command stay in flight while
+ * the register writes following it in the CDO are executed. Any other
+ * command, and the writes to the control space or near the destination
+ * that may depend on the transfer, wait for it to complete first. A CDO
+ * setting the XPLMI_DMA_XFER_PIPELINE flag states that the writes following
+ * the transfer do not depend on it, so only the writes to the PMC space or
+ * to the transfer's ranges wait. See xplmi_cdo_pipe.h.
+ * Please note that below is defined in xparameters.h based on the
+ * xilplmi library configuration, hence commented out here.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_CDO_PIPELINE
 /**
  * @name PLM STL inclusion options
  *
@@ -186,6 +205,8 @@ extern "C" {
  * KEYHOLE will print the time taken to process keyhole command.
  * Keyhole command is used for Cframe and slave slr image loading.
  * PL prints the PL Power status and House clean status.
+ * CDO_PROFILE prints the time taken and the count of each CDO command per
+ * partition, in the folded stack format taken by flame graph tools.
  * Make sure to enable PLM_PRINT_PERF to see prints.
  */
 //#define PLM_PRINT_PERF_POLL
@@ -193,6 +214,7 @@ extern "C" {
 //#define PLM_PRINT_PERF_CDO_PROCESS
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
+//#define PLM_PRINT_PERF_CDO_PROFILE
 
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
@@ -24,6 +24,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  bm   07/06/2022 Initial release
 *       dc   07/17/2022 Added PLM_OCP configuration
+* 1.01  kc   10/18/2026 Added PLM_CDO_PIPELINE macro
+*       kc   10/18/2026 Added PLM_PRINT_PERF_CDO_PROFILE macro
 *
 * </pre>
 *
@@ -145,6 +147,23 @@ extern "C" {
  */
 //#define PLM_DEBUG_MODE
 
+/**
+ * @name PLM CDO pipeline option
+ *
+ * By default, PLM executes the CDO commands strictly one after the other.
+ * Enabling the below macro lets a DMA_XFER command stay in flight while
+ * the register writes following it in the CDO are executed. Any other
+ * command, and the writes to the control space or near the destination
+ * that may depend on the transfer, wait for it to complete first. A CDO
+ * setting the XPLMI_DMA_XFER_PIPELINE flag states that the writes following
+ * the transfer do not depend on it, so only the writes to the PMC space or
+ * to the transfer's ranges wait. See xplmi_cdo_pipe.h.
+ * Please note that below is defined in xparameters.h based on the
+ * xilplmi library configuration, hence commented out here.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_CDO_PIPELINE
+
 /**
  * NOTE: ALL the configurations below this line can only be done in this file
  *       and NOT through xilplmi library configuration through xparameters.h
@@ -158,6 +177,8 @@ extern "C" {
  * KEYHOLE will print the time taken to process keyhole command.
  * Keyhole command is used for Cframe and slave slr image loading.
  * PL prints the PL Power status and House clean status.
+ * CDO_PROFILE prints the time taken and the count of each CDO command per
+ * partition, in the folded stack format taken by flame graph tools.
  * Make sure to enable PLM_PRINT_PERF to see prints.
  */
 //#define PLM_PRINT_PERF_POLL
@@ -165,6 +186,7 @@ extern "C" {
 //#define PLM_PRINT_PERF_CDO_PROCESS
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
+//#define PLM_PRINT_PERF_CDO_PROFILE
 
 /************************** Function Prototypes ******************************/
 
@@ -23,6 +23,7 @@
 *       ma   07/29/2022 Replaced XPAR_XIPIPSU_0_DEVICE_ID macro with
 *                       XPLMI_IPI_DEVICE_ID
 *       bm   09/14/2022 Move ScatterWrite commands from common to versal_net
+*       kc   10/18/2026 Allow Get Task Stats command over secure IPI
 *
 * </pre>
 *
@@ -84,10 +85,11 @@ int XPlmi_CheckIpiAccess(u32 CmdId, u32 IpiReqType)
 	/* Secure check for PLMI IPI commands */
 	switch (ModuleCmdId) {
 		/*
-		 * Check IPI request type for Event Logging IPI command
-		 * and allow access only if the request is secure
+		 * Check IPI request type for Event Logging and Get Task Stats
+		 * IPI commands and allow access only if the request is secure
 		 */
 		case XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL:
+		case XPLMI_PLM_GENERIC_TASK_STATS_VAL:
 			if (XPLMI_CMD_SECURE == IpiReqType) {
 				Status = XST_SUCCESS;
 			}
@@ -121,8 +123,8 @@ int XPlmi_ValidateCmd(u32 ModuleId, u32 ApiId)
 	switch (ModuleId) {
 		case XPLMI_MODULE_GENERIC_ID:
 			/*
-			 * Only Device ID, Event Logging and Get Board
-			 * commands are allowed through IPI.
+			 * Only Device ID, Event Logging, Get Board and
+			 * Get Task Stats commands are allowed through IPI.
 			 * All other commands are allowed only from CDO file.
 			 */
 			if ((ApiId == XPLMI_PLM_GENERIC_DEVICE_ID_VAL) ||
@@ -130,7 +132,8 @@ int XPlmi_ValidateCmd(u32 ModuleId, u32 ApiId)
 					(ApiId == XPLMI_PLM_MODULES_FEATURES_VAL) ||
 					(ApiId == XPLMI_PLM_GENERIC_PLMUPDATE) ||
 					(ApiId == XPLMI_PLM_MODULES_GET_BOARD_VAL) ||
-					(ApiId == XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL)) {
+					(ApiId == XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL) ||
+					(ApiId == XPLMI_PLM_GENERIC_TASK_STATS_VAL)) {
 				Status = XST_SUCCESS;
 			}
 			break;
@@ -0,0 +1 @@
+/* Host build of xpm_requirement.c, no BSP configuration */
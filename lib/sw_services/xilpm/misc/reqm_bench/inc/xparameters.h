@@ -0,0 +1,7 @@
+/* Host build of xpm_requirement.c, only the parameters its headers need */
+#define XPAR_XCSUDMA_NUM_INSTANCES 1
+#define XPAR_IOMODULE_INTC_MAX_INTR_SIZE 32
+#define XPAR_XCFUPMC_NUM_INSTANCES 1
+#define XPAR_IOMODULE_0_DEVICE_ID 0
+#define XPAR_XCSUDMA_0_DEVICE_ID 0
+#define XPAR_XCSUDMA_1_DEVICE_ID 1
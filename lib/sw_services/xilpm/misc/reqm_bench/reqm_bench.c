@@ -0,0 +1,317 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file reqm_bench.c
+*
+* Host benchmark of the requirement lookup of the PM server, with
+* xpm_requirement.c compiled into this tool.
+*
+* Subsystems are added with requirements on a random share of the main
+* database and PL devices, some subsystems are then re-added. A storm of
+* device requests and releases follows, each one finding the requirement,
+* setting its allocated flag and answering, for every subsystem index, if
+* the device is held, as XPmDevice_GetSubsystemIdOfCore() and
+* XPmDevice_GetPermissions() do. Every answer is checked against a walk of
+* the requirement list of the device, which is also timed as the reference.
+*
+* The bytes taken from the PM pool by the requirements and subsystems are
+* printed, next to what a table of XPM_NODEIDX_DEV_MAX requirement pointers
+* per added subsystem would take.
+*
+* Usage: reqm_bench [-n <operations>] [-r <re-added subsystems>] [-p <%>]
+*	-n	Requests and releases of the storm, 1000000 by default
+*	-r	Subsystems re-added after the first setup, 2 by default
+*	-p	Share of the devices each subsystem has a requirement on, 60%
+*		by default
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include "xpm_requirement.h"
+#include "xpm_subsystem.h"
+
+#define BENCH_PL_DEVICES	64U
+#define BENCH_NUM_DEVICES	((u32)XPM_NODEIDX_DEV_MAX + BENCH_PL_DEVICES)
+#define BENCH_MAX_ADDED		(MAX_NUM_SUBSYSTEMS * 4U)
+
+static XPm_Device Devices[BENCH_NUM_DEVICES];
+/* Latest subsystem of each index, as XPmSubsystem_GetByIndex() returns */
+static XPm_Subsystem *Latest[MAX_NUM_SUBSYSTEMS];
+static XPm_Subsystem *AddedSubsystems[BENCH_MAX_ADDED];
+static u32 NumAdded;
+static u32 PoolBytes;
+static u32 Seed = 1U;
+
+/* PM pool of the target, which never frees */
+void *XPm_AllocBytes(u32 SizeInBytes)
+{
+	PoolBytes += (SizeInBytes + 3U) & ~3U;
+	return calloc(1U, SizeInBytes);
+}
+
+XStatus XPmDevice_Release(const u32 SubsystemId, const u32 DeviceId,
+			  const u32 CmdType)
+{
+	(void)SubsystemId;
+	(void)DeviceId;
+	(void)CmdType;
+	return XST_SUCCESS;
+}
+
+XStatus XPmDevice_UpdateStatus(XPm_Device *Device)
+{
+	(void)Device;
+	return XST_SUCCESS;
+}
+
+static u32 Rand(void)
+{
+	Seed = (Seed * 1103515245U) + 12345U;
+	return Seed >> 8U;
+}
+
+static double NowUs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((double)Ts.tv_sec * 1e6) + ((double)Ts.tv_nsec / 1e3);
+}
+
+/* Lookup of the PM server before the held devices bitmap, for reference */
+static XPm_Requirement *WalkFind(const XPm_Subsystem *Subsystem,
+				 const XPm_Device *Device)
+{
+	XPm_Requirement *Reqm = Device->Requirements;
+
+	while ((NULL != Reqm) && (Reqm->Subsystem != Subsystem)) {
+		Reqm = Reqm->NextSubsystem;
+	}
+
+	return Reqm;
+}
+
+static u32 WalkIsHeld(const XPm_Subsystem *Subsystem, const XPm_Device *Device)
+{
+	const XPm_Requirement *Reqm = WalkFind(Subsystem, Device);
+
+	return ((NULL != Reqm) && (1U == Reqm->Allocated)) ? 1U : 0U;
+}
+
+static XPm_Subsystem *AddSubsystem(u32 Idx, u32 Percent)
+{
+	XPm_Subsystem *Subsystem = XPm_AllocBytes(sizeof(XPm_Subsystem));
+	u32 Dev;
+
+	if (NULL == Subsystem) {
+		return NULL;
+	}
+	Subsystem->Id = NODEID((u32)XPM_NODECLASS_SUBSYSTEM,
+		(u32)XPM_NODESUBCL_SUBSYSTEM, (u32)XPM_NODETYPE_SUBSYSTEM, Idx);
+	for (Dev = 0U; Dev < BENCH_NUM_DEVICES; Dev++) {
+		if ((Rand() % 100U) < Percent) {
+			if (XST_SUCCESS != XPmRequirement_Add(Subsystem,
+				&Devices[Dev], 0U, 0U, 0U)) {
+				return NULL;
+			}
+		}
+	}
+	Latest[Idx] = Subsystem;
+	AddedSubsystems[NumAdded] = Subsystem;
+	NumAdded++;
+
+	return Subsystem;
+}
+
+/* Releases every device, so that both storms start from the same state */
+static void ReleaseAll(void)
+{
+	XPm_Requirement *Reqm;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < NumAdded; Idx++) {
+		Reqm = AddedSubsystems[Idx]->Requirements;
+		while (NULL != Reqm) {
+			XPmRequirement_SetAllocated(Reqm, 0U);
+			Reqm = Reqm->NextDevice;
+		}
+	}
+}
+
+/* Request or release, then the held check of every subsystem index */
+static u32 StormOp(u32 Op, int Walk)
+{
+	XPm_Subsystem *Subsystem = Latest[Op % MAX_NUM_SUBSYSTEMS];
+	XPm_Device *Device = &Devices[(Op >> 4U) % BENCH_NUM_DEVICES];
+	XPm_Requirement *Reqm;
+	u32 Held = 0U;
+	u32 Idx;
+
+	if (0 != Walk) {
+		Reqm = WalkFind(Subsystem, Device);
+		if (NULL != Reqm) {
+			Reqm->Allocated = (u8)((Op >> 12U) & 1U);
+		}
+		for (Idx = 0U; Idx < MAX_NUM_SUBSYSTEMS; Idx++) {
+			Held = (Held << 1U) | WalkIsHeld(Latest[Idx], Device);
+		}
+	} else {
+		Reqm = XPmRequirement_Find(Subsystem, Device);
+		if (NULL != Reqm) {
+			XPmRequirement_SetAllocated(Reqm, (u8)((Op >> 12U) & 1U));
+		}
+		for (Idx = 0U; Idx < MAX_NUM_SUBSYSTEMS; Idx++) {
+			Held = (Held << 1U) |
+				XPmRequirement_IsHeld(Latest[Idx], Device);
+		}
+	}
+
+	return Held;
+}
+
+static int Check(u32 Num)
+{
+	u32 Op;
+	u32 Idx;
+	u32 Dev;
+	XPm_Requirement *Reqm;
+
+	for (Op = 0U; Op < Num; Op++) {
+		(void)StormOp(Rand(), 0);
+	}
+	for (Idx = 0U; Idx < MAX_NUM_SUBSYSTEMS; Idx++) {
+		for (Dev = 0U; Dev < BENCH_NUM_DEVICES; Dev++) {
+			Reqm = XPmRequirement_Find(Latest[Idx], &Devices[Dev]);
+			if ((Reqm != WalkFind(Latest[Idx], &Devices[Dev])) ||
+			    (XPmRequirement_IsHeld(Latest[Idx], &Devices[Dev]) !=
+			     WalkIsHeld(Latest[Idx], &Devices[Dev]))) {
+				printf("mismatch subsystem %u device %u\n",
+					Idx, Dev);
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	u32 Num = 1000000U;
+	u32 ReAdd = 2U;
+	u32 Percent = 60U;
+	u32 Idx;
+	u32 Op;
+	u32 Sum = 0U;
+	u32 Added;
+	double Start;
+	double WalkUs;
+	double IdxUs;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:r:p:")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Num = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			ReAdd = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			Percent = (u32)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n <operations>] "
+				"[-r <re-added subsystems>] [-p <%%>]\n",
+				argv[0]);
+			return 1;
+		}
+	}
+	if (ReAdd > (BENCH_MAX_ADDED - MAX_NUM_SUBSYSTEMS)) {
+		ReAdd = BENCH_MAX_ADDED - MAX_NUM_SUBSYSTEMS;
+	}
+
+	for (Idx = 0U; Idx < BENCH_NUM_DEVICES; Idx++) {
+		if (Idx < (u32)XPM_NODEIDX_DEV_MAX) {
+			Devices[Idx].Node.Id = NODEID((u32)XPM_NODECLASS_DEVICE,
+				(u32)XPM_NODESUBCL_DEV_PERIPH,
+				(u32)XPM_NODETYPE_DEV_PERIPH, Idx);
+		} else {
+			Devices[Idx].Node.Id = NODEID((u32)XPM_NODECLASS_DEVICE,
+				(u32)XPM_NODESUBCL_DEV_PL, 0U,
+				Idx - (u32)XPM_NODEIDX_DEV_MAX);
+		}
+	}
+
+	/* Setup, then check and storm with some subsystems re-added */
+	for (Idx = 0U; Idx < MAX_NUM_SUBSYSTEMS; Idx++) {
+		if (NULL == AddSubsystem(Idx, Percent)) {
+			printf("Out of memory\n");
+			return 1;
+		}
+	}
+	if (0 != Check(Num / 10U)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	for (Idx = 0U; Idx < ReAdd; Idx++) {
+		if (NULL == AddSubsystem(Rand() % MAX_NUM_SUBSYSTEMS, Percent)) {
+			printf("Out of memory\n");
+			return 1;
+		}
+	}
+	if (0 != Check(Num / 10U)) {
+		printf("FAILED\n");
+		return 1;
+	}
+
+	Added = NumAdded;
+	printf("%u subsystems added, %u devices, PM pool %u bytes on the host "
+		"(a %u pointer table per subsystem adds %u on the target)\n",
+		Added, BENCH_NUM_DEVICES, PoolBytes, (u32)XPM_NODEIDX_DEV_MAX,
+		Added * (u32)XPM_NODEIDX_DEV_MAX * 4U);
+
+	ReleaseAll();
+	Seed = 7U;
+	Start = NowUs();
+	for (Op = 0U; Op < Num; Op++) {
+		Sum += StormOp(Rand(), 1);
+	}
+	WalkUs = NowUs() - Start;
+
+	ReleaseAll();
+	Seed = 7U;
+	Start = NowUs();
+	for (Op = 0U; Op < Num; Op++) {
+		Sum -= StormOp(Rand(), 0);
+	}
+	IdxUs = NowUs() - Start;
+
+	printf("list walk     %8.1f ns per operation\n", (WalkUs * 1e3) / Num);
+	printf("held bitmap   %8.1f ns per operation\n", (IdxUs * 1e3) / Num);
+	if (0U != Sum) {
+		printf("FAILED, held answers differ\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
@@ -177,17 +177,7 @@ static XStatus SetAieDeviceNode(u32 Id, XPm_Device *Device)
 
 static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *Subsystem)
 {
-	XPm_Requirement *Reqm = NULL;
-
-	Reqm = Device->Requirements;
-	while (NULL != Reqm) {
-		if (Reqm->Subsystem == Subsystem) {
-			break;
-		}
-		Reqm = Reqm->NextSubsystem;
-	}
-
-	return Reqm;
+	return XPmRequirement_Find(Subsystem, Device);
 }
 
 struct XPm_Reqm *XPmDevice_FindRequirement(const u32 DeviceId, const u32 SubsystemId)
@@ -240,18 +230,15 @@ static XStatus SetDeviceNode(u32 Id, XPm_Device *Device)
  ****************************************************************************/
 u32 XPmDevice_GetSubsystemIdOfCore(const XPm_Device *Device)
 {
-	const XPm_Requirement *Reqm;
 	const XPm_Subsystem *Subsystem = NULL;
 	u32 Idx, SubSystemId;
 	u32 SubsysIdx = XPmSubsystem_GetMaxSubsysIdx();
 
 	for (Idx = 0; Idx <= SubsysIdx; Idx++) {
 		Subsystem = XPmSubsystem_GetByIndex(Idx);
-		if (NULL != Subsystem) {
-			Reqm = FindReqm(Device, Subsystem);
-			if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
-				break;
-			}
+		if ((NULL != Subsystem) &&
+		    (1U == XPmRequirement_IsHeld(Subsystem, Device))) {
+			break;
 		}
 	}
 
@@ -607,7 +594,7 @@ static XStatus HandleDeviceEvent(XPm_Node *Node, u32 Event)
 				Device->Node.Flags &= (u8)(~NODE_IDLE_DONE);
 				if (Device->WfPwrUseCnt == Device->Power->UseCount) {
 					if (1U == Device->WfDealloc) {
-						Device->PendingReqm->Allocated = 0;
+						XPmRequirement_SetAllocated(Device->PendingReqm, 0U);
 						Device->WfDealloc = 0;
 					}
 					if(Device->PendingReqm != NULL) {
@@ -812,7 +799,7 @@ static XStatus DevRequest(XPm_Device *Device, XPm_Subsystem *Subsystem,
 	}
 
 	/* Allocated device for the subsystem */
-	Reqm->Allocated = 1U;
+	XPmRequirement_SetAllocated(Reqm, 1U);
 
 	Status = Device->DeviceOps->SetRequirement(Device, Subsystem,
 						   Capabilities, QoS);
@@ -1728,12 +1715,11 @@ XStatus XPmDevice_GetPermissions(const XPm_Device *Device, u32 *PermissionMask)
 
 	Reqm = Device->Requirements;
 	while (NULL != Reqm) {
-		if (1U == Reqm->Allocated) {
-			for (Idx = 0; Idx <= SubsysIdx; Idx++) {
-				if (Reqm->Subsystem == XPmSubsystem_GetByIndex(Idx)) {
-					*PermissionMask |= ((u32)1U << Idx);
-				}
-			}
+		/* Only the latest subsystem of an index holds its permission bit */
+		Idx = NODEINDEX(Reqm->Subsystem->Id);
+		if ((1U == Reqm->Allocated) && (Idx <= SubsysIdx) &&
+		    (Reqm->Subsystem == XPmSubsystem_GetByIndex(Idx))) {
+			*PermissionMask |= ((u32)1U << Idx);
 		}
 		Reqm = Reqm->NextSubsystem;
 	}
@@ -109,6 +109,7 @@ struct XPm_DeviceNode {
 	struct XPm_Reqm *PendingReqm; /**< Requirement being updated */
 	u8 WfDealloc; /**< Deallocation is pending */
 	u8 WfPwrUseCnt; /**< Pending power use count */
+	u16 ReqmSubsystems; /**< Bit per subsystem index with a requirement on the device */
 	XPm_DeviceOps *DeviceOps; /**< Device operations */
 	XPm_DeviceAttr *DevAttr;  /**< Device attributes */
 	const XPm_DeviceFsm* DeviceFsm; /**< Device finite state machine */
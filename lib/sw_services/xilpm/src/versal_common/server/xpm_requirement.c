@@ -9,10 +9,49 @@
 #include "xpm_power.h"
 #include "xpm_api.h"
 
+/****************************************************************************/
+/**
+ * @brief	Get the index of a device in the held devices bitmap of a
+ *		subsystem
+ *
+ * @param DeviceId	Device ID
+ *
+ * @return	Node index of the device, or XPM_NODEIDX_DEV_MAX for devices
+ *		that are not kept in the bitmap
+ *
+ * @note	Only devices of the main device database are indexed. PL, AIE,
+ *		virtual and healthy boot monitor devices have index spaces of
+ *		their own and are checked through their requirement.
+ *
+ ****************************************************************************/
+static u32 XPmRequirement_GetDevIdx(u32 DeviceId)
+{
+	u32 Idx = (u32)XPM_NODEIDX_DEV_MAX;
+
+	if (((u32)XPM_NODECLASS_DEVICE != NODECLASS(DeviceId)) ||
+	    ((u32)XPM_NODESUBCL_DEV_PL == NODESUBCLASS(DeviceId)) ||
+	    ((u32)XPM_NODESUBCL_DEV_AIE == NODESUBCLASS(DeviceId)) ||
+	    ((u32)XPM_NODETYPE_DEV_GGS == NODETYPE(DeviceId)) ||
+	    ((u32)XPM_NODETYPE_DEV_PGGS == NODETYPE(DeviceId)) ||
+	    (((u32)XPM_NODESUBCL_DEV_PERIPH == NODESUBCLASS(DeviceId)) &&
+	     ((u32)XPM_NODETYPE_DEV_HB_MON == NODETYPE(DeviceId)))) {
+		goto done;
+	}
+
+	if ((u32)XPM_NODEIDX_DEV_MAX > NODEINDEX(DeviceId)) {
+		Idx = NODEINDEX(DeviceId);
+	}
+
+done:
+	return Idx;
+}
+
 static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 				XPm_Device *Device, u32 Flags,
 				u32 PreallocCaps, u32 PreallocQoS)
 {
+	u32 Idx;
+
 	/* Prepend to subsystem's device reqm list */
 	Reqm->NextDevice = Subsystem->Requirements;
 	Subsystem->Requirements = Reqm;
@@ -35,6 +74,18 @@ static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 	Reqm->Next.Capabilities = XPM_MIN_CAPABILITY;
 	Reqm->Next.Latency = XPM_MAX_LATENCY;
 	Reqm->Next.QoS = XPM_MAX_QOS;
+
+	/* Subsystem index is validated against MAX_NUM_SUBSYSTEMS on add */
+	Device->ReqmSubsystems |= (u16)((u32)1U << NODEINDEX(Subsystem->Id));
+
+	/*
+	 * The newest requirement of a subsystem on a device is the one found
+	 * first on the device list, so it replaces any older held state.
+	 */
+	Idx = XPmRequirement_GetDevIdx(Device->Node.Id);
+	if ((u32)XPM_NODEIDX_DEV_MAX > Idx) {
+		Subsystem->HeldDevices[Idx / 32U] &= ~((u32)1U << (Idx % 32U));
+	}
 }
 
 XStatus XPmRequirement_Add(XPm_Subsystem *Subsystem, XPm_Device *Device,
@@ -66,11 +117,115 @@ void XPm_RequiremntUpdate(XPm_Requirement *Reqm)
 	}
 }
 
+/****************************************************************************/
+/**
+ * @brief	Find the requirement of a subsystem on a device
+ *
+ * @param Subsystem	Subsystem imposing the requirement
+ * @param Device	Device the requirement is on
+ *
+ * @return	Pointer to the requirement, NULL if the subsystem has none on
+ *		the device
+ *
+ * @note	Devices without a requirement of the subsystem index are
+ *		rejected with a bit test. Otherwise the requirement list of the
+ *		device, which holds at most one requirement per added subsystem,
+ *		is walked from the newest requirement.
+ *
+ ****************************************************************************/
+XPm_Requirement *XPmRequirement_Find(const XPm_Subsystem *Subsystem,
+				     const XPm_Device *Device)
+{
+	XPm_Requirement *Reqm = NULL;
+
+	if (0U == ((u32)Device->ReqmSubsystems &
+		   ((u32)1U << NODEINDEX(Subsystem->Id)))) {
+		goto done;
+	}
+
+	Reqm = Device->Requirements;
+	while (NULL != Reqm) {
+		if (Reqm->Subsystem == Subsystem) {
+			break;
+		}
+		Reqm = Reqm->NextSubsystem;
+	}
+
+done:
+	return Reqm;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Set or clear the allocated flag of a requirement
+ *
+ * @param Reqm		Requirement
+ * @param Allocated	1 if the device is allocated to the subsystem, else 0
+ *
+ * @return	None
+ *
+ * @note	Keeps the held devices bitmap of the subsystem in step with the
+ *		flag. Reqm->Allocated must not be written directly.
+ *
+ ****************************************************************************/
+void XPmRequirement_SetAllocated(XPm_Requirement *Reqm, u8 Allocated)
+{
+	XPm_Subsystem *Subsystem = Reqm->Subsystem;
+	u32 Idx = XPmRequirement_GetDevIdx(Reqm->Device->Node.Id);
+
+	Reqm->Allocated = Allocated;
+
+	/* Only the newest requirement of the subsystem on the device counts */
+	if (((u32)XPM_NODEIDX_DEV_MAX <= Idx) ||
+	    (XPmRequirement_Find(Subsystem, Reqm->Device) != Reqm)) {
+		goto done;
+	}
+
+	if (1U == Allocated) {
+		Subsystem->HeldDevices[Idx / 32U] |= ((u32)1U << (Idx % 32U));
+	} else {
+		Subsystem->HeldDevices[Idx / 32U] &= ~((u32)1U << (Idx % 32U));
+	}
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Check if a device is allocated to a subsystem
+ *
+ * @param Subsystem	Subsystem
+ * @param Device	Device
+ *
+ * @return	1 if the device is allocated to the subsystem, else 0
+ *
+ ****************************************************************************/
+u32 XPmRequirement_IsHeld(const XPm_Subsystem *Subsystem, const XPm_Device *Device)
+{
+	u32 Held = 0U;
+	const XPm_Requirement *Reqm;
+	u32 Idx = XPmRequirement_GetDevIdx(Device->Node.Id);
+
+	if ((u32)XPM_NODEIDX_DEV_MAX > Idx) {
+		Held = (Subsystem->HeldDevices[Idx / 32U] >> (Idx % 32U)) & 1U;
+		goto done;
+	}
+
+	Reqm = XPmRequirement_Find(Subsystem, Device);
+	if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
+		Held = 1U;
+	}
+
+done:
+	return Held;
+}
+
 void XPmRequirement_Clear(XPm_Requirement* Reqm)
 {
 	if(NULL != Reqm) {
 		/* Clear flag - master is not using slave anymore */
-		Reqm->Allocated = 0;
+		XPmRequirement_SetAllocated(Reqm, 0U);
 		/* Release current and next requirements */
 		Reqm->Curr.Capabilities = XPM_MIN_CAPABILITY;
 		Reqm->Curr.Latency = XPM_MAX_LATENCY;
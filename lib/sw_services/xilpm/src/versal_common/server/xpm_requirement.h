@@ -96,7 +96,7 @@ struct XPm_Reqm {
 	XPm_ReqmInfo Next; /**< Pending requirements */
 	u32 PreallocQoS;  /**< Preallocated QoS value */
 	u16 Flags;	  /** Flags */
-	u8 Allocated; /**< Device has been allocated to the subsystem */
+	u8 Allocated; /**< Device has been allocated to the subsystem, set with XPmRequirement_SetAllocated() */
 	u8 SetLatReq; /**< Latency has been set from the subsystem */
 	u8 PreallocCaps;  /**< Preallocated capabilities */
 	u8 AttrCaps;	/**
@@ -113,6 +113,10 @@ XStatus XPmRequirement_Add(XPm_Subsystem *Subsystem, XPm_Device *Device,
 void XPm_RequiremntUpdate(XPm_Requirement *Reqm);
 XStatus XPmRequirement_Release(XPm_Requirement *Reqm, XPm_ReleaseScope Scope);
 void XPmRequirement_Clear(XPm_Requirement* Reqm);
+XPm_Requirement *XPmRequirement_Find(const XPm_Subsystem *Subsystem,
+				     const XPm_Device *Device);
+void XPmRequirement_SetAllocated(XPm_Requirement *Reqm, u8 Allocated);
+u32 XPmRequirement_IsHeld(const XPm_Subsystem *Subsystem, const XPm_Device *Device);
 XStatus XPmRequirement_UpdateScheduled(const XPm_Subsystem *Subsystem, u32 Swap);
 XStatus XPmRequirement_IsExclusive(const XPm_Requirement *Reqm);
 
@@ -18,6 +18,8 @@
 #include "xpm_requirement.h"
 
 static XPm_Subsystem *PmSubsystems;
+/* Latest subsystem added for each subsystem index */
+static XPm_Subsystem *PmSubsystemsByIdx[MAX_NUM_SUBSYSTEMS];
 static u32 MaxSubsysIdx;
 
 XStatus XPmSubsystem_AddPermission(const XPm_Subsystem *Host,
@@ -285,12 +287,9 @@ XPm_Subsystem * XPmSubsystem_GetById(u32 SubsystemId)
                 goto done;
         }
 
-        SubSystem = PmSubsystems;
-        while (NULL != SubSystem) {
-                if (SubSystem->Id == SubsystemId) {
-                        break;
-                }
-                SubSystem = SubSystem->NextSubsystem;
+        SubSystem = PmSubsystemsByIdx[NODEINDEX(SubsystemId)];
+        if ((NULL != SubSystem) && (SubSystem->Id != SubsystemId)) {
+                SubSystem = NULL;
         }
 
 done:
@@ -315,17 +314,14 @@ done:
  ****************************************************************************/
 XPm_Subsystem *XPmSubsystem_GetByIndex(u32 SubSysIdx)
 {
-        XPm_Subsystem *Subsystem = PmSubsystems;
+        XPm_Subsystem *Subsystem = NULL;
 
         /*
          * We assume that Subsystem class, subclass and type have been
          * validated before, so just validate index against bounds here
          */
-        while (NULL != Subsystem) {
-                if (SubSysIdx == NODEINDEX(Subsystem->Id)) {
-                        break;
-                }
-                Subsystem = Subsystem->NextSubsystem;
+        if (MAX_NUM_SUBSYSTEMS > SubSysIdx) {
+                Subsystem = PmSubsystemsByIdx[SubSysIdx];
         }
 
         return Subsystem;
@@ -588,6 +584,7 @@ XStatus XPmSubsystem_Add(u32 SubsystemId)
                 Subsystem->IpiMask = 0U;
         }
         PmSubsystems = Subsystem;
+        PmSubsystemsByIdx[NODEINDEX(SubsystemId)] = Subsystem;
 
         if (NODEINDEX(SubsystemId) > MaxSubsysIdx) {
                 MaxSubsysIdx = NODEINDEX(SubsystemId);
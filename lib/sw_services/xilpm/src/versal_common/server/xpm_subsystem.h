@@ -9,6 +9,7 @@
 
 #include "xpm_api.h"
 #include "xpm_defs.h"
+#include "xpm_node.h"
 #include "xstatus.h"
 #include "xpm_subsystem_plat.h"
 
@@ -20,6 +21,8 @@ extern "C" {
 #define MAX_NUM_SUBSYSTEMS			(16U)
 #define SUBSYS_TO_NS_BITPOS(x)			(NODE_INDEX_MASK & ((x)))
 #define SUBSYS_TO_S_BITPOS(x)			(NODE_INDEX_MASK & ((x) + MAX_NUM_SUBSYSTEMS))
+/* Words of the held devices bitmap, one bit per device node index */
+#define SUBSYS_HELD_DEV_WORDS			(((u32)XPM_NODEIDX_DEV_MAX + 31U) / 32U)
 
 /**
  * Subsystem specific flags.
@@ -101,6 +104,8 @@ struct XPm_Subsystem {
 	struct XPm_PendSuspCb PendCb;
 	struct XPm_Reqm *Requirements;
 		/**< Head of the requirement list for all devices. */
+	u32 HeldDevices[SUBSYS_HELD_DEV_WORDS];
+		/**< Bit per device node index, set while the device is allocated */
 	struct XPm_FrcPwrDwnReq FrcPwrDwnReq;
 	void (*NotifyCb)(u32 SubsystemId, const u32 EventId);
 	XPm_Subsystem *NextSubsystem;
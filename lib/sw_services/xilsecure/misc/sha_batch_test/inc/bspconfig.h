@@ -0,0 +1 @@
+/* Host build of xsecure_sha_ipihandler.c, no BSP configuration */
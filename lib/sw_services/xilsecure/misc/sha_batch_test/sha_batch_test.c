@@ -0,0 +1,414 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file sha_batch_test.c
+*
+* Host test of the SHA3 batch command of the xilsecure server, with
+* xsecure_sha_ipihandler.c compiled into this tool. The SHA3 driver is
+* replaced by a 48 byte FNV digest and the PMC DMA by copies between host
+* buffers.
+*
+* A non-blocking descriptor fetch fills its destination with a pattern and
+* only copies the descriptors when it is waited for, so hashing a buffer
+* while it is being fetched gives wrong hashes. For 1, 8, 9 and 256
+* descriptors the batch is run without errors and with descriptors failing,
+* and every hash, the status written back to each descriptor, the returned
+* status and the number of fetches are checked. A batch sent while another
+* client has a multi packet update open must fail and leave that digest
+* intact.
+*
+* Usage: sha_batch_test
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- ---------- -------------------------------------------------------
+* 1.0   kc   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xsecure_defs.h"
+#include "xsecure_sha_ipihandler.h"
+#include "xsecure_sha.h"
+#include "xsecure_init.h"
+#include "xsecure_error.h"
+#include "xplmi_dma.h"
+
+#define TEST_DATA_SIZE		0x10000U
+#define TEST_MAX_SIZE		300U
+#define TEST_STATUS_INIT	0xDEADBEEFU
+#define TEST_HASH_INIT		0x5AU
+#define TEST_FETCH_PATTERN	0xA5U
+#define TEST_FIRST_PACKET	0x40000000U
+#define TEST_CONTINUE		0x80000000U
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s:%d: check failed: %s\n", __FILE__,	\
+				__LINE__, #Cond);			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+typedef struct {
+	u64 Src;
+	u64 Dst;
+	u32 Len;
+	u32 Pending;
+} Test_Fetch;
+
+static XSecure_Sha3 Sha3Inst;
+static XPmcDma PmcDma;
+static u64 Digest[XSECURE_HASH_SIZE_IN_BYTES / sizeof(u64)];
+static u32 EngineStarted;
+static Test_Fetch Fetch;
+static u32 BlockingFetches;
+static u32 NonBlockingFetches;
+
+static u8 Data[TEST_DATA_SIZE];
+static XSecure_Sha3BatchEntry List[XSECURE_SHA3_BATCH_MAX_ENTRIES + 1U];
+static u8 Hashes[XSECURE_SHA3_BATCH_MAX_ENTRIES][XSECURE_HASH_SIZE_IN_BYTES];
+static unsigned int Seed = 1U;
+
+static void Test_DigestStart(u64 *DigestPtr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XSECURE_HASH_SIZE_IN_BYTES / sizeof(u64);
+		Index++) {
+		DigestPtr[Index] = 0xCBF29CE484222325ULL + Index;
+	}
+}
+
+static void Test_DigestUpdate(u64 *DigestPtr, const u8 *Buf, u32 Size)
+{
+	u32 Index;
+	u32 Word;
+
+	for (Index = 0U; Index < Size; Index++) {
+		for (Word = 0U; Word < XSECURE_HASH_SIZE_IN_BYTES / sizeof(u64);
+			Word++) {
+			DigestPtr[Word] = (DigestPtr[Word] ^ Buf[Index]) *
+				(0x100000001B3ULL + (2U * Word));
+		}
+	}
+}
+
+/* SHA3 driver, a FNV digest of the input */
+XSecure_Sha3 *XSecure_GetSha3Instance(void)
+{
+	return &Sha3Inst;
+}
+
+int XSecure_Sha3Initialize(XSecure_Sha3 *InstancePtr, XPmcDma *DmaPtr)
+{
+	InstancePtr->DmaPtr = DmaPtr;
+	InstancePtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+	EngineStarted = (u32)FALSE;
+
+	return XST_SUCCESS;
+}
+
+int XSecure_Sha3Start(XSecure_Sha3 *InstancePtr)
+{
+	if (InstancePtr->Sha3State == XSECURE_SHA3_UNINITIALIZED) {
+		return (int)XSECURE_SHA3_STATE_MISMATCH_ERROR;
+	}
+	Test_DigestStart(Digest);
+	EngineStarted = (u32)TRUE;
+
+	return XST_SUCCESS;
+}
+
+int XSecure_Sha3Update64Bit(XSecure_Sha3 *InstancePtr, u64 InDataAddr,
+	u32 Size)
+{
+	(void)InstancePtr;
+
+	if (EngineStarted != (u32)TRUE) {
+		return (int)XSECURE_SHA3_STATE_MISMATCH_ERROR;
+	}
+	if (InDataAddr == 0U) {
+		return (int)XSECURE_SHA3_PMC_DMA_UPDATE_ERROR;
+	}
+	Test_DigestUpdate(Digest, (const u8 *)(UINTPTR)InDataAddr, Size);
+
+	return XST_SUCCESS;
+}
+
+int XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, XSecure_Sha3Hash *Sha3Hash)
+{
+	(void)InstancePtr;
+
+	if (EngineStarted != (u32)TRUE) {
+		return (int)XSECURE_SHA3_STATE_MISMATCH_ERROR;
+	}
+	memcpy(Sha3Hash->Hash, Digest, XSECURE_HASH_SIZE_IN_BYTES);
+	EngineStarted = (u32)FALSE;
+
+	return XST_SUCCESS;
+}
+
+/* PMC DMA, a non-blocking transfer lands when it is waited for */
+XPmcDma *XPlmi_GetDmaInstance(u32 DeviceId)
+{
+	(void)DeviceId;
+
+	return &PmcDma;
+}
+
+int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	if ((Flags & XPLMI_DMA_SRC_NONBLK) != 0U) {
+		if (Fetch.Pending != 0U) {
+			return XST_FAILURE;
+		}
+		Fetch.Src = SrcAddr;
+		Fetch.Dst = DestAddr;
+		Fetch.Len = Len;
+		Fetch.Pending = 1U;
+		memset((void *)(UINTPTR)DestAddr, TEST_FETCH_PATTERN, Len * 4U);
+		NonBlockingFetches++;
+	} else {
+		memcpy((void *)(UINTPTR)DestAddr, (const void *)(UINTPTR)SrcAddr,
+			Len * 4U);
+		BlockingFetches++;
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	if (Fetch.Pending == 0U) {
+		return XST_FAILURE;
+	}
+	memcpy((void *)(UINTPTR)Fetch.Dst, (const void *)(UINTPTR)Fetch.Src,
+		Fetch.Len * 4U);
+	Fetch.Pending = 0U;
+
+	return XST_SUCCESS;
+}
+
+static int Test_Send(u32 ApiId, u32 *Payload)
+{
+	XPlmi_Cmd Cmd;
+
+	memset(&Cmd, 0, sizeof(Cmd));
+	Cmd.CmdId = XSECURE_API(ApiId);
+	Cmd.Payload = Payload;
+
+	return XSecure_Sha3IpiHandler(&Cmd);
+}
+
+static int Test_Batch(const XSecure_Sha3BatchEntry *ListPtr, u32 NumEntries)
+{
+	u32 Payload[3U];
+
+	Payload[0U] = (u32)(UINTPTR)ListPtr;
+	Payload[1U] = (u32)((u64)(UINTPTR)ListPtr >> 32U);
+	Payload[2U] = NumEntries;
+
+	return Test_Send(XSECURE_API_SHA3_BATCH, Payload);
+}
+
+static int Test_Update(const void *Buf, u32 Size, void *HashPtr)
+{
+	u32 Payload[5U];
+
+	Payload[0U] = (u32)(UINTPTR)Buf;
+	Payload[1U] = (u32)((u64)(UINTPTR)Buf >> 32U);
+	Payload[2U] = Size;
+	Payload[3U] = (u32)(UINTPTR)HashPtr;
+	Payload[4U] = (u32)((u64)(UINTPTR)HashPtr >> 32U);
+
+	return Test_Send(XSECURE_API_SHA3_UPDATE, Payload);
+}
+
+/*
+ * Fills the list with NumEntries descriptors. With Errors set, some have no
+ * hash address and some an input the DMA fails on.
+ */
+static void Test_FillList(u32 NumEntries, u32 Errors)
+{
+	u32 Index;
+	u32 Size;
+
+	memset(Hashes, TEST_HASH_INIT, sizeof(Hashes));
+	for (Index = 0U; Index < NumEntries; Index++) {
+		Size = (u32)rand_r(&Seed) % TEST_MAX_SIZE;
+		List[Index].DataAddr = (u64)(UINTPTR)&Data[(u32)rand_r(&Seed) %
+			(TEST_DATA_SIZE - TEST_MAX_SIZE)];
+		List[Index].HashAddr = (u64)(UINTPTR)Hashes[Index];
+		List[Index].Size = Size;
+		List[Index].Status = TEST_STATUS_INIT;
+		if (Errors != 0U) {
+			if ((Index % 7U) == 3U) {
+				List[Index].HashAddr = 0U;
+			} else if ((Index % 11U) == 5U) {
+				List[Index].DataAddr = 0U;
+				List[Index].Size = Size + 1U;
+			}
+		}
+	}
+}
+
+static int Test_CheckEntry(u32 Index)
+{
+	const XSecure_Sha3BatchEntry *EntryPtr = &List[Index];
+	u64 Expected[XSECURE_HASH_SIZE_IN_BYTES / sizeof(u64)];
+	u32 Byte;
+
+	if (EntryPtr->HashAddr == 0U) {
+		TEST_CHECK(EntryPtr->Status ==
+			(u32)XSECURE_SHA3_INVALID_PARAM);
+		for (Byte = 0U; Byte < XSECURE_HASH_SIZE_IN_BYTES; Byte++) {
+			TEST_CHECK(Hashes[Index][Byte] == TEST_HASH_INIT);
+		}
+	} else if (EntryPtr->DataAddr == 0U) {
+		TEST_CHECK(EntryPtr->Status ==
+			(u32)XSECURE_SHA3_PMC_DMA_UPDATE_ERROR);
+		for (Byte = 0U; Byte < XSECURE_HASH_SIZE_IN_BYTES; Byte++) {
+			TEST_CHECK(Hashes[Index][Byte] == TEST_HASH_INIT);
+		}
+	} else {
+		TEST_CHECK(EntryPtr->Status == (u32)XST_SUCCESS);
+		Test_DigestStart(Expected);
+		Test_DigestUpdate(Expected,
+			(const u8 *)(UINTPTR)EntryPtr->DataAddr, EntryPtr->Size);
+		TEST_CHECK(memcmp(Hashes[Index], Expected,
+			XSECURE_HASH_SIZE_IN_BYTES) == 0);
+	}
+
+	return XST_SUCCESS;
+}
+
+static int Test_Run(u32 NumEntries, u32 Errors)
+{
+	int FirstErr = XST_SUCCESS;
+	u32 Index;
+	int Status;
+
+	Test_FillList(NumEntries, Errors);
+	BlockingFetches = 0U;
+	NonBlockingFetches = 0U;
+
+	Status = Test_Batch(List, NumEntries);
+
+	for (Index = 0U; Index < NumEntries; Index++) {
+		TEST_CHECK(Test_CheckEntry(Index) == XST_SUCCESS);
+		if ((List[Index].Status != (u32)XST_SUCCESS) &&
+			(FirstErr == XST_SUCCESS)) {
+			FirstErr = (int)List[Index].Status;
+		}
+	}
+	TEST_CHECK(Status == FirstErr);
+	TEST_CHECK((Errors == 0U) || (NumEntries < 4U) ||
+		(Status != XST_SUCCESS));
+	TEST_CHECK(Fetch.Pending == 0U);
+	TEST_CHECK(BlockingFetches == 1U);
+	TEST_CHECK(NonBlockingFetches == ((NumEntries + 7U) / 8U) - 1U);
+
+	printf("%3u descriptors%s: %u fetches, status 0x%x\n", NumEntries,
+		(Errors != 0U) ? " with errors" : "",
+		BlockingFetches + NonBlockingFetches, (u32)Status);
+
+	return XST_SUCCESS;
+}
+
+static int Test_InvalidLists(void)
+{
+	Test_FillList(1U, 0U);
+	TEST_CHECK(Test_Batch(List, 0U) == (int)XSECURE_SHA3_INVALID_PARAM);
+	TEST_CHECK(Test_Batch(List, XSECURE_SHA3_BATCH_MAX_ENTRIES + 1U) ==
+		(int)XSECURE_SHA3_INVALID_PARAM);
+	TEST_CHECK(Test_Batch((const XSecure_Sha3BatchEntry *)
+		((const u8 *)List + 4U), 1U) ==
+		(int)XSECURE_SHA3_INVALID_PARAM);
+	TEST_CHECK(List[0U].Status == TEST_STATUS_INIT);
+
+	return XST_SUCCESS;
+}
+
+/* A batch must not start while another client's digest is open */
+static int Test_UpdateInProgress(void)
+{
+	u64 Expected[XSECURE_HASH_SIZE_IN_BYTES / sizeof(u64)];
+	u8 Hash[XSECURE_HASH_SIZE_IN_BYTES];
+
+	TEST_CHECK(Test_Update(Data, 100U | TEST_FIRST_PACKET |
+		TEST_CONTINUE, NULL) == XST_SUCCESS);
+
+	Test_FillList(8U, 0U);
+	TEST_CHECK(Test_Batch(List, 8U) ==
+		(int)XSECURE_SHA3_STATE_MISMATCH_ERROR);
+	TEST_CHECK(List[0U].Status == TEST_STATUS_INIT);
+
+	TEST_CHECK(Test_Update(&Data[100U], 60U | TEST_CONTINUE, NULL) ==
+		XST_SUCCESS);
+	TEST_CHECK(Test_Batch(List, 8U) ==
+		(int)XSECURE_SHA3_STATE_MISMATCH_ERROR);
+	TEST_CHECK(Test_Update(NULL, 0U, Hash) == XST_SUCCESS);
+
+	Test_DigestStart(Expected);
+	Test_DigestUpdate(Expected, Data, 160U);
+	TEST_CHECK(memcmp(Hash, Expected, sizeof(Hash)) == 0);
+
+	/* The digest is finished, batches run again */
+	TEST_CHECK(Test_Batch(List, 8U) == XST_SUCCESS);
+	TEST_CHECK(Test_CheckEntry(7U) == XST_SUCCESS);
+
+	/* A failed update also closes the digest */
+	TEST_CHECK(Test_Update(Data, 100U | TEST_FIRST_PACKET |
+		TEST_CONTINUE, NULL) == XST_SUCCESS);
+	TEST_CHECK(Test_Update(NULL, 60U | TEST_CONTINUE, NULL) ==
+		(int)XSECURE_SHA3_PMC_DMA_UPDATE_ERROR);
+	TEST_CHECK(Test_Batch(List, 8U) == XST_SUCCESS);
+
+	printf("batch refused while a multi packet update is open\n");
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	static const u32 Counts[] = {1U, 8U, 9U, XSECURE_SHA3_BATCH_MAX_ENTRIES};
+	u32 Index;
+	u32 Errors;
+
+	for (Index = 0U; Index < TEST_DATA_SIZE; Index++) {
+		Data[Index] = (u8)rand_r(&Seed);
+	}
+
+	for (Index = 0U; Index < sizeof(Counts) / sizeof(Counts[0U]); Index++) {
+		for (Errors = 0U; Errors < 2U; Errors++) {
+			if (Test_Run(Counts[Index], Errors) != XST_SUCCESS) {
+				printf("FAILED\n");
+				return 1;
+			}
+		}
+	}
+
+	if ((Test_InvalidLists() != XST_SUCCESS) ||
+		(Test_UpdateInProgress() != XST_SUCCESS)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
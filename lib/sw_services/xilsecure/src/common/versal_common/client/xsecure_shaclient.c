@@ -26,6 +26,8 @@
 *                     XSecure_Sha3Initialize API
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
 * 5.0   kpt  07/24/22 Moved XSecure_Sha3Kat into xsecure_katclient.c
+*       kc   10/18/26 Added XSecure_Sha3QueueInit, XSecure_Sha3QueueAdd and
+*                     XSecure_Sha3QueueSubmit
 *
 * </pre>
 *
@@ -220,3 +222,154 @@ int XSecure_Sha3Digest(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function initializes a queue of SHA3 hash jobs
+ *
+ * @param	QueuePtr	Pointer to the queue
+ * @param	Entries		Descriptor list of the queue. It must be
+ *				8 byte aligned and in memory the server can
+ *				access
+ * @param	MaxEntries	Number of descriptors in Entries
+ *
+ * @return
+ *	-	XST_SUCCESS - If the queue is initialized
+ *	-	XST_FAILURE - On invalid parameter
+ *
+ ******************************************************************************/
+int XSecure_Sha3QueueInit(XSecure_Sha3Queue *QueuePtr, XSecure_Sha3BatchEntry *Entries, u32 MaxEntries)
+{
+	volatile int Status = XST_FAILURE;
+
+	if ((QueuePtr == NULL) || (Entries == NULL) || (MaxEntries == 0U) ||
+		(((UINTPTR)Entries & (sizeof(u64) - 1U)) != 0U)) {
+		goto END;
+	}
+
+	QueuePtr->Entries = Entries;
+	QueuePtr->MaxEntries = MaxEntries;
+	QueuePtr->Count = 0U;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds a hash job to a queue. The job runs when the
+ *		queue is submitted
+ *
+ * @param	QueuePtr	Pointer to the queue
+ * @param	InDataAddr	Address of the input data
+ * @param	Size		Size of the input data in bytes
+ * @param	OutDataAddr	Address of the buffer to store the 48 byte
+ *				output hash
+ *
+ * @return
+ *	-	XST_SUCCESS - If the job is queued
+ *	-	XST_FAILURE - On invalid parameter or if the queue is full
+ *
+ ******************************************************************************/
+int XSecure_Sha3QueueAdd(XSecure_Sha3Queue *QueuePtr, const u64 InDataAddr, u32 Size, const u64 OutDataAddr)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_Sha3BatchEntry *EntryPtr;
+
+	if ((QueuePtr == NULL) || (QueuePtr->Entries == NULL) ||
+		(OutDataAddr == 0U)) {
+		goto END;
+	}
+
+	if (QueuePtr->Count >= QueuePtr->MaxEntries) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Sha3 queue is full \r\n");
+		goto END;
+	}
+
+	EntryPtr = &QueuePtr->Entries[QueuePtr->Count];
+	EntryPtr->DataAddr = InDataAddr;
+	EntryPtr->HashAddr = OutDataAddr;
+	EntryPtr->Size = Size;
+	EntryPtr->Status = (u32)XST_FAILURE;
+	QueuePtr->Count++;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sends the queued hash jobs to the server. Up to
+ *		XSECURE_SHA3_BATCH_MAX_ENTRIES jobs are sent with one IPI
+ *		request and run back to back on the SHA3 engine
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	QueuePtr	Pointer to the queue
+ *
+ * @return
+ *	-	XST_SUCCESS - If the hash of every job is calculated
+ *	-	XST_FAILURE - On invalid parameter or if a SHA3 operation
+ *			started with XSecure_Sha3Update is in progress
+ *	-	ErrorCode - Error of the first failing job. The Status field
+ *			of each descriptor holds the result of its job
+ *
+ * @note	The queue is empty on return. The descriptors keep their
+ *		status until the next XSecure_Sha3QueueAdd.
+ *
+ ******************************************************************************/
+int XSecure_Sha3QueueSubmit(XSecure_ClientInstance *InstancePtr, XSecure_Sha3Queue *QueuePtr)
+{
+	volatile int Status = XST_FAILURE;
+	int FirstErr = XST_SUCCESS;
+	u32 Payload[XSECURE_PAYLOAD_LEN_4U];
+	XSecure_Sha3BatchEntry *EntryPtr;
+	u32 Done = 0U;
+	u32 Cnt;
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) ||
+		(QueuePtr == NULL) || (QueuePtr->Entries == NULL)) {
+		goto END;
+	}
+
+	/* A batch restarts the SHA3 engine, so no other operation may be open */
+	if (Sha3State != XSECURE_SHA_UNINITIALIZED) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+		goto END;
+	}
+
+	while (Done < QueuePtr->Count) {
+		Cnt = QueuePtr->Count - Done;
+		if (Cnt > XSECURE_SHA3_BATCH_MAX_ENTRIES) {
+			Cnt = XSECURE_SHA3_BATCH_MAX_ENTRIES;
+		}
+		EntryPtr = &QueuePtr->Entries[Done];
+
+		XSecure_DCacheFlushRange(EntryPtr,
+			Cnt * sizeof(XSecure_Sha3BatchEntry));
+
+		/* Fill IPI Payload */
+		Payload[0U] = HEADER(0U, XSECURE_API_SHA3_BATCH);
+		Payload[1U] = (u32)(UINTPTR)EntryPtr;
+		Payload[2U] = (u32)((u64)(UINTPTR)EntryPtr >> 32);
+		Payload[3U] = Cnt;
+
+		Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
+
+		/* The server writes the status of each job to its descriptor */
+		XSecure_DCacheInvalidateRange(EntryPtr,
+			Cnt * sizeof(XSecure_Sha3BatchEntry));
+		if ((Status != XST_SUCCESS) && (FirstErr == XST_SUCCESS)) {
+			XSecure_Printf(XSECURE_DEBUG_GENERAL, "Sha3 Batch Failed \r\n");
+			FirstErr = Status;
+		}
+		Done += Cnt;
+	}
+
+	QueuePtr->Count = 0U;
+	Status = FirstErr;
+
+END:
+	return Status;
+}
@@ -23,6 +23,7 @@
 *       kpt  04/28/21 Added enum XSecure_ShaState to update sha driver states
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
 * 5.0   kpt  07/24/22 Moved XSecure_Sha3Kat into xsecure_katclient.c
+*       kc   10/18/26 Added SHA3 job queue APIs
 *
 * </pre>
 *
@@ -50,6 +51,13 @@ typedef enum {
 	XSECURE_SHA_INITIALIZED,
 	XSECURE_SHA_UPDATE
 }XSecure_ShaState;
+
+typedef struct {
+	XSecure_Sha3BatchEntry *Entries;	/**< Descriptor list, in memory
+						  *  shared with the server */
+	u32 MaxEntries;		/**< Number of descriptors in Entries */
+	u32 Count;		/**< Number of queued jobs */
+} XSecure_Sha3Queue;
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
@@ -57,6 +65,9 @@ int XSecure_Sha3Initialize(void);
 int XSecure_Sha3Update(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr, u32 Size);
 int XSecure_Sha3Finish(XSecure_ClientInstance *InstancePtr, const u64 OutDataAddr);
 int XSecure_Sha3Digest(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr, const u64 OutDataAddr, u32 Size);
+int XSecure_Sha3QueueInit(XSecure_Sha3Queue *QueuePtr, XSecure_Sha3BatchEntry *Entries, u32 MaxEntries);
+int XSecure_Sha3QueueAdd(XSecure_Sha3Queue *QueuePtr, const u64 InDataAddr, u32 Size, const u64 OutDataAddr);
+int XSecure_Sha3QueueSubmit(XSecure_ClientInstance *InstancePtr, XSecure_Sha3Queue *QueuePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -21,6 +21,8 @@
 * 4.7   kpt  11/29/21 Added macro XSecure_DCacheFlushRange
 * 5.0   bm   07/06/22 Refactor versal and versal_net code
 *       kpt  07/24/22 Added XSecure_EccCrvClass
+*       kc   10/18/26 Added XSecure_Sha3BatchEntry and
+*                     XSecure_DCacheInvalidateRange
 *
 * </pre>
 * @note
@@ -68,12 +70,26 @@ extern "C" {
 	#define XSecure_DCacheFlushRange(SrcAddr, Len) {}
 #endif /**< Cache Invalidate function */
 
+#ifndef XSECURE_CACHE_DISABLE
+	#if defined(__microblaze__)
+		#define XSecure_DCacheInvalidateRange(SrcAddr, Len) Xil_DCacheInvalidateRange((UINTPTR)SrcAddr, Len)
+	#else
+		#define XSecure_DCacheInvalidateRange(SrcAddr, Len) Xil_DCacheInvalidateRange((INTPTR)SrcAddr, Len)
+	#endif
+#else
+	#define XSecure_DCacheInvalidateRange(SrcAddr, Len) {}
+#endif /**< Cache Invalidate function */
+
 #define XSECURE_API(ApiId)	((u32)ApiId)
 				/**< Macro to typecast XILSECURE API ID */
 
 #define XSECURE_API_ID_MASK	0xFFU
 				/**< Mask for API ID in Secure IPI command */
 
+#define XSECURE_SHA3_BATCH_MAX_ENTRIES	(256U)
+				/**< Maximum descriptors in one SHA3 batch
+				 *   command */
+
 /************************** Variable Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
@@ -118,6 +134,13 @@ typedef struct {
 	u32 IsLast;	/**< Flag to indicate last update of data*/
 } XSecure_AesInParams;
 
+typedef struct {
+	u64 DataAddr;	/**< Address of input data */
+	u64 HashAddr;	/**< Address of the 48 byte hash output */
+	u32 Size;	/**< Length of input data */
+	u32 Status;	/**< Status of the hash, written by the server */
+} XSecure_Sha3BatchEntry;
+
 typedef enum {
 	XSECURE_ENCRYPT,	/**< Encrypt operation */
 	XSECURE_DECRYPT,	/**< Decrypt operation */
@@ -25,6 +25,7 @@
 * 4.7   am   03/08/2022 Fixed MISRA C violations
 * 5.0   bm   07/06/2022 Refactor versal and versal_net code
 *       kpt  07/24/2022 Added XSecure_KatIpiHandler
+*       kc   10/18/2026 Added SHA3 batch command
 *
 * </pre>
 *
@@ -88,6 +89,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 
 	switch (ApiId) {
 	case XSECURE_API(XSECURE_API_SHA3_UPDATE):
+	case XSECURE_API(XSECURE_API_SHA3_BATCH):
 #ifndef PLM_SECURE_EXCLUDE
 	case XSECURE_API(XSECURE_API_RSA_PRIVATE_DECRYPT):
 	case XSECURE_API(XSECURE_API_RSA_PUBLIC_ENCRYPT):
@@ -135,6 +137,7 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 		Status = XSecure_FeaturesCmd(Pload[0]);
 		break;
 	case XSECURE_API(XSECURE_API_SHA3_UPDATE):
+	case XSECURE_API(XSECURE_API_SHA3_BATCH):
 		Status = XSecure_Sha3IpiHandler(Cmd);
 		break;
 #ifndef PLM_SECURE_EXCLUDE
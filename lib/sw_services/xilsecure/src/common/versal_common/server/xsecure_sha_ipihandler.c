@@ -25,6 +25,7 @@
 * 4.6   har   07/14/2021 Fixed doxygen warnings
 *       gm    07/16/2021 Added support for 64-bit address
 * 5.0   kpt   07/24/2022 Moved XSecure_ShaKat into xsecure_kat_plat_ipihandler.c
+*       kc    10/18/2026 Added SHA3 batch command
 *
 * </pre>
 *
@@ -34,6 +35,7 @@
 ******************************************************************************/
 
 /***************************** Include Files *********************************/
+#include <stddef.h>
 #include "xplmi_dma.h"
 #include "xsecure_defs.h"
 #include "xsecure_sha.h"
@@ -47,12 +49,26 @@
 					/**< IPI Continue Mask */
 #define XSECURE_IPI_FIRST_PACKET_MASK		(0x40000000U)
 					/**< IPI First packet Mask */
+#define XSECURE_SHA3_BATCH_CHUNK		(8U)
+					/**< Batch descriptors fetched per DMA
+					 *   transfer */
 
 /************************** Function Prototypes *****************************/
 
 static int XSecure_ShaInitialize(void);
 static int XSecure_ShaUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
 	u32 DstAddrLow, u32 DstAddrHigh);
+static int XSecure_ShaBatch(u32 ListAddrLow, u32 ListAddrHigh, u32 NumEntries);
+static int XSecure_ShaBatchEntry(XSecure_Sha3 *XSecureSha3InstPtr,
+	const XSecure_Sha3BatchEntry *EntryPtr);
+
+/************************** Variable Definitions *****************************/
+
+/** Two buffers of descriptors, one hashed while the other is fetched */
+static XSecure_Sha3BatchEntry BatchDesc[2U][XSECURE_SHA3_BATCH_CHUNK];
+
+/** TRUE from the first packet of a multi packet SHA3 update to its finish */
+static u32 Sha3UpdateInProgress = (u32)FALSE;
 
 /*************************** Function Definitions *****************************/
 
@@ -77,6 +93,10 @@ int XSecure_Sha3IpiHandler(XPlmi_Cmd *Cmd)
 		Status = XSecure_ShaUpdate(Pload[0], Pload[1],
 				Pload[2], Pload[3], Pload[4]);
 	}
+	else if ((Cmd->CmdId & XSECURE_API_ID_MASK) ==
+		XSECURE_API(XSECURE_API_SHA3_BATCH)) {
+		Status = XSecure_ShaBatch(Pload[0], Pload[1], Pload[2]);
+	}
 	else {
 		Status = XST_INVALID_PARAM;
 	}
@@ -146,18 +166,24 @@ static int XSecure_ShaUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
 	u32 Index = 0U;
 
 	if ((InputSize & XSECURE_IPI_FIRST_PACKET_MASK) != 0x0U) {
+		Sha3UpdateInProgress = (u32)FALSE;
 		Status = XSecure_ShaInitialize();
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
+		Sha3UpdateInProgress = (u32)TRUE;
 	}
 
 	if ((InputSize & XSECURE_IPI_CONTINUE_MASK) != 0x0U) {
 		InputSize = InputSize & (~XSECURE_IPI_CONTINUE_MASK) &
 			(~XSECURE_IPI_FIRST_PACKET_MASK);
 		Status = XSecure_Sha3Update64Bit(XSecureSha3InstPtr, DataAddr, InputSize);
+		if (Status != XST_SUCCESS) {
+			Sha3UpdateInProgress = (u32)FALSE;
+		}
 	}
 	else {
+		Sha3UpdateInProgress = (u32)FALSE;
 		Status = XSecure_Sha3Finish(XSecureSha3InstPtr,
 				(XSecure_Sha3Hash *)&Hash);
 		if (XST_SUCCESS == Status) {
@@ -171,3 +197,171 @@ static int XSecure_ShaUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief       This function calculates the SHA3 hash of every descriptor of
+ *		a batch list, back to back on the SHA3 engine
+ *
+ * @param	ListAddrLow	- Lower 32 bit address of the descriptor list
+ * 		ListAddrHigh	- Higher 32 bit address of the descriptor list
+ * 		NumEntries	- Number of descriptors in the list
+ *
+ * @return
+ *	-	XST_SUCCESS - If the hash of every descriptor is calculated
+ *	-	XSECURE_SHA3_STATE_MISMATCH_ERROR - If a multi packet SHA3
+ *			update is in progress
+ *	-	ErrorCode - Error of the first failing descriptor, or of the
+ *			list itself
+ *
+ * @note	The descriptors are copied to PMC RAM by PMC DMA1, the next
+ *		chunk being fetched while the current one is hashed through
+ *		PMC DMA0. The hash and the status of each descriptor are
+ *		written back to it in the list.
+ *
+ ******************************************************************************/
+static int XSecure_ShaBatch(u32 ListAddrLow, u32 ListAddrHigh, u32 NumEntries)
+{
+	volatile int Status = XST_FAILURE;
+	int EntryStatus = XST_FAILURE;
+	int FirstErr = XST_SUCCESS;
+	XSecure_Sha3 *XSecureSha3InstPtr = XSecure_GetSha3Instance();
+	XPmcDma *PmcDmaInstPtr = XPlmi_GetDmaInstance(0U);
+	u64 ListAddr = ((u64)ListAddrHigh << 32) | (u64)ListAddrLow;
+	u64 EntryAddr;
+	u32 Buf = 0U;
+	u32 Done = 0U;
+	u32 Cnt;
+	u32 NextCnt;
+	u32 Index;
+
+	if ((NumEntries == 0U) || (NumEntries > XSECURE_SHA3_BATCH_MAX_ENTRIES) ||
+		((ListAddr & (u64)(sizeof(u64) - 1U)) != 0U)) {
+		Status = (int)XSECURE_SHA3_INVALID_PARAM;
+		goto END;
+	}
+
+	/* The engine holds the digest of another client's update */
+	if (Sha3UpdateInProgress == (u32)TRUE) {
+		Status = (int)XSECURE_SHA3_STATE_MISMATCH_ERROR;
+		goto END;
+	}
+
+	if (NULL == PmcDmaInstPtr) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3Initialize(XSecureSha3InstPtr, PmcDmaInstPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Cnt = (NumEntries < XSECURE_SHA3_BATCH_CHUNK) ? NumEntries :
+		XSECURE_SHA3_BATCH_CHUNK;
+	Status = XPlmi_DmaXfr(ListAddr, (u64)(UINTPTR)BatchDesc[Buf],
+		(Cnt * (u32)sizeof(XSecure_Sha3BatchEntry)) >> 2U,
+		XPLMI_PMCDMA_1);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	while (Done < NumEntries) {
+		NextCnt = NumEntries - Done - Cnt;
+		if (NextCnt > XSECURE_SHA3_BATCH_CHUNK) {
+			NextCnt = XSECURE_SHA3_BATCH_CHUNK;
+		}
+
+		/* Fetch the next descriptors while the current ones are hashed */
+		if (NextCnt != 0U) {
+			Status = XPlmi_DmaXfr(ListAddr + ((u64)(Done + Cnt) *
+				sizeof(XSecure_Sha3BatchEntry)),
+				(u64)(UINTPTR)BatchDesc[Buf ^ 1U],
+				(NextCnt * (u32)sizeof(XSecure_Sha3BatchEntry)) >> 2U,
+				XPLMI_PMCDMA_1 | XPLMI_DMA_SRC_NONBLK);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
+		for (Index = 0U; Index < Cnt; Index++) {
+			EntryStatus = XSecure_ShaBatchEntry(XSecureSha3InstPtr,
+				&BatchDesc[Buf][Index]);
+			EntryAddr = ListAddr + ((u64)(Done + Index) *
+				sizeof(XSecure_Sha3BatchEntry));
+			XPlmi_Out64(EntryAddr + offsetof(XSecure_Sha3BatchEntry,
+				Status), (u32)EntryStatus);
+			if ((EntryStatus != XST_SUCCESS) &&
+				(FirstErr == XST_SUCCESS)) {
+				FirstErr = EntryStatus;
+			}
+		}
+
+		if (NextCnt != 0U) {
+			Status = XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_1);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		Done += Cnt;
+		Cnt = NextCnt;
+		Buf ^= 1U;
+	}
+
+	Status = FirstErr;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function calculates the SHA3 hash of one batch descriptor
+ *		and writes it to the output address of the descriptor
+ *
+ * @param	XSecureSha3InstPtr	- Pointer to the initialized SHA3
+ *					instance
+ * 		EntryPtr		- Pointer to the descriptor
+ *
+ * @return
+ *	-	XST_SUCCESS - If the hash is calculated
+ *	-	ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_ShaBatchEntry(XSecure_Sha3 *XSecureSha3InstPtr,
+	const XSecure_Sha3BatchEntry *EntryPtr)
+{
+	int Status = XST_FAILURE;
+	XSecure_Sha3Hash Hash = {0U};
+	u32 Index;
+
+	if (EntryPtr->HashAddr == 0U) {
+		Status = (int)XSECURE_SHA3_INVALID_PARAM;
+		goto END;
+	}
+
+	Status = XSecure_Sha3Start(XSecureSha3InstPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if (EntryPtr->Size != 0U) {
+		Status = XSecure_Sha3Update64Bit(XSecureSha3InstPtr,
+			EntryPtr->DataAddr, EntryPtr->Size);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Status = XSecure_Sha3Finish(XSecureSha3InstPtr,
+			(XSecure_Sha3Hash *)&Hash);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < XSECURE_HASH_SIZE_IN_BYTES; Index++) {
+		XPlmi_OutByte64((EntryPtr->HashAddr + Index), Hash.Hash[Index]);
+	}
+
+END:
+	return Status;
+}
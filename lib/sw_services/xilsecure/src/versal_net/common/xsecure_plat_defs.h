@@ -18,6 +18,7 @@
 * 5.0   bm   07/06/22 Initial release
 *       kpt  07/24/22 Added XSECURE_API_KAT and additional KAT ids
 *       dc   08/26/22 Removed gaps in between the API IDs
+*       kc   10/18/26 Added XSECURE_API_SHA3_BATCH
 *
 * </pre>
 * @note
@@ -65,7 +66,8 @@ typedef enum {
 	XSECURE_API_AES_SET_DPA_CM,		/**< 20U */
 	XSECURE_API_KAT,			/**< 21U */
 	XSECURE_API_TRNG_GENERATE,		/**< 22U */
-	XSECURE_API_MAX,			/**< 23U */
+	XSECURE_API_SHA3_BATCH,			/**< 23U */
+	XSECURE_API_MAX,			/**< 24U */
 } XSecure_ApiId;
 
 typedef enum {
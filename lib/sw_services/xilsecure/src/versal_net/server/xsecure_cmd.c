@@ -24,6 +24,7 @@
 *       rb   08/11/2021 Fix compilation warnings
 * 5.0   kpt  07/24/2022 Added XSecure_KatIpiHandler and support to go into
 *                       secure lockdown when KAT fails
+*       kc   10/18/2026 Added SHA3 batch command
 *
 *
 * </pre>
@@ -93,6 +94,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 
 	switch (ApiId) {
 	case XSECURE_API(XSECURE_API_SHA3_UPDATE):
+	case XSECURE_API(XSECURE_API_SHA3_BATCH):
 #ifndef PLM_SECURE_EXCLUDE
 	case XSECURE_API(XSECURE_API_RSA_PRIVATE_DECRYPT):
 	case XSECURE_API(XSECURE_API_RSA_PUBLIC_ENCRYPT):
@@ -142,6 +144,7 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 		Status = XSecure_FeaturesCmd(Pload[0]);
 		break;
 	case XSECURE_API(XSECURE_API_SHA3_UPDATE):
+	case XSECURE_API(XSECURE_API_SHA3_BATCH):
 		Status = XSecure_Sha3IpiHandler(Cmd);
 		break;
 #ifndef PLM_SECURE_EXCLUDE
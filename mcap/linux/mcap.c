@@ -30,9 +30,11 @@
 *
 ******************************************************************************/
 
+#include <unistd.h>
+
 #include "mcap_lib.h"
 
-static const char options[] = "x:pC:rmfdvHhDa::";
+static const char options[] = "x:pC:rmfdvHhDa::Ms:S:j:";
 static char help_msg[] =
 "Usage: mcap [options]\n"
 "\n"
@@ -52,8 +54,95 @@ static char help_msg[] =
 "\t\t      here type[data] - h for half word data [16 bits]\n"
 "\t\t      here type[data] - w for word data [32 bits]\n"
 "\n"
+"Multi device programming:\n"
+"\t-M\t\tProgram every MCAP device matching -x (any if omitted)\n"
+"\t-s    <bdf>\tProgram the device at [[domain:]bus:]dev.func (repeatable)\n"
+"\t-S    <file>\tProgram a simulated config space file (repeatable)\n"
+"\t-j    <n>\tNumber of worker threads (default: one per device)\n"
+"\t      -C and -p are honoured, the clear file is loaded first\n"
+"\t      e.g. mcap -M -x 0x8011 -p <file>\n"
+"\n"
 ;
 
+static int MultiProgram(int device_id, char **slots, int nslots,
+			char **sims, int nsims, char *clear_path,
+			char *file_path, int nthreads)
+{
+	struct mcap_dev *mdevs[MCAP_MAX_DEVICES];
+	struct mcap_result res[MCAP_MAX_DEVICES];
+	struct mcap_bitstream bs;
+	int i, n, count = 0, err;
+
+	if (!file_path && !clear_path) {
+		printf("No bitstream specified...\n");
+		return 1;
+	}
+
+	if (nsims) {
+		for (i = 0; i < nsims; i++) {
+			mdevs[count] = MCapLibInitSim(sims[i]);
+			if (mdevs[count])
+				count++;
+		}
+	} else {
+		count = MCapLibInitMulti(device_id, slots, nslots, mdevs,
+					 MCAP_MAX_DEVICES);
+	}
+
+	if (count <= 0) {
+		printf("Xilinx MCAP device not found .. Exiting ...\n");
+		return 1;
+	}
+
+	/* Clear file first, the bitstream then goes to the cleared devices */
+	memset(res, 0, sizeof(res));
+	err = 0;
+	n = count;
+	if (clear_path) {
+		if (MCapBitstreamLoad(&bs, clear_path)) {
+			err = 1;
+			file_path = NULL;
+		} else {
+			for (i = 0; i < count; i++)
+				mdevs[i]->is_multiplebit = file_path ? 1 : 0;
+			err = MCapConfigureFPGAMulti(mdevs, res, count, &bs,
+						     EMCAP_PARTIALCONFIG_FILE,
+						     nthreads);
+			MCapBitstreamFree(&bs);
+
+			/* res[] is not filled on an early error, keep all */
+			if (err < 0) {
+				err = 1;
+				file_path = NULL;
+			} else {
+				for (i = 0, n = 0; i < count; i++) {
+					if (!res[i].err)
+						mdevs[n++] = res[i].mdev;
+					else
+						MCapLibFree(res[i].mdev);
+				}
+			}
+		}
+	}
+
+	/* Parse once, shared by all the workers */
+	if (file_path && n) {
+		if (!MCapBitstreamLoad(&bs, file_path)) {
+			err |= MCapConfigureFPGAMulti(mdevs, res, n, &bs,
+						      EMCAP_CONFIG_FILE,
+						      nthreads);
+			MCapBitstreamFree(&bs);
+		} else {
+			err = 1;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+		MCapLibFree(mdevs[i]);
+
+	return err ? 1 : 0;
+}
+
 int main(int argc, char **argv)
 {
 	struct mcap_dev *mdev;
@@ -61,6 +150,9 @@ int main(int argc, char **argv)
 	int program = 0, verbose = 0, device_id = 0;
 	int data_regs = 0, dump_regs = 0, access_config = 0;
 	int programconfigfile = 0;
+	int multi = 0, nslots = 0, nsims = 0, nthreads = 0;
+	char *slots[MCAP_MAX_DEVICES], *sims[MCAP_MAX_DEVICES];
+	char *clear_path = NULL;
 
 	while ((i = getopt(argc, argv, options)) != -1) {
 		switch (i) {
@@ -88,6 +180,7 @@ int main(int argc, char **argv)
 			return 1;
 		case 'C':
 			programconfigfile = 1;
+			clear_path = optarg;
 			break;
 		case 'p':
 			program = 1;
@@ -96,7 +189,23 @@ int main(int argc, char **argv)
 			verbose++;
 			break;
 		case 'x':
-			device_id = (int) strtol(argv[2], NULL, 16);
+			device_id = (int) strtol(optarg, NULL, 16);
+			break;
+		case 'M':
+			multi = 1;
+			break;
+		case 's':
+			multi = 1;
+			if (nslots < MCAP_MAX_DEVICES)
+				slots[nslots++] = optarg;
+			break;
+		case 'S':
+			multi = 1;
+			if (nsims < MCAP_MAX_DEVICES)
+				sims[nsims++] = optarg;
+			break;
+		case 'j':
+			nthreads = atoi(optarg);
 			break;
 		default:
 			printf("%s", help_msg);
@@ -104,6 +213,12 @@ int main(int argc, char **argv)
 		}
 	}
 
+	if (multi)
+		return MultiProgram(device_id, slots, nslots, sims, nsims,
+				    clear_path,
+				    program && optind < argc ? argv[optind] : NULL,
+				    nthreads);
+
 	if (!device_id) {
 		printf("No device id specified...\n");
 		printf("%s", help_msg);
@@ -0,0 +1,244 @@
+/******************************************************************************
+* Copyright (C) 2014-2015 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+*
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file mcap_bench.c
+* Host benchmark for the MCAP bitstream ingestion and writer path
+*
+* Generates synthetic .bit/.bin/.rbt files, checks that all three decode to
+* the same Data register stream and times decode and write against a plain
+* file standing in for the PCIe config space. No MCAP hardware or libpci is
+* required. The config space file left behind ('bench.cfg') carries an MCAP
+* capability and can be handed to 'mcap -S' as a simulated device.
+*
+* Usage: mcap_bench [size in MiB] [work directory]
+*
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mcap_stream.h"
+
+#define BENCH_DEFAULT_MB	4
+#define BENCH_CFG_SIZE		4096
+#define BENCH_MCAP_BASE		0x100	/* First extended capability */
+#define BENCH_MCAP_HEADER	0x0001000B	/* MCAP capability, no next */
+#define BENCH_MCAP_STATUS	0x00000002	/* End of Startup */
+#define BENCH_DATA_OFFSET	(BENCH_MCAP_BASE + 0x18)
+#define BENCH_BIT_HEADER	"\x00\x09\x0f\xf0\x0f\xf0\x0f\xf0\x0f\xf0\x00\x00\x01" \
+				"a\x00\x05" "bench\x00"
+
+static double BenchNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int BenchWriteFiles(const char *dir, const uint8_t *payload,
+			   size_t sz)
+{
+	char path[256];
+	FILE *fp;
+	size_t i;
+	int b;
+
+	/* .bin: raw payload, preceded by the sync word */
+	snprintf(path, sizeof(path), "%s/bench.bin", dir);
+	fp = fopen(path, "wb");
+	if (!fp)
+		return -1;
+	fwrite("\xff\xff\xff\xff", 4, 1, fp);
+	fwrite(payload, sz, 1, fp);
+	fclose(fp);
+
+	/* .bit: odd length header so the sync word is not dword aligned */
+	snprintf(path, sizeof(path), "%s/bench.bit", dir);
+	fp = fopen(path, "wb");
+	if (!fp)
+		return -1;
+	fwrite(BENCH_BIT_HEADER, sizeof(BENCH_BIT_HEADER) - 1, 1, fp);
+	fwrite("\xff\xff\xff\xff", 4, 1, fp);
+	fwrite(payload, sz, 1, fp);
+	fclose(fp);
+
+	/* .rbt: one 32 digit line per big endian dword */
+	snprintf(path, sizeof(path), "%s/bench.rbt", dir);
+	fp = fopen(path, "wb");
+	if (!fp)
+		return -1;
+	fprintf(fp, "Xilinx ASCII Bitstream\nCreated by mcap_bench\n");
+	fprintf(fp, "Bits:\t%zu\n", (sz + 4) * 8);
+	fprintf(fp, "11111111111111111111111111111111\n");
+	for (i = 0; i < sz; i++) {
+		for (b = 7; b >= 0; b--)
+			fputc('0' + ((payload[i] >> b) & 1), fp);
+		if ((i & 3) == 3)
+			fputc('\n', fp);
+	}
+	fclose(fp);
+
+	return 0;
+}
+
+static int BenchWriteCfg(const char *path)
+{
+	uint32_t cfg[BENCH_CFG_SIZE / 4];
+	FILE *fp;
+
+	memset(cfg, 0, sizeof(cfg));
+	cfg[BENCH_MCAP_BASE / 4] = BENCH_MCAP_HEADER;
+	cfg[(BENCH_MCAP_BASE + 0x10) / 4] = BENCH_MCAP_STATUS;
+
+	fp = fopen(path, "wb");
+	if (!fp)
+		return -1;
+	fwrite(cfg, sizeof(cfg), 1, fp);
+	fclose(fp);
+
+	return 0;
+}
+
+/*
+ * Every dword goes to the Data register, so the file holds the last dword
+ * of the stream, in little endian, and the next register is left untouched.
+ */
+static int BenchCheckCfg(const char *path, uint32_t last)
+{
+	uint8_t cfg[8];
+	FILE *fp;
+	int err = -1;
+
+	fp = fopen(path, "rb");
+	if (!fp)
+		return -1;
+	if (!fseek(fp, BENCH_DATA_OFFSET, SEEK_SET) &&
+	    fread(cfg, sizeof(cfg), 1, fp) == 1 &&
+	    cfg[0] == (uint8_t)last && cfg[1] == (uint8_t)(last >> 8) &&
+	    cfg[2] == (uint8_t)(last >> 16) && cfg[3] == (uint8_t)(last >> 24) &&
+	    !(cfg[4] | cfg[5] | cfg[6] | cfg[7]))
+		err = 0;
+	fclose(fp);
+
+	return err;
+}
+
+static int BenchLoad(const char *dir, const char *ext,
+		     struct mcap_bitstream *bs)
+{
+	char path[256];
+	double t;
+
+	snprintf(path, sizeof(path), "%s/bench%s", dir, ext);
+	t = BenchNow();
+	if (MCapBitstreamLoad(bs, path)) {
+		printf("%s: load failed\n", ext);
+		return -1;
+	}
+	t = BenchNow() - t;
+	printf("%s: decoded %u dwords in %.3f ms (%.1f MiB/s)\n", ext,
+	       bs->len, t * 1e3, bs->len * 4.0 / (1 << 20) / t);
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	struct mcap_bitstream bs[3];
+	struct mcap_writer wr;
+	const char *ext[3] = { ".bin", ".bit", ".rbt" };
+	const char *dir = "/tmp";
+	char cfg[256];
+	uint8_t *payload;
+	size_t sz, i;
+	double t;
+	int err = 1;
+
+	sz = (size_t)(argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_MB) << 20;
+	if (argc > 2)
+		dir = argv[2];
+
+	memset(bs, 0, sizeof(bs));
+	payload = malloc(sz);
+	if (!payload)
+		return 1;
+	srand(1);
+	for (i = 0; i < sz; i++)
+		payload[i] = rand();
+
+	if (BenchWriteFiles(dir, payload, sz)) {
+		printf("Failed to create bitstream files in %s\n", dir);
+		goto free_payload;
+	}
+
+	for (i = 0; i < 3; i++)
+		if (BenchLoad(dir, ext[i], &bs[i]))
+			goto free_streams;
+
+	for (i = 1; i < 3; i++) {
+		if (bs[i].len != bs[0].len ||
+		    memcmp(bs[i].data, bs[0].data, bs[0].len * 4)) {
+			printf("%s: decoded stream mismatch\n", ext[i]);
+			goto free_streams;
+		}
+	}
+
+	/* File backed fake config space */
+	snprintf(cfg, sizeof(cfg), "%s/bench.cfg", dir);
+	if (BenchWriteCfg(cfg))
+		goto free_streams;
+
+	if (MCapWriterOpen(&wr, cfg, BENCH_DATA_OFFSET)) {
+		printf("Failed to open %s\n", cfg);
+		goto free_streams;
+	}
+	t = BenchNow();
+	err = MCapWriterWrite(&wr, bs[0].data, bs[0].len);
+	t = BenchNow() - t;
+	MCapWriterClose(&wr);
+	if (!err)
+		printf("write: %llu dwords in %llu batches, %.3f ms (%.2f Mdw/s)\n",
+		       (unsigned long long)wr.words,
+		       (unsigned long long)wr.calls, t * 1e3,
+		       wr.words / t / 1e6);
+	if (!err && BenchCheckCfg(cfg, bs[0].data[bs[0].len - 1])) {
+		printf("write: Data register mismatch in %s\n", cfg);
+		err = 1;
+	}
+
+free_streams:
+	for (i = 0; i < 3; i++)
+		MCapBitstreamFree(&bs[i]);
+free_payload:
+	free(payload);
+
+	return err ? 1 : 0;
+}
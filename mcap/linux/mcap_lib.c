@@ -30,6 +30,9 @@
 *
 ******************************************************************************/
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "mcap_lib.h"
 
 /* Library Specific Definitions */
@@ -37,134 +40,67 @@
 
 #define MCAP_LOOP_COUNT	1000000
 
-#define MCAP_SYNC_DWORD	0xFFFFFFFF
-#define MCAP_SYNC_BYTE0 ((MCAP_SYNC_DWORD & 0xFF000000) >> 24)
-#define MCAP_SYNC_BYTE1 ((MCAP_SYNC_DWORD & 0x00FF0000) >> 16)
-#define MCAP_SYNC_BYTE2 ((MCAP_SYNC_DWORD & 0x0000FF00) >> 8)
-#define MCAP_SYNC_BYTE3 ((MCAP_SYNC_DWORD & 0x000000FF) >> 0)
+/* sysfs config space file of a PCI device */
+#define MCAP_SYSFS_CONFIG	"/sys/bus/pci/devices/%s/config"
+#define MCAP_SLOT_NAME		"%04x:%02x:%02x.%d"
 
-#define MCAP_RBT_FILE	".rbt"
-#define MCAP_BIT_FILE	".bit"
-#define MCAP_BIN_FILE	".bin"
+/* PCIe Extended Capability list */
+#define MCAP_EXT_CAP_START	0x100
+#define MCAP_EXT_CAP_END	0x1000
 
-static char *MCapFindTypeofFile(const char *s1, const char *s2)
+u32 MCapCfgRead32(struct mcap_dev *mdev, int pos)
 {
-	size_t l1, l2;
-
-	l2 = strlen(s2);
-	if (!l2)
-		return (char *)s1;
-	l1 = strlen(s1);
-	while (l1 >= l2) {
-		l1--;
-		if (!strncasecmp(s1, s2, l2))
-			return (char *)s1;
-		s1++;
-	}
+	u32 value;
 
-	return NULL;
-}
+	if (mdev->pdev)
+		return pci_read_long(mdev->pdev, pos);
 
-static u32 MCapProcessRBT(FILE *fptr, u32 *buf)
-{
-	char *raw = NULL;
-	int i, read;
-	size_t linelen;
-	u32 count = 0, len = 0, result = 0;
-
-	while ((read = getline(&raw, &linelen, fptr)) != -1) {
-		if (raw[0] != '1' && raw[1] != '0')
-			continue;
-
-		for (i = 0; i < read - 1; i++) {
-			if (raw[i] == '1' || raw[i] == '0') {
-				result = (result << 1) | (raw[i] - 0x30);
-				count++;
-				if (count == 32) {
-					*buf++ = result;
-					len ++;
-					result = count = 0;
-					break;
-				}
-			}
-		}
-	}
+	if (pread(mdev->cfg_fd, &value, sizeof(value), pos) != sizeof(value))
+		return 0xFFFFFFFF;
 
-	return len;
+	return value;
 }
 
-static u32 MCapProcessBIT(FILE *fptr, u32 *buf, int sz)
+void MCapCfgWrite32(struct mcap_dev *mdev, int pos, u32 value)
 {
-	int err;
-	u8 value, len = 0;
-
-	/*
-	 * .bit files are not guaranteed to be aligned with
-	 * the bitstream sync word on a 32-bit boundary. So,
-	 * we need to check every byte here.
-	 */
-	while ((err = fread(&value, 1, 1, fptr)) == 1) {
-		len++; if (value == MCAP_SYNC_BYTE0)
-		  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-		    len++; if (value == MCAP_SYNC_BYTE1)
-		      if ((err = fread(&value, 1, 1, fptr)) == 1) {
-			len++; if (value == MCAP_SYNC_BYTE2)
-			  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-				len++; if (value == MCAP_SYNC_BYTE3)
-					break;
-			  }
-		      }
-		}
-	}
-
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
-	}
-
-	if (err != 1 && feof(fptr)) {
-		pr_err("Failed to find SYNC Word in BIT file\n");
-		return 0;
-	}
-
-	*buf++ = __bswap_32(MCAP_SYNC_DWORD);
-
-	while ((err = fread(buf, sz - len, 1, fptr)) == 1)
-		;
-
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
-	}
-
-	return (sz - len)/4 + 1;
-}
-
-static u32 MCapProcessBIN(FILE *fptr, u32 *buf, int sz)
-{
-	int err;
-
-	err = fread(buf, sz, 1, fptr);
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIN file\n");
-		return 0;
+	if (mdev->pdev) {
+		pci_write_long(mdev->pdev, pos, value);
+		return;
 	}
 
-	return sz/4;
+	if (pwrite(mdev->cfg_fd, &value, sizeof(value), pos) != sizeof(value))
+		pr_err("Failed to write config space @ 0x%x\n", pos);
 }
 
 static int MCapDoBusWalk(struct mcap_dev *mdev)
 {
 	struct pci_cap *c;
+	u32 hdr;
+	int pos, loop;
 
-	c = pci_find_cap(mdev->pdev, MCAP_EXT_CAP_ID, PCI_CAP_EXTENDED);
+	if (mdev->pdev) {
+		c = pci_find_cap(mdev->pdev, MCAP_EXT_CAP_ID,
+				 PCI_CAP_EXTENDED);
+		if (!c)
+			return -EMCAPBUSWALK;
 
-	if (!c)
-		return -EMCAPBUSWALK;
+		mdev->reg_base = c->addr;
+		return 0;
+	}
 
-	mdev->reg_base = c->addr;
+	/* Simulated config space, walk the extended capability list */
+	pos = MCAP_EXT_CAP_START;
+	for (loop = 0; pos >= MCAP_EXT_CAP_START && pos < MCAP_EXT_CAP_END &&
+	     loop < MCAP_EXT_CAP_END / 4; loop++) {
+		hdr = MCapCfgRead32(mdev, pos);
+		if ((hdr & 0xFFFF) == MCAP_EXT_CAP_ID) {
+			mdev->reg_base = pos;
+			return 0;
+		}
+		pos = (hdr >> 20) & 0xFFC;
+	}
 
-	return 0;
+	return -EMCAPBUSWALK;
 }
 
 static int MCapClearRequestByConfigure(struct mcap_dev *mdev, u32 *restore)
@@ -220,11 +156,42 @@ static int Checkforcompletion(struct mcap_dev *mdev)
 	return 0;
 }
 
-static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
-					int len, u8 bswap)
+static int MCapWriteData(struct mcap_dev *mdev, const u32 *data, int len)
+{
+	struct mcap_writer wr;
+	int count, n, err = 0;
+
+	__atomic_store_n(&mdev->progress, 0, __ATOMIC_RELAXED);
+
+	if (!MCapWriterOpen(&wr, mdev->cfg_path, mdev->reg_base + MCAP_DATA)) {
+		for (count = 0; count < len && !err; count += n) {
+			n = len - count < MCAP_WRITE_BATCH ?
+				len - count : MCAP_WRITE_BATCH;
+			err = MCapWriterWrite(&wr, data + count, n);
+			__atomic_store_n(&mdev->progress, count + n,
+					 __ATOMIC_RELAXED);
+		}
+		MCapWriterClose(&wr);
+		return err ? -EMCAPWRITE : 0;
+	}
+
+	/* sysfs config file is not writable, fall back to libpci */
+	for (count = 0; count < len; count++) {
+		MCapRegWrite(mdev, MCAP_DATA, data[count]);
+		if (!((count + 1) % MCAP_WRITE_BATCH))
+			__atomic_store_n(&mdev->progress, count + 1,
+					 __ATOMIC_RELAXED);
+	}
+	__atomic_store_n(&mdev->progress, len, __ATOMIC_RELAXED);
+
+	return 0;
+}
+
+static int MCapWritePartialBitStream(struct mcap_dev *mdev, const u32 *data,
+					int len)
 {
 	u32 set, restore;
-	int err, count = 0, i;
+	int err, i;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -254,12 +221,10 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	MCapRegWrite(mdev, MCAP_CONTROL, set);
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
+	err = MCapWriteData(mdev, data, len);
+	if (err) {
+		MCapRegWrite(mdev, MCAP_CONTROL, restore);
+		return -EMCAPWRITE;
 	}
 
 	for (i = 0 ; i < EMCAP_EOS_LOOP_COUNT; i++) {
@@ -283,11 +248,11 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	return 0;
 }
 
-static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
-			      int len, u8 bswap)
+static int MCapWriteBitStream(struct mcap_dev *mdev, const u32 *data,
+			      int len)
 {
 	u32 set, restore;
-	int err, count = 0;
+	int err;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -319,12 +284,10 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	}
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
+	err = MCapWriteData(mdev, data, len);
+	if (err) {
+		MCapRegWrite(mdev, MCAP_CONTROL, restore);
+		return -EMCAPWRITE;
 	}
 
 	/* Check for Completion */
@@ -350,18 +313,50 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 void MCapLibFree(struct mcap_dev *mdev)
 {
 	if (mdev) {
-		pci_cleanup(mdev->pacc);
+		if (mdev->pacc)
+			pci_cleanup(mdev->pacc);
+		if (mdev->cfg_fd >= 0)
+			close(mdev->cfg_fd);
 		free(mdev);
 	}
 }
 
+static struct mcap_dev *MCapAllocDev(void)
+{
+	struct mcap_dev *mdev;
+
+	/* Allocate MCAP device */
+	mdev = calloc(1, sizeof(struct mcap_dev));
+	if (!mdev)
+		return NULL;
+
+	mdev->cfg_fd = -1;
+
+	return mdev;
+}
+
+static int MCapSetupDev(struct mcap_dev *mdev)
+{
+	if (mdev->pdev) {
+		snprintf(mdev->name, sizeof(mdev->name), MCAP_SLOT_NAME,
+			 mdev->pdev->domain, mdev->pdev->bus,
+			 mdev->pdev->dev, mdev->pdev->func);
+
+		/* sysfs config file used for streaming the bitstream */
+		snprintf(mdev->cfg_path, sizeof(mdev->cfg_path),
+			 MCAP_SYSFS_CONFIG, mdev->name);
+	}
+
+	/* Get the MCAP Register base */
+	return MCapDoBusWalk(mdev);
+}
+
 struct mcap_dev *MCapLibInit(int device_id)
 {
 	struct pci_dev *dev;
 	struct mcap_dev *mdev;
 
-	/* Allocate MCAP device */
-	mdev = malloc(sizeof(struct mcap_dev));
+	mdev = MCapAllocDev();
 	if (!mdev)
 		return NULL;
 
@@ -395,8 +390,7 @@ struct mcap_dev *MCapLibInit(int device_id)
 		goto free_resources;
 	}
 
-	/* Get the MCAP Register base */
-	if (MCapDoBusWalk(mdev)) {
+	if (MCapSetupDev(mdev)) {
 		pr_err("Unable to get the Register Base\n");
 		goto free_resources;
 	}
@@ -409,6 +403,140 @@ free_resources:
 	return NULL;
 }
 
+static struct mcap_dev *MCapLibInitSlot(struct pci_dev *slot)
+{
+	struct mcap_dev *mdev;
+
+	mdev = MCapAllocDev();
+	if (!mdev)
+		return NULL;
+
+	/* Each device gets its own pci_access so workers do not share it */
+	mdev->pacc = pci_alloc();
+	pci_init(mdev->pacc);
+
+	mdev->pdev = pci_get_dev(mdev->pacc, slot->domain, slot->bus,
+				 slot->dev, slot->func);
+	if (!mdev->pdev)
+		goto free_resources;
+
+	pci_fill_info(mdev->pdev, PCI_FILL_IDENT | PCI_FILL_BASES |
+		      PCI_FILL_CLASS);
+
+	if (MCapSetupDev(mdev))
+		goto free_resources;
+
+	return mdev;
+
+free_resources:
+	MCapLibFree(mdev);
+
+	return NULL;
+}
+
+/*
+ * Finds all Xilinx MCAP devices matching 'device_id' (0 for any) and, when
+ * 'nslots' is non zero, one of the [[domain:]bus:]dev.func 'slots'.
+ * Returns the number of devices stored in 'mdevs' or a negative error.
+ */
+int MCapLibInitMulti(int device_id, char **slots, int nslots,
+		     struct mcap_dev **mdevs, int max)
+{
+	struct pci_access *pacc;
+	struct pci_filter *filters = NULL;
+	struct pci_dev *dev;
+	char *msg;
+	int i, count = 0;
+
+	pacc = pci_alloc();
+	pci_init(pacc);
+
+	if (nslots) {
+		filters = calloc(nslots, sizeof(*filters));
+		if (!filters) {
+			count = -EMCAPCFG;
+			goto cleanup;
+		}
+	}
+
+	for (i = 0; i < nslots; i++) {
+		pci_filter_init(pacc, &filters[i]);
+		msg = pci_filter_parse_slot(&filters[i], slots[i]);
+		if (msg) {
+			pr_err("Invalid device %s: %s\n", slots[i], msg);
+			count = -EMCAPCFG;
+			goto cleanup;
+		}
+	}
+
+	pci_scan_bus(pacc);
+
+	for (dev = pacc->devices; dev && count < max; dev = dev->next) {
+		pci_fill_info(dev, PCI_FILL_IDENT);
+
+		if (dev->vendor_id != MCAP_VENDOR_ID ||
+		    (device_id && dev->device_id != device_id))
+			continue;
+
+		for (i = 0; i < nslots; i++)
+			if (pci_filter_match(&filters[i], dev))
+				break;
+		if (nslots && i == nslots)
+			continue;
+
+		mdevs[count] = MCapLibInitSlot(dev);
+		if (!mdevs[count])
+			continue;
+
+		pr_info("Xilinx MCAP device found at %s\n",
+			mdevs[count]->name);
+		count++;
+	}
+
+cleanup:
+	free(filters);
+	pci_cleanup(pacc);
+
+	return count;
+}
+
+/*
+ * Creates an MCAP device backed by a file holding an image of the PCIe
+ * config space. Used to exercise the programming flow without hardware.
+ */
+struct mcap_dev *MCapLibInitSim(const char *cfg_path)
+{
+	struct mcap_dev *mdev;
+	const char *base;
+
+	mdev = MCapAllocDev();
+	if (!mdev)
+		return NULL;
+
+	base = strrchr(cfg_path, '/');
+	snprintf(mdev->cfg_path, sizeof(mdev->cfg_path), "%s", cfg_path);
+	snprintf(mdev->name, sizeof(mdev->name), "%s",
+		 base ? base + 1 : cfg_path);
+
+	mdev->cfg_fd = open(cfg_path, O_RDWR);
+	if (mdev->cfg_fd < 0) {
+		pr_err("Failed to open %s\n", cfg_path);
+		goto free_resources;
+	}
+
+	if (MCapSetupDev(mdev)) {
+		pr_err("No MCAP capability in %s\n", cfg_path);
+		goto free_resources;
+	}
+
+	return mdev;
+
+free_resources:
+	MCapLibFree(mdev);
+
+	return NULL;
+}
+
 int MCapReset(struct mcap_dev *mdev)
 {
 	u32 set, restore;
@@ -589,70 +717,39 @@ void MCapDumpRegs(struct mcap_dev *mdev)
 	MCapDumpReadRegs(mdev);
 }
 
-int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
+int MCapProgramBitstream(struct mcap_dev *mdev,
+			 const struct mcap_bitstream *bs, u32 bitfile_type)
 {
-	FILE *fptr;
-	u32 *data;
-	u32 binsz, wrdatasz;
 	int err = 0;
-	u8 bswap = 0;
-
-	/* Get the size */
-	fptr = fopen(file_path, "rb");
-	if (fptr == NULL)
-		return -EMCAPCFG;
-	fseek(fptr, 0L, SEEK_END);
-	binsz = ftell(fptr);
-	fseek(fptr, 0L, SEEK_SET);
-
-	/* Allocate the buffer */
-	data = malloc(binsz);
-	if (data == NULL)
-		return -EMCAPCFG;
-
-	/* Process files and Read the data */
-	if (MCapFindTypeofFile(file_path, MCAP_RBT_FILE)) {
-
-		/* Read the RBT file */
-		wrdatasz = MCapProcessRBT(fptr, data);
-
-	} else if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE)) {
-
-		/* Read the BIT file */
-		wrdatasz = MCapProcessBIT(fptr, data, binsz);
-		bswap = 1;
-
-	} else if (MCapFindTypeofFile(file_path, MCAP_BIN_FILE)) {
-
-		/* Read the BIN file */
-		wrdatasz = MCapProcessBIN(fptr, data, binsz);
-		bswap = 1;
-
-	} else {
-		pr_err("Unknown File Format.. This may be");
-		pr_err(" due to .bit/.bin/.rbt files does not exist at the.");
-		pr_err(" specified location, Please cross check the");
-		pr_err(" path is correct or not\n");
-		goto free_resources;
-	}
 
 	/* Program FPGA */
 	if (bitfile_type == EMCAP_PARTIALCONFIG_FILE) {
-		err = MCapWritePartialBitStream(mdev, data, wrdatasz, bswap);
+		err = MCapWritePartialBitStream(mdev, bs->data, bs->len);
 		if (err)
 			return -EMCAPCFG;
 		pr_info("FPGA Partial Configuration Done!!\n");
 	} else if (bitfile_type == EMCAP_CONFIG_FILE) {
-		err = MCapWriteBitStream(mdev, data, wrdatasz, bswap);
+		err = MCapWriteBitStream(mdev, bs->data, bs->len);
 		if (err)
 			return -EMCAPCFG;
 		pr_info("FPGA Configuration Done!!\n");
 	}
 
-free_resources:
-	if (data)
-		free(data);
-	fclose(fptr);
+	return 0;
+}
+
+int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
+{
+	struct mcap_bitstream bs;
+	int err;
+
+	/* Map the file and convert it to the Data register stream */
+	if (MCapBitstreamLoad(&bs, file_path))
+		return -EMCAPCFG;
+
+	err = MCapProgramBitstream(mdev, &bs, bitfile_type);
+
+	MCapBitstreamFree(&bs);
 
 	return err;
 }
@@ -39,6 +39,7 @@
 #include "pci.h"
 #include "lspci.h"
 #include "byteswap.h"
+#include "mcap_stream.h"
 
 /* Register Definitions */
 #define MCAP_EXT_CAP_HEADER	0x00
@@ -110,13 +111,17 @@ struct mcap_dev {
 	struct pci_access *pacc;
 	unsigned int reg_base;
 	u32 is_multiplebit;
+	char cfg_path[256];
+	char name[32];
+	int cfg_fd;		/* Simulated config space, -1 for libpci */
+	u32 progress;		/* Data register dwords written so far */
 };
 
 #define MCapRegWrite(mdev, offset, value) \
-	pci_write_long(mdev->pdev, mdev->reg_base + offset, value)
+	MCapCfgWrite32(mdev, mdev->reg_base + offset, value)
 
 #define MCapRegRead(mdev, offset) \
-	pci_read_long(mdev->pdev, mdev->reg_base + offset)
+	MCapCfgRead32(mdev, mdev->reg_base + offset)
 
 #define IsResetSet(mdev) \
 	(MCapRegRead(mdev, MCAP_CONTROL) & \
@@ -146,8 +151,23 @@ struct mcap_dev {
 	((MCapRegRead(mdev, MCAP_STATUS) & \
 		MCAP_STS_REG_READ_COUNT_MASK) >> 5)
 
+/* Maximum number of devices handled by the multi device mode */
+#define MCAP_MAX_DEVICES	64
+
+/* Per device outcome of a multi device programming run */
+struct mcap_result {
+	struct mcap_dev *mdev;
+	int err;
+	double seconds;
+};
+
 /* Function Prototypes */
 struct mcap_dev *MCapLibInit(int device_id);
+int MCapLibInitMulti(int device_id, char **slots, int nslots,
+		     struct mcap_dev **mdevs, int max);
+struct mcap_dev *MCapLibInitSim(const char *cfg_path);
+u32 MCapCfgRead32(struct mcap_dev *mdev, int pos);
+void MCapCfgWrite32(struct mcap_dev *mdev, int pos, u32 value);
 void MCapLibFree(struct mcap_dev *mdev);
 void MCapDumpRegs(struct mcap_dev *mdev);
 void MCapDumpReadRegs(struct mcap_dev *mdev);
@@ -156,5 +176,10 @@ int MCapModuleReset(struct mcap_dev *mdev);
 int MCapFullReset(struct mcap_dev *mdev);
 int MCapShowDevice(struct mcap_dev *mdev, int verbose);
 int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type);
+int MCapProgramBitstream(struct mcap_dev *mdev,
+			 const struct mcap_bitstream *bs, u32 bitfile_type);
+int MCapConfigureFPGAMulti(struct mcap_dev **mdevs, struct mcap_result *res,
+			   int count, const struct mcap_bitstream *bs,
+			   u32 bitfile_type, int nthreads);
 int MCapReadRegisters(struct mcap_dev *mdev, u32 *data);
 int MCapAccessConfigSpace(struct mcap_dev *mdev, int argc, char **argv);
@@ -0,0 +1,168 @@
+/******************************************************************************
+* Copyright (C) 2014-2015 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+*
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file mcap_multi.c
+* MCAP multi device programming
+*
+* A bitstream parsed once with MCapBitstreamLoad() is shared read-only by a
+* pool of worker threads, each of which programs one device at a time.
+*
+******************************************************************************/
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mcap_lib.h"
+
+/* Interval between progress reports, in microseconds */
+#define MCAP_PROGRESS_INTERVAL	500000
+
+struct mcap_pool {
+	struct mcap_dev **mdevs;
+	struct mcap_result *res;
+	const struct mcap_bitstream *bs;
+	u32 bitfile_type;
+	int count;
+	int next;
+	int done;
+};
+
+static double MCapNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *MCapWorker(void *arg)
+{
+	struct mcap_pool *pool = arg;
+	struct mcap_result *res;
+	double start;
+	int idx;
+
+	while ((idx = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) <
+	       pool->count) {
+		res = &pool->res[idx];
+		res->mdev = pool->mdevs[idx];
+
+		start = MCapNow();
+		res->err = MCapProgramBitstream(res->mdev, pool->bs,
+						pool->bitfile_type);
+		res->seconds = MCapNow() - start;
+
+		__atomic_fetch_add(&pool->done, 1, __ATOMIC_RELEASE);
+	}
+
+	return NULL;
+}
+
+static void MCapReportProgress(struct mcap_pool *pool)
+{
+	u32 progress;
+	int i;
+
+	for (i = 0; i < pool->count; i++) {
+		progress = __atomic_load_n(&pool->mdevs[i]->progress,
+					   __ATOMIC_RELAXED);
+		pr_info("%s: %3u%%%s", pool->mdevs[i]->name,
+			(u32)((u64)progress * 100 / pool->bs->len),
+			i + 1 < pool->count ? "  " : "\n");
+	}
+}
+
+/*
+ * Programs 'count' devices with the same bitstream from 'nthreads' worker
+ * threads. Per device status and time are returned in 'res'. Returns the
+ * number of devices that failed.
+ */
+int MCapConfigureFPGAMulti(struct mcap_dev **mdevs, struct mcap_result *res,
+			   int count, const struct mcap_bitstream *bs,
+			   u32 bitfile_type, int nthreads)
+{
+	struct mcap_pool pool;
+	pthread_t *threads;
+	double start;
+	int i, started, failed = 0;
+
+	if (!mdevs || !res || !bs || !bs->len || count <= 0)
+		return -EMCAPCFG;
+
+	if (nthreads <= 0 || nthreads > count)
+		nthreads = count;
+
+	threads = calloc(nthreads, sizeof(*threads));
+	if (!threads)
+		return -EMCAPCFG;
+
+	pool.mdevs = mdevs;
+	pool.res = res;
+	pool.bs = bs;
+	pool.bitfile_type = bitfile_type;
+	pool.count = count;
+	pool.next = 0;
+	pool.done = 0;
+
+	for (i = 0; i < count; i++) {
+		mdevs[i]->progress = 0;
+		res[i].mdev = mdevs[i];
+		res[i].err = -EMCAPCFG;
+		res[i].seconds = 0;
+	}
+
+	start = MCapNow();
+	for (started = 0; started < nthreads; started++)
+		if (pthread_create(&threads[started], NULL, MCapWorker, &pool))
+			break;
+
+	/* Run in the caller's thread if no worker could be created */
+	if (!started)
+		MCapWorker(&pool);
+
+	while (__atomic_load_n(&pool.done, __ATOMIC_ACQUIRE) < count) {
+		usleep(MCAP_PROGRESS_INTERVAL);
+		MCapReportProgress(&pool);
+	}
+
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+	free(threads);
+
+	for (i = 0; i < count; i++) {
+		pr_info("%s: %s in %.3f s\n", res[i].mdev->name,
+			res[i].err ? "FAILED" : "programmed", res[i].seconds);
+		if (res[i].err)
+			failed++;
+	}
+	pr_info("%d of %d devices programmed in %.3f s using %d threads\n",
+		count - failed, count, MCapNow() - start,
+		started ? started : 1);
+
+	return failed;
+}
@@ -0,0 +1,381 @@
+/******************************************************************************
+* Copyright (C) 2014-2015 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+*
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file mcap_stream.c
+* MCAP bitstream ingestion and batched config space writer
+*
+* Bitstream files are memory mapped and converted in a single pass into the
+* dword stream expected by the MCAP Data register. The Data register is then
+* fed through the sysfs config file of the device, which avoids the per
+* access dispatch of libpci.
+*
+* The Data register is a single FIFO address while a pwrite() of several
+* dwords on the config file writes consecutive registers, so every dword is
+* its own pwrite(). The dwords are staged in batches converted to the little
+* endian byte order of config space.
+*
+******************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <endian.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "mcap_stream.h"
+
+#define MCAP_RBT_FILE	".rbt"
+#define MCAP_BIT_FILE	".bit"
+#define MCAP_BIN_FILE	".bin"
+
+/* Number of ASCII digits making up one RBT dword */
+#define MCAP_RBT_DIGITS	32
+
+#define pr_err	printf
+
+static inline uint32_t MCapBswap32(uint32_t val)
+{
+	return __builtin_bswap32(val);
+}
+
+/*
+ * Returns the offset of the first byte following the sync word, or 0
+ * when the sync word is not present in the buffer.
+ */
+size_t MCapFindSyncWord(const uint8_t *buf, size_t sz)
+{
+	size_t i = 0;
+	uint32_t run = 0;
+
+#if defined(__SSE2__)
+	const __m128i sync = _mm_set1_epi8((char)0xFF);
+	uint32_t carry = 0, m, w, r;
+
+	/*
+	 * Build a bit mask of the 0xFF bytes of each 16 byte block, prefixed
+	 * with the last three bits of the previous block, and look for four
+	 * consecutive set bits.
+	 */
+	for (; i + 16 <= sz; i += 16) {
+		m = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((const __m128i *)(buf + i)), sync));
+		w = (m << 3) | carry;
+		r = w & (w >> 1) & (w >> 2) & (w >> 3);
+		if (r)
+			return i + __builtin_ctz(r) + 1;
+		carry = m >> 13;
+	}
+	run = (carry & 4) ? ((carry & 2) ? ((carry & 1) ? 3 : 2) : 1) : 0;
+#elif defined(__ARM_NEON)
+	const uint8x16_t sync = vdupq_n_u8(0xFF);
+
+	uint64x2_t m;
+
+	/*
+	 * Skip blocks that can not contribute to a sync word. The lanes are
+	 * reduced as two 64-bit halves, which also builds for 32-bit ARM.
+	 */
+	for (; i + 16 <= sz; i += 16) {
+		m = vreinterpretq_u64_u8(vceqq_u8(vld1q_u8(buf + i), sync));
+		if (vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1))
+			break;
+		run = 0;
+	}
+#endif
+
+	for (; i < sz; i++) {
+		run = (buf[i] == 0xFF) ? run + 1 : 0;
+		if (run == 4)
+			return i + 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Copies 'count' dwords from an arbitrarily aligned source, swapping the
+ * byte order of each dword.
+ */
+void MCapSwap32Copy(uint32_t *dst, const uint8_t *src, size_t count)
+{
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	__m128i v;
+
+	for (; i + 4 <= count; i += 4) {
+		v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+		/* Swap bytes within halfwords, then halfwords within dwords */
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+#elif defined(__ARM_NEON)
+	for (; i + 4 <= count; i += 4)
+		vst1q_u8((uint8_t *)(dst + i), vrev32q_u8(vld1q_u8(src + i * 4)));
+#endif
+
+	for (; i < count; i++) {
+		uint32_t val;
+
+		memcpy(&val, src + i * 4, sizeof(val));
+		dst[i] = MCapBswap32(val);
+	}
+}
+
+/* Converts 8 ASCII '0'/'1' digits to a byte, MSB first */
+static inline int MCapRBTPack8(const char *p, uint32_t *bits)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+	v -= 0x3030303030303030ULL;
+	if (v & ~0x0101010101010101ULL)
+		return -1;
+	*bits = (uint32_t)((v * 0x8040201008040201ULL) >> 56);
+#else
+	int i;
+
+	*bits = 0;
+	for (i = 0; i < 8; i++) {
+		if (p[i] != '0' && p[i] != '1')
+			return -1;
+		*bits = (*bits << 1) | (uint32_t)(p[i] - '0');
+	}
+#endif
+
+	return 0;
+}
+
+/*
+ * Decodes the ASCII body of an .rbt file. Header lines are skipped and
+ * every data line yields one dword. Returns the number of dwords decoded.
+ */
+uint32_t MCapDecodeRBT(const char *buf, size_t sz, uint32_t *out)
+{
+	const char *p = buf, *end = buf + sz, *eol;
+	uint32_t len = 0, result, bits;
+	int i, count;
+
+	while (p < end) {
+		eol = memchr(p, '\n', end - p);
+		if (!eol)
+			eol = end;
+
+		if (*p != '0' && *p != '1') {
+			p = eol + 1;
+			continue;
+		}
+
+		if (eol - p >= MCAP_RBT_DIGITS &&
+		    !MCapRBTPack8(p, &result) &&
+		    !MCapRBTPack8(p + 8, &bits) &&
+		    (result = (result << 8) | bits, 1) &&
+		    !MCapRBTPack8(p + 16, &bits) &&
+		    (result = (result << 8) | bits, 1) &&
+		    !MCapRBTPack8(p + 24, &bits)) {
+			out[len++] = (result << 8) | bits;
+		} else {
+			/* Irregular line, fall back to the digit by digit parse */
+			result = count = 0;
+			for (i = 0; p + i < eol; i++) {
+				if (p[i] != '0' && p[i] != '1')
+					continue;
+				result = (result << 1) | (uint32_t)(p[i] - '0');
+				if (++count == MCAP_RBT_DIGITS) {
+					out[len++] = result;
+					break;
+				}
+			}
+		}
+
+		p = eol + 1;
+	}
+
+	return len;
+}
+
+static int MCapIsFileType(const char *path, const char *ext)
+{
+	size_t l1 = strlen(path), l2 = strlen(ext);
+
+	return l1 >= l2 && !strcasecmp(path + l1 - l2, ext);
+}
+
+int MCapBitstreamLoad(struct mcap_bitstream *bs, const char *file_path)
+{
+	struct stat st;
+	const uint8_t *map;
+	size_t sz, off;
+	int fd, err = -1;
+
+	bs->data = NULL;
+	bs->len = 0;
+
+	fd = open(file_path, O_RDONLY);
+	if (fd < 0) {
+		pr_err("Failed to open %s\n", file_path);
+		return -1;
+	}
+
+	if (fstat(fd, &st) || st.st_size <= 0) {
+		pr_err("Failed to get the size of %s\n", file_path);
+		goto close_fd;
+	}
+	sz = st.st_size;
+
+	map = mmap(NULL, sz, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED) {
+		pr_err("Failed to map %s\n", file_path);
+		goto close_fd;
+	}
+	madvise((void *)map, sz, MADV_SEQUENTIAL);
+
+	/* The decoded stream is never larger than the file (+1 sync word) */
+	bs->data = malloc(sz + sizeof(uint32_t));
+	if (!bs->data)
+		goto unmap;
+
+	if (MCapIsFileType(file_path, MCAP_RBT_FILE)) {
+		bs->len = MCapDecodeRBT((const char *)map, sz, bs->data);
+	} else if (MCapIsFileType(file_path, MCAP_BIT_FILE)) {
+		/*
+		 * .bit files are not guaranteed to be aligned with
+		 * the bitstream sync word on a 32-bit boundary.
+		 */
+		off = MCapFindSyncWord(map, sz);
+		if (!off) {
+			pr_err("Failed to find SYNC Word in BIT file\n");
+			goto unmap;
+		}
+		bs->data[0] = MCAP_SYNC_DWORD;
+		MCapSwap32Copy(bs->data + 1, map + off, (sz - off) / 4);
+		bs->len = (sz - off) / 4 + 1;
+	} else if (MCapIsFileType(file_path, MCAP_BIN_FILE)) {
+		MCapSwap32Copy(bs->data, map, sz / 4);
+		bs->len = sz / 4;
+	} else {
+		pr_err("Unknown File Format.. This may be");
+		pr_err(" due to .bit/.bin/.rbt files does not exist at the.");
+		pr_err(" specified location, Please cross check the");
+		pr_err(" path is correct or not\n");
+		goto unmap;
+	}
+
+	if (bs->len)
+		err = 0;
+
+unmap:
+	munmap((void *)map, sz);
+close_fd:
+	close(fd);
+	if (err)
+		MCapBitstreamFree(bs);
+
+	return err;
+}
+
+void MCapBitstreamFree(struct mcap_bitstream *bs)
+{
+	free(bs->data);
+	bs->data = NULL;
+	bs->len = 0;
+}
+
+/*
+ * Opens the writer on a config space file ('/sys/bus/pci/devices/.../config'
+ * or a plain file standing in for it). 'offset' is the position of the MCAP
+ * Data register within that file.
+ */
+int MCapWriterOpen(struct mcap_writer *wr, const char *cfg_path, off_t offset)
+{
+	wr->fd = open(cfg_path, O_WRONLY);
+	wr->offset = offset;
+	wr->words = 0;
+	wr->calls = 0;
+
+	if (wr->fd < 0)
+		return -1;
+
+	return 0;
+}
+
+/*
+ * Writes 'count' dwords to the Data register. Config space is little
+ * endian, so the dwords are converted MCAP_WRITE_BATCH at a time before
+ * being written.
+ */
+int MCapWriterWrite(struct mcap_writer *wr, const uint32_t *data, size_t count)
+{
+	size_t i, n;
+	ssize_t ret;
+
+	while (count) {
+		n = count < MCAP_WRITE_BATCH ? count : MCAP_WRITE_BATCH;
+		for (i = 0; i < n; i++)
+			wr->buf[i] = htole32(data[i]);
+
+		for (i = 0; i < n; i++) {
+			do {
+				ret = pwrite(wr->fd, &wr->buf[i],
+					     sizeof(uint32_t), wr->offset);
+			} while (ret < 0 && errno == EINTR);
+
+			if (ret != sizeof(uint32_t)) {
+				pr_err("Failed to write MCAP Data register\n");
+				return -1;
+			}
+		}
+		wr->words += n;
+		wr->calls++;
+		data += n;
+		count -= n;
+	}
+
+	return 0;
+}
+
+void MCapWriterClose(struct mcap_writer *wr)
+{
+	if (wr->fd >= 0)
+		close(wr->fd);
+	wr->fd = -1;
+}
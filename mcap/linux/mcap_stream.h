@@ -0,0 +1,77 @@
+/******************************************************************************
+* Copyright (C) 2014-2015 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+*
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file mcap_stream.h
+*  MCAP bitstream ingestion and batched config space writer
+*
+*  This part of the library has no dependency on libpci, so that it can be
+*  built and exercised on a host against a file backed config space.
+*
+******************************************************************************/
+
+#ifndef MCAP_STREAM_H
+#define MCAP_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+/* Bitstream Sync Word used to locate the start of data in .bit files */
+#define MCAP_SYNC_DWORD	0xFFFFFFFF
+
+/* Number of dwords handed to the writer per call */
+#define MCAP_WRITE_BATCH	1024
+
+/*
+ * Parsed bitstream. 'data' holds 'len' dwords in the order and byte order
+ * in which they have to be written to the MCAP Data register.
+ */
+struct mcap_bitstream {
+	uint32_t *data;
+	uint32_t len;
+};
+
+/* Batched MCAP Data register writer */
+struct mcap_writer {
+	int fd;
+	off_t offset;
+	uint64_t words;
+	uint64_t calls;
+	uint32_t buf[MCAP_WRITE_BATCH];	/* Batch in config space byte order */
+};
+
+/* Function Prototypes */
+size_t MCapFindSyncWord(const uint8_t *buf, size_t sz);
+void MCapSwap32Copy(uint32_t *dst, const uint8_t *src, size_t count);
+uint32_t MCapDecodeRBT(const char *buf, size_t sz, uint32_t *out);
+int MCapBitstreamLoad(struct mcap_bitstream *bs, const char *file_path);
+void MCapBitstreamFree(struct mcap_bitstream *bs);
+int MCapWriterOpen(struct mcap_writer *wr, const char *cfg_path, off_t offset);
+int MCapWriterWrite(struct mcap_writer *wr, const uint32_t *data, size_t count);
+void MCapWriterClose(struct mcap_writer *wr);
+
+#endif /* MCAP_STREAM_H */